@@ -0,0 +1,62 @@
+/**
+ * @fileoverview Benchmarks for VotingChain append and integrity verification
+ */
+
+import { bench, describe } from 'vitest';
+import { VotingChain } from '../chain/VotingChain.js';
+import type { VotingSession, VoteData } from '../types/index.js';
+
+// Override with e.g. BENCH_CHAIN_SIZES=10000 for a quick run
+const CHAIN_SIZES = (process.env.BENCH_CHAIN_SIZES ?? '10000,100000,1000000')
+  .split(',')
+  .map(size => Number(size.trim()))
+  .filter(size => size > 0);
+
+function createSession(): VotingSession {
+  return {
+    minuteId: 'bench',
+    proposals: ['P001'],
+    startTime: new Date('2025-09-08T10:00:00.000Z'),
+    endTime: new Date('2025-09-15T10:00:00.000Z'),
+    status: 'Active',
+    quorumThreshold: 0.6,
+    approvalThreshold: 0.6,
+    chain: [],
+    participants: []
+  };
+}
+
+function voteData(i: number): VoteData {
+  return {
+    voteFile: `votes/model-${i}.json`,
+    voteFileHash: i.toString(16).padStart(64, '0'),
+    votes: [{ proposalId: 'P001', weight: (i % 10) + 1 }]
+  };
+}
+
+function buildChain(size: number): VotingChain {
+  const chain = new VotingChain(createSession());
+  for (let i = 0; i < size; i++) {
+    chain.addVoteBlock(`model-${i}`, voteData(i));
+  }
+  return chain;
+}
+
+for (const size of CHAIN_SIZES) {
+  describe(`VotingChain (${size} blocks)`, () => {
+    const chain = buildChain(size);
+    let next = size;
+
+    bench('addVoteBlock', () => {
+      chain.addVoteBlock(`model-${next}`, voteData(next++));
+    });
+
+    bench('verifyChainIntegrity (checkpointed)', () => {
+      chain.verifyChainIntegrity();
+    });
+
+    bench('verifyChainIntegrity (full rescan)', () => {
+      chain.verifyChainIntegrity({ fullRescan: true });
+    }, { iterations: 3, time: 0, warmupIterations: 1, warmupTime: 0 });
+  });
+}
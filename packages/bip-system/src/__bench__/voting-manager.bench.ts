@@ -0,0 +1,44 @@
+/**
+ * @fileoverview End-to-end benchmark for VotingManager.submitVote on a temp gov tree
+ */
+
+import { afterAll, bench, describe } from 'vitest';
+import { promises as fs } from 'fs';
+import { tmpdir } from 'os';
+import { join } from 'path';
+import { VotingManager } from '../voting/VotingManager.js';
+import type { ModelProfile } from '../types/index.js';
+
+// Enough participants that no iteration runs out of eligible voters
+const PARTICIPANTS = 20000;
+
+const models: ModelProfile[] = Array.from({ length: PARTICIPANTS }, (_, i) => ({
+  id: `model-${i}`,
+  name: `model-${i}`,
+  provider: 'bench',
+  category: 'General',
+  weight: 1,
+  isActive: true
+}));
+
+const minutesDir = await fs.mkdtemp(join(tmpdir(), 'bip-bench-'));
+const manager = new VotingManager(minutesDir, models);
+await manager.createVotingSession('0001', ['P001', 'P002', 'P003']);
+
+let voter = 0;
+
+describe('VotingManager', () => {
+  afterAll(async () => {
+    await fs.rm(minutesDir, { recursive: true, force: true });
+  });
+
+  // Every vote extends the same session, as votes on a real minute do
+  bench('submitVote', async () => {
+    const modelId = `model-${voter++}`;
+    await manager.submitVote('0001', modelId, [
+      { proposalId: 'P001', weight: 8 },
+      { proposalId: 'P002', weight: 5 },
+      { proposalId: 'P003', weight: 2 }
+    ]);
+  }, { time: 2000 });
+});
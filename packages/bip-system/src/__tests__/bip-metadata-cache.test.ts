@@ -0,0 +1,129 @@
+/**
+ * @fileoverview Tests for the shared BIP metadata cache
+ */
+
+import { describe, it, expect, beforeEach, afterEach } from 'vitest';
+import { promises as fs } from 'fs';
+import { tmpdir } from 'os';
+import { dirname, join } from 'path';
+import { fileURLToPath } from 'url';
+import { BIPManager } from '../proposal/BIPManager.js';
+import { BIPMetadataCache } from '../proposal/BIPMetadataCache.js';
+
+const govBipsDir = join(dirname(fileURLToPath(import.meta.url)), '../../../../gov/bips');
+
+const longText = (label: string, length: number) => `${label} `.repeat(Math.ceil(length / (label.length + 1)));
+
+describe('BIP Metadata Cache', () => {
+  let bipsDir: string;
+  let manager: BIPManager;
+
+  beforeEach(async () => {
+    bipsDir = await fs.mkdtemp(join(tmpdir(), 'bip-meta-'));
+    manager = new BIPManager(bipsDir, new BIPMetadataCache(bipsDir, { concurrency: 2, headBytes: 256, tailBytes: 512 }));
+  });
+
+  afterEach(async () => {
+    await fs.rm(bipsDir, { recursive: true, force: true });
+  });
+
+  async function createBIP(title: string) {
+    return manager.createBIP(
+      title,
+      'model-a',
+      'Standards Track',
+      'Core',
+      longText('abstract', 60),
+      longText('motivation', 120),
+      longText('specification', 20000), // body far larger than the read windows
+      longText('rationale', 40)
+    );
+  }
+
+  it('should list metadata matching the full parse', async () => {
+    await createBIP('First');
+    await createBIP('Second');
+    await createBIP('Third');
+
+    const metadata = await manager.listBIPMetadata();
+    const full = await manager.listBIPs();
+
+    expect(metadata.map(m => m.number)).toEqual(['BIP-01', 'BIP-02', 'BIP-03']);
+    for (let i = 0; i < full.length; i++) {
+      expect(metadata[i]).toMatchObject({
+        number: full[i]!.number,
+        title: full[i]!.title,
+        author: full[i]!.author,
+        type: full[i]!.type,
+        category: full[i]!.category,
+        status: full[i]!.status,
+      });
+      expect(metadata[i]!.created.getTime()).toBe(full[i]!.created.getTime());
+    }
+  });
+
+  it('should match the full parse for the governance BIPs', async () => {
+    // BIP-01 repeats the footer field names in its body; BIP-02 has an unprefixed Status
+    for (const number of ['BIP-01', 'BIP-02']) {
+      await fs.mkdir(join(bipsDir, number));
+      await fs.copyFile(join(govBipsDir, number, `${number}.md`), join(bipsDir, number, `${number}.md`));
+    }
+
+    for (const options of [{}, { headBytes: 32, tailBytes: 128 }]) {
+      const cached = new BIPManager(bipsDir, new BIPMetadataCache(bipsDir, options));
+      for (const number of ['BIP-01', 'BIP-02']) {
+        const metadata = await cached.loadBIPMetadata(number);
+        const full = await cached.loadBIP(number);
+        expect(metadata).toMatchObject({
+          number: full.number,
+          title: full.title,
+          author: full.author,
+          type: full.type,
+          category: full.category,
+          status: full.status,
+        });
+        expect(metadata.created.getTime()).toBe(full.created.getTime());
+      }
+    }
+
+    const bip01 = await manager.loadBIPMetadata('BIP-01');
+    expect(bip01.status).toBe('Implemented (Phase 1-2 Complete)');
+    expect(bip01.author).toBe('Grok-Code-Fast-1 (Implementation Lead)');
+    expect(bip01.created.toISOString()).toBe('2025-09-07T00:00:00.000Z');
+  });
+
+  it('should pick up changes by mtime and hand out independent copies', async () => {
+    await createBIP('Mutable');
+
+    const first = await manager.loadBIP('BIP-01');
+    first.title = 'Changed in memory only';
+    expect((await manager.loadBIP('BIP-01')).title).toBe('Mutable');
+
+    const updated = await manager.updateBIPStatus('BIP-01', 'Review', 'model-b');
+    expect(updated.status).toBe('Review');
+    expect((await manager.loadBIPMetadata('BIP-01')).status).toBe('Review');
+
+    // External edit with a different size and mtime
+    const filePath = join(bipsDir, 'BIP-01', 'BIP-01.md');
+    const content = await fs.readFile(filePath, 'utf-8');
+    await fs.writeFile(filePath, content.replace('# BIP-01: Mutable', '# BIP-01: Edited on disk'), 'utf-8');
+    const future = new Date(Date.now() + 5000);
+    await fs.utimes(filePath, future, future);
+
+    expect((await manager.loadBIPMetadata('BIP-01')).title).toBe('Edited on disk');
+    expect((await manager.loadBIP('BIP-01')).title).toBe('Edited on disk');
+  });
+
+  it('should skip unreadable BIPs and drop deleted ones', async () => {
+    await createBIP('Kept');
+    await createBIP('Removed');
+    await fs.mkdir(join(bipsDir, 'BIP-03'));
+    await fs.writeFile(join(bipsDir, 'BIP-03', 'BIP-03.md'), 'not a bip', 'utf-8');
+
+    expect((await manager.listBIPMetadata()).map(m => m.number)).toEqual(['BIP-01', 'BIP-02']);
+
+    await fs.rm(join(bipsDir, 'BIP-02'), { recursive: true });
+    expect((await manager.listBIPMetadata()).map(m => m.number)).toEqual(['BIP-01']);
+    expect(await manager.getNextBIPNumber()).toBe('BIP-04');
+  });
+});
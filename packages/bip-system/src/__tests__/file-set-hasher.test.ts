@@ -0,0 +1,69 @@
+/**
+ * @fileoverview Tests for streaming, cached BIP file set hashing
+ */
+
+import { describe, it, expect, beforeEach, afterEach } from 'vitest';
+import { promises as fs } from 'fs';
+import { tmpdir } from 'os';
+import { join } from 'path';
+import { createHash } from 'crypto';
+import { FileSetHasher } from '../chain/FileSetHasher.js';
+
+async function referenceHash(files: string[], dir: string): Promise<string> {
+  const contents: string[] = [];
+  for (const file of files) {
+    try {
+      contents.push(await fs.readFile(join(dir, file), 'utf-8'));
+    } catch {
+      contents.push(`[FILE_NOT_FOUND: ${file}]`);
+    }
+  }
+  return createHash('sha256').update(contents.join('\n---\n'), 'utf8').digest('hex');
+}
+
+describe('File Set Hashing', () => {
+  let dir: string;
+
+  beforeEach(async () => {
+    dir = await fs.mkdtemp(join(tmpdir(), 'bip-hash-'));
+  });
+
+  afterEach(async () => {
+    await fs.rm(dir, { recursive: true, force: true });
+  });
+
+  it('should match the joined-string digest for multi-chunk UTF-8 files', async () => {
+    await fs.writeFile(join(dir, 'a.md'), 'é€😀'.repeat(30000), 'utf-8');
+    await fs.writeFile(join(dir, 'b.md'), '# Title\n', 'utf-8');
+    const files = ['a.md', 'missing.md', 'b.md'];
+
+    const hasher = new FileSetHasher();
+    expect(await hasher.hashFileSet(files, dir)).toBe(await referenceHash(files, dir));
+  });
+
+  it('should match the decoded digest for files that are not valid UTF-8', async () => {
+    await fs.writeFile(join(dir, 'bad.md'), Buffer.from([0x61, 0xff, 0xe2, 0x82]));
+
+    const hasher = new FileSetHasher();
+    expect(await hasher.hashFileSet(['bad.md'], dir)).toBe(await referenceHash(['bad.md'], dir));
+  });
+
+  it('should reuse persisted digests while size and mtime are unchanged', async () => {
+    const cacheFile = join(dir, 'cache.json');
+    const file = join(dir, 'a.md');
+    await fs.writeFile(file, 'original', 'utf-8');
+    await fs.utimes(file, 1700000000, 1700000000);
+
+    const first = new FileSetHasher({ cacheFile });
+    const digest = await first.hashFileSet(['a.md'], dir);
+    await first.saveCache();
+
+    // Same size and mtime: served from the cache without reading
+    await fs.writeFile(file, 'modified', 'utf-8');
+    await fs.utimes(file, 1700000000, 1700000000);
+    expect(await new FileSetHasher({ cacheFile }).hashFileSet(['a.md'], dir)).toBe(digest);
+
+    await fs.writeFile(file, 'modified again', 'utf-8');
+    expect(await new FileSetHasher({ cacheFile }).hashFileSet(['a.md'], dir)).toBe(await referenceHash(['a.md'], dir));
+  });
+});
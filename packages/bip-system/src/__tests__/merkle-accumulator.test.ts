@@ -0,0 +1,179 @@
+/**
+ * @fileoverview Tests for the vote Merkle accumulator and inclusion proofs
+ */
+
+import { describe, it, expect, beforeEach, afterEach } from 'vitest';
+import { promises as fs } from 'fs';
+import { tmpdir } from 'os';
+import { join } from 'path';
+import { createHash } from 'crypto';
+import { MerkleAccumulator, verifyInclusionProof, EMPTY_MERKLE_ROOT } from '../chain/MerkleAccumulator.js';
+import { VotingChain } from '../chain/VotingChain.js';
+import { VotingManager } from '../voting/VotingManager.js';
+import type { ModelProfile, VotingSession, VoteData, ResultData } from '../types/index.js';
+
+const sha256 = (...parts: Buffer[]) => {
+  const hash = createHash('sha256');
+  parts.forEach(part => hash.update(part));
+  return hash.digest();
+};
+
+// Straight RFC 6962 MTH, used as the reference
+function referenceRoot(leaves: string[]): string {
+  const mth = (items: string[]): Buffer => {
+    if (items.length === 1) return sha256(Buffer.from([0]), Buffer.from(items[0]!, 'utf8'));
+    let k = 1;
+    while (k * 2 < items.length) k *= 2;
+    return sha256(Buffer.from([1]), mth(items.slice(0, k)), mth(items.slice(k)));
+  };
+  return leaves.length === 0 ? EMPTY_MERKLE_ROOT : mth(leaves).toString('hex');
+}
+
+function createSession(): VotingSession {
+  return {
+    minuteId: '0042',
+    proposals: ['P001'],
+    startTime: new Date('2025-09-08T10:00:00.000Z'),
+    endTime: new Date('2025-09-15T10:00:00.000Z'),
+    status: 'Active',
+    quorumThreshold: 0.6,
+    approvalThreshold: 0.6,
+    chain: [],
+    participants: []
+  };
+}
+
+function voteData(model: string): VoteData {
+  return {
+    voteFile: `votes/${model}.json`,
+    voteFileHash: createHash('sha256').update(model).digest('hex'),
+    votes: [{ proposalId: 'P001', weight: 8 }]
+  };
+}
+
+describe('MerkleAccumulator', () => {
+  it('should match the RFC 6962 root for every tree size', () => {
+    const tree = new MerkleAccumulator();
+    const leaves: string[] = [];
+
+    expect(tree.root()).toBe(EMPTY_MERKLE_ROOT);
+    for (let i = 0; i < 33; i++) {
+      leaves.push(`leaf-${i}`);
+      tree.append(`leaf-${i}`);
+      expect(tree.root()).toBe(referenceRoot(leaves));
+    }
+
+    expect(tree.root(5)).toBe(referenceRoot(leaves.slice(0, 5)));
+  });
+
+  it('should prove and verify every leaf in O(log n) hashes', () => {
+    const tree = new MerkleAccumulator();
+    for (let i = 0; i < 21; i++) tree.append(`leaf-${i}`);
+
+    for (let size = 1; size <= 21; size++) {
+      for (let index = 0; index < size; index++) {
+        const proof = tree.prove(index, size);
+        expect(proof.auditPath.length).toBeLessThanOrEqual(Math.ceil(Math.log2(size)));
+        expect(verifyInclusionProof(proof, tree.root(size))).toBe(true);
+      }
+    }
+  });
+
+  it('should reject tampered proofs', () => {
+    const tree = new MerkleAccumulator();
+    for (let i = 0; i < 7; i++) tree.append(`leaf-${i}`);
+    const proof = tree.prove(3);
+
+    expect(verifyInclusionProof({ ...proof, leafIndex: 2 })).toBe(false);
+    expect(verifyInclusionProof({ ...proof, treeSize: 4 })).toBe(false);
+    expect(verifyInclusionProof({ ...proof, auditPath: proof.auditPath.slice(1) })).toBe(false);
+    expect(verifyInclusionProof({ ...proof, leafHash: MerkleAccumulator.hashLeaf('other') })).toBe(false);
+    expect(verifyInclusionProof(proof, tree.root(6))).toBe(false);
+  });
+});
+
+describe('VotingChain vote commitments', () => {
+  it('should keep the root current as votes are added', () => {
+    const chain = new VotingChain(createSession());
+    chain.addVoteBlock('model-a', voteData('model-a'));
+    const rootAfterOne = chain.getVoteMerkleRoot();
+
+    chain.addVoteBlock('model-b', voteData('model-b'));
+    chain.addVoteBlock('model-c', voteData('model-c'));
+
+    const rebuilt = new VotingChain(chain.getSession());
+    expect(rebuilt.getVoteMerkleRoot()).toBe(chain.getVoteMerkleRoot());
+    expect(chain.getVoteMerkleRoot()).not.toBe(rootAfterOne);
+
+    const proof = chain.getVoteInclusionProof('model-b');
+    expect(proof.blockIndex).toBe(2);
+    expect(VotingChain.verifyVoteInclusionProof(proof, chain.getVoteMerkleRoot())).toBe(true);
+    expect(VotingChain.verifyVoteInclusionProof({ ...proof, voteFileHash: 'f'.repeat(64) })).toBe(false);
+    expect(VotingChain.verifyVoteInclusionProof({ ...proof, model: 'model-a' })).toBe(false);
+  });
+
+  it('should flag a finalize block whose root does not match the votes', () => {
+    const chain = new VotingChain(createSession());
+    chain.addVoteBlock('model-a', voteData('model-a'));
+
+    const result: ResultData = {
+      resultFile: 'results.json',
+      resultFileHash: 'a'.repeat(64),
+      results: [],
+      autoGenerated: true,
+      voteMerkleRoot: 'b'.repeat(64),
+      voteCount: 1
+    };
+    chain.addFinalizeBlock('model-a', result);
+
+    const verification = chain.verifyChainIntegrity({ fullRescan: true });
+    expect(verification.isValid).toBe(false);
+    expect(verification.errors[0]).toContain('vote Merkle root');
+  });
+});
+
+describe('VotingManager inclusion proofs', () => {
+  let minutesDir: string;
+  const models: ModelProfile[] = ['model-a', 'model-b', 'model-c'].map(id => ({
+    id,
+    name: id,
+    provider: 'test',
+    category: 'General',
+    weight: 1,
+    isActive: true
+  }));
+
+  beforeEach(async () => {
+    minutesDir = await fs.mkdtemp(join(tmpdir(), 'bip-merkle-'));
+  });
+
+  afterEach(async () => {
+    await fs.rm(minutesDir, { recursive: true, force: true });
+  });
+
+  it('should record the root at finalization and prove votes against it', async () => {
+    const manager = new VotingManager(minutesDir, models);
+    await manager.createVotingSession('0001', ['P001']);
+    for (const model of models) {
+      await manager.submitVote('0001', model.id, [{ proposalId: 'P001', weight: 8 }]);
+    }
+    await manager.finalizeVoting('0001', 'model-a');
+
+    const results = JSON.parse(await fs.readFile(join(minutesDir, '0001', 'results.json'), 'utf-8'));
+    const session = await manager.loadVotingSession('0001');
+    const finalize = session.chain.find(block => block.type === 'finalize')!.data as ResultData;
+
+    expect(results.vote_merkle_root).toBe(finalize.voteMerkleRoot);
+    expect(finalize.voteCount).toBe(3);
+    expect((await manager.verifyVotingIntegrity('0001', { fullRescan: true })).isValid).toBe(true);
+
+    const proof = await manager.getVoteInclusionProof('0001', 'model-c');
+    expect(proof.root).toBe(results.vote_merkle_root);
+    expect(await manager.verifyVoteInclusionProof('0001', proof)).toBe(true);
+
+    // Auditor check: the vote file bytes hash to the proven leaf
+    const voteFile = await fs.readFile(join(minutesDir, '0001', proof.voteFile), 'utf-8');
+    expect(createHash('sha256').update(voteFile, 'utf8').digest('hex')).toBe(proof.voteFileHash);
+    expect(VotingChain.verifyVoteInclusionProof(proof, results.vote_merkle_root)).toBe(true);
+  });
+});
@@ -0,0 +1,107 @@
+/**
+ * @fileoverview Tests for single-flight coalescing and the operation result cache
+ */
+
+import { describe, it, expect } from 'vitest';
+import { OperationCoalescer } from '../resilience/OperationCoalescer.js';
+
+const sleep = (ms: number) => new Promise(resolve => setTimeout(resolve, ms));
+
+describe('OperationCoalescer', () => {
+  it('should share one execution between identical in-flight calls', async () => {
+    const coalescer = new OperationCoalescer<number>();
+    let calls = 0;
+    const fn = async () => {
+      calls++;
+      await sleep(10);
+      return 42;
+    };
+
+    const results = await Promise.all([
+      coalescer.execute('k', fn),
+      coalescer.execute('k', fn),
+      coalescer.execute('k', fn)
+    ]);
+
+    expect(results).toEqual([42, 42, 42]);
+    expect(calls).toBe(1);
+    expect(coalescer.getStats().coalesced).toBe(2);
+    expect(coalescer.getStats().inFlight).toBe(0);
+  });
+
+  it('should propagate failures to every waiter and not cache them', async () => {
+    const coalescer = new OperationCoalescer<number>({ ttlMs: 1000, maxEntries: 10 });
+    let calls = 0;
+    const failing = async () => {
+      calls++;
+      await sleep(5);
+      throw new Error('boom');
+    };
+
+    const settled = await Promise.allSettled([
+      coalescer.execute('k', failing, { cacheable: true }),
+      coalescer.execute('k', failing, { cacheable: true })
+    ]);
+    expect(settled.every(r => r.status === 'rejected')).toBe(true);
+
+    await expect(coalescer.execute('k', failing, { cacheable: true })).rejects.toThrow('boom');
+    expect(calls).toBe(2);
+  });
+
+  it('should serve cached results until the TTL expires', async () => {
+    const coalescer = new OperationCoalescer<number>({ ttlMs: 20, maxEntries: 10 });
+    let calls = 0;
+    const fn = async () => ++calls;
+
+    expect(await coalescer.execute('k', fn, { cacheable: true })).toBe(1);
+    expect(await coalescer.execute('k', fn, { cacheable: true })).toBe(1);
+
+    await sleep(30);
+    expect(await coalescer.execute('k', fn, { cacheable: true })).toBe(2);
+
+    const stats = coalescer.getStats();
+    expect(stats.hits).toBe(1);
+    expect(stats.misses).toBe(2);
+  });
+
+  it('should skip results rejected by isSuccess', async () => {
+    const coalescer = new OperationCoalescer<{ success: boolean }>({ ttlMs: 1000, maxEntries: 10 });
+    const fn = async () => ({ success: false });
+
+    await coalescer.execute('k', fn, { cacheable: true, isSuccess: r => r.success });
+    expect(coalescer.getStats().cachedEntries).toBe(0);
+  });
+
+  it('should evict the least recently used entry', async () => {
+    const coalescer = new OperationCoalescer<string>({ ttlMs: 1000, maxEntries: 2 });
+    const value = (v: string) => async () => v;
+
+    await coalescer.execute('a', value('a'), { cacheable: true });
+    await coalescer.execute('b', value('b'), { cacheable: true });
+    await coalescer.execute('a', value('a2'), { cacheable: true }); // touch a
+    await coalescer.execute('c', value('c'), { cacheable: true }); // evicts b
+
+    expect(await coalescer.execute('a', value('a3'), { cacheable: true })).toBe('a');
+    expect(await coalescer.execute('b', value('b2'), { cacheable: true })).toBe('b2');
+    expect(coalescer.getStats().evictions).toBeGreaterThanOrEqual(1);
+  });
+
+  it('should invalidate cached entries by prefix', async () => {
+    const coalescer = new OperationCoalescer<number>({ ttlMs: 1000, maxEntries: 10 });
+    await coalescer.execute('BIP-01:validation:x', async () => 1, { cacheable: true });
+    await coalescer.execute('BIP-02:validation:x', async () => 2, { cacheable: true });
+
+    coalescer.invalidate('BIP-01:');
+    expect(coalescer.getStats().cachedEntries).toBe(1);
+  });
+
+  it('should build the same key regardless of payload key order', () => {
+    const a = OperationCoalescer.keyFor('BIP-01:validation', { type: 'analysis', payload: { x: 1, y: [1, 2] } });
+    const b = OperationCoalescer.keyFor('BIP-01:validation', { payload: { y: [1, 2], x: 1 }, type: 'analysis' });
+    const c = OperationCoalescer.keyFor('BIP-01:validation', { type: 'analysis', payload: { x: 2, y: [1, 2] } });
+
+    expect(a).toBe(b);
+    expect(a).not.toBe(c);
+    expect(a.startsWith('BIP-01:validation:')).toBe(true);
+  });
+});
@@ -0,0 +1,70 @@
+/**
+ * @fileoverview Tests for operation coalescing in the BIP resilience adapter
+ */
+
+import { describe, it, expect, vi, afterEach } from 'vitest';
+import { BIPResilienceFactory, type ResilientBIPOperation } from '../resilience/BIPResilienceAdapter.js';
+
+const sleep = (ms: number) => new Promise(resolve => setTimeout(resolve, ms));
+
+const operation = (priority: ResilientBIPOperation['priority']): ResilientBIPOperation => ({
+  operationType: 'validation',
+  bipId: 'BIP-01',
+  modelId: 'model-a',
+  task: { id: `task-${priority}`, type: 'validate', payload: { section: 'abstract' } },
+  priority,
+  requiresConsensus: false,
+  timeout: 1000,
+  idempotent: true
+});
+
+function createAdapter(degraded: boolean) {
+  const adapter = BIPResilienceFactory.createDefault();
+  const internals = adapter as any;
+  const model = { id: 'model-a', provider: 'test' };
+  const executeModelTask = vi.fn(async () => {
+    await sleep(10);
+    return { content: 'ok', metadata: { modelId: model.id, provider: model.provider, timestamp: new Date(), tokensUsed: 1 } };
+  });
+
+  vi.spyOn(internals, 'selectOptimalModel').mockResolvedValue(model);
+  vi.spyOn(internals, 'executeModelTask').mockImplementation(executeModelTask);
+  vi.spyOn(internals, 'isDegradedMode').mockReturnValue(degraded);
+  vi.spyOn(internals, 'handleOperationFailure').mockResolvedValue(undefined);
+  vi.spyOn(internals, 'recordOperationMetrics').mockReturnValue(undefined);
+  vi.spyOn(internals.retryManager, 'executeWithRetry').mockImplementation(async (fn: any) => fn());
+
+  return { adapter, executeModelTask };
+}
+
+describe('BIP Resilience Adapter coalescing', () => {
+  afterEach(() => {
+    vi.restoreAllMocks();
+  });
+
+  it('should share one execution between identical idempotent operations', async () => {
+    const { adapter, executeModelTask } = createAdapter(false);
+
+    const results = await Promise.all([
+      adapter.executeBIPOperation(operation('medium')),
+      adapter.executeBIPOperation(operation('medium'))
+    ]);
+
+    expect(results.every(result => result.success)).toBe(true);
+    expect(executeModelTask).toHaveBeenCalledTimes(1);
+  });
+
+  it('should not let a critical operation join a non-critical flight in degraded mode', async () => {
+    const { adapter, executeModelTask } = createAdapter(true);
+
+    const [normal, critical] = await Promise.all([
+      adapter.executeBIPOperation(operation('medium')),
+      adapter.executeBIPOperation(operation('critical'))
+    ]);
+
+    expect(normal.success).toBe(false);
+    expect(normal.error?.message).toMatch(/only critical operations allowed/);
+    expect(critical.success).toBe(true);
+    expect(executeModelTask).toHaveBeenCalledTimes(1);
+  });
+});
@@ -0,0 +1,85 @@
+/**
+ * @fileoverview Tests for governance schema validation with the precompiled validators
+ */
+
+import { describe, it, expect, beforeEach, afterEach } from 'vitest';
+import { promises as fs } from 'fs';
+import { tmpdir } from 'os';
+import { dirname, join } from 'path';
+import { fileURLToPath } from 'url';
+import { BIPManager } from '../proposal/BIPManager.js';
+import { VotingManager } from '../voting/VotingManager.js';
+import { SchemaTreeValidator } from '../validation/SchemaTreeValidator.js';
+
+const govDir = join(dirname(fileURLToPath(import.meta.url)), '../../../../gov');
+
+describe('Schema Validation', () => {
+  let minutesDir: string;
+  let validReport: Record<string, unknown>;
+
+  beforeEach(async () => {
+    minutesDir = await fs.mkdtemp(join(tmpdir(), 'schema-validation-'));
+    validReport = JSON.parse(await fs.readFile(join(govDir, 'minutes/0001/final_report.json'), 'utf-8'));
+
+    await fs.mkdir(join(minutesDir, '0001'));
+    await fs.writeFile(join(minutesDir, '0001/final_report.json'), JSON.stringify(validReport));
+
+    await fs.mkdir(join(minutesDir, '0002'));
+    await fs.writeFile(
+      join(minutesDir, '0002/final_report.json'),
+      JSON.stringify({ ...validReport, minutesId: '2', reporter: { model: 'model-a' } })
+    );
+    await fs.writeFile(join(minutesDir, '0002/votes.json'), JSON.stringify({ votes: [] }));
+
+    await fs.mkdir(join(minutesDir, 'templates'));
+    await fs.writeFile(join(minutesDir, 'templates/final_report.json'), '{ "minutesId": {{ID}} }');
+  });
+
+  afterEach(async () => {
+    await fs.rm(minutesDir, { recursive: true, force: true });
+  });
+
+  it('should validate a tree, skipping unmatched files and templates', async () => {
+    const report = await new SchemaTreeValidator({ concurrency: 2 }).validate([minutesDir]);
+
+    expect(report).toMatchObject({ valid: 1, invalid: 1, skipped: 1 });
+    expect(report.files.map(file => file.status)).toEqual(['valid', 'invalid', 'skipped']);
+
+    const invalid = report.files[1]!;
+    expect(invalid.schema).toBe('minutes_report');
+    expect(invalid.errors.some(error => error.startsWith('/minutesId:'))).toBe(true);
+    expect(invalid.errors.some(error => error.startsWith('/reporter:'))).toBe(true);
+  });
+
+  it('should report the recorded files that do not match their schemas', async () => {
+    const report = await new SchemaTreeValidator().validate([join(govDir, 'minutes'), join(govDir, 'metrics')]);
+    const statusOf = (suffix: string) => report.files.find(file => file.filePath.endsWith(suffix))?.status;
+
+    expect(statusOf(join('0001', 'final_report.json'))).toBe('valid');
+    // Listed in gov/schemas/README.md; kept as recorded
+    expect(statusOf(join('0004', 'final_report.json'))).toBe('invalid');
+    expect(statusOf(join('metrics', 'model_evaluations.json'))).toBe('invalid');
+  });
+
+  it('should validate minutes reports through the voting manager', async () => {
+    const votingManager = new VotingManager(minutesDir);
+
+    expect(await votingManager.validateMinutesReport('0001')).toEqual({ isValid: true, errors: [] });
+    expect((await votingManager.validateMinutesReport('0002')).isValid).toBe(false);
+
+    const missing = await votingManager.validateMinutesReport('0003');
+    expect(missing.isValid).toBe(false);
+    expect(missing.errors[0]).toMatch(/Cannot read final_report.json/);
+  });
+
+  it('should validate structured proposal data', async () => {
+    const bipManager = new BIPManager(minutesDir);
+    const proposal = JSON.parse(await fs.readFile(join(govDir, 'schemas/proposal_example.json'), 'utf-8'));
+
+    expect(bipManager.validateProposalData(proposal)).toEqual({ isValid: true, errors: [] });
+
+    const result = bipManager.validateProposalData({ ...proposal, id: 'x', status: 'unknown' });
+    expect(result.isValid).toBe(false);
+    expect(result.errors).toHaveLength(2);
+  });
+});
@@ -0,0 +1,125 @@
+/**
+ * @fileoverview Tests for the persistent voting session index
+ */
+
+import { describe, it, expect, beforeEach, afterEach, vi } from 'vitest';
+import { promises as fs } from 'fs';
+import { tmpdir } from 'os';
+import { join } from 'path';
+import { VotingManager } from '../voting/VotingManager.js';
+import { VotingSessionStore } from '../voting/SessionStore.js';
+import { SessionIndex } from '../voting/SessionIndex.js';
+import { NotificationManager } from '../notifications/NotificationManager.js';
+import type { ModelProfile } from '../types/index.js';
+
+const models: ModelProfile[] = ['model-a', 'model-b'].map(id => ({
+  id,
+  name: id,
+  provider: 'test',
+  category: 'General',
+  weight: 1,
+  isActive: true
+}));
+
+describe('Voting Session Index', () => {
+  let minutesDir: string;
+
+  beforeEach(async () => {
+    minutesDir = await fs.mkdtemp(join(tmpdir(), 'bip-index-'));
+  });
+
+  afterEach(async () => {
+    vi.restoreAllMocks();
+    await fs.rm(minutesDir, { recursive: true, force: true });
+  });
+
+  it('should list active sessions without parsing unchanged session bodies', async () => {
+    const manager = new VotingManager(minutesDir, models);
+    await manager.createVotingSession('0001', ['P001']);
+    await manager.createVotingSession('0002', ['P002']);
+    await manager.submitVote('0002', 'model-a', [{ proposalId: 'P002', weight: 8 }]);
+    await manager.submitVote('0002', 'model-b', [{ proposalId: 'P002', weight: 8 }]);
+    await manager.finalizeVoting('0002', 'model-a');
+    await manager.getActiveSessionSummaries();
+
+    const load = vi.spyOn(VotingSessionStore.prototype, 'load');
+    const summaries = await manager.getActiveSessionSummaries();
+    expect(load).not.toHaveBeenCalled();
+    expect(summaries.map(summary => summary.minuteId)).toEqual(['0001']);
+    expect(summaries[0]!.participantCount).toBe(2);
+    expect(summaries[0]!.voteCount).toBe(0);
+  });
+
+  it('should answer unchanged queries without locking or rewriting the index', async () => {
+    const manager = new VotingManager(minutesDir, models);
+    await manager.createVotingSession('0003', ['P001']);
+    await manager.getActiveSessionSummaries();
+
+    const indexFile = join(minutesDir, 'session_index.json');
+    const before = await fs.stat(indexFile);
+    const lock = vi.spyOn(fs, 'open');
+    const rename = vi.spyOn(fs, 'rename');
+
+    expect((await new SessionIndex(minutesDir).entries()).map(entry => entry.minuteId)).toEqual(['0003']);
+    expect(lock).not.toHaveBeenCalled();
+    expect(rename).not.toHaveBeenCalled();
+    expect((await fs.stat(indexFile)).mtimeMs).toBe(before.mtimeMs);
+  });
+
+  it('should refresh closed entries whose session file changed on disk', async () => {
+    const manager = new VotingManager(minutesDir, models);
+    const session = await manager.createVotingSession('0005', ['P001']);
+    await new Promise(resolve => setTimeout(resolve, 20));
+    await new VotingSessionStore(minutesDir).write({ ...session, status: 'Cancelled' });
+    expect(await manager.getActiveSessionSummaries()).toHaveLength(0);
+
+    // Reopened by another process
+    await new Promise(resolve => setTimeout(resolve, 20));
+    await new VotingSessionStore(minutesDir).write(session);
+
+    expect((await manager.getActiveSessionSummaries()).map(summary => summary.minuteId)).toEqual(['0005']);
+  });
+
+  it('should not lose concurrent updates from separate index instances', async () => {
+    await fs.mkdir(join(minutesDir, '0006'));
+    await fs.mkdir(join(minutesDir, '0007'));
+    const reminderAt = new Date(Date.now() + 3600000);
+
+    await Promise.all([
+      new SessionIndex(minutesDir).recordReminders('0006', reminderAt),
+      new SessionIndex(minutesDir).recordReminders('0007', reminderAt),
+      new SessionIndex(minutesDir).recordNotifications('0006', reminderAt)
+    ]);
+
+    const entries = await new SessionIndex(minutesDir).entries();
+    const byId = new Map(entries.map(entry => [entry.minuteId, entry]));
+    expect(byId.get('0006')).toMatchObject({ nextReminderAt: reminderAt.toISOString(), oldestNotificationAt: reminderAt.toISOString() });
+    expect(byId.get('0007')!.nextReminderAt).toBe(reminderAt.toISOString());
+    expect((await fs.readdir(minutesDir)).filter(name => name.endsWith('.tmp') || name.endsWith('.lock'))).toEqual([]);
+  });
+
+  it('should refresh entries whose session file changed on disk', async () => {
+    const manager = new VotingManager(minutesDir, models);
+    const session = await manager.createVotingSession('0003', ['P001']);
+    expect(await manager.getActiveSessionSummaries()).toHaveLength(1);
+
+    // Written by another process: the index only sees the new mtime
+    await new Promise(resolve => setTimeout(resolve, 20));
+    await new VotingSessionStore(minutesDir).write({ ...session, status: 'Cancelled' });
+
+    expect(await manager.getActiveSessionSummaries()).toHaveLength(0);
+  });
+
+  it('should pick up new minute directories and due reminders', async () => {
+    const minuteDir = join(minutesDir, '0004');
+    await fs.mkdir(minuteDir, { recursive: true });
+    await fs.writeFile(join(minuteDir, 'reminder_schedule.json'), JSON.stringify([
+      { scheduledFor: new Date(Date.now() - 60000).toISOString(), hoursBeforeDeadline: 24, minuteId: '0004' },
+      { scheduledFor: new Date(Date.now() + 3600000).toISOString(), hoursBeforeDeadline: 1, minuteId: '0004' }
+    ]), 'utf-8');
+
+    const notifications = new NotificationManager(minutesDir);
+    expect(await notifications.checkPendingReminders()).toEqual([{ minuteId: '0004', hoursRemaining: 24 }]);
+    expect(await notifications.checkPendingReminders()).toEqual([]);
+  });
+});
@@ -0,0 +1,163 @@
+/**
+ * @fileoverview Tests for the append-only voting session log
+ */
+
+import { describe, it, expect, beforeEach, afterEach } from 'vitest';
+import { promises as fs } from 'fs';
+import { tmpdir } from 'os';
+import { join } from 'path';
+import { createHash } from 'crypto';
+import { VotingManager } from '../voting/VotingManager.js';
+import { VotingSessionStore, SESSION_LOG_FILE } from '../voting/SessionStore.js';
+import type { ModelProfile } from '../types/index.js';
+
+const models: ModelProfile[] = ['model-a', 'model-b'].map(id => ({
+  id,
+  name: id,
+  provider: 'test',
+  category: 'General',
+  weight: 1,
+  isActive: true
+}));
+
+describe('Voting Session Block Log', () => {
+  let minutesDir: string;
+
+  beforeEach(async () => {
+    minutesDir = await fs.mkdtemp(join(tmpdir(), 'bip-session-'));
+  });
+
+  afterEach(async () => {
+    await fs.rm(minutesDir, { recursive: true, force: true });
+  });
+
+  it('should append one line per vote and reload the session', async () => {
+    const manager = new VotingManager(minutesDir, models);
+    await manager.createVotingSession('0001', ['P001']);
+
+    await manager.submitVote('0001', 'model-a', [{ proposalId: 'P001', weight: 8 }]);
+    await manager.submitVote('0001', 'model-b', [{ proposalId: 'P001', weight: 9 }]);
+
+    const log = await fs.readFile(join(minutesDir, '0001', SESSION_LOG_FILE), 'utf-8');
+    expect(log.trim().split('\n')).toHaveLength(3);
+
+    const session = await manager.loadVotingSession('0001');
+    expect(session.chain).toHaveLength(2);
+    expect(session.chain[1]!.timestamp).toBeInstanceOf(Date);
+    expect((await manager.verifyVotingIntegrity('0001', { fullRescan: true })).isValid).toBe(true);
+
+    await manager.finalizeVoting('0001', 'model-a');
+    expect((await manager.loadVotingSession('0001')).status).toBe('Completed');
+  });
+
+  it('should only write the chain checkpoint when asked to', async () => {
+    const manager = new VotingManager(minutesDir, models);
+    await manager.createVotingSession('0006', ['P001']);
+    await manager.submitVote('0006', 'model-a', [{ proposalId: 'P001', weight: 8 }]);
+
+    const checkpointFile = join(minutesDir, '0006', 'chain_checkpoint.json');
+    await fs.rm(checkpointFile);
+
+    expect((await manager.verifyVotingIntegrity('0006')).isValid).toBe(true);
+    await expect(fs.access(checkpointFile)).rejects.toThrow();
+
+    const result = await manager.verifyVotingIntegrity('0006', { fullRescan: true, saveCheckpoint: true });
+    expect(result.isValid).toBe(true);
+    expect(JSON.parse(await fs.readFile(checkpointFile, 'utf-8')).verifiedIndex).toBe(result.checkpoint.verifiedIndex);
+  });
+
+  it('should hash the vote file bytes that were written', async () => {
+    const manager = new VotingManager(minutesDir, models);
+    await manager.createVotingSession('0002', ['P001']);
+    const block = await manager.submitVote('0002', 'model-a', [{ proposalId: 'P001', weight: 5 }]);
+
+    const content = await fs.readFile(join(minutesDir, '0002', 'votes', 'model-a.json'), 'utf-8');
+    const expected = createHash('sha256').update(content, 'utf8').digest('hex');
+    expect((block.data as { voteFileHash: string }).voteFileHash).toBe(expected);
+  });
+
+  it('should skip a torn trailing record on load and drop it on the next append', async () => {
+    const manager = new VotingManager(minutesDir, models);
+    await manager.createVotingSession('0003', ['P001']);
+    await manager.submitVote('0003', 'model-a', [{ proposalId: 'P001', weight: 8 }]);
+
+    const logPath = join(minutesDir, '0003', SESSION_LOG_FILE);
+    await fs.appendFile(logPath, '{"type":"block","blo', 'utf-8');
+    const torn = await fs.readFile(logPath, 'utf-8');
+
+    const store = new VotingSessionStore(minutesDir);
+    const session = await store.load('0003');
+    expect(session?.chain).toHaveLength(1);
+    // Loading leaves the log untouched
+    expect(await fs.readFile(logPath, 'utf-8')).toBe(torn);
+
+    await manager.submitVote('0003', 'model-b', [{ proposalId: 'P001', weight: 8 }]);
+    const log = await fs.readFile(logPath, 'utf-8');
+    expect(log).not.toContain('"blo{');
+    expect(log.trim().split('\n')).toHaveLength(3);
+    expect((await manager.loadVotingSession('0003')).chain).toHaveLength(2);
+  });
+
+  it('should serialize concurrent votes onto one chain', async () => {
+    await new VotingManager(minutesDir, models).createVotingSession('0005', ['P001']);
+
+    // Separate managers share nothing in memory but the minutes directory
+    const submissions = await Promise.allSettled([
+      new VotingManager(minutesDir, models).submitVote('0005', 'model-a', [{ proposalId: 'P001', weight: 8 }]),
+      new VotingManager(minutesDir, models).submitVote('0005', 'model-b', [{ proposalId: 'P001', weight: 7 }]),
+      new VotingManager(minutesDir, models).submitVote('0005', 'model-a', [{ proposalId: 'P001', weight: 2 }])
+    ]);
+
+    expect(submissions.map(submission => submission.status)).toEqual(['fulfilled', 'fulfilled', 'rejected']);
+    expect((submissions[2] as PromiseRejectedResult).reason.message).toMatch(/already voted/);
+
+    const manager = new VotingManager(minutesDir, models);
+    const session = await manager.loadVotingSession('0005');
+    expect(session.chain).toHaveLength(2);
+    expect(session.chain[1]!.previousHash).toBe(session.chain[0]!.hash);
+    expect((await manager.verifyVotingIntegrity('0005', { fullRescan: true })).isValid).toBe(true);
+  });
+
+  it('should wait for a lock file held by another process', async () => {
+    const manager = new VotingManager(minutesDir, models);
+    await manager.createVotingSession('0006', ['P001']);
+
+    const lockFile = join(minutesDir, '0006', '.session.lock');
+    await fs.writeFile(lockFile, '99999', 'utf-8');
+
+    let settled = false;
+    const submission = manager.submitVote('0006', 'model-a', [{ proposalId: 'P001', weight: 8 }])
+      .finally(() => { settled = true; });
+
+    await new Promise(resolve => setTimeout(resolve, 50));
+    expect(settled).toBe(false);
+
+    await fs.rm(lockFile);
+    await submission;
+    expect((await manager.loadVotingSession('0006')).chain).toHaveLength(1);
+    await expect(fs.access(lockFile)).rejects.toThrow();
+  });
+
+  it('should migrate legacy JSON sessions on first append', async () => {
+    const sessionDir = join(minutesDir, '0004');
+    await fs.mkdir(join(sessionDir, 'votes'), { recursive: true });
+    await fs.writeFile(join(sessionDir, 'voting_session.json'), JSON.stringify({
+      minuteId: '0004',
+      proposals: ['P001'],
+      startTime: new Date().toISOString(),
+      endTime: new Date(Date.now() + 3600000).toISOString(),
+      status: 'Active',
+      quorumThreshold: 0.6,
+      approvalThreshold: 0.6,
+      chain: [],
+      participants: ['model-a']
+    }), 'utf-8');
+
+    const manager = new VotingManager(minutesDir, models);
+    await manager.submitVote('0004', 'model-a', [{ proposalId: 'P001', weight: 8 }]);
+
+    const store = new VotingSessionStore(minutesDir);
+    expect(await store.exists('0004')).toBe(true);
+    expect((await store.load('0004'))?.chain).toHaveLength(1);
+  });
+});
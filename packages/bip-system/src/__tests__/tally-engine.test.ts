@@ -0,0 +1,141 @@
+/**
+ * @fileoverview Tests for the streaming, incremental tally engine
+ */
+
+import { describe, it, expect, beforeEach, afterEach } from 'vitest';
+import { promises as fs } from 'fs';
+import { tmpdir } from 'os';
+import { join } from 'path';
+import { createHash } from 'crypto';
+import { TallyEngine, TALLY_AGGREGATE_FILE, toProposalResults } from '../voting/TallyEngine.js';
+import type { TalliedVote } from '../voting/TallyEngine.js';
+
+describe('TallyEngine', () => {
+  let minutesDir: string;
+  let votesDir: string;
+
+  const writeVote = async (name: string, document: unknown): Promise<string> => {
+    const content = JSON.stringify(document, null, 2);
+    await fs.writeFile(join(votesDir, name), content, 'utf-8');
+    return createHash('sha256').update(content, 'utf8').digest('hex');
+  };
+
+  const govVote = (model: string, weights: Record<string, number>) => ({
+    minute_id: '0007',
+    model,
+    timestamp: '2025-09-08T12:00:00Z',
+    weights: Object.entries(weights).map(([proposal_id, weight]) => ({ proposal_id, weight, comment: `${model} on ${proposal_id}` }))
+  });
+
+  beforeEach(async () => {
+    minutesDir = await fs.mkdtemp(join(tmpdir(), 'bip-tally-'));
+    votesDir = join(minutesDir, '0007', 'votes');
+    await fs.mkdir(votesDir, { recursive: true });
+  });
+
+  afterEach(async () => {
+    await fs.rm(minutesDir, { recursive: true, force: true });
+  });
+
+  it('should tally both vote formats and skip the template', async () => {
+    await writeVote('model-a.json', govVote('model-a', { '001': 9, '002': 2 }));
+    await writeVote('model-b.json', {
+      model: 'model-b',
+      timestamp: '2025-09-08T12:05:00Z',
+      proposals: [{ proposalId: '001', weight: 5, justification: 'ok' }]
+    });
+    await writeVote('TEMPLATE.json', govVote('<your-model>', { '001': 10 }));
+    await writeVote('broken.json', { model: 'model-c', proposals: [{ proposal_id: '001', vote: 'SUPPORT' }] });
+
+    const report = await new TallyEngine(minutesDir, { concurrency: 2 }).tally('0007');
+
+    expect(report.votes.map(vote => vote.model)).toEqual(['model-a', 'model-b']);
+    expect(report.rejected.map(issue => issue.file)).toEqual(['votes/broken.json']);
+
+    const p001 = report.proposals.find(tally => tally.proposalId === '001')!;
+    expect(p001).toEqual({ proposalId: '001', totalWeight: 14, voteCount: 2, approve: 1, reject: 0, abstain: 1, averageWeight: 7 });
+    expect(report.votes[0]!.votes[0]!.justification).toBe('model-a on 001');
+  });
+
+  it('should report or reject votes whose hash differs from the chain', async () => {
+    const hashA = await writeVote('model-a.json', govVote('model-a', { '001': 9 }));
+    await writeVote('model-b.json', govVote('model-b', { '001': 8 }));
+    const expectedHashes = new Map([
+      ['votes/model-a.json', hashA],
+      ['votes/model-b.json', 'f'.repeat(64)]
+    ]);
+    const engine = new TallyEngine(minutesDir);
+
+    const lenient = await engine.tally('0007', { expectedHashes, rejectHashMismatches: false });
+    expect(lenient.votes).toHaveLength(2);
+    expect(lenient.hashMismatches.map(issue => issue.file)).toEqual(['votes/model-b.json']);
+
+    const strict = await engine.tally('0007', { expectedHashes });
+    expect(strict.votes.map(vote => vote.model)).toEqual(['model-a']);
+    expect(strict.rejected.map(issue => issue.file)).toEqual(['votes/model-b.json']);
+  });
+
+  it('should re-tally incrementally, applying only new, changed and removed votes', async () => {
+    await writeVote('model-a.json', govVote('model-a', { '001': 9, '002': 4 }));
+    await writeVote('model-b.json', govVote('model-b', { '001': 3 }));
+    const engine = new TallyEngine(minutesDir);
+
+    const first = await engine.tally('0007', { incremental: true });
+    expect(first.stats).toEqual({ read: 2, reused: 0, retracted: 0 });
+    await fs.access(join(minutesDir, '0007', TALLY_AGGREGATE_FILE));
+
+    // Change one vote (different size, so the stamp changes), add one, remove one
+    await writeVote('model-a.json', govVote('model-a', { '001': 10, '002': 4, '003': 7 }));
+    await writeVote('model-c.json', govVote('model-c', { '002': 8 }));
+    await fs.rm(join(votesDir, 'model-b.json'));
+
+    const second = await engine.tally('0007', { incremental: true });
+    expect(second.stats).toEqual({ read: 2, reused: 0, retracted: 1 });
+
+    const third = await engine.tally('0007', { incremental: true });
+    expect(third.stats).toEqual({ read: 0, reused: 2, retracted: 0 });
+
+    // The incremental aggregate matches a full tally
+    const full = await new TallyEngine(minutesDir).tally('0007');
+    expect(third.proposals).toEqual(full.proposals);
+    expect(full.proposals.map(tally => [tally.proposalId, tally.totalWeight])).toEqual([
+      ['001', 10],
+      ['002', 12],
+      ['003', 7]
+    ]);
+  });
+
+  it('should only count votes the verifier accepts', async () => {
+    for (const model of ['model-a', 'model-b', 'model-c']) {
+      await writeVote(`${model}.json`, govVote(model, { '001': 8 }));
+    }
+
+    const batches: number[] = [];
+    const verifier = async (_minuteId: string, votes: TalliedVote[]) => {
+      batches.push(votes.length);
+      return votes.map(vote => vote.model !== 'model-b');
+    };
+
+    const report = await new TallyEngine(minutesDir, { verifier, verifyBatchSize: 2 }).tally('0007');
+
+    expect(batches.reduce((sum, size) => sum + size, 0)).toBe(3);
+    expect(Math.max(...batches)).toBeLessThanOrEqual(2);
+    expect(report.votes.map(vote => vote.model)).toEqual(['model-a', 'model-c']);
+    expect(report.rejected).toEqual([{ file: 'votes/model-b.json', reason: 'Vote is not signed' }]);
+  });
+
+  it('should apply session thresholds when converting to results', () => {
+    const results = toProposalResults([
+      { proposalId: 'P001', totalWeight: 24, voteCount: 3, approve: 3, reject: 0, abstain: 0, averageWeight: 8 },
+      { proposalId: 'P002', totalWeight: 12, voteCount: 3, approve: 1, reject: 1, abstain: 1, averageWeight: 4 },
+      { proposalId: 'P999', totalWeight: 30, voteCount: 3, approve: 3, reject: 0, abstain: 0, averageWeight: 10 }
+    ], { proposals: ['P002', 'P001', 'P003'], participantCount: 4, quorumThreshold: 0.6, approvalThreshold: 0.6 });
+
+    expect(results.map(result => [result.proposalId, result.status])).toEqual([
+      ['P001', 'Approved'],
+      ['P002', 'Rejected'],
+      ['P003', 'Rejected']
+    ]);
+    expect(results[2]!.participantCount).toBe(0);
+  });
+});
@@ -0,0 +1,95 @@
+/**
+ * @fileoverview Tests for incremental VotingChain verification
+ */
+
+import { describe, it, expect } from 'vitest';
+import { VotingChain } from '../chain/VotingChain.js';
+import type { VotingSession, VoteData } from '../types/index.js';
+
+function createSession(): VotingSession {
+  return {
+    minuteId: '0099',
+    proposals: ['P001'],
+    startTime: new Date('2025-09-08T10:00:00.000Z'),
+    endTime: new Date('2025-09-15T10:00:00.000Z'),
+    status: 'Active',
+    quorumThreshold: 0.6,
+    approvalThreshold: 0.6,
+    chain: [],
+    participants: ['model-a', 'model-b', 'model-c']
+  };
+}
+
+function voteData(model: string): VoteData {
+  return {
+    voteFile: `votes/${model}.json`,
+    voteFileHash: `hash-${model}`,
+    votes: [{ proposalId: 'P001', weight: 8 }]
+  };
+}
+
+describe('VotingChain Incremental Verification', () => {
+  it('should advance the checkpoint as blocks are appended', () => {
+    const chain = new VotingChain(createSession());
+
+    chain.addVoteBlock('model-a', voteData('model-a'));
+    chain.addVoteBlock('model-b', voteData('model-b'));
+
+    const checkpoint = chain.getCheckpoint();
+    expect(checkpoint.verifiedIndex).toBe(2);
+    expect(checkpoint.verifiedHash).toBe(chain.getSession().chain[1]!.hash);
+
+    const result = chain.verifyChainIntegrity();
+    expect(result.isValid).toBe(true);
+    expect(result.blocksVerified).toBe(0);
+  });
+
+  it('should only verify blocks after a persisted checkpoint', () => {
+    const first = new VotingChain(createSession());
+    first.addVoteBlock('model-a', voteData('model-a'));
+    first.addVoteBlock('model-b', voteData('model-b'));
+    const checkpoint = first.getCheckpoint();
+
+    // Block appended by another writer that did not carry the checkpoint
+    const writer = new VotingChain(first.getSession());
+    writer.addVoteBlock('model-c', voteData('model-c'));
+
+    const reader = new VotingChain(writer.getSession(), checkpoint);
+    const result = reader.verifyChainIntegrity();
+
+    expect(result.isValid).toBe(true);
+    expect(result.blocksVerified).toBe(1);
+    expect(result.checkpoint.verifiedIndex).toBe(3);
+  });
+
+  it('should fall back to a full rescan when the checkpoint no longer matches', () => {
+    const chain = new VotingChain(createSession());
+    chain.addVoteBlock('model-a', voteData('model-a'));
+    chain.addVoteBlock('model-b', voteData('model-b'));
+
+    chain.getSession().chain[1]!.hash = 'tampered';
+
+    const result = chain.verifyChainIntegrity();
+    expect(result.isValid).toBe(false);
+    expect(result.blocksVerified).toBe(2);
+    expect(result.errors.some(error => error.includes('Checkpoint mismatch'))).toBe(true);
+    expect(result.checkpoint.verifiedIndex).toBe(0);
+  });
+
+  it('should detect tampering inside the verified prefix on full rescan', () => {
+    const chain = new VotingChain(createSession());
+    chain.addVoteBlock('model-a', voteData('model-a'));
+    chain.addVoteBlock('model-b', voteData('model-b'));
+
+    const block = chain.getSession().chain[0]!;
+    (block.data as VoteData).voteFileHash = 'tampered';
+
+    expect(chain.verifyChainIntegrity().isValid).toBe(true);
+
+    const audit = chain.verifyChainIntegrity({ fullRescan: true });
+    expect(audit.isValid).toBe(false);
+    expect(audit.blocksVerified).toBe(2);
+    expect(audit.errors).toContain('Block 0 has invalid hash');
+    expect(audit.checkpoint.verifiedIndex).toBe(0);
+  });
+});
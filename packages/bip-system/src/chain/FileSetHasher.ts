@@ -0,0 +1,258 @@
+/**
+ * FileSetHasher - Streaming, cached hashing of BIP file sets
+ * Produces the same digest as hashing the files' UTF-8 contents joined with
+ * '\n---\n', but streams raw bytes into an incremental SHA-256 and skips
+ * file sets whose (path, size, mtime) are unchanged since the last run.
+ */
+
+import { promises as fs, createReadStream } from 'fs';
+import * as buffer from 'buffer';
+import { join } from 'path';
+import { createHash, Hash } from 'crypto';
+
+export const FILE_SET_SEPARATOR = '\n---\n';
+const HASH_CACHE_VERSION = 1;
+
+export interface FileSetHasherOptions {
+  cacheFile?: string; // persistent digest cache; omit for in-memory only
+  concurrency?: number; // max files streamed at once (default 8)
+}
+
+interface FileStamp {
+  path: string;
+  size: number;
+  mtimeMs: number;
+}
+
+interface CacheEntry {
+  files: FileStamp[];
+  digest: string;
+}
+
+// Available from Node 18.14; older runtimes validate through TextDecoder
+const isUtf8: ((input: Uint8Array) => boolean) | undefined = (buffer as any).isUtf8;
+
+/**
+ * Incremental UTF-8 validity check over arbitrary chunk boundaries
+ */
+class Utf8Validator {
+  private carry: Buffer = Buffer.alloc(0);
+  private decoder = isUtf8 ? null : new TextDecoder('utf-8', { fatal: true });
+  valid = true;
+
+  push(chunk: Buffer): void {
+    if (!this.valid) return;
+
+    if (this.decoder) {
+      try {
+        this.decoder.decode(chunk, { stream: true });
+      } catch {
+        this.valid = false;
+      }
+      return;
+    }
+
+    const data = this.carry.length > 0 ? Buffer.concat([this.carry, chunk]) : chunk;
+    const tail = Utf8Validator.incompleteTail(data);
+
+    if (!isUtf8!(data.subarray(0, data.length - tail))) {
+      this.valid = false;
+    }
+    this.carry = Buffer.from(data.subarray(data.length - tail));
+  }
+
+  end(): boolean {
+    if (this.decoder) {
+      try {
+        this.decoder.decode();
+      } catch {
+        this.valid = false;
+      }
+      return this.valid;
+    }
+    return this.valid && this.carry.length === 0;
+  }
+
+  /**
+   * Length of a multi-byte sequence cut off at the end of the chunk
+   */
+  private static incompleteTail(data: Buffer): number {
+    for (let i = 1; i <= Math.min(3, data.length); i++) {
+      const byte = data[data.length - i]!;
+      if ((byte & 0xc0) === 0x80) continue; // continuation byte
+
+      const length = byte >= 0xf0 ? 4 : byte >= 0xe0 ? 3 : byte >= 0xc0 ? 2 : 1;
+      return length > i ? i : 0;
+    }
+    return 0;
+  }
+}
+
+export class FileSetHasher {
+  private cacheFile: string | undefined;
+  private concurrency: number;
+  private cache: Map<string, CacheEntry> = new Map();
+  private cacheLoaded = false;
+  private cacheDirty = false;
+  private activeStreams = 0;
+  private waiters: Array<() => void> = [];
+
+  constructor(options: FileSetHasherOptions = {}) {
+    this.cacheFile = options.cacheFile;
+    this.concurrency = Math.max(1, options.concurrency ?? 8);
+  }
+
+  /**
+   * Hash a list of files relative to baseDir
+   */
+  async hashFileSet(files: string[], baseDir: string): Promise<string> {
+    await this.loadCache();
+
+    const key = [baseDir, ...files].join('\n');
+    const stamps = await Promise.all(files.map(file => this.stamp(join(baseDir, file))));
+    const cached = this.cache.get(key);
+
+    if (cached && stamps.every(stamp => stamp !== null) && this.sameStamps(cached.files, stamps as FileStamp[])) {
+      return cached.digest;
+    }
+
+    let digest = await this.streamFileSet(files, baseDir, stamps);
+    if (digest === null) {
+      // Some file is not valid UTF-8: only the decoded-string form matches
+      digest = await this.hashDecoded(files, baseDir);
+    }
+
+    if (stamps.every(stamp => stamp !== null)) {
+      this.cache.set(key, { files: stamps as FileStamp[], digest });
+      this.cacheDirty = true;
+    }
+
+    return digest;
+  }
+
+  /**
+   * Persist the digest cache if it changed
+   */
+  async saveCache(): Promise<void> {
+    if (!this.cacheFile || !this.cacheDirty) return;
+
+    const data = {
+      version: HASH_CACHE_VERSION,
+      entries: Object.fromEntries(this.cache)
+    };
+
+    await fs.writeFile(this.cacheFile, JSON.stringify(data), 'utf-8');
+    this.cacheDirty = false;
+  }
+
+  private async loadCache(): Promise<void> {
+    if (this.cacheLoaded) return;
+    this.cacheLoaded = true;
+    if (!this.cacheFile) return;
+
+    try {
+      const content = await fs.readFile(this.cacheFile, 'utf-8');
+      const data = JSON.parse(content);
+      if (data.version === HASH_CACHE_VERSION) {
+        this.cache = new Map(Object.entries(data.entries as Record<string, CacheEntry>));
+      }
+    } catch {
+      // No cache yet, or unreadable: start empty
+    }
+  }
+
+  /**
+   * Stream the files into one hash. Returns null if any file is not UTF-8.
+   */
+  private async streamFileSet(files: string[], baseDir: string, stamps: Array<FileStamp | null>): Promise<string | null> {
+    const hash = createHash('sha256');
+
+    for (let i = 0; i < files.length; i++) {
+      if (i > 0) {
+        hash.update(FILE_SET_SEPARATOR, 'utf8');
+      }
+
+      const file = files[i]!;
+      if (stamps[i] === null) {
+        console.warn(`Warning: Could not read file ${file}, using placeholder`);
+        hash.update(`[FILE_NOT_FOUND: ${file}]`, 'utf8');
+        continue;
+      }
+
+      try {
+        if (!(await this.streamFile(join(baseDir, file), hash))) {
+          return null;
+        }
+      } catch {
+        // Failed mid-read: let the decoded path decide on the placeholder
+        return null;
+      }
+    }
+
+    return hash.digest('hex');
+  }
+
+  private async streamFile(path: string, hash: Hash): Promise<boolean> {
+    await this.acquire();
+    try {
+      const validator = new Utf8Validator();
+      for await (const chunk of createReadStream(path)) {
+        hash.update(chunk as Buffer);
+        validator.push(chunk as Buffer);
+      }
+      return validator.end();
+    } finally {
+      this.release();
+    }
+  }
+
+  /**
+   * Reference form: decode every file and hash the joined string
+   */
+  private async hashDecoded(files: string[], baseDir: string): Promise<string> {
+    const fileContents: string[] = [];
+
+    for (const file of files) {
+      try {
+        fileContents.push(await fs.readFile(join(baseDir, file), 'utf-8'));
+      } catch (error) {
+        console.warn(`Warning: Could not read file ${file}, using placeholder`);
+        fileContents.push(`[FILE_NOT_FOUND: ${file}]`);
+      }
+    }
+
+    return createHash('sha256').update(fileContents.join(FILE_SET_SEPARATOR), 'utf8').digest('hex');
+  }
+
+  private async stamp(path: string): Promise<FileStamp | null> {
+    try {
+      const stat = await fs.stat(path);
+      return stat.isFile() ? { path, size: stat.size, mtimeMs: stat.mtimeMs } : null;
+    } catch {
+      return null;
+    }
+  }
+
+  private sameStamps(a: FileStamp[], b: FileStamp[]): boolean {
+    return a.length === b.length && a.every((stamp, i) =>
+      stamp.path === b[i]!.path && stamp.size === b[i]!.size && stamp.mtimeMs === b[i]!.mtimeMs
+    );
+  }
+
+  private async acquire(): Promise<void> {
+    if (this.activeStreams < this.concurrency) {
+      this.activeStreams++;
+      return;
+    }
+    await new Promise<void>(resolve => this.waiters.push(resolve));
+  }
+
+  private release(): void {
+    const next = this.waiters.shift();
+    if (next) {
+      next(); // hand the slot over without releasing it
+    } else {
+      this.activeStreams--;
+    }
+  }
+}
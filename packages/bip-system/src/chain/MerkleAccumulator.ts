@@ -0,0 +1,204 @@
+/**
+ * MerkleAccumulator - Append-only Merkle tree over vote hashes
+ * Follows the RFC 6962 tree shape and domain separation (0x00 leaves,
+ * 0x01 interior nodes) so inclusion proofs are O(log n) and can be checked
+ * without the rest of the minute.
+ */
+
+import { createHash } from 'crypto';
+
+export interface MerkleInclusionProof {
+  leafIndex: number; // 0-based
+  treeSize: number;
+  leafHash: string;
+  auditPath: string[]; // sibling hashes, leaf to root
+  root: string;
+}
+
+const LEAF_PREFIX = Buffer.from([0x00]);
+const NODE_PREFIX = Buffer.from([0x01]);
+
+/**
+ * Hash of an empty tree
+ */
+export const EMPTY_MERKLE_ROOT = createHash('sha256').digest('hex');
+
+export class MerkleAccumulator {
+  // levels[0] holds leaf hashes; levels[k][i] is the root of the perfect
+  // subtree covering leaves [i * 2^k, (i + 1) * 2^k)
+  private readonly levels: Buffer[][] = [[]];
+
+  /**
+   * Hash raw leaf data into a leaf hash
+   */
+  static hashLeaf(data: string | Buffer): string {
+    return MerkleAccumulator.leafDigest(typeof data === 'string' ? Buffer.from(data, 'utf8') : data).toString('hex');
+  }
+
+  get size(): number {
+    return this.levels[0]!.length;
+  }
+
+  /**
+   * Append leaf data; returns the leaf index
+   */
+  append(data: string | Buffer): number {
+    return this.appendLeafHash(MerkleAccumulator.leafDigest(typeof data === 'string' ? Buffer.from(data, 'utf8') : data));
+  }
+
+  /**
+   * Root of the first `size` leaves (defaults to the whole tree)
+   */
+  root(size: number = this.size): string {
+    this.assertSize(size);
+    return size === 0 ? EMPTY_MERKLE_ROOT : this.subtreeRoot(0, size).toString('hex');
+  }
+
+  /**
+   * Leaf hash at an index
+   */
+  leafHash(index: number): string {
+    const leaf = this.levels[0]![index];
+    if (!leaf) {
+      throw new Error(`Leaf index ${index} out of range (size ${this.size})`);
+    }
+    return leaf.toString('hex');
+  }
+
+  /**
+   * Inclusion proof for a leaf in the tree of the first `treeSize` leaves
+   */
+  prove(leafIndex: number, treeSize: number = this.size): MerkleInclusionProof {
+    this.assertSize(treeSize);
+    if (!Number.isInteger(leafIndex) || leafIndex < 0 || leafIndex >= treeSize) {
+      throw new Error(`Leaf index ${leafIndex} out of range (tree size ${treeSize})`);
+    }
+
+    const auditPath: string[] = [];
+    this.collectPath(leafIndex, 0, treeSize, auditPath);
+
+    return {
+      leafIndex,
+      treeSize,
+      leafHash: this.leafHash(leafIndex),
+      auditPath,
+      root: this.root(treeSize)
+    };
+  }
+
+  private appendLeafHash(leaf: Buffer): number {
+    const index = this.size;
+    this.levels[0]!.push(leaf);
+
+    // Complete every perfect subtree this leaf closes
+    let level = 0;
+    let position = index;
+    while (position % 2 === 1) {
+      const nodes = this.levels[level]!;
+      const parent = MerkleAccumulator.nodeDigest(nodes[position - 1]!, nodes[position]!);
+      level++;
+      position = Math.floor(position / 2);
+      (this.levels[level] ??= []).push(parent);
+    }
+
+    return index;
+  }
+
+  /**
+   * MTH over leaves [start, start + count); perfect aligned subtrees are read
+   * from the stored levels, so only the ragged right edge is recomputed
+   */
+  private subtreeRoot(start: number, count: number): Buffer {
+    if (isPowerOfTwo(count) && start % count === 0) {
+      const level = Math.log2(count);
+      return this.levels[level]![start / count]!;
+    }
+
+    const split = largestPowerOfTwoBelow(count);
+    return MerkleAccumulator.nodeDigest(
+      this.subtreeRoot(start, split),
+      this.subtreeRoot(start + split, count - split)
+    );
+  }
+
+  /**
+   * RFC 6962 PATH(m, D[start:start+count]), appended leaf-first
+   */
+  private collectPath(leafIndex: number, start: number, count: number, out: string[]): void {
+    if (count <= 1) return;
+
+    const split = largestPowerOfTwoBelow(count);
+    if (leafIndex - start < split) {
+      this.collectPath(leafIndex, start, split, out);
+      out.push(this.subtreeRoot(start + split, count - split).toString('hex'));
+    } else {
+      this.collectPath(leafIndex, start + split, count - split, out);
+      out.push(this.subtreeRoot(start, split).toString('hex'));
+    }
+  }
+
+  private assertSize(size: number): void {
+    if (!Number.isInteger(size) || size < 0 || size > this.size) {
+      throw new Error(`Tree size ${size} out of range (size ${this.size})`);
+    }
+  }
+
+  private static leafDigest(data: Buffer): Buffer {
+    return createHash('sha256').update(LEAF_PREFIX).update(data).digest();
+  }
+
+  private static nodeDigest(left: Buffer, right: Buffer): Buffer {
+    return createHash('sha256').update(NODE_PREFIX).update(left).update(right).digest();
+  }
+}
+
+/**
+ * Verify an inclusion proof (RFC 9162 section 2.1.3.2). When `expectedRoot`
+ * is given the proof must also lead to that root, not just to its own.
+ */
+export function verifyInclusionProof(proof: MerkleInclusionProof, expectedRoot?: string): boolean {
+  const { leafIndex, treeSize, auditPath } = proof;
+  if (!Number.isInteger(leafIndex) || !Number.isInteger(treeSize) || leafIndex < 0 || leafIndex >= treeSize) {
+    return false;
+  }
+  if (expectedRoot !== undefined && expectedRoot !== proof.root) {
+    return false;
+  }
+
+  let fn = leafIndex;
+  let sn = treeSize - 1;
+  let node = Buffer.from(proof.leafHash, 'hex');
+
+  for (const siblingHex of auditPath) {
+    if (sn === 0) return false;
+    const sibling = Buffer.from(siblingHex, 'hex');
+
+    if (fn % 2 === 1 || fn === sn) {
+      node = createHash('sha256').update(NODE_PREFIX).update(sibling).update(node).digest();
+      if (fn % 2 === 0) {
+        while (fn % 2 === 0 && fn !== 0) {
+          fn = Math.floor(fn / 2);
+          sn = Math.floor(sn / 2);
+        }
+      }
+    } else {
+      node = createHash('sha256').update(NODE_PREFIX).update(node).update(sibling).digest();
+    }
+
+    fn = Math.floor(fn / 2);
+    sn = Math.floor(sn / 2);
+  }
+
+  return sn === 0 && node.toString('hex') === proof.root;
+}
+
+function isPowerOfTwo(n: number): boolean {
+  return n > 0 && (n & (n - 1)) === 0;
+}
+
+function largestPowerOfTwoBelow(n: number): number {
+  // Largest power of two strictly less than n (n >= 2)
+  let k = 1;
+  while (k * 2 < n) k *= 2;
+  return k;
+}
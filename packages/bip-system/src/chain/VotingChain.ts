@@ -4,13 +4,36 @@
  */
 
 import { createHash } from 'crypto';
-import { VotingBlock, VotingSession, VoteData, ResultData, BlockType } from '../types/index.js';
+import {
+  VotingBlock,
+  VotingSession,
+  VoteData,
+  ResultData,
+  BlockType,
+  ChainCheckpoint,
+  ChainVerificationOptions,
+  ChainVerificationResult,
+  VoteInclusionProof
+} from '../types/index.js';
+import { MerkleAccumulator, verifyInclusionProof } from './MerkleAccumulator.js';
 
 export class VotingChain {
   private session: VotingSession;
+  private checkpoint: ChainCheckpoint;
+  // Built on first use, then extended by addVoteBlock
+  private voteTree?: MerkleAccumulator;
+  private voteLeaves = new Map<string, { leafIndex: number; blockIndex: number }>();
 
-  constructor(session: VotingSession) {
+  constructor(session: VotingSession, checkpoint?: ChainCheckpoint) {
     this.session = session;
+    this.checkpoint = checkpoint ?? VotingChain.emptyCheckpoint();
+  }
+
+  /**
+   * Checkpoint covering no blocks
+   */
+  static emptyCheckpoint(): ChainCheckpoint {
+    return { verifiedIndex: 0, verifiedHash: null, verifiedAt: new Date(0) };
   }
 
   /**
@@ -72,7 +95,10 @@ export class VotingChain {
       hash: blockHash
     };
 
-    this.session.chain.push(block);
+    this.appendBlock(block);
+    if (this.voteTree) {
+      this.addVoteLeaf(block);
+    }
     return block;
   }
 
@@ -106,86 +132,248 @@ export class VotingChain {
       hash: blockHash
     };
 
-    this.session.chain.push(block);
+    this.appendBlock(block);
     this.session.status = 'Completed';
     return block;
   }
 
   /**
-   * Verify the integrity of the entire chain
+   * Append a block built by this chain. Its hash was computed here, so when
+   * the chain was verified up to its tip the checkpoint moves with it.
    */
-  verifyChainIntegrity(): { isValid: boolean; errors: string[] } {
-    const errors: string[] = [];
+  private appendBlock(block: VotingBlock): void {
+    const tipVerified = this.checkpoint.verifiedIndex === this.session.chain.length &&
+      this.checkpoint.verifiedHash === (this.session.chain[this.session.chain.length - 1]?.hash ?? null);
 
-    if (this.session.chain.length === 0) {
-      return { isValid: true, errors: [] };
+    this.session.chain.push(block);
+
+    if (tipVerified) {
+      this.checkpoint = {
+        verifiedIndex: block.index,
+        verifiedHash: block.hash,
+        verifiedAt: new Date()
+      };
     }
+  }
 
-    // Check first block
-    const firstBlock = this.session.chain[0];
-    if (firstBlock && firstBlock.index !== 1) {
-      errors.push('First block index should be 1');
+  /**
+   * Verify chain integrity. Blocks covered by the checkpoint are skipped
+   * unless a full rescan is requested; the checkpoint advances over every
+   * newly verified contiguous block.
+   */
+  verifyChainIntegrity(options: ChainVerificationOptions = {}): ChainVerificationResult {
+    const errors: string[] = [];
+    const chain = this.session.chain;
+
+    let startIndex = 0;
+    if (!options.fullRescan && this.checkpoint.verifiedIndex > 0) {
+      const anchor = chain[this.checkpoint.verifiedIndex - 1];
+      if (anchor && anchor.hash === this.checkpoint.verifiedHash) {
+        startIndex = this.checkpoint.verifiedIndex;
+      } else {
+        errors.push(
+          `Checkpoint mismatch at block ${this.checkpoint.verifiedIndex}: chain was modified after verification`
+        );
+        this.checkpoint = VotingChain.emptyCheckpoint();
+      }
+    } else if (options.fullRescan) {
+      this.checkpoint = VotingChain.emptyCheckpoint();
     }
-    if (firstBlock && firstBlock.previousHash !== null) {
-      errors.push('First block should have null previousHash');
+
+    if (startIndex === 0 && chain.length > 0) {
+      // Check first block
+      const firstBlock = chain[0];
+      if (firstBlock && firstBlock.index !== 1) {
+        errors.push('First block index should be 1');
+      }
+      if (firstBlock && firstBlock.previousHash !== null) {
+        errors.push('First block should have null previousHash');
+      }
     }
 
-    // Verify each block in sequence
-    for (let i = 0; i < this.session.chain.length; i++) {
-      const block = this.session.chain[i];
+    // Verify each new block in sequence
+    let contiguousValid = errors.length === 0;
+    for (let i = startIndex; i < chain.length; i++) {
+      const block = chain[i];
       if (!block) continue;
 
-      const expectedIndex = i + 1;
+      const blockErrors = this.verifyBlock(i);
+      errors.push(...blockErrors);
 
-      // Check index sequence
-      if (block.index !== expectedIndex) {
-        errors.push(`Block ${i} has incorrect index: expected ${expectedIndex}, got ${block.index}`);
+      if (contiguousValid && blockErrors.length === 0) {
+        this.checkpoint = {
+          verifiedIndex: i + 1,
+          verifiedHash: block.hash,
+          verifiedAt: new Date()
+        };
+      } else {
+        contiguousValid = false;
       }
+    }
 
-      // Check previous hash linkage
-      if (i > 0) {
-        const previousBlock = this.session.chain[i - 1];
-        if (previousBlock && block.previousHash !== previousBlock.hash) {
-          errors.push(`Block ${i} has incorrect previousHash`);
-        }
-      }
+    return {
+      isValid: errors.length === 0,
+      errors,
+      blocksVerified: chain.length - startIndex,
+      checkpoint: this.getCheckpoint()
+    };
+  }
 
-      // Verify block hash
-      const data = block.data;
-      let fileReference: string;
-      let fileHash: string;
+  /**
+   * Current verified-prefix checkpoint
+   */
+  getCheckpoint(): ChainCheckpoint {
+    return { ...this.checkpoint };
+  }
 
-      if (block.type === 'vote') {
-        const voteData = data as VoteData;
-        fileReference = voteData.voteFile;
-        fileHash = voteData.voteFileHash;
-      } else {
-        const resultData = data as ResultData;
-        fileReference = resultData.resultFile;
-        fileHash = resultData.resultFileHash;
+  /**
+   * Check index, linkage and hash of the block at position i
+   */
+  private verifyBlock(i: number): string[] {
+    const errors: string[] = [];
+    const block = this.session.chain[i];
+    if (!block) return errors;
+
+    const expectedIndex = i + 1;
+
+    // Check index sequence
+    if (block.index !== expectedIndex) {
+      errors.push(`Block ${i} has incorrect index: expected ${expectedIndex}, got ${block.index}`);
+    }
+
+    // Check previous hash linkage
+    if (i > 0) {
+      const previousBlock = this.session.chain[i - 1];
+      if (previousBlock && block.previousHash !== previousBlock.hash) {
+        errors.push(`Block ${i} has incorrect previousHash`);
       }
+    }
+
+    // Verify block hash
+    const data = block.data;
+    let fileReference: string;
+    let fileHash: string;
+
+    if (block.type === 'vote') {
+      const voteData = data as VoteData;
+      fileReference = voteData.voteFile;
+      fileHash = voteData.voteFileHash;
+    } else {
+      const resultData = data as ResultData;
+      fileReference = resultData.resultFile;
+      fileHash = resultData.resultFileHash;
+    }
+
+    const expectedHash = this.calculateBlockHash(
+      block.index,
+      block.timestamp,
+      block.previousHash,
+      block.type,
+      block.model,
+      fileReference,
+      fileHash
+    );
 
-      const expectedHash = this.calculateBlockHash(
-        block.index,
-        block.timestamp,
-        block.previousHash,
-        block.type,
-        block.model,
-        fileReference,
-        fileHash
-      );
-
-      if (block.hash !== expectedHash) {
-        errors.push(`Block ${i} has invalid hash`);
+    if (block.hash !== expectedHash) {
+      errors.push(`Block ${i} has invalid hash`);
+    }
+
+    if (block.type === 'finalize') {
+      const resultData = data as ResultData;
+      if (resultData.voteMerkleRoot !== undefined) {
+        const votesBefore = this.countVotesBefore(i);
+        if (resultData.voteCount !== votesBefore || resultData.voteMerkleRoot !== this.getVoteTree().root(votesBefore)) {
+          errors.push(`Block ${i} has a vote Merkle root that does not match the preceding votes`);
+        }
       }
     }
 
+    return errors;
+  }
+
+  /**
+   * Leaf data committed for a vote: the model and the hash of its vote file
+   */
+  static voteLeafData(model: string, voteData: Pick<VoteData, 'voteFile' | 'voteFileHash'>): string {
+    return [model, voteData.voteFile, voteData.voteFileHash].join('|');
+  }
+
+  /**
+   * Merkle root over all vote blocks
+   */
+  getVoteMerkleRoot(): string {
+    return this.getVoteTree().root();
+  }
+
+  /**
+   * Number of vote blocks in the Merkle tree
+   */
+  getVoteCount(): number {
+    return this.getVoteTree().size;
+  }
+
+  /**
+   * O(log n) inclusion proof for a model's vote. `treeSize` selects an
+   * earlier root, e.g. the one recorded in the finalize block.
+   */
+  getVoteInclusionProof(model: string, treeSize?: number): VoteInclusionProof {
+    const tree = this.getVoteTree();
+    const leaf = this.voteLeaves.get(model);
+    if (!leaf) {
+      throw new Error(`No vote from model ${model} in session ${this.session.minuteId}`);
+    }
+
+    const proof = tree.prove(leaf.leafIndex, treeSize ?? tree.size);
+    const voteData = this.session.chain[leaf.blockIndex - 1]!.data as VoteData;
+
     return {
-      isValid: errors.length === 0,
-      errors
+      minuteId: this.session.minuteId,
+      model,
+      voteFile: voteData.voteFile,
+      voteFileHash: voteData.voteFileHash,
+      blockIndex: leaf.blockIndex,
+      ...proof
     };
   }
 
+  /**
+   * Check a vote inclusion proof without the chain. The leaf is recomputed
+   * from the model and vote file hash, so a proof cannot vouch for other data.
+   */
+  static verifyVoteInclusionProof(proof: VoteInclusionProof, expectedRoot?: string): boolean {
+    const leafHash = MerkleAccumulator.hashLeaf(VotingChain.voteLeafData(proof.model, proof));
+    if (leafHash !== proof.leafHash) {
+      return false;
+    }
+    return verifyInclusionProof(proof, expectedRoot);
+  }
+
+  private getVoteTree(): MerkleAccumulator {
+    if (!this.voteTree) {
+      this.voteTree = new MerkleAccumulator();
+      this.voteLeaves.clear();
+      for (const block of this.session.chain) {
+        if (block.type === 'vote') {
+          this.addVoteLeaf(block);
+        }
+      }
+    }
+    return this.voteTree;
+  }
+
+  private countVotesBefore(position: number): number {
+    let count = 0;
+    for (let i = 0; i < position; i++) {
+      if (this.session.chain[i]?.type === 'vote') count++;
+    }
+    return count;
+  }
+
+  private addVoteLeaf(block: VotingBlock): void {
+    const leafIndex = this.voteTree!.append(VotingChain.voteLeafData(block.model, block.data as VoteData));
+    this.voteLeaves.set(block.model, { leafIndex, blockIndex: block.index });
+  }
+
   /**
    * Get voting progress statistics
    */
@@ -1,5 +1,7 @@
-/**
- * Chain module exports
- */
-
-export { VotingChain } from './VotingChain.js';
+/**
+ * Chain module exports
+ */
+
+export { VotingChain } from './VotingChain.js';
+export { MerkleAccumulator, verifyInclusionProof, EMPTY_MERKLE_ROOT } from './MerkleAccumulator.js';
+export type { MerkleInclusionProof } from './MerkleAccumulator.js';
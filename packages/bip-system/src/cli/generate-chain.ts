@@ -7,6 +7,7 @@
 import { promises as fs } from 'fs';
 import { join } from 'path';
 import { createHash } from 'crypto';
+import { FileSetHasher } from '../chain/FileSetHasher.js';
 
 interface ChainBlock {
   index: number;
@@ -35,7 +36,11 @@ interface BIPChain {
   chain: ChainBlock[];
 }
 
+// BIPs analyzed at once; file streams are bounded separately by the hasher
+const BIP_CONCURRENCY = 4;
+
 class ChainGenerator {
+  private hasher = new FileSetHasher({ cacheFile: 'gov/.implementation_hash_cache.json' });
 
   /**
    * Calculate deterministic block hash
@@ -67,20 +72,7 @@ class ChainGenerator {
    * Calculate file hash for multiple files
    */
   private async calculateFilesHash(files: string[], bipDir: string): Promise<string> {
-    const fileContents: string[] = [];
-
-    for (const file of files) {
-      try {
-        const content = await fs.readFile(join(bipDir, file), 'utf-8');
-        fileContents.push(content);
-      } catch (error) {
-        console.warn(`Warning: Could not read file ${file}, using placeholder`);
-        fileContents.push(`[FILE_NOT_FOUND: ${file}]`);
-      }
-    }
-
-    const combinedContent = fileContents.join('\n---\n');
-    return createHash('sha256').update(combinedContent, 'utf8').digest('hex');
+    return this.hasher.hashFileSet(files, bipDir);
   }
 
   /**
@@ -406,11 +398,24 @@ class ChainGenerator {
       chains: []
     };
 
-    for (const bipId of bipDirs) {
+    // Analyze BIPs concurrently, then report and append them in directory order
+    const outcomes: Array<Promise<BIPChain>> = new Array(bipDirs.length);
+    let next = 0;
+    const workers = Array.from({ length: Math.min(BIP_CONCURRENCY, bipDirs.length) }, async () => {
+      while (next < bipDirs.length) {
+        const i = next++;
+        outcomes[i] = this.generateBIPChain(bipDirs[i]!);
+        await outcomes[i]!.catch(() => undefined);
+      }
+    });
+    await Promise.all(workers);
+
+    for (let i = 0; i < bipDirs.length; i++) {
+      const bipId = bipDirs[i]!;
       try {
         console.log(`⚙️  Processing ${bipId}...`);
 
-        const chain = await this.generateBIPChain(bipId);
+        const chain = await outcomes[i]!;
         consolidatedBlockchain.chains.push(chain);
 
         console.log(`✅ Added ${bipId} to blockchain:`);
@@ -440,6 +445,12 @@ class ChainGenerator {
       }
     }
 
+    try {
+      await this.hasher.saveCache();
+    } catch (cacheError) {
+      console.log(`⚠️  Could not save file hash cache: ${cacheError}`);
+    }
+
     // Save consolidated blockchain
     try {
       const blockchainFile = 'gov/implementation_blockchain.json';
@@ -0,0 +1,184 @@
+#!/usr/bin/env node
+/**
+ * BIP Vote Inclusion Proof CLI Tool
+ * Emits and verifies O(log n) proofs that a model's vote is committed in a minute
+ */
+
+import { promises as fs } from 'fs';
+import { createHash } from 'crypto';
+import { VotingManager } from '../voting/VotingManager.js';
+import { VotingChain } from '../chain/VotingChain.js';
+import { VoteInclusionProof } from '../types/index.js';
+
+interface CLIOptions {
+  minuteId?: string;
+  model?: string;
+  output?: string;
+  verify?: string;
+  root?: string;
+  voteFile?: string;
+  help?: boolean;
+}
+
+function parseArgs(args: string[]): CLIOptions {
+  const options: CLIOptions = {};
+
+  for (let i = 0; i < args.length; i++) {
+    const arg = args[i];
+
+    switch (arg) {
+      case '--minute':
+      case '-m': {
+        const value = args[++i];
+        if (value !== undefined) options.minuteId = value;
+        break;
+      }
+      case '--model': {
+        const value = args[++i];
+        if (value !== undefined) options.model = value;
+        break;
+      }
+      case '--output':
+      case '-o': {
+        const value = args[++i];
+        if (value !== undefined) options.output = value;
+        break;
+      }
+      case '--verify':
+      case '-v': {
+        const value = args[++i];
+        if (value !== undefined) options.verify = value;
+        break;
+      }
+      case '--root': {
+        const value = args[++i];
+        if (value !== undefined) options.root = value;
+        break;
+      }
+      case '--vote-file': {
+        const value = args[++i];
+        if (value !== undefined) options.voteFile = value;
+        break;
+      }
+      case '--help':
+      case '-h':
+        options.help = true;
+        break;
+    }
+  }
+
+  return options;
+}
+
+function showUsage(): void {
+  console.log(`
+BIP Vote Inclusion Proof Tool
+
+Usage:
+  bip-proof --minute <id> --model <model-id> [--output <file>]
+  bip-proof --verify <proof.json> [--minute <id> | --root <hex>] [--vote-file <file>]
+
+Options:
+  -m, --minute <id>         Voting session minute ID
+      --model <model>       Model whose vote should be proven
+  -o, --output <file>       Write the proof to a file instead of stdout
+  -v, --verify <file>       Verify a proof file
+      --root <hex>          Expected vote Merkle root (e.g. vote_merkle_root from results.json)
+      --vote-file <file>    Also check that this vote file hashes to the proven vote
+  -h, --help                Show this help
+
+Examples:
+  # Emit a proof for one vote
+  bip-proof -m 0003 --model gpt-5 -o gpt-5.proof.json
+
+  # Verify offline against a published root
+  bip-proof -v gpt-5.proof.json --root 9f2c... --vote-file votes/gpt-5.json
+
+  # Verify against the local minute
+  bip-proof -v gpt-5.proof.json -m 0003
+`);
+}
+
+async function emitProof(minuteId: string, model: string, output?: string): Promise<void> {
+  const votingManager = new VotingManager();
+  const proof = await votingManager.getVoteInclusionProof(minuteId, model);
+  const serialized = JSON.stringify(proof, null, 2);
+
+  if (output) {
+    await fs.writeFile(output, serialized + '\n', 'utf-8');
+    console.log(`✅ Proof written to ${output}`);
+    console.log(`   Leaf ${proof.leafIndex + 1}/${proof.treeSize}, ${proof.auditPath.length} sibling hashes`);
+    console.log(`   Root: ${proof.root}`);
+  } else {
+    console.log(serialized);
+  }
+}
+
+async function verifyProof(options: CLIOptions & { verify: string }): Promise<boolean> {
+  const proof = JSON.parse(await fs.readFile(options.verify, 'utf-8')) as VoteInclusionProof;
+  let valid: boolean;
+
+  if (options.minuteId) {
+    valid = await new VotingManager().verifyVoteInclusionProof(options.minuteId, proof);
+  } else {
+    if (!options.root) {
+      console.log('⚠️  No --root or --minute given: only checking the proof against its own root');
+    }
+    valid = VotingChain.verifyVoteInclusionProof(proof, options.root);
+  }
+
+  if (valid && options.voteFile) {
+    const content = await fs.readFile(options.voteFile, 'utf-8');
+    const fileHash = createHash('sha256').update(content, 'utf8').digest('hex');
+    if (fileHash !== proof.voteFileHash) {
+      console.error(`❌ Vote file hash ${fileHash} does not match the proven hash ${proof.voteFileHash}`);
+      return false;
+    }
+  }
+
+  if (valid) {
+    console.log(`✅ Vote by ${proof.model} is included in minute ${proof.minuteId}`);
+    console.log(`   Root: ${proof.root} (${proof.treeSize} votes)`);
+  } else {
+    console.error(`❌ Invalid inclusion proof for ${proof.model} in minute ${proof.minuteId}`);
+  }
+
+  return valid;
+}
+
+async function main(): Promise<void> {
+  try {
+    const args = process.argv.slice(2);
+    const options = parseArgs(args);
+
+    if (options.help || args.length === 0) {
+      showUsage();
+      return;
+    }
+
+    if (options.verify) {
+      const valid = await verifyProof({ ...options, verify: options.verify });
+      process.exit(valid ? 0 : 1);
+    }
+
+    if (!options.minuteId || !options.model) {
+      console.error('❌ Both --minute and --model are required to emit a proof');
+      showUsage();
+      process.exit(1);
+    }
+
+    await emitProof(options.minuteId, options.model, options.output);
+
+  } catch (error) {
+    console.error('❌ Unexpected error:', error instanceof Error ? error.message : String(error));
+    process.exit(1);
+  }
+}
+
+// Run the CLI
+if (import.meta.url === `file://${process.argv[1]}`) {
+  main().catch(error => {
+    console.error('Unexpected error:', error);
+    process.exit(1);
+  });
+}
@@ -7,12 +7,22 @@
 import { VotingManager } from '../voting/VotingManager.js';
 import { VotingAnalyticsService } from '../analytics/VotingAnalytics.js';
 import { NotificationManager } from '../notifications/NotificationManager.js';
+import { TallyEngine } from '../voting/TallyEngine.js';
+import { createSignatureVerifier } from '../voting/SignatureVerifier.js';
+import { promises as fs } from 'fs';
 
 interface CLIOptions {
   minuteId?: string;
   reporter?: string;
   analytics?: boolean;
   force?: boolean;
+  audit?: boolean;
+  count?: boolean;
+  incremental?: boolean;
+  strict?: boolean;
+  concurrency?: number;
+  identities?: string;
+  workers?: number;
   help?: boolean;
 }
 
@@ -43,6 +53,35 @@ function parseArgs(args: string[]): CLIOptions {
       case '-f':
         options.force = true;
         break;
+      case '--audit':
+        options.audit = true;
+        break;
+      case '--count':
+      case '-c':
+        options.count = true;
+        break;
+      case '--incremental':
+      case '-i':
+        options.incremental = true;
+        break;
+      case '--strict':
+        options.strict = true;
+        break;
+      case '--concurrency': {
+        const value = Number(args[++i]);
+        if (Number.isInteger(value) && value > 0) options.concurrency = value;
+        break;
+      }
+      case '--identities': {
+        const value = args[++i];
+        if (value !== undefined) options.identities = value;
+        break;
+      }
+      case '--workers': {
+        const value = Number(args[++i]);
+        if (Number.isInteger(value) && value >= 0) options.workers = value;
+        break;
+      }
       case '--help':
       case '-h':
         options.help = true;
@@ -60,12 +99,22 @@ BIP Vote Tallying Tool
 Usage:
   bip-tally --minute <id> --reporter <model-id>
   bip-tally --minute <id> --analytics
+  bip-tally --minute <id> --count [--incremental] [--strict]
 
 Options:
   -m, --minute <id>         Voting session minute ID
   -r, --reporter <model>    Reporter model ID (for finalization)
   -a, --analytics          Generate analytics report only
   -f, --force              Force finalization even if deadline not reached
+      --audit              Re-verify every chain block, ignoring the checkpoint,
+                           and record the verified checkpoint
+  -c, --count              Count the minute's vote files without finalizing
+  -i, --incremental        Reuse tally_aggregate.json; only re-read changed votes
+      --strict             Leave out votes whose hash differs from voting_chain.json
+      --concurrency <n>    Vote files read at once (default 8)
+      --identities <file>  Model identities JSON; requires valid vote signatures
+      --workers <n>        Worker threads for signature verification (default: one
+                           per spare CPU for batches of 256+ signatures; 0 = inline)
   -h, --help               Show this help
 
 Examples:
@@ -75,6 +124,12 @@ Examples:
   # Generate analytics only
   bip-tally -m 0003 --analytics
 
+  # Recount a minute, re-reading only votes changed since the last count
+  bip-tally -m 0004 --count --incremental
+
+  # Audit the full chain
+  bip-tally -m 0003 --analytics --audit
+
   # Force finalization before deadline
   bip-tally -m 0003 -r gpt-5 --force
 
@@ -82,7 +137,7 @@ Note: Only use --force when all expected votes are received or in emergency situ
 `);
 }
 
-async function showAnalytics(minuteId: string): Promise<void> {
+async function showAnalytics(minuteId: string, audit: boolean = false): Promise<void> {
   const votingManager = new VotingManager();
   const analyticsService = new VotingAnalyticsService();
 
@@ -147,8 +202,8 @@ async function showAnalytics(minuteId: string): Promise<void> {
     });
 
     // Chain integrity
-    const integrity = await votingManager.verifyVotingIntegrity(minuteId);
-    console.log(`\n🔒 Chain Integrity: ${integrity.isValid ? '✅ Valid' : '❌ Invalid'}`);
+    const integrity = await votingManager.verifyVotingIntegrity(minuteId, { fullRescan: audit, saveCheckpoint: audit });
+    console.log(`\n🔒 Chain Integrity: ${integrity.isValid ? '✅ Valid' : '❌ Invalid'} (${integrity.blocksVerified} blocks verified)`);
     if (!integrity.isValid) {
       integrity.errors.forEach(error => console.log(`   ❌ ${error}`));
     }
@@ -158,6 +213,62 @@ async function showAnalytics(minuteId: string): Promise<void> {
   }
 }
 
+async function countVotes(minuteId: string, options: CLIOptions): Promise<void> {
+  const minutesDirectory = 'gov/minutes';
+
+  try {
+    const verifier = options.identities
+      ? createSignatureVerifier(
+          JSON.parse(await fs.readFile(options.identities, 'utf-8'), (key, value) =>
+            key === 'createdAt' || key === 'expiresAt' ? new Date(value) : value),
+          options.workers !== undefined ? { workers: options.workers } : {}
+        )
+      : undefined;
+    const engine = new TallyEngine(minutesDirectory, {
+      ...(options.concurrency !== undefined ? { concurrency: options.concurrency } : {}),
+      ...(verifier ? { verifier } : {})
+    });
+    const expectedHashes = await engine.readChainHashes(minuteId);
+
+    console.log(`🧮 Counting votes for minute ${minuteId}...`);
+    const report = await engine.tally(minuteId, {
+      ...(expectedHashes ? { expectedHashes } : {}),
+      rejectHashMismatches: options.strict ?? false,
+      incremental: options.incremental ?? false
+    });
+
+    console.log(`📊 Votes counted: ${report.votes.length} (read ${report.stats.read}, reused ${report.stats.reused})`);
+
+    const ranking = [...report.proposals].sort((a, b) => b.averageWeight - a.averageWeight);
+    if (ranking.length > 0) {
+      console.log('\n' + 'Proposal'.padEnd(12) + 'Average'.padEnd(10) + 'Total'.padEnd(8) + 'Votes');
+      console.log('─'.repeat(40));
+      ranking.forEach(tally => {
+        console.log(
+          tally.proposalId.padEnd(12) +
+          tally.averageWeight.toFixed(2).padEnd(10) +
+          tally.totalWeight.toString().padEnd(8) +
+          tally.voteCount
+        );
+      });
+    }
+
+    if (report.hashMismatches.length > 0) {
+      console.log(`\n⚠️  ${report.hashMismatches.length} vote file(s) differ from the recorded chain hash:`);
+      report.hashMismatches.forEach(issue => console.log(`   ${issue.file}: ${issue.reason}`));
+    }
+
+    if (report.rejected.length > 0) {
+      console.log(`\n❌ ${report.rejected.length} vote file(s) not counted:`);
+      report.rejected.forEach(issue => console.log(`   ${issue.file}: ${issue.reason}`));
+    }
+
+  } catch (error) {
+    console.error(`❌ Error counting votes: ${error instanceof Error ? error.message : String(error)}`);
+    process.exit(1);
+  }
+}
+
 async function finalizeVoting(minuteId: string, reporter: string, force: boolean = false): Promise<void> {
   const votingManager = new VotingManager();
   const notificationManager = new NotificationManager();
@@ -249,12 +360,14 @@ async function main(): Promise<void> {
       process.exit(1);
     }
 
-    if (options.analytics) {
-      await showAnalytics(options.minuteId);
+    if (options.count) {
+      await countVotes(options.minuteId, options);
+    } else if (options.analytics) {
+      await showAnalytics(options.minuteId, options.audit);
     } else if (options.reporter) {
       await finalizeVoting(options.minuteId, options.reporter, options.force);
     } else {
-      console.error('❌ Please specify --reporter for finalization or --analytics for report generation');
+      console.error('❌ Please specify --reporter for finalization, --analytics for report generation or --count to count votes');
       showUsage();
       process.exit(1);
     }
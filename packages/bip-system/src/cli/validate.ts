@@ -5,11 +5,14 @@
  */
 
 import { BIPManager } from '../proposal/BIPManager.js';
+import { SchemaTreeValidator } from '../validation/SchemaTreeValidator.js';
 
 interface CLIOptions {
   bipNumber?: string;
   file?: string;
   all?: boolean;
+  list?: boolean;
+  schemas?: string[];
   help?: boolean;
 }
 
@@ -36,6 +39,16 @@ function parseArgs(args: string[]): CLIOptions {
       case '-a':
         options.all = true;
         break;
+      case '--list':
+      case '-l':
+        options.list = true;
+        break;
+      case '--schemas':
+      case '-s': {
+        const value = args[++i];
+        if (value !== undefined) (options.schemas ??= []).push(value);
+        break;
+      }
       case '--help':
       case '-h':
         options.help = true;
@@ -54,12 +67,17 @@ Usage:
   bip-validate --bip <number>      Validate specific BIP
   bip-validate --file <path>       Validate BIP from file
   bip-validate --all               Validate all BIPs
+  bip-validate --list              List BIPs without validating
+  bip-validate --schemas <path>    Validate governance JSON against gov/schemas
   bip-validate --help              Show this help
 
 Options:
   -b, --bip <number>    BIP number (e.g., BIP-01)
   -f, --file <path>     Path to BIP markdown file
   -a, --all             Validate all BIPs in repository
+  -l, --list            List number, status and title of every BIP
+  -s, --schemas <path>  JSON file or directory to check against the governance
+                        schemas (repeatable; exits 1 if any file is invalid)
   -h, --help            Show this help
 
 Examples:
@@ -71,6 +89,12 @@ Examples:
 
   # Validate all BIPs
   bip-validate --all
+
+  # List all BIPs
+  bip-validate --list
+
+  # Check every minutes report and metrics file in one run
+  bip-validate --schemas gov/minutes --schemas gov/metrics
 `);
 }
 
@@ -163,6 +187,40 @@ async function validateAllBIPs(bipManager: BIPManager): Promise<void> {
   }
 }
 
+async function listAllBIPs(bipManager: BIPManager): Promise<void> {
+  // Reads only each BIP's title line and metadata footer
+  const bips = await bipManager.listBIPMetadata();
+
+  if (bips.length === 0) {
+    console.log(`ℹ️  No BIPs found in repository`);
+    return;
+  }
+
+  for (const bip of bips) {
+    console.log(`${bip.number.padEnd(8)} ${bip.status.padEnd(16)} ${bip.title}`);
+  }
+  console.log(`\n${bips.length} BIP(s)`);
+}
+
+async function validateSchemaTree(paths: string[]): Promise<boolean> {
+  const report = await new SchemaTreeValidator().validate(paths);
+
+  for (const file of report.files) {
+    if (file.status !== 'invalid') continue;
+    console.log(`❌ ${file.filePath}${file.schema ? ` (${file.schema})` : ''}`);
+    file.errors.forEach(error => {
+      console.log(`   ❌ ${error}`);
+    });
+  }
+
+  console.log(
+    `📈 Schemas: ${report.valid} valid, ${report.invalid} invalid, ${report.skipped} skipped ` +
+    `(${report.files.length} files in ${report.durationMs}ms)`
+  );
+
+  return report.invalid === 0;
+}
+
 async function validateFromFile(filePath: string, bipManager: BIPManager): Promise<void> {
   try {
     const fs = await import('fs/promises');
@@ -205,7 +263,13 @@ async function main(): Promise<void> {
 
     const bipManager = new BIPManager();
 
-    if (options.all) {
+    if (options.schemas) {
+      if (!(await validateSchemaTree(options.schemas))) {
+        process.exit(1);
+      }
+    } else if (options.list) {
+      await listAllBIPs(bipManager);
+    } else if (options.all) {
       await validateAllBIPs(bipManager);
     } else if (options.bipNumber) {
       await validateBIP(options.bipNumber, bipManager);
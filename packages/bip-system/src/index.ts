@@ -5,13 +5,21 @@
 
 // Core classes
 export { VotingChain } from './chain/VotingChain.js';
+export { MerkleAccumulator, verifyInclusionProof } from './chain/MerkleAccumulator.js';
 export { VotingManager } from './voting/VotingManager.js';
+export { VotingSessionStore } from './voting/SessionStore.js';
+export { SessionIndex } from './voting/SessionIndex.js';
+export { TallyEngine, toProposalResults } from './voting/TallyEngine.js';
+export { createSignatureVerifier, signVote } from './voting/SignatureVerifier.js';
 export { BIPManager } from './proposal/BIPManager.js';
+export { BIPMetadataCache } from './proposal/BIPMetadataCache.js';
+export { SchemaTreeValidator } from './validation/SchemaTreeValidator.js';
 export { VotingAnalyticsService } from './analytics/VotingAnalytics.js';
 export { NotificationManager } from './notifications/NotificationManager.js';
 
 // Types
 export * from './types/index.js';
+export type { SchemaFileResult, SchemaTreeReport, SchemaTreeValidatorOptions } from './validation/index.js';
 
 // Convenience exports for common workflows
 export { createBIPWorkflow, createVotingWorkflow, analyzeVotingWorkflow } from './workflows/index.js';
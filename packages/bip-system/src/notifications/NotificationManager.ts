@@ -6,12 +6,15 @@
 import { promises as fs } from 'fs';
 import { join } from 'path';
 import { NotificationEvent, NotificationType, VotingSession } from '../types/index.js';
+import { SessionIndex } from '../voting/SessionIndex.js';
 
 export class NotificationManager {
   private notificationsDirectory: string;
+  private sessionIndex: SessionIndex;
 
   constructor(notificationsDirectory: string = 'gov/minutes') {
     this.notificationsDirectory = notificationsDirectory;
+    this.sessionIndex = new SessionIndex(notificationsDirectory);
   }
 
   /**
@@ -172,6 +175,7 @@ export class NotificationManager {
 
     const scheduleFile = join(this.notificationsDirectory, session.minuteId, 'reminder_schedule.json');
     await fs.writeFile(scheduleFile, JSON.stringify(reminderSchedule, null, 2), 'utf-8');
+    await this.sessionIndex.recordReminders(session.minuteId, this.earliest(reminderSchedule.map(reminder => reminder.scheduledFor)));
   }
 
   /**
@@ -184,8 +188,12 @@ export class NotificationManager {
     const pendingReminders: { minuteId: string; hoursRemaining: number }[] = [];
 
     try {
-      const entries = await fs.readdir(this.notificationsDirectory, { withFileTypes: true });
-      const minuteDirs = entries.filter(entry => entry.isDirectory()).map(entry => entry.name);
+      // Only minutes whose earliest reminder is due need their schedule read
+      const now = new Date();
+      const entries = await this.sessionIndex.entries();
+      const minuteDirs = entries
+        .filter(entry => entry.nextReminderAt !== null && new Date(entry.nextReminderAt) <= now)
+        .map(entry => entry.minuteId);
 
       for (const minuteDir of minuteDirs) {
         const scheduleFile = join(this.notificationsDirectory, minuteDir, 'reminder_schedule.json');
@@ -193,7 +201,6 @@ export class NotificationManager {
         try {
           const scheduleContent = await fs.readFile(scheduleFile, 'utf-8');
           const schedule = JSON.parse(scheduleContent);
-          const now = new Date();
 
           const dueReminders = schedule.filter((reminder: any) => {
             const scheduledTime = new Date(reminder.scheduledFor);
@@ -214,6 +221,7 @@ export class NotificationManager {
           });
 
           await fs.writeFile(scheduleFile, JSON.stringify(remainingSchedule, null, 2), 'utf-8');
+          await this.sessionIndex.recordReminders(minuteDir, this.earliest(remainingSchedule.map((reminder: any) => reminder.scheduledFor)));
 
         } catch (error) {
           // Skip if no schedule file or invalid format
@@ -253,8 +261,11 @@ export class NotificationManager {
     let cleanedCount = 0;
 
     try {
-      const entries = await fs.readdir(this.notificationsDirectory, { withFileTypes: true });
-      const minuteDirs = entries.filter(entry => entry.isDirectory()).map(entry => entry.name);
+      // Only minutes holding notifications older than the cutoff are touched
+      const entries = await this.sessionIndex.entries();
+      const minuteDirs = entries
+        .filter(entry => entry.oldestNotificationAt !== null && new Date(entry.oldestNotificationAt) < cutoffDate)
+        .map(entry => entry.minuteId);
 
       for (const minuteDir of minuteDirs) {
         const notificationsFile = join(this.notificationsDirectory, minuteDir, 'notifications.json');
@@ -276,6 +287,7 @@ export class NotificationManager {
           } else {
             await fs.writeFile(notificationsFile, JSON.stringify(data, null, 2), 'utf-8');
           }
+          await this.sessionIndex.recordNotifications(minuteDir, this.earliest(data.notifications.map((notif: any) => notif.timestamp)));
         } catch (error) {
           // Skip if file doesn't exist or invalid format
         }
@@ -324,6 +336,21 @@ export class NotificationManager {
     };
 
     await fs.writeFile(notificationsFile, JSON.stringify(data, null, 2), 'utf-8');
+    await this.sessionIndex.recordNotifications(notification.minuteId, this.earliest(notifications.map(notif => notif.timestamp)));
+  }
+
+  /**
+   * Earliest of a list of timestamps, or null if there are none
+   */
+  private earliest(timestamps: Array<Date | string>): Date | null {
+    let earliest: Date | null = null;
+    for (const timestamp of timestamps) {
+      const date = new Date(timestamp);
+      if (!Number.isNaN(date.getTime()) && (earliest === null || date < earliest)) {
+        earliest = date;
+      }
+    }
+    return earliest;
   }
 
   /**
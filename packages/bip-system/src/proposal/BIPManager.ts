@@ -5,37 +5,35 @@
 import { promises as fs } from 'fs';
 import { join, dirname } from 'path';
 import { BIPProposal, BIPType, BIPCategory, BIPStatus, BIPChangelogEntry } from '../types/index.js';
+import { BIPMetadataCache, BIPMetadata, parseBIPFooter } from './BIPMetadataCache.js';
+import { formatSchemaErrors, validateSchema } from '@cmmv-hive/shared-types';
 
 export class BIPManager {
   private bipsDirectory: string;
+  private metadataCache: BIPMetadataCache;
 
-  constructor(bipsDirectory: string = 'gov/bips') {
+  constructor(bipsDirectory: string = 'gov/bips', metadataCache?: BIPMetadataCache) {
     this.bipsDirectory = bipsDirectory;
+    this.metadataCache = metadataCache ?? BIPMetadataCache.forDirectory(bipsDirectory);
   }
 
   /**
    * Generate the next available BIP number
    */
   async getNextBIPNumber(): Promise<string> {
-    try {
-      const entries = await fs.readdir(this.bipsDirectory, { withFileTypes: true });
-      const bipDirs = entries
-        .filter(entry => entry.isDirectory() && entry.name.startsWith('BIP-'))
-        .map(entry => entry.name)
-        .map(name => {
-          const match = name.match(/BIP-(\d+)/);
-          return match && match[1] ? parseInt(match[1], 10) : 0;
-        })
-        .filter(num => num > 0);
-
-      const maxNumber = bipDirs.length > 0 ? Math.max(...bipDirs) : 0;
-      const nextNumber = maxNumber + 1;
-
-      return `BIP-${nextNumber.toString().padStart(2, '0')}`;
-    } catch (error) {
-      // If directory doesn't exist or is empty, start with BIP-01
-      return 'BIP-01';
-    }
+    // Directory names alone decide the number; no BIP file is opened.
+    // A missing or empty directory starts with BIP-01.
+    const bipDirs = (await this.metadataCache.bipNumbers())
+      .map(name => {
+        const match = name.match(/BIP-(\d+)/);
+        return match && match[1] ? parseInt(match[1], 10) : 0;
+      })
+      .filter(num => num > 0);
+
+    const maxNumber = bipDirs.length > 0 ? Math.max(...bipDirs) : 0;
+    const nextNumber = maxNumber + 1;
+
+    return `BIP-${nextNumber.toString().padStart(2, '0')}`;
   }
 
   /**
@@ -82,9 +80,14 @@ export class BIPManager {
    * Load a BIP proposal from file
    */
   async loadBIP(number: string): Promise<BIPProposal> {
-    const filePath = join(this.bipsDirectory, number, `${number}.md`);
-    const content = await fs.readFile(filePath, 'utf-8');
-    return this.parseBIPFromMarkdown(content);
+    return this.metadataCache.getProposal(number, content => this.parseBIPFromMarkdown(content));
+  }
+
+  /**
+   * Load only a BIP's listing metadata (title line and metadata footer)
+   */
+  async loadBIPMetadata(number: string): Promise<BIPMetadata> {
+    return this.metadataCache.get(number);
   }
 
   /**
@@ -97,6 +100,7 @@ export class BIPManager {
     const markdown = this.generateBIPMarkdown(proposal);
     const filePath = join(bipDir, `${proposal.number}.md`);
     await fs.writeFile(filePath, markdown, 'utf-8');
+    this.metadataCache.invalidate(proposal.number);
   }
 
   /**
@@ -122,6 +126,14 @@ export class BIPManager {
     return proposal;
   }
 
+  /**
+   * Validate structured proposal data (JSON) against gov/schemas/proposal.schema.json
+   */
+  validateProposalData(data: unknown): { isValid: boolean; errors: string[] } {
+    const result = validateSchema('proposal', data);
+    return { isValid: result.valid, errors: formatSchemaErrors(result.errors) };
+  }
+
   /**
    * Validate BIP structure and content
    */
@@ -251,11 +263,7 @@ export class BIPManager {
     const lines = content.split('\n');
 
     // Extract metadata from the bottom
-    const statusMatch = content.match(/\*\*([^*]+) Status\*\*: (.+)/);
-    const createdMatch = content.match(/\*\*Created\*\*: (.+)/);
-    const authorMatch = content.match(/\*\*Author\*\*: (.+)/);
-    const typeMatch = content.match(/\*\*Type\*\*: (.+)/);
-    const categoryMatch = content.match(/\*\*Category\*\*: (.+)/);
+    const footer = parseBIPFooter(content);
 
     // Extract title and number from first line
     const titleMatch = lines[0]?.match(/^# (BIP-\d+): (.+)$/);
@@ -295,11 +303,7 @@ export class BIPManager {
     return {
       number,
       title,
-      author: authorMatch?.[1] || '',
-      type: (typeMatch?.[1] as BIPType) || 'Standards Track',
-      category: (categoryMatch?.[1] as BIPCategory) || 'Core',
-      status: (statusMatch?.[2] as BIPStatus) || 'Draft',
-      created: createdMatch && createdMatch[1] ? new Date(createdMatch[1]) : new Date(),
+      ...footer,
       abstract,
       motivation,
       specification,
@@ -322,28 +326,16 @@ export class BIPManager {
   }
 
   /**
-   * List all BIPs
+   * List all BIPs, fully parsed
    */
   async listBIPs(): Promise<BIPProposal[]> {
-    try {
-      const entries = await fs.readdir(this.bipsDirectory, { withFileTypes: true });
-      const bipDirs = entries
-        .filter(entry => entry.isDirectory() && entry.name.startsWith('BIP-'))
-        .map(entry => entry.name);
-
-      const bips: BIPProposal[] = [];
-      for (const bipDir of bipDirs) {
-        try {
-          const bip = await this.loadBIP(bipDir);
-          bips.push(bip);
-        } catch (error) {
-          console.warn(`Failed to load BIP ${bipDir}: ${error}`);
-        }
-      }
+    return this.metadataCache.listProposals(content => this.parseBIPFromMarkdown(content));
+  }
 
-      return bips.sort((a, b) => a.number.localeCompare(b.number));
-    } catch (error) {
-      return [];
-    }
+  /**
+   * List metadata of all BIPs without parsing their bodies
+   */
+  async listBIPMetadata(): Promise<BIPMetadata[]> {
+    return this.metadataCache.list();
   }
 }
@@ -0,0 +1,347 @@
+/**
+ * BIPMetadataCache - Shared, mtime-validated cache of BIP listing metadata
+ * Listing reads only the title line and the trailing metadata block of each
+ * BIP markdown file, loads files in parallel with a concurrency cap, and
+ * keeps results until the file's mtime or size changes. Full proposals are
+ * parsed on demand and cached under the same validation.
+ */
+
+import { promises as fs } from 'fs';
+import type { FileHandle } from 'fs/promises';
+import { join, resolve } from 'path';
+import { BIPProposal, BIPType, BIPCategory, BIPStatus } from '../types/index.js';
+
+export interface BIPMetadata {
+  number: string;
+  title: string;
+  author: string;
+  type: BIPType;
+  category: BIPCategory;
+  status: BIPStatus;
+  created: Date;
+  filePath: string;
+  mtimeMs: number;
+  size: number;
+}
+
+export interface BIPMetadataCacheOptions {
+  concurrency?: number; // max BIP files read at once (default 16)
+  headBytes?: number; // bytes read from the start for the title line (default 1024)
+  tailBytes?: number; // bytes read from the end for the metadata block (default 4096)
+}
+
+interface CacheEntry {
+  mtimeMs: number;
+  size: number;
+  metadata: BIPMetadata;
+  proposal?: BIPProposal;
+}
+
+type ProposalParser = (content: string) => BIPProposal;
+
+const TITLE_PATTERN = /^# (BIP-\d+): (.+)$/;
+
+const FOOTER_PATTERNS = {
+  status: /\*\*[^*]+ Status\*\*: (.+)/g,
+  created: /\*\*Created\*\*: (.+)/g,
+  author: /\*\*Author\*\*: (.+)/g,
+  type: /\*\*Type\*\*: (.+)/g,
+  category: /\*\*Category\*\*: (.+)/g
+};
+
+type BIPFooterField = keyof typeof FOOTER_PATTERNS;
+
+export interface BIPFooter {
+  author: string;
+  type: BIPType;
+  category: BIPCategory;
+  status: BIPStatus;
+  created: Date;
+}
+
+/**
+ * Raw metadata footer values found in the text. The last occurrence of each
+ * field wins: the footer closes the file, and a body may describe the same
+ * fields (as BIP-01 does).
+ */
+function matchFooterFields(text: string): Partial<Record<BIPFooterField, string>> {
+  const fields: Partial<Record<BIPFooterField, string>> = {};
+  for (const [field, pattern] of Object.entries(FOOTER_PATTERNS) as Array<[BIPFooterField, RegExp]>) {
+    let value: string | undefined;
+    for (const match of text.matchAll(pattern)) {
+      value = match[1];
+    }
+    if (value !== undefined) {
+      fields[field] = value;
+    }
+  }
+  return fields;
+}
+
+/**
+ * Metadata footer of a BIP with the defaults for missing fields; shared by
+ * the header-only listing and BIPManager's full markdown parser
+ */
+export function parseBIPFooter(text: string): BIPFooter {
+  const fields = matchFooterFields(text);
+  return {
+    author: fields.author || '',
+    type: (fields.type as BIPType) || 'Standards Track',
+    category: (fields.category as BIPCategory) || 'Core',
+    status: (fields.status as BIPStatus) || 'Draft',
+    created: fields.created ? new Date(fields.created) : new Date()
+  };
+}
+
+export class BIPMetadataCache {
+  private static registry = new Map<string, BIPMetadataCache>();
+
+  private bipsDirectory: string;
+  private concurrency: number;
+  private headBytes: number;
+  private tailBytes: number;
+  private entries = new Map<string, CacheEntry>();
+
+  constructor(bipsDirectory: string, options: BIPMetadataCacheOptions = {}) {
+    this.bipsDirectory = bipsDirectory;
+    this.concurrency = Math.max(1, options.concurrency ?? 16);
+    this.headBytes = Math.max(64, options.headBytes ?? 1024);
+    this.tailBytes = Math.max(256, options.tailBytes ?? 4096);
+  }
+
+  /**
+   * Cache shared by every BIPManager working on the same directory
+   */
+  static forDirectory(bipsDirectory: string): BIPMetadataCache {
+    const key = resolve(bipsDirectory);
+    let cache = BIPMetadataCache.registry.get(key);
+    if (!cache) {
+      cache = new BIPMetadataCache(bipsDirectory);
+      BIPMetadataCache.registry.set(key, cache);
+    }
+    return cache;
+  }
+
+  /**
+   * BIP directory names (BIP-XX), unsorted; empty when the directory is missing
+   */
+  async bipNumbers(): Promise<string[]> {
+    try {
+      const entries = await fs.readdir(this.bipsDirectory, { withFileTypes: true });
+      return entries
+        .filter(entry => entry.isDirectory() && entry.name.startsWith('BIP-'))
+        .map(entry => entry.name);
+    } catch {
+      return [];
+    }
+  }
+
+  /**
+   * Metadata of every BIP, sorted by number. BIPs that fail to load are
+   * reported and skipped.
+   */
+  async list(): Promise<BIPMetadata[]> {
+    const numbers = await this.bipNumbers();
+    this.forgetMissing(numbers);
+
+    const results = await this.mapLimit(numbers, async number => {
+      try {
+        return await this.get(number);
+      } catch (error) {
+        console.warn(`Failed to load BIP ${number}: ${error}`);
+        return null;
+      }
+    });
+
+    return results
+      .filter((metadata): metadata is BIPMetadata => metadata !== null)
+      .sort((a, b) => a.number.localeCompare(b.number));
+  }
+
+  /**
+   * Metadata of a single BIP, re-read only when the file changed
+   */
+  async get(number: string): Promise<BIPMetadata> {
+    const filePath = this.filePathOf(number);
+    const stat = await fs.stat(filePath);
+    const cached = this.entries.get(number);
+
+    if (cached && cached.mtimeMs === stat.mtimeMs && cached.size === stat.size) {
+      return { ...cached.metadata };
+    }
+
+    const metadata = await this.readMetadata(number, filePath);
+    this.entries.set(number, { mtimeMs: metadata.mtimeMs, size: metadata.size, metadata });
+    return { ...metadata };
+  }
+
+  /**
+   * Fully parsed proposal, parsed at most once per file version. Callers
+   * receive a copy they are free to mutate.
+   */
+  async getProposal(number: string, parse: ProposalParser): Promise<BIPProposal> {
+    const filePath = this.filePathOf(number);
+    const stat = await fs.stat(filePath);
+    let entry = this.entries.get(number);
+
+    if (!entry || entry.mtimeMs !== stat.mtimeMs || entry.size !== stat.size || !entry.proposal) {
+      const content = await fs.readFile(filePath, 'utf-8');
+      const proposal = parse(content);
+      entry = {
+        mtimeMs: stat.mtimeMs,
+        size: stat.size,
+        metadata: this.metadataFromProposal(proposal, filePath, stat.mtimeMs, stat.size),
+        proposal
+      };
+      this.entries.set(number, entry);
+    }
+
+    return structuredClone(entry.proposal!);
+  }
+
+  /**
+   * Fully parsed proposals for every BIP, sorted by number
+   */
+  async listProposals(parse: ProposalParser): Promise<BIPProposal[]> {
+    const numbers = await this.bipNumbers();
+    this.forgetMissing(numbers);
+
+    const results = await this.mapLimit(numbers, async number => {
+      try {
+        return await this.getProposal(number, parse);
+      } catch (error) {
+        console.warn(`Failed to load BIP ${number}: ${error}`);
+        return null;
+      }
+    });
+
+    return results
+      .filter((proposal): proposal is BIPProposal => proposal !== null)
+      .sort((a, b) => a.number.localeCompare(b.number));
+  }
+
+  /**
+   * Drop one BIP (or everything) so the next read goes to disk
+   */
+  invalidate(number?: string): void {
+    if (number === undefined) {
+      this.entries.clear();
+    } else {
+      this.entries.delete(number);
+    }
+  }
+
+  /**
+   * Read the title line and trailing metadata block; fall back to the whole
+   * file when either does not fit in its window. With every footer field in
+   * the tail, its last occurrences there are the file's last occurrences.
+   */
+  private async readMetadata(number: string, filePath: string): Promise<BIPMetadata> {
+    const handle = await fs.open(filePath, 'r');
+    try {
+      const stat = await handle.stat();
+      let head: string;
+      let tail: string;
+
+      if (stat.size <= this.headBytes + this.tailBytes) {
+        head = tail = await this.readRange(handle, 0, stat.size);
+      } else {
+        head = await this.readRange(handle, 0, this.headBytes);
+        tail = await this.readRange(handle, stat.size - this.tailBytes, this.tailBytes);
+        const complete = Object.keys(matchFooterFields(tail)).length === Object.keys(FOOTER_PATTERNS).length;
+        if (!head.includes('\n') || !complete) {
+          head = tail = await this.readRange(handle, 0, stat.size);
+        }
+      }
+
+      return this.parseMetadata(number, head, tail, filePath, stat.mtimeMs, stat.size);
+    } finally {
+      await handle.close();
+    }
+  }
+
+  private async readRange(handle: FileHandle, position: number, length: number): Promise<string> {
+    const buffer = Buffer.alloc(length);
+    const { bytesRead } = await handle.read(buffer, 0, length, position);
+    return buffer.toString('utf-8', 0, bytesRead);
+  }
+
+  /**
+   * Same rules as BIPManager's markdown parser (parseBIPFooter), applied
+   * to the first line and the metadata footer only
+   */
+  private parseMetadata(
+    number: string,
+    head: string,
+    tail: string,
+    filePath: string,
+    mtimeMs: number,
+    size: number
+  ): BIPMetadata {
+    const firstLine = head.split('\n', 1)[0];
+    const titleMatch = firstLine?.match(TITLE_PATTERN);
+    if (!titleMatch) {
+      throw new Error(`Invalid BIP format: missing title in ${number}`);
+    }
+
+    return {
+      number: titleMatch[1] || '',
+      title: titleMatch[2] || '',
+      ...parseBIPFooter(tail),
+      filePath,
+      mtimeMs,
+      size
+    };
+  }
+
+  private metadataFromProposal(
+    proposal: BIPProposal,
+    filePath: string,
+    mtimeMs: number,
+    size: number
+  ): BIPMetadata {
+    return {
+      number: proposal.number,
+      title: proposal.title,
+      author: proposal.author,
+      type: proposal.type,
+      category: proposal.category,
+      status: proposal.status,
+      created: proposal.created,
+      filePath,
+      mtimeMs,
+      size
+    };
+  }
+
+  private filePathOf(number: string): string {
+    return join(this.bipsDirectory, number, `${number}.md`);
+  }
+
+  private forgetMissing(numbers: string[]): void {
+    const present = new Set(numbers);
+    for (const number of this.entries.keys()) {
+      if (!present.has(number)) {
+        this.entries.delete(number);
+      }
+    }
+  }
+
+  /**
+   * Map with at most `concurrency` calls in flight, preserving input order
+   */
+  private async mapLimit<T, R>(items: T[], fn: (item: T) => Promise<R>): Promise<R[]> {
+    const results: R[] = new Array(items.length);
+    let next = 0;
+
+    const workers = Array.from({ length: Math.min(this.concurrency, items.length) }, async () => {
+      while (next < items.length) {
+        const i = next++;
+        results[i] = await fn(items[i]!);
+      }
+    });
+
+    await Promise.all(workers);
+    return results;
+  }
+}
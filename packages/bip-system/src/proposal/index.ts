@@ -3,3 +3,5 @@
  */
 
 export { BIPManager } from './BIPManager.js';
+export { BIPMetadataCache } from './BIPMetadataCache.js';
+export type { BIPMetadata, BIPMetadataCacheOptions } from './BIPMetadataCache.js';
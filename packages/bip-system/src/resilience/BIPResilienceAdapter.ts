@@ -20,8 +20,11 @@ import {
   AITask,
   AIResponse,
   FallbackStrategy,
+  Tracer,
+  SPAN_NAMES,
   type ResilienceFrameworkConfig
 } from '@cmmv-hive/resilience-framework';
+import { OperationCoalescer, type OperationCoalescerStats } from './OperationCoalescer.js';
 
 /**
  * BIP operation types that need resilience
@@ -52,6 +55,11 @@ export interface BIPResilienceConfig extends ResilienceFrameworkConfig {
     readonly consensusThreshold: number;
     readonly emergencyMode: boolean;
   };
+  readonly operationCache?: {
+    readonly enabled: boolean;
+    readonly ttlMs: number;
+    readonly maxEntries: number;
+  };
 }
 
 /**
@@ -65,6 +73,7 @@ export interface ResilientBIPOperation {
   readonly priority: 'low' | 'medium' | 'high' | 'critical';
   readonly requiresConsensus: boolean;
   readonly timeout: number;
+  readonly idempotent?: boolean; // read-only; safe to coalesce and cache
 }
 
 /**
@@ -83,6 +92,11 @@ export interface BIPOperationResult {
   readonly error?: Error;
 }
 
+/**
+ * Consensus result with the individual model responses
+ */
+export type BIPConsensusResult = BIPOperationResult & { consensus: boolean; responses: AIResponse[] };
+
 /**
  * Adapter class that integrates resilience framework with BIP system
  */
@@ -97,6 +111,9 @@ export class BIPResilienceAdapter {
   private readonly degradationController: DegradationController;
   private readonly config: BIPResilienceConfig;
   private readonly registeredModels: Map<string, ModelIdentity> = new Map();
+  private readonly operationCoalescer: OperationCoalescer<BIPOperationResult>;
+  private readonly consensusCoalescer: OperationCoalescer<BIPConsensusResult>;
+  private readonly tracer = Tracer.shared();
 
   constructor(config: BIPResilienceConfig) {
     this.config = config;
@@ -110,6 +127,10 @@ export class BIPResilienceAdapter {
     this.autoRecovery = new AutoRecovery();
     this.loadBalancer = new LoadBalancer();
     this.degradationController = new DegradationController();
+
+    const cacheOptions = config.operationCache?.enabled ? config.operationCache : null;
+    this.operationCoalescer = new OperationCoalescer(cacheOptions);
+    this.consensusCoalescer = new OperationCoalescer(cacheOptions);
   }
 
   /**
@@ -127,9 +148,46 @@ export class BIPResilienceAdapter {
   }
 
   /**
-   * Execute BIP operation with full resilience protection
+   * Execute BIP operation with full resilience protection.
+   * Identical idempotent operations in flight share one execution; critical
+   * operations always run their own, so a degraded-mode rejection of a
+   * lower-priority leader never reaches them.
    */
   async executeBIPOperation(operation: ResilientBIPOperation): Promise<BIPOperationResult> {
+    const component = `bip.${operation.operationType}`;
+
+    return this.tracer.withSpan(SPAN_NAMES.bipOperation, async span => {
+      let result: BIPOperationResult;
+
+      if (!operation.idempotent || operation.priority === 'critical') {
+        result = await this.runBIPOperation(operation);
+      } else {
+        const enqueuedAt = this.tracer.now();
+        let led = false;
+
+        result = await this.operationCoalescer.execute(
+          this.operationKey(operation),
+          () => {
+            led = true;
+            return this.runBIPOperation(operation);
+          },
+          { cacheable: true, isSuccess: outcome => outcome.success }
+        );
+
+        // Followers spend their whole wait queued behind the leader's run
+        if (!led) {
+          this.tracer.recordSpan(SPAN_NAMES.queue, enqueuedAt, this.tracer.now(), { 'queue.reason': 'coalesced' });
+        }
+      }
+
+      if (!result.success) {
+        span.setStatus('error', result.error?.message ?? 'BIP operation failed');
+      }
+      return result;
+    }, { component, 'bip.operation': operation.operationType, 'bip.priority': operation.priority });
+  }
+
+  private async runBIPOperation(operation: ResilientBIPOperation): Promise<BIPOperationResult> {
     const startTime = Date.now();
     let fallbackUsed = false;
     const recoveryActions: string[] = [];
@@ -155,7 +213,7 @@ export class BIPResilienceAdapter {
           }
 
           // Execute through circuit breaker
-          return await circuitBreaker.execute(async () => {
+          return await this.tracer.traceBreakerCall(circuitBreaker, selectedModel.id, async () => {
             const response = await this.executeModelTask(selectedModel, operation.task);
 
             // Record success metrics
@@ -230,7 +288,22 @@ export class BIPResilienceAdapter {
   async executeBIPConsensus(
     operation: ResilientBIPOperation,
     requiredAgreement: number = 0.7
-  ): Promise<BIPOperationResult & { consensus: boolean; responses: AIResponse[] }> {
+  ): Promise<BIPConsensusResult> {
+    if (!operation.idempotent || operation.priority === 'critical') {
+      return this.runBIPConsensus(operation, requiredAgreement);
+    }
+
+    return this.consensusCoalescer.execute(
+      `${this.operationKey(operation)}:${requiredAgreement}`,
+      () => this.runBIPConsensus(operation, requiredAgreement),
+      { cacheable: true, isSuccess: result => result.success && result.consensus }
+    );
+  }
+
+  private async runBIPConsensus(
+    operation: ResilientBIPOperation,
+    requiredAgreement: number
+  ): Promise<BIPConsensusResult> {
     const availableModels = await this.getHealthyModels();
     const minModels = this.config.governanceSettings.minimumActiveModels;
 
@@ -243,7 +316,8 @@ export class BIPResilienceAdapter {
     const results = await Promise.allSettled(
       availableModels.slice(0, 5).map(async (model) => {
         const modelOperation = { ...operation, modelId: model.id };
-        const result = await this.executeBIPOperation(modelOperation);
+        // Each model must answer on its own, so bypass coalescing here
+        const result = await this.runBIPOperation(modelOperation);
         if (result.success && result.response) {
           responses.push(result.response);
         }
@@ -290,6 +364,7 @@ export class BIPResilienceAdapter {
     averageResponseTime: number;
     successRate: number;
     readyForOperations: boolean;
+    operationCache: OperationCoalescerStats;
   }> {
     const healthyModels = await this.getHealthyModels();
     const systemMetrics = this.metricsCollector.getSystemMetrics();
@@ -307,7 +382,8 @@ export class BIPResilienceAdapter {
       openCircuitBreakers: systemMetrics.circuitBreakersOpen,
       averageResponseTime: systemMetrics.averageResponseTime,
       successRate: systemMetrics.successfulRequests / systemMetrics.totalRequests,
-      readyForOperations: systemHealth !== 'critical'
+      readyForOperations: systemHealth !== 'critical',
+      operationCache: this.getOperationCacheStats()
     };
   }
 
@@ -329,7 +405,7 @@ export class BIPResilienceAdapter {
     await this.degradationController.temporaryOverride('emergency_mode');
 
     try {
-      return await this.executeBIPOperation(originalOperation);
+      return await this.runBIPOperation(originalOperation);
     } finally {
       // Restore normal degradation state
       await this.degradationController.clearOverride();
@@ -377,10 +453,44 @@ export class BIPResilienceAdapter {
     console.log('🛡️ BIP Resilience monitoring stopped');
   }
 
+  /**
+   * Drop cached results, for all BIPs or just one
+   */
+  invalidateOperationCache(bipId?: string): void {
+    const prefix = bipId === undefined ? undefined : `${bipId}:`;
+    this.operationCoalescer.invalidate(prefix);
+    this.consensusCoalescer.invalidate(prefix);
+  }
+
   /**
    * Private helper methods
    */
 
+  private operationKey(operation: ResilientBIPOperation): string {
+    // The task id differs per call, so only type and payload identify the
+    // work; priority and model decide how it may run, so they are part of it
+    return OperationCoalescer.keyFor(`${operation.bipId}:${operation.operationType}`, {
+      type: operation.task.type,
+      payload: operation.task.payload,
+      priority: operation.priority,
+      modelId: operation.modelId
+    });
+  }
+
+  private getOperationCacheStats(): OperationCoalescerStats {
+    const single = this.operationCoalescer.getStats();
+    const consensus = this.consensusCoalescer.getStats();
+
+    return {
+      hits: single.hits + consensus.hits,
+      misses: single.misses + consensus.misses,
+      coalesced: single.coalesced + consensus.coalesced,
+      evictions: single.evictions + consensus.evictions,
+      inFlight: single.inFlight + consensus.inFlight,
+      cachedEntries: single.cachedEntries + consensus.cachedEntries
+    };
+  }
+
   private async selectOptimalModel(operation: ResilientBIPOperation): Promise<ModelIdentity> {
     // Use load balancer to select best model
     const decision = await this.loadBalancer.selectModel({
@@ -0,0 +1,161 @@
+/**
+ * OperationCoalescer - Single-flight execution and result caching
+ * Concurrent calls with the same key share one in-flight promise, and
+ * successful results of idempotent operations can be kept in a TTL/LRU
+ * cache so repeated reads of the same proposal skip the resilience stack.
+ */
+
+import { createHash } from 'crypto';
+
+export interface OperationCacheOptions {
+  ttlMs: number; // how long a cached result stays valid
+  maxEntries: number; // least recently used entries are evicted beyond this
+}
+
+export interface OperationCoalescerStats {
+  hits: number; // served from the result cache
+  misses: number; // executed (cache enabled but no valid entry)
+  coalesced: number; // joined an identical in-flight operation
+  evictions: number;
+  inFlight: number;
+  cachedEntries: number;
+}
+
+interface CacheEntry<T> {
+  value: T;
+  expiresAt: number;
+}
+
+export class OperationCoalescer<T> {
+  private inFlight: Map<string, Promise<T>> = new Map();
+  private cache: Map<string, CacheEntry<T>> = new Map();
+  private cacheOptions: OperationCacheOptions | null;
+  private stats = { hits: 0, misses: 0, coalesced: 0, evictions: 0 };
+
+  constructor(cacheOptions: OperationCacheOptions | null = null) {
+    this.cacheOptions = cacheOptions && cacheOptions.maxEntries > 0 && cacheOptions.ttlMs > 0
+      ? cacheOptions
+      : null;
+  }
+
+  /**
+   * Build a key from an operation name and a hash of its payload
+   */
+  static keyFor(operation: string, payload: unknown): string {
+    const hash = createHash('sha256').update(stableStringify(payload), 'utf8').digest('hex');
+    return `${operation}:${hash}`;
+  }
+
+  /**
+   * Run `fn` once per key at a time. With `cacheable`, a successful result
+   * is cached; `isSuccess` decides which results are worth keeping.
+   */
+  async execute(
+    key: string,
+    fn: () => Promise<T>,
+    options: { cacheable?: boolean; isSuccess?: (value: T) => boolean } = {}
+  ): Promise<T> {
+    const cacheable = options.cacheable === true && this.cacheOptions !== null;
+
+    if (cacheable) {
+      const cached = this.getCached(key);
+      if (cached !== undefined) {
+        this.stats.hits++;
+        return cached.value;
+      }
+    }
+
+    const pending = this.inFlight.get(key);
+    if (pending) {
+      this.stats.coalesced++;
+      return pending;
+    }
+
+    if (cacheable) {
+      this.stats.misses++;
+    }
+
+    const run = (async () => {
+      try {
+        const value = await fn();
+        if (cacheable && (options.isSuccess?.(value) ?? true)) {
+          this.store(key, value);
+        }
+        return value;
+      } finally {
+        this.inFlight.delete(key);
+      }
+    })();
+
+    this.inFlight.set(key, run);
+    return run;
+  }
+
+  /**
+   * Drop cached results, for all keys or those starting with a prefix
+   */
+  invalidate(prefix?: string): void {
+    if (prefix === undefined) {
+      this.cache.clear();
+      return;
+    }
+
+    for (const key of this.cache.keys()) {
+      if (key.startsWith(prefix)) {
+        this.cache.delete(key);
+      }
+    }
+  }
+
+  getStats(): OperationCoalescerStats {
+    return {
+      ...this.stats,
+      inFlight: this.inFlight.size,
+      cachedEntries: this.cache.size
+    };
+  }
+
+  private getCached(key: string): CacheEntry<T> | undefined {
+    const entry = this.cache.get(key);
+    if (!entry) return undefined;
+
+    if (entry.expiresAt <= Date.now()) {
+      this.cache.delete(key);
+      return undefined;
+    }
+
+    // Re-insert to mark as most recently used
+    this.cache.delete(key);
+    this.cache.set(key, entry);
+    return entry;
+  }
+
+  private store(key: string, value: T): void {
+    const options = this.cacheOptions!;
+
+    this.cache.delete(key);
+    this.cache.set(key, { value, expiresAt: Date.now() + options.ttlMs });
+
+    while (this.cache.size > options.maxEntries) {
+      const oldest = this.cache.keys().next().value as string;
+      this.cache.delete(oldest);
+      this.stats.evictions++;
+    }
+  }
+}
+
+/**
+ * JSON with object keys sorted, so equal payloads hash equally
+ */
+function stableStringify(value: unknown): string {
+  if (value === undefined) return 'undefined';
+  if (value === null || typeof value !== 'object') return JSON.stringify(value);
+  if (value instanceof Date) return JSON.stringify(value.toISOString());
+  if (Array.isArray(value)) return `[${value.map(stableStringify).join(',')}]`;
+
+  const entries = Object.keys(value as Record<string, unknown>)
+    .sort()
+    .filter(key => (value as Record<string, unknown>)[key] !== undefined)
+    .map(key => `${JSON.stringify(key)}:${stableStringify((value as Record<string, unknown>)[key])}`);
+  return `{${entries.join(',')}}`;
+}
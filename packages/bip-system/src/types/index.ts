@@ -98,6 +98,28 @@ export interface VotingBlock {
 
 export type BlockType = 'vote' | 'finalize';
 
+/**
+ * Verified-prefix checkpoint for a voting chain: every block up to and
+ * including `verifiedIndex` has been hash-checked and links to `verifiedHash`
+ */
+export interface ChainCheckpoint {
+  verifiedIndex: number; // 0 = nothing verified yet
+  verifiedHash: string | null;
+  verifiedAt: Date;
+}
+
+export interface ChainVerificationOptions {
+  fullRescan?: boolean; // ignore the checkpoint and rehash every block (audits)
+  saveCheckpoint?: boolean; // VotingManager: persist the verified checkpoint if the chain is valid
+}
+
+export interface ChainVerificationResult {
+  isValid: boolean;
+  errors: string[];
+  blocksVerified: number; // blocks hashed during this call
+  checkpoint: ChainCheckpoint;
+}
+
 export interface VoteData {
   voteFile: string;
   voteFileHash: string;
@@ -109,6 +131,24 @@ export interface ResultData {
   resultFileHash: string;
   results: ProposalResult[];
   autoGenerated: boolean;
+  voteMerkleRoot?: string; // root over the vote blocks this result covers
+  voteCount?: number; // leaves under voteMerkleRoot
+}
+
+/**
+ * Proof that one model's vote is committed under a minute's vote Merkle root
+ */
+export interface VoteInclusionProof {
+  minuteId: string;
+  model: string;
+  voteFile: string;
+  voteFileHash: string; // sha256 of the vote file bytes
+  blockIndex: number;
+  leafIndex: number;
+  treeSize: number;
+  leafHash: string;
+  auditPath: string[];
+  root: string;
 }
 
 export interface ProposalVote {
@@ -0,0 +1,148 @@
+/**
+ * SchemaTreeValidator - Validates every governance JSON file under a tree
+ * in one process with the precompiled schema validators. Files are read
+ * in parallel with a concurrency cap; each file's schema comes from its
+ * `$schema` reference or its name, as in scripts/validate_schema.py.
+ * Files no schema claims are reported as skipped, not as failures.
+ */
+
+import { promises as fs } from 'fs';
+import { join } from 'path';
+import {
+  detectSchema,
+  formatSchemaErrors,
+  validateSchema,
+  type SchemaName
+} from '@cmmv-hive/shared-types';
+
+export type SchemaFileStatus = 'valid' | 'invalid' | 'skipped';
+
+export interface SchemaFileResult {
+  filePath: string;
+  status: SchemaFileStatus;
+  schema?: SchemaName;
+  errors: string[];
+}
+
+export interface SchemaTreeReport {
+  files: SchemaFileResult[];
+  valid: number;
+  invalid: number;
+  skipped: number;
+  durationMs: number;
+}
+
+export interface SchemaTreeValidatorOptions {
+  concurrency?: number; // max files read at once (default 32)
+  schema?: SchemaName; // validate every file against this schema instead of detecting
+}
+
+// Template directories hold placeholder documents that are not valid JSON
+const SKIPPED_DIRECTORIES = new Set(['node_modules', 'templates', 'dist']);
+
+export class SchemaTreeValidator {
+  private concurrency: number;
+  private schema: SchemaName | undefined;
+
+  constructor(options: SchemaTreeValidatorOptions = {}) {
+    this.concurrency = Math.max(1, options.concurrency ?? 32);
+    this.schema = options.schema;
+  }
+
+  /**
+   * Validate files and directory trees; results are sorted by path
+   */
+  async validate(paths: string[]): Promise<SchemaTreeReport> {
+    const startTime = Date.now();
+    const files = (await Promise.all(paths.map(path => this.collect(path)))).flat();
+    const unique = [...new Set(files)].sort();
+
+    const results = await this.mapLimit(unique, filePath => this.validateFile(filePath));
+
+    return {
+      files: results,
+      valid: results.filter(result => result.status === 'valid').length,
+      invalid: results.filter(result => result.status === 'invalid').length,
+      skipped: results.filter(result => result.status === 'skipped').length,
+      durationMs: Date.now() - startTime
+    };
+  }
+
+  /**
+   * Validate a single JSON file
+   */
+  async validateFile(filePath: string): Promise<SchemaFileResult> {
+    let data: unknown;
+    try {
+      data = JSON.parse(await fs.readFile(filePath, 'utf-8'));
+    } catch (error) {
+      return {
+        filePath,
+        status: 'invalid',
+        errors: [`Invalid JSON: ${error instanceof Error ? error.message : String(error)}`]
+      };
+    }
+
+    const schema = this.schema ?? detectSchema(filePath, data);
+    if (!schema) {
+      return { filePath, status: 'skipped', errors: [] };
+    }
+
+    const result = validateSchema(schema, data);
+    return {
+      filePath,
+      status: result.valid ? 'valid' : 'invalid',
+      schema,
+      errors: formatSchemaErrors(result.errors)
+    };
+  }
+
+  /**
+   * JSON files under a path; schema definitions themselves are left out
+   */
+  private async collect(path: string): Promise<string[]> {
+    const stat = await fs.stat(path);
+    if (!stat.isDirectory()) {
+      return [path];
+    }
+
+    const files: string[] = [];
+    const pending = [path];
+
+    while (pending.length > 0) {
+      const directory = pending.pop()!;
+      const entries = await fs.readdir(directory, { withFileTypes: true });
+
+      for (const entry of entries) {
+        const entryPath = join(directory, entry.name);
+        if (entry.isDirectory()) {
+          if (!entry.name.startsWith('.') && !SKIPPED_DIRECTORIES.has(entry.name)) {
+            pending.push(entryPath);
+          }
+        } else if (entry.isFile() && entry.name.endsWith('.json') && !entry.name.endsWith('.schema.json')) {
+          files.push(entryPath);
+        }
+      }
+    }
+
+    return files;
+  }
+
+  /**
+   * Map with at most `concurrency` calls in flight, preserving input order
+   */
+  private async mapLimit<T, R>(items: T[], fn: (item: T) => Promise<R>): Promise<R[]> {
+    const results: R[] = new Array(items.length);
+    let next = 0;
+
+    const workers = Array.from({ length: Math.min(this.concurrency, items.length) }, async () => {
+      while (next < items.length) {
+        const i = next++;
+        results[i] = await fn(items[i]!);
+      }
+    });
+
+    await Promise.all(workers);
+    return results;
+  }
+}
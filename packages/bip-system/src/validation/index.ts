@@ -0,0 +1,11 @@
+/**
+ * Validation module exports
+ */
+
+export { SchemaTreeValidator } from './SchemaTreeValidator.js';
+export type {
+  SchemaFileResult,
+  SchemaFileStatus,
+  SchemaTreeReport,
+  SchemaTreeValidatorOptions
+} from './SchemaTreeValidator.js';
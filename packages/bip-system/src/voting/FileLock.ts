@@ -0,0 +1,88 @@
+/**
+ * FileLock - Mutual exclusion for read-modify-write cycles on governance files
+ * Calls for the same lock path are chained within a process; across processes
+ * an O_EXCL lock file is held for the duration. Lock files older than
+ * `staleMs` are assumed to belong to a crashed writer and are broken.
+ */
+
+import { promises as fs } from 'fs';
+import { resolve } from 'path';
+
+export interface FileLockOptions {
+  retryMs?: number; // delay between attempts while another process holds the lock (default 10)
+  timeoutMs?: number; // give up waiting after this long (default 10000)
+  staleMs?: number; // break lock files older than this (default 30000)
+}
+
+// Serializes holders of the same lock path within a process
+const processLocks: Map<string, Promise<unknown>> = new Map();
+
+/**
+ * Run `fn` while holding the lock at `lockPath`
+ */
+export async function withFileLock<T>(
+  lockPath: string,
+  fn: () => Promise<T>,
+  options: FileLockOptions = {}
+): Promise<T> {
+  const key = resolve(lockPath);
+  const previous = processLocks.get(key) ?? Promise.resolve();
+
+  const run = previous.catch(() => undefined).then(async () => {
+    const release = await acquireLockFile(key, options);
+    try {
+      return await fn();
+    } finally {
+      await release();
+    }
+  });
+
+  processLocks.set(key, run);
+  try {
+    return await run;
+  } finally {
+    if (processLocks.get(key) === run) {
+      processLocks.delete(key);
+    }
+  }
+}
+
+async function acquireLockFile(lockPath: string, options: FileLockOptions): Promise<() => Promise<void>> {
+  const retryMs = options.retryMs ?? 10;
+  const staleMs = options.staleMs ?? 30000;
+  const deadline = Date.now() + (options.timeoutMs ?? 10000);
+
+  for (;;) {
+    try {
+      const handle = await fs.open(lockPath, 'wx');
+      await handle.writeFile(String(process.pid), 'utf-8');
+      await handle.close();
+      return () => fs.rm(lockPath, { force: true });
+    } catch (error) {
+      const code = (error as NodeJS.ErrnoException).code;
+      if (code === 'ENOENT') {
+        // Parent directory missing: there is nothing on disk to protect yet
+        return async () => undefined;
+      }
+      if (code !== 'EEXIST') {
+        throw error;
+      }
+    }
+
+    try {
+      const { mtimeMs } = await fs.stat(lockPath);
+      if (Date.now() - mtimeMs > staleMs) {
+        await fs.rm(lockPath, { force: true });
+        continue;
+      }
+    } catch (error) {
+      // Released between open and stat: retry immediately
+      continue;
+    }
+
+    if (Date.now() >= deadline) {
+      throw new Error(`Timed out waiting for lock ${lockPath}`);
+    }
+    await new Promise(resolveDelay => setTimeout(resolveDelay, retryMs));
+  }
+}
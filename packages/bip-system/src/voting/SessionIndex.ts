@@ -0,0 +1,292 @@
+/**
+ * SessionIndex - On-disk summary of every minute directory
+ * Active-session and reminder queries read this index instead of parsing
+ * session bodies. Entries are refreshed when the minutes directory gains or
+ * loses entries, or when a session file's mtime changes. Queries read the
+ * index without locking; updates hold a lock file and replace the index by
+ * rename, so concurrent processes neither lose each other's updates nor read
+ * a torn index.
+ */
+
+import { promises as fs } from 'fs';
+import { join } from 'path';
+import { VotingSession, VotingStatus } from '../types/index.js';
+import { VotingSessionStore } from './SessionStore.js';
+import { withFileLock } from './FileLock.js';
+
+export const SESSION_INDEX_FILE = 'session_index.json';
+const SESSION_INDEX_LOCK_FILE = '.session_index.lock';
+const SESSION_INDEX_VERSION = 1;
+
+export interface SessionIndexEntry {
+  minuteId: string;
+  status: VotingStatus | null; // null when the directory holds no voting session
+  endTime: string | null;
+  participantCount: number;
+  voteCount: number;
+  sessionMtimeMs: number | null;
+  nextReminderAt: string | null;
+  oldestNotificationAt: string | null;
+}
+
+interface SessionIndexData {
+  version: number;
+  directoryMtimeMs: number | null;
+  sessions: Record<string, SessionIndexEntry>;
+}
+
+type SessionFields = Pick<SessionIndexEntry, 'status' | 'endTime' | 'participantCount' | 'voteCount' | 'sessionMtimeMs'>;
+
+export class SessionIndex {
+  private minutesDirectory: string;
+  private indexFile: string;
+  private lockFile: string;
+  private sessionStore: VotingSessionStore;
+
+  constructor(minutesDirectory: string) {
+    this.minutesDirectory = minutesDirectory;
+    this.indexFile = join(minutesDirectory, SESSION_INDEX_FILE);
+    this.lockFile = join(minutesDirectory, SESSION_INDEX_LOCK_FILE);
+    this.sessionStore = new VotingSessionStore(minutesDirectory);
+  }
+
+  /**
+   * Up-to-date entries for every minute directory. The lock is taken and the
+   * index rewritten only when revalidation changed an entry.
+   */
+  async entries(): Promise<SessionIndexEntry[]> {
+    const data = await this.read();
+    if (!(await this.refresh(data))) {
+      return Object.values(data.sessions);
+    }
+
+    // Refresh again under the lock so updates made meanwhile are kept
+    return this.update(async latest => {
+      const changed = await this.refresh(latest);
+      return { changed, result: Object.values(latest.sessions) };
+    });
+  }
+
+  /**
+   * Record the summary of a session that was just written
+   */
+  async recordSession(session: VotingSession): Promise<void> {
+    const sessionMtimeMs = await this.sessionMtime(session.minuteId);
+
+    await this.update(async data => {
+      Object.assign(this.entryFor(data, session.minuteId), this.summarize(session, sessionMtimeMs));
+      return { changed: true, result: undefined };
+    });
+  }
+
+  /**
+   * Record the earliest pending reminder for a minute
+   */
+  async recordReminders(minuteId: string, nextReminderAt: Date | null): Promise<void> {
+    const value = nextReminderAt ? nextReminderAt.toISOString() : null;
+
+    await this.update(async data => {
+      const entry = this.entryFor(data, minuteId);
+      const changed = entry.nextReminderAt !== value;
+      entry.nextReminderAt = value;
+      return { changed, result: undefined };
+    });
+  }
+
+  /**
+   * Record the oldest stored notification for a minute
+   */
+  async recordNotifications(minuteId: string, oldestNotificationAt: Date | null): Promise<void> {
+    const value = oldestNotificationAt ? oldestNotificationAt.toISOString() : null;
+
+    await this.update(async data => {
+      const entry = this.entryFor(data, minuteId);
+      const changed = entry.oldestNotificationAt !== value;
+      entry.oldestNotificationAt = value;
+      return { changed, result: undefined };
+    });
+  }
+
+  /**
+   * Run a read-modify-write cycle on the index file
+   */
+  private async update<T>(fn: (data: SessionIndexData) => Promise<{ changed: boolean; result: T }>): Promise<T> {
+    return withFileLock(this.lockFile, async () => {
+      const data = await this.read();
+      const { changed, result } = await fn(data);
+      if (changed) {
+        await this.write(data);
+      }
+      return result;
+    });
+  }
+
+  /**
+   * Bring entries in line with the directory listing and session files
+   */
+  private async refresh(data: SessionIndexData): Promise<boolean> {
+    let changed = false;
+
+    let directoryMtimeMs: number;
+    try {
+      directoryMtimeMs = (await fs.stat(this.minutesDirectory)).mtimeMs;
+    } catch (error) {
+      // No minutes directory
+      return false;
+    }
+
+    // Index writes and lock files also touch the directory, so a changed mtime
+    // only costs a listing; the index is rewritten when membership changed
+    if (directoryMtimeMs !== data.directoryMtimeMs) {
+      const entries = await fs.readdir(this.minutesDirectory, { withFileTypes: true });
+      const minuteDirs = new Set(entries.filter(entry => entry.isDirectory()).map(entry => entry.name));
+
+      for (const minuteId of Object.keys(data.sessions)) {
+        if (!minuteDirs.has(minuteId)) {
+          delete data.sessions[minuteId];
+          changed = true;
+        }
+      }
+
+      for (const minuteId of minuteDirs) {
+        if (!data.sessions[minuteId]) {
+          data.sessions[minuteId] = await this.scanMinute(minuteId);
+          changed = true;
+        }
+      }
+
+      data.directoryMtimeMs = directoryMtimeMs;
+    }
+
+    // Closed sessions can still be rewritten (tally repair, manual edits), so
+    // every entry is checked against its session file's mtime
+    for (const entry of Object.values(data.sessions)) {
+      const sessionMtimeMs = await this.sessionMtime(entry.minuteId);
+      if (sessionMtimeMs !== entry.sessionMtimeMs) {
+        Object.assign(entry, await this.scanSession(entry.minuteId));
+        changed = true;
+      }
+    }
+
+    return changed;
+  }
+
+  /**
+   * Build an entry for a minute directory not yet in the index
+   */
+  private async scanMinute(minuteId: string): Promise<SessionIndexEntry> {
+    const entry: SessionIndexEntry = {
+      ...this.emptyEntry(minuteId),
+      ...(await this.scanSession(minuteId))
+    };
+
+    try {
+      const content = await fs.readFile(join(this.minutesDirectory, minuteId, 'reminder_schedule.json'), 'utf-8');
+      const schedule: Array<{ scheduledFor: string }> = JSON.parse(content);
+      entry.nextReminderAt = this.earliest(schedule.map(reminder => reminder.scheduledFor));
+    } catch (error) {
+      // No reminder schedule
+    }
+
+    try {
+      const content = await fs.readFile(join(this.minutesDirectory, minuteId, 'notifications.json'), 'utf-8');
+      const data: { notifications: Array<{ timestamp: string }> } = JSON.parse(content);
+      entry.oldestNotificationAt = this.earliest(data.notifications.map(notification => notification.timestamp));
+    } catch (error) {
+      // No notifications
+    }
+
+    return entry;
+  }
+
+  private async scanSession(minuteId: string): Promise<SessionFields> {
+    // Stat before loading so a concurrent write is picked up next refresh
+    const sessionMtimeMs = await this.sessionMtime(minuteId);
+    if (sessionMtimeMs === null) {
+      return this.summarize(null, null);
+    }
+
+    try {
+      const session = (await this.sessionStore.load(minuteId)) ?? (await this.sessionStore.loadLegacy(minuteId));
+      return this.summarize(session, sessionMtimeMs);
+    } catch (error) {
+      // Unreadable session: index it as absent
+      return this.summarize(null, sessionMtimeMs);
+    }
+  }
+
+  private summarize(session: VotingSession | null, sessionMtimeMs: number | null): SessionFields {
+    return {
+      status: session ? session.status : null,
+      endTime: session ? session.endTime.toISOString() : null,
+      participantCount: session ? session.participants.length : 0,
+      voteCount: session ? session.chain.filter(block => block.type === 'vote').length : 0,
+      sessionMtimeMs
+    };
+  }
+
+  private async sessionMtime(minuteId: string): Promise<number | null> {
+    for (const path of [this.sessionStore.getLogPath(minuteId), this.sessionStore.getLegacyPath(minuteId)]) {
+      try {
+        return (await fs.stat(path)).mtimeMs;
+      } catch (error) {
+        // Try the next format
+      }
+    }
+    return null;
+  }
+
+  private entryFor(data: SessionIndexData, minuteId: string): SessionIndexEntry {
+    let entry = data.sessions[minuteId];
+    if (!entry) {
+      entry = this.emptyEntry(minuteId);
+      data.sessions[minuteId] = entry;
+    }
+    return entry;
+  }
+
+  private emptyEntry(minuteId: string): SessionIndexEntry {
+    return {
+      minuteId,
+      status: null,
+      endTime: null,
+      participantCount: 0,
+      voteCount: 0,
+      sessionMtimeMs: null,
+      nextReminderAt: null,
+      oldestNotificationAt: null
+    };
+  }
+
+  private earliest(timestamps: string[]): string | null {
+    let earliest: number | null = null;
+    for (const timestamp of timestamps) {
+      const time = new Date(timestamp).getTime();
+      if (!Number.isNaN(time) && (earliest === null || time < earliest)) {
+        earliest = time;
+      }
+    }
+    return earliest === null ? null : new Date(earliest).toISOString();
+  }
+
+  private async read(): Promise<SessionIndexData> {
+    try {
+      const content = await fs.readFile(this.indexFile, 'utf-8');
+      const data = JSON.parse(content);
+      if (data.version === SESSION_INDEX_VERSION && data.sessions) {
+        return data;
+      }
+    } catch (error) {
+      // Missing or corrupt index: rebuild from the directory listing
+    }
+
+    return { version: SESSION_INDEX_VERSION, directoryMtimeMs: null, sessions: {} };
+  }
+
+  private async write(data: SessionIndexData): Promise<void> {
+    await fs.mkdir(this.minutesDirectory, { recursive: true });
+    const tempFile = `${this.indexFile}.${process.pid}.tmp`;
+    await fs.writeFile(tempFile, JSON.stringify(data, null, 2), 'utf-8');
+    await fs.rename(tempFile, this.indexFile);
+  }
+}
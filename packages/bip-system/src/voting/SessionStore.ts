@@ -0,0 +1,273 @@
+/**
+ * VotingSessionStore - Append-only block log for voting sessions
+ * Each session is an NDJSON log: one header line with the session metadata,
+ * followed by one line per chain block or status change. Votes append a
+ * single line instead of rewriting the whole session document.
+ */
+
+import { promises as fs, createReadStream } from 'fs';
+import type { FileHandle } from 'fs/promises';
+import { createInterface } from 'readline';
+import { join } from 'path';
+import { VotingSession, VotingBlock, VotingStatus } from '../types/index.js';
+
+export const SESSION_LOG_FILE = 'voting_session.log';
+export const LEGACY_SESSION_FILE = 'voting_session.json';
+export const SESSION_LOG_VERSION = 1;
+
+export type SessionHeader = Omit<VotingSession, 'chain'>;
+
+export type SessionLogRecord =
+  | { type: 'header'; version: number; session: SessionHeader }
+  | { type: 'block'; block: VotingBlock }
+  | { type: 'status'; status: VotingStatus };
+
+export interface SessionStoreOptions {
+  durable?: boolean; // fsync each appended batch (default true)
+}
+
+interface PendingAppend {
+  payload: string;
+  resolve: () => void;
+  reject: (error: unknown) => void;
+}
+
+export class VotingSessionStore {
+  private minutesDirectory: string;
+  private durable: boolean;
+  private pending: Map<string, PendingAppend[]> = new Map();
+  private flushing: Map<string, Promise<void>> = new Map();
+
+  constructor(minutesDirectory: string, options: SessionStoreOptions = {}) {
+    this.minutesDirectory = minutesDirectory;
+    this.durable = options.durable ?? true;
+  }
+
+  /**
+   * Path of the session log for a minute
+   */
+  getLogPath(minuteId: string): string {
+    return join(this.minutesDirectory, minuteId, SESSION_LOG_FILE);
+  }
+
+  /**
+   * Path of the pre-log JSON session document for a minute
+   */
+  getLegacyPath(minuteId: string): string {
+    return join(this.minutesDirectory, minuteId, LEGACY_SESSION_FILE);
+  }
+
+  /**
+   * Check whether a session log exists
+   */
+  async exists(minuteId: string): Promise<boolean> {
+    try {
+      await fs.access(this.getLogPath(minuteId));
+      return true;
+    } catch {
+      return false;
+    }
+  }
+
+  /**
+   * Write a complete log (header, blocks, status) replacing any existing one.
+   * Used for new sessions and for migrating legacy JSON sessions.
+   */
+  async write(session: VotingSession): Promise<void> {
+    await this.flushing.get(session.minuteId);
+
+    const { chain, ...header } = session;
+    const records: SessionLogRecord[] = [
+      { type: 'header', version: SESSION_LOG_VERSION, session: header },
+      ...chain.map(block => ({ type: 'block' as const, block }))
+    ];
+
+    const logPath = this.getLogPath(session.minuteId);
+    const tempPath = `${logPath}.tmp`;
+    await this.writeRecords(tempPath, records);
+    await fs.rename(tempPath, logPath);
+  }
+
+  /**
+   * Append records to an existing log. Appends issued concurrently for the
+   * same session are written and synced as one batch. Callers hold the
+   * session lock, so a torn final record left by an interrupted append is
+   * cut off here before the batch is written.
+   */
+  append(minuteId: string, records: SessionLogRecord[]): Promise<void> {
+    const payload = records.map(record => JSON.stringify(record) + '\n').join('');
+
+    return new Promise((resolve, reject) => {
+      let queue = this.pending.get(minuteId);
+      if (!queue) {
+        queue = [];
+        this.pending.set(minuteId, queue);
+      }
+      queue.push({ payload, resolve, reject });
+
+      if (!this.flushing.has(minuteId)) {
+        this.flushing.set(minuteId, this.flush(minuteId));
+      }
+    });
+  }
+
+  /**
+   * Stream a session log back into memory. Returns undefined if no log exists.
+   * Read-only: a torn final record is skipped, and the next append drops it.
+   */
+  async load(minuteId: string): Promise<VotingSession | undefined> {
+    const logPath = this.getLogPath(minuteId);
+
+    try {
+      await fs.access(logPath);
+    } catch {
+      return undefined;
+    }
+
+    const lines = createInterface({
+      input: createReadStream(logPath, { encoding: 'utf-8' }),
+      crlfDelay: Infinity
+    });
+
+    let session: VotingSession | undefined;
+    let tornLine: number | undefined;
+    let lineNumber = 0;
+
+    for await (const line of lines) {
+      lineNumber++;
+      if (line.trim() === '') continue;
+
+      if (tornLine !== undefined) {
+        throw new Error(`Corrupt session log ${logPath}: invalid record at line ${tornLine}`);
+      }
+
+      let record: SessionLogRecord;
+      try {
+        record = JSON.parse(line);
+      } catch {
+        // Tolerated only as the final line (an interrupted append)
+        tornLine = lineNumber;
+        continue;
+      }
+
+      if (!session) {
+        if (record.type !== 'header') {
+          throw new Error(`Corrupt session log ${logPath}: missing header`);
+        }
+        if (record.version !== SESSION_LOG_VERSION) {
+          throw new Error(`Unsupported session log version ${record.version} in ${logPath}`);
+        }
+
+        const header = record.session;
+        session = {
+          ...header,
+          startTime: new Date(header.startTime),
+          endTime: new Date(header.endTime),
+          chain: []
+        };
+        continue;
+      }
+
+      if (record.type === 'block') {
+        session.chain.push({
+          ...record.block,
+          timestamp: new Date(record.block.timestamp)
+        });
+      } else if (record.type === 'status') {
+        session.status = record.status;
+      }
+    }
+
+    if (!session) {
+      throw new Error(`Corrupt session log ${logPath}: missing header`);
+    }
+
+    return session;
+  }
+
+  /**
+   * Load a session stored as a single legacy JSON document
+   */
+  async loadLegacy(minuteId: string): Promise<VotingSession> {
+    const content = await fs.readFile(this.getLegacyPath(minuteId), 'utf-8');
+    const data = JSON.parse(content);
+
+    return {
+      ...data,
+      startTime: new Date(data.startTime),
+      endTime: new Date(data.endTime),
+      chain: data.chain.map((block: any) => ({
+        ...block,
+        timestamp: new Date(block.timestamp)
+      }))
+    };
+  }
+
+  /**
+   * Drain the pending queue for a session, one write + sync per batch
+   */
+  private async flush(minuteId: string): Promise<void> {
+    // Let appends issued in the same tick join the first batch
+    await Promise.resolve();
+
+    let batch = this.pending.get(minuteId);
+    while (batch && batch.length > 0) {
+      this.pending.delete(minuteId);
+
+      try {
+        await this.writePayload(this.getLogPath(minuteId), batch.map(item => item.payload).join(''), 'a+');
+        batch.forEach(item => item.resolve());
+      } catch (error) {
+        batch.forEach(item => item.reject(error));
+      }
+
+      batch = this.pending.get(minuteId);
+    }
+
+    this.flushing.delete(minuteId);
+  }
+
+  private async writeRecords(path: string, records: SessionLogRecord[]): Promise<void> {
+    const payload = records.map(record => JSON.stringify(record) + '\n').join('');
+    await this.writePayload(path, payload, 'w');
+  }
+
+  private async writePayload(path: string, payload: string, flags: 'w' | 'a+'): Promise<void> {
+    const handle = await fs.open(path, flags);
+    try {
+      if (flags === 'a+') {
+        await this.truncateTornRecord(handle);
+      }
+      await handle.writeFile(payload, 'utf-8');
+      if (this.durable) {
+        await handle.datasync();
+      }
+    } finally {
+      await handle.close();
+    }
+  }
+
+  /**
+   * Cut the log back to its last complete line so an append starts on a
+   * clean line. A log without any newline is left for load() to reject.
+   */
+  private async truncateTornRecord(handle: FileHandle): Promise<void> {
+    const { size } = await handle.stat();
+    const chunk = Buffer.alloc(4096);
+    let end = size;
+
+    while (end > 0) {
+      const start = Math.max(0, end - chunk.length);
+      const { bytesRead } = await handle.read(chunk, 0, end - start, start);
+      const newline = chunk.subarray(0, bytesRead).lastIndexOf(0x0a);
+      if (newline !== -1) {
+        const cleanSize = start + newline + 1;
+        if (cleanSize < size) {
+          await handle.truncate(cleanSize);
+        }
+        return;
+      }
+      end = start;
+    }
+  }
+}
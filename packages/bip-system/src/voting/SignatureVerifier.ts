@@ -0,0 +1,82 @@
+/**
+ * SignatureVerifier - Vote signature checks for the TallyEngine
+ * Verifies detached vote signatures against model identities with
+ * SignatureService.batchVerify, fanning each batch out to worker threads.
+ */
+
+import { cpus } from 'os';
+import { ECCService, SignatureService } from '@cmmv-hive/crypto-utils';
+import type { ModelIdentity, SignedMessage } from '@cmmv-hive/shared-types';
+import { TalliedVote, VoteSignature, VoteSignatureVerifier, voteSigningPayload } from './TallyEngine.js';
+
+export interface SignatureVerifierOptions {
+  // Worker threads per batch; 0 verifies inline. By default a batch uses one
+  // worker per spare CPU once it reaches SignatureService's worker threshold
+  // (256 signatures), and smaller batches are verified inline.
+  workers?: number;
+}
+
+/**
+ * Build a verifier that accepts votes signed by the identity of their model
+ */
+export function createSignatureVerifier(
+  identities: ModelIdentity[],
+  options: SignatureVerifierOptions = {}
+): VoteSignatureVerifier {
+  return async (minuteId, votes) => {
+    const signed = votes.filter(vote => vote.signature !== undefined);
+    const messages = signed.map(vote => toSignedMessage(minuteId, vote));
+
+    const report = await SignatureService.batchVerify(messages, identities, options.workers === undefined
+      ? { workers: Math.max(1, cpus().length - 1) }
+      : { workers: options.workers, minBatchSizeForWorkers: 1 });
+
+    const valid = new Map(signed.map((vote, i) => [vote, report.results[i]?.isValid ?? false]));
+    return votes.map(vote => valid.get(vote) ?? false);
+  };
+}
+
+/**
+ * Sign a vote for a minute; store the result in the vote file's `signature`
+ * field (as `compact`, `recovery`, `signed_at`)
+ */
+export async function signVote(
+  minuteId: string,
+  vote: Pick<TalliedVote, 'model' | 'votes'>,
+  privateKey: Uint8Array
+): Promise<VoteSignature> {
+  const message = {
+    content: voteSigningPayload(minuteId, vote),
+    type: 'vote' as const,
+    context: { modelId: vote.model, minuteId },
+    timestamp: new Date()
+  };
+  const signedMessage = await ECCService.signCompleteMessage(message, privateKey);
+  const compact = ECCService.signatureToCompact(signedMessage.signature);
+
+  return {
+    compact: Buffer.from(compact.signature).toString('hex'),
+    recovery: compact.recovery,
+    signedAt: message.timestamp.toISOString()
+  };
+}
+
+function toSignedMessage(minuteId: string, vote: TalliedVote): SignedMessage {
+  const signature = vote.signature!;
+  const bytes = Buffer.from(signature.compact, 'hex');
+  const signedAt = new Date(signature.signedAt);
+
+  return {
+    content: voteSigningPayload(minuteId, vote),
+    type: 'vote',
+    context: { modelId: vote.model, minuteId },
+    timestamp: signedAt,
+    signature: {
+      r: new Uint8Array(bytes.subarray(0, 32)),
+      s: new Uint8Array(bytes.subarray(32, 64)),
+      recovery: signature.recovery
+    },
+    signerPublicKey: new Uint8Array(0), // resolved from the model identity
+    signedAt
+  };
+}
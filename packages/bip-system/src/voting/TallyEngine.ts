@@ -0,0 +1,526 @@
+/**
+ * TallyEngine - Streaming, incremental vote tally for a minute
+ * Shared by VotingManager.finalizeVoting, `bip-tally --count` and
+ * scripts/voting/tally_minute_votes.js. Vote files are streamed with bounded
+ * concurrency and hashed as they are read; signature checks run in batches
+ * (on worker threads when the verifier uses them) while later files are still
+ * being read and aggregated. With `incremental`, the aggregate is persisted
+ * next to the votes and a re-tally only re-reads files whose (size, mtime)
+ * changed, retracting their old weights before applying the new ones.
+ */
+
+import { promises as fs, createReadStream } from 'fs';
+import { join, basename } from 'path';
+import { createHash } from 'crypto';
+import { ProposalVote, ProposalResult } from '../types/index.js';
+
+export const TALLY_AGGREGATE_FILE = 'tally_aggregate.json';
+const TALLY_AGGREGATE_VERSION = 1;
+const VOTES_DIRECTORY = 'votes';
+const CHAIN_FILE = 'voting_chain.json';
+const IGNORED_VOTE_FILES = new Set(['TEMPLATE.json']);
+
+/**
+ * Detached vote signature as stored in a vote file's `signature` field
+ */
+export interface VoteSignature {
+  compact: string; // 64-byte r || s, hex
+  recovery: number;
+  signedAt: string;
+}
+
+/**
+ * Vote file normalized across the bip-system and gov/minutes formats
+ */
+export interface TalliedVote {
+  file: string; // relative to the minute directory, e.g. votes/gpt-5.json
+  fileHash: string; // SHA-256 of the file bytes
+  model: string;
+  timestamp?: string;
+  votes: ProposalVote[];
+  signature?: VoteSignature;
+}
+
+/**
+ * Checks the signatures of a batch of votes; resolves one flag per vote
+ */
+export type VoteSignatureVerifier = (minuteId: string, votes: TalliedVote[]) => Promise<boolean[]>;
+
+export interface TallyEngineOptions {
+  concurrency?: number; // max vote files read at once (default 8)
+  verifier?: VoteSignatureVerifier; // omit to skip signature checks
+  verifyBatchSize?: number; // votes per verifier call (default 256)
+}
+
+export interface TallyOptions {
+  files?: string[]; // vote files to count (default: every *.json under votes/)
+  expectedHashes?: Map<string, string>; // file -> SHA-256 recorded on the chain
+  rejectHashMismatches?: boolean; // leave mismatching votes out (default true)
+  incremental?: boolean; // reuse and update the persisted aggregate
+}
+
+export interface ProposalTally {
+  proposalId: string;
+  totalWeight: number;
+  voteCount: number;
+  approve: number; // weight 7+
+  reject: number; // weight 1-3
+  abstain: number; // weight 4-6
+  averageWeight: number;
+}
+
+export interface TallyIssue {
+  file: string;
+  reason: string;
+}
+
+export interface TallyReport {
+  minuteId: string;
+  votes: TalliedVote[]; // counted votes, by file name
+  proposals: ProposalTally[]; // by proposal id
+  hashMismatches: TallyIssue[];
+  rejected: TallyIssue[]; // files left out of the tally
+  stats: {
+    read: number; // files read and hashed this run
+    reused: number; // files taken from the persisted aggregate
+    retracted: number; // previously counted files no longer counted
+  };
+}
+
+export interface ResultRules {
+  proposals: string[];
+  participantCount: number;
+  quorumThreshold: number;
+  approvalThreshold: number;
+}
+
+interface AggregateEntry {
+  model: string;
+  timestamp?: string;
+  fileHash: string;
+  size: number;
+  mtimeMs: number;
+  votes: ProposalVote[];
+}
+
+type ProposalTotals = Omit<ProposalTally, 'proposalId' | 'averageWeight'>;
+
+interface TallyAggregate {
+  version: number;
+  minuteId: string;
+  entries: Record<string, AggregateEntry>;
+  proposals: Record<string, ProposalTotals>;
+}
+
+interface FileStamp {
+  size: number;
+  mtimeMs: number;
+}
+
+interface PendingVote {
+  vote: TalliedVote;
+  stamp: FileStamp;
+}
+
+export class TallyEngine {
+  private minutesDirectory: string;
+  private concurrency: number;
+  private verifier: VoteSignatureVerifier | undefined;
+  private verifyBatchSize: number;
+  private activeReads = 0;
+  private waiters: Array<() => void> = [];
+
+  constructor(minutesDirectory: string = 'gov/minutes', options: TallyEngineOptions = {}) {
+    this.minutesDirectory = minutesDirectory;
+    this.concurrency = Math.max(1, options.concurrency ?? 8);
+    this.verifier = options.verifier;
+    this.verifyBatchSize = Math.max(1, options.verifyBatchSize ?? 256);
+  }
+
+  /**
+   * Tally the votes of a minute
+   */
+  async tally(minuteId: string, options: TallyOptions = {}): Promise<TallyReport> {
+    const minuteDir = join(this.minutesDirectory, minuteId);
+    const files = [...new Set(options.files ?? await this.listVoteFiles(minuteDir))].sort();
+    const rejectMismatches = options.rejectHashMismatches ?? true;
+    const aggregate = options.incremental
+      ? await this.loadAggregate(minuteDir, minuteId)
+      : TallyEngine.emptyAggregate(minuteId);
+
+    const hashMismatches: TallyIssue[] = [];
+    const rejected: TallyIssue[] = [];
+    const stats = { read: 0, reused: 0, retracted: 0 };
+    const pending: PendingVote[] = [];
+    const verifications: Promise<void>[] = [];
+
+    const retract = (file: string) => {
+      if (this.retract(aggregate, file)) stats.retracted++;
+    };
+    const reject = (file: string, reason: string) => {
+      retract(file);
+      rejected.push({ file, reason });
+    };
+    const flush = () => {
+      const batch = pending.splice(0);
+      if (batch.length > 0) {
+        verifications.push(this.verifyBatch(minuteId, batch, aggregate, reject));
+      }
+    };
+
+    // Files counted before but no longer part of the minute
+    const wanted = new Set(files);
+    Object.keys(aggregate.entries).filter(file => !wanted.has(file)).forEach(retract);
+
+    await Promise.all(files.map(async file => {
+      await this.acquire();
+      try {
+        const stamp = await this.stamp(join(minuteDir, file));
+        if (!stamp) {
+          reject(file, 'Vote file not found');
+          return;
+        }
+
+        const expected = options.expectedHashes?.get(file);
+        const previous = aggregate.entries[file];
+        if (previous && previous.size === stamp.size && previous.mtimeMs === stamp.mtimeMs &&
+            (expected === undefined || expected === previous.fileHash)) {
+          stats.reused++;
+          return;
+        }
+
+        let vote: TalliedVote;
+        try {
+          vote = await this.readVote(minuteDir, file);
+          stats.read++;
+        } catch (error) {
+          reject(file, error instanceof Error ? error.message : String(error));
+          return;
+        }
+
+        if (expected !== undefined && expected !== vote.fileHash) {
+          hashMismatches.push({ file, reason: `Hash ${vote.fileHash} does not match recorded ${expected}` });
+          if (rejectMismatches) {
+            reject(file, 'Vote file hash does not match the chain');
+            return;
+          }
+        }
+
+        if (this.verifier) {
+          pending.push({ vote, stamp });
+          if (pending.length >= this.verifyBatchSize) flush();
+        } else {
+          this.apply(aggregate, vote, stamp);
+        }
+      } finally {
+        this.release();
+      }
+    }));
+
+    flush();
+    await Promise.all(verifications);
+
+    if (options.incremental) {
+      await this.saveAggregate(minuteDir, aggregate);
+    }
+
+    return {
+      minuteId,
+      votes: Object.entries(aggregate.entries)
+        .sort(([a], [b]) => a.localeCompare(b))
+        .map(([file, entry]) => ({
+          file,
+          fileHash: entry.fileHash,
+          model: entry.model,
+          ...(entry.timestamp !== undefined ? { timestamp: entry.timestamp } : {}),
+          votes: entry.votes
+        })),
+      proposals: Object.entries(aggregate.proposals)
+        .sort(([a], [b]) => a.localeCompare(b))
+        .map(([proposalId, totals]) => ({
+          proposalId,
+          ...totals,
+          averageWeight: totals.voteCount > 0 ? totals.totalWeight / totals.voteCount : 0
+        })),
+      hashMismatches,
+      rejected: rejected.sort((a, b) => a.file.localeCompare(b.file)),
+      stats
+    };
+  }
+
+  /**
+   * Vote file hashes recorded in a minute's voting_chain.json (the
+   * gov/minutes chain format), or undefined when the minute has none
+   */
+  async readChainHashes(minuteId: string): Promise<Map<string, string> | undefined> {
+    try {
+      const content = await fs.readFile(join(this.minutesDirectory, minuteId, CHAIN_FILE), 'utf-8');
+      const blocks: Array<Record<string, unknown>> = JSON.parse(content).chain ?? [];
+      return new Map(blocks
+        .filter(block => block.type === 'vote' && typeof block.vote_file === 'string' && typeof block.vote_file_hash === 'string')
+        .map(block => [block.vote_file as string, block.vote_file_hash as string]));
+    } catch {
+      return undefined;
+    }
+  }
+
+  /**
+   * Path of the persisted aggregate for a minute
+   */
+  getAggregatePath(minuteId: string): string {
+    return join(this.minutesDirectory, minuteId, TALLY_AGGREGATE_FILE);
+  }
+
+  private async verifyBatch(
+    minuteId: string,
+    batch: PendingVote[],
+    aggregate: TallyAggregate,
+    reject: (file: string, reason: string) => void
+  ): Promise<void> {
+    let flags: boolean[];
+    try {
+      flags = await this.verifier!(minuteId, batch.map(item => item.vote));
+    } catch (error) {
+      const reason = `Signature verification failed: ${error instanceof Error ? error.message : String(error)}`;
+      batch.forEach(item => reject(item.vote.file, reason));
+      return;
+    }
+
+    batch.forEach((item, i) => {
+      if (flags[i]) {
+        this.apply(aggregate, item.vote, item.stamp);
+      } else {
+        reject(item.vote.file, item.vote.signature ? 'Invalid vote signature' : 'Vote is not signed');
+      }
+    });
+  }
+
+  /**
+   * Count a vote, replacing any earlier version of the same file
+   */
+  private apply(aggregate: TallyAggregate, vote: TalliedVote, stamp: FileStamp): void {
+    this.retract(aggregate, vote.file);
+
+    aggregate.entries[vote.file] = {
+      model: vote.model,
+      ...(vote.timestamp !== undefined ? { timestamp: vote.timestamp } : {}),
+      fileHash: vote.fileHash,
+      size: stamp.size,
+      mtimeMs: stamp.mtimeMs,
+      votes: vote.votes
+    };
+    TallyEngine.accumulate(aggregate, vote.votes, 1);
+  }
+
+  /**
+   * Remove a file's weights from the aggregate; false if it was not counted
+   */
+  private retract(aggregate: TallyAggregate, file: string): boolean {
+    const entry = aggregate.entries[file];
+    if (!entry) return false;
+
+    delete aggregate.entries[file];
+    TallyEngine.accumulate(aggregate, entry.votes, -1);
+    return true;
+  }
+
+  private static accumulate(aggregate: TallyAggregate, votes: ProposalVote[], sign: 1 | -1): void {
+    for (const vote of votes) {
+      const totals = aggregate.proposals[vote.proposalId] ??= {
+        totalWeight: 0,
+        voteCount: 0,
+        approve: 0,
+        reject: 0,
+        abstain: 0
+      };
+
+      totals.totalWeight += sign * vote.weight;
+      totals.voteCount += sign;
+
+      // Weights 7+ approve, 1-3 reject, 4-6 abstain
+      if (vote.weight >= 7) {
+        totals.approve += sign;
+      } else if (vote.weight <= 3) {
+        totals.reject += sign;
+      } else {
+        totals.abstain += sign;
+      }
+
+      if (totals.voteCount === 0) {
+        delete aggregate.proposals[vote.proposalId];
+      }
+    }
+  }
+
+  /**
+   * Stream a vote file into its hash and parse it
+   */
+  private async readVote(minuteDir: string, file: string): Promise<TalliedVote> {
+    const hash = createHash('sha256');
+    const chunks: Buffer[] = [];
+
+    for await (const chunk of createReadStream(join(minuteDir, file))) {
+      hash.update(chunk as Buffer);
+      chunks.push(chunk as Buffer);
+    }
+
+    let document: unknown;
+    try {
+      document = JSON.parse(Buffer.concat(chunks).toString('utf8'));
+    } catch (error) {
+      throw new Error(`Invalid JSON: ${error instanceof Error ? error.message : String(error)}`);
+    }
+
+    return { file, fileHash: hash.digest('hex'), ...normalizeVoteDocument(document, file) };
+  }
+
+  private async listVoteFiles(minuteDir: string): Promise<string[]> {
+    try {
+      const names = await fs.readdir(join(minuteDir, VOTES_DIRECTORY));
+      return names
+        .filter(name => name.endsWith('.json') && !IGNORED_VOTE_FILES.has(name))
+        .map(name => `${VOTES_DIRECTORY}/${name}`);
+    } catch {
+      return [];
+    }
+  }
+
+  private async loadAggregate(minuteDir: string, minuteId: string): Promise<TallyAggregate> {
+    try {
+      const content = await fs.readFile(join(minuteDir, TALLY_AGGREGATE_FILE), 'utf-8');
+      const data = JSON.parse(content) as TallyAggregate;
+      if (data.version === TALLY_AGGREGATE_VERSION && data.minuteId === minuteId) {
+        return data;
+      }
+    } catch {
+      // No aggregate yet, or unreadable: tally from scratch
+    }
+    return TallyEngine.emptyAggregate(minuteId);
+  }
+
+  private async saveAggregate(minuteDir: string, aggregate: TallyAggregate): Promise<void> {
+    // Write-then-rename so a crash never leaves a torn aggregate behind
+    const target = join(minuteDir, TALLY_AGGREGATE_FILE);
+    const temp = `${target}.${process.pid}.tmp`;
+    await fs.writeFile(temp, JSON.stringify(aggregate), 'utf-8');
+    await fs.rename(temp, target);
+  }
+
+  private static emptyAggregate(minuteId: string): TallyAggregate {
+    return { version: TALLY_AGGREGATE_VERSION, minuteId, entries: {}, proposals: {} };
+  }
+
+  private async stamp(path: string): Promise<FileStamp | null> {
+    try {
+      const stat = await fs.stat(path);
+      return stat.isFile() ? { size: stat.size, mtimeMs: stat.mtimeMs } : null;
+    } catch {
+      return null;
+    }
+  }
+
+  private async acquire(): Promise<void> {
+    if (this.activeReads < this.concurrency) {
+      this.activeReads++;
+      return;
+    }
+    await new Promise<void>(resolve => this.waiters.push(resolve));
+  }
+
+  private release(): void {
+    const next = this.waiters.shift();
+    if (next) {
+      next(); // hand the slot over without releasing it
+    } else {
+      this.activeReads--;
+    }
+  }
+}
+
+/**
+ * Normalize a parsed vote file. Accepts the bip-system format
+ * (`model`, `proposals[].proposalId`) and the gov/minutes format
+ * (`model`, `weights[].proposal_id`, `comment`).
+ */
+export function normalizeVoteDocument(document: unknown, file: string): Omit<TalliedVote, 'file' | 'fileHash'> {
+  if (typeof document !== 'object' || document === null) {
+    throw new Error('Vote file is not a JSON object');
+  }
+
+  const doc = document as Record<string, any>;
+  const entries = Array.isArray(doc.proposals) ? doc.proposals : doc.weights;
+  if (!Array.isArray(entries)) {
+    throw new Error('Vote file has no proposals or weights');
+  }
+
+  const votes: ProposalVote[] = entries.map((entry: Record<string, any>) => {
+    const proposalId = entry?.proposalId ?? entry?.proposal_id;
+    const weight = entry?.weight;
+    if (typeof proposalId !== 'string' || typeof weight !== 'number' || !Number.isFinite(weight)) {
+      throw new Error(`Vote entry for ${String(proposalId)} has no numeric weight`);
+    }
+
+    const justification = entry.justification ?? entry.comment;
+    return { proposalId, weight, ...(typeof justification === 'string' ? { justification } : {}) };
+  });
+
+  const signature = doc.signature;
+  return {
+    model: String(doc.model ?? doc.model_id ?? basename(file, '.json')),
+    ...(typeof doc.timestamp === 'string' ? { timestamp: doc.timestamp } : {}),
+    votes,
+    ...(signature && typeof signature.compact === 'string'
+      ? {
+          signature: {
+            compact: signature.compact,
+            recovery: Number(signature.recovery ?? 0),
+            signedAt: String(signature.signed_at ?? signature.signedAt ?? doc.timestamp)
+          }
+        }
+      : {})
+  };
+}
+
+/**
+ * Content covered by a vote signature: the minute, model and weights, but not
+ * the signature itself
+ */
+export function voteSigningPayload(minuteId: string, vote: Pick<TalliedVote, 'model' | 'votes'>): string {
+  return JSON.stringify({
+    minute_id: minuteId,
+    model: vote.model,
+    votes: vote.votes.map(entry => ({ proposal_id: entry.proposalId, weight: entry.weight }))
+  });
+}
+
+/**
+ * Apply session quorum and approval thresholds to tallied proposals. Only the
+ * session's proposals are reported, highest total score first.
+ */
+export function toProposalResults(proposals: ProposalTally[], rules: ResultRules): ProposalResult[] {
+  const tallies = new Map(proposals.map(tally => [tally.proposalId, tally]));
+
+  return rules.proposals.map(proposalId => {
+    const tally = tallies.get(proposalId);
+    const participantCount = tally?.voteCount ?? 0;
+    const approve = tally?.approve ?? 0;
+
+    const participationRate = participantCount / rules.participantCount;
+    const approvalRate = approve / participantCount;
+    const approved = participationRate >= rules.quorumThreshold && approvalRate >= rules.approvalThreshold;
+
+    const result: ProposalResult = {
+      proposalId,
+      totalScore: tally?.totalWeight ?? 0,
+      participantCount,
+      status: approved ? 'Approved' : 'Rejected',
+      voteBreakdown: {
+        approve,
+        reject: tally?.reject ?? 0,
+        abstain: tally?.abstain ?? 0,
+        averageWeight: tally?.averageWeight ?? 0
+      }
+    };
+    return result;
+  }).sort((a, b) => b.totalScore - a.totalScore);
+}
@@ -5,17 +5,47 @@
 
 import { promises as fs } from 'fs';
 import { join } from 'path';
-import { VotingSession, VotingBlock, VoteData, ResultData, ProposalVote, ProposalResult, ModelProfile, VotingStatus } from '../types/index.js';
+import {
+  VotingSession,
+  VotingBlock,
+  VoteData,
+  ResultData,
+  ProposalVote,
+  ProposalResult,
+  ModelProfile,
+  VotingStatus,
+  ChainCheckpoint,
+  ChainVerificationOptions,
+  ChainVerificationResult,
+  VoteInclusionProof
+} from '../types/index.js';
 import { VotingChain } from '../chain/VotingChain.js';
+import { VotingSessionStore, SessionLogRecord } from './SessionStore.js';
+import { SessionIndex, SessionIndexEntry } from './SessionIndex.js';
+import { TallyEngine, toProposalResults } from './TallyEngine.js';
 import { createHash } from 'crypto';
+import { withFileLock } from './FileLock.js';
+import { formatSchemaErrors, validateSchema } from '@cmmv-hive/shared-types';
+
+const SESSION_LOCK_FILE = '.session.lock';
 
 export class VotingManager {
   private minutesDirectory: string;
   private modelsConfig: ModelProfile[];
-
-  constructor(minutesDirectory: string = 'gov/minutes', modelsConfig: ModelProfile[] = []) {
+  private sessionStore: VotingSessionStore;
+  private sessionIndex: SessionIndex;
+  private tallyEngine: TallyEngine;
+
+  constructor(
+    minutesDirectory: string = 'gov/minutes',
+    modelsConfig: ModelProfile[] = [],
+    tallyEngine: TallyEngine = new TallyEngine(minutesDirectory)
+  ) {
     this.minutesDirectory = minutesDirectory;
     this.modelsConfig = modelsConfig;
+    this.sessionStore = new VotingSessionStore(minutesDirectory);
+    this.sessionIndex = new SessionIndex(minutesDirectory);
+    this.tallyEngine = tallyEngine;
   }
 
   /**
@@ -51,44 +81,86 @@ export class VotingManager {
   }
 
   /**
-   * Load voting session from file
+   * Load voting session from its block log, falling back to legacy JSON
    */
   async loadVotingSession(minuteId: string): Promise<VotingSession> {
-    const sessionFile = join(this.minutesDirectory, minuteId, 'voting_session.json');
-    const content = await fs.readFile(sessionFile, 'utf-8');
-    const data = JSON.parse(content);
-
-    return {
-      ...data,
-      startTime: new Date(data.startTime),
-      endTime: new Date(data.endTime),
-      chain: data.chain.map((block: any) => ({
-        ...block,
-        timestamp: new Date(block.timestamp)
-      }))
-    };
+    const logged = await this.sessionStore.load(minuteId);
+    return logged ?? this.sessionStore.loadLegacy(minuteId);
   }
 
   /**
-   * Save voting session to file
+   * Save the complete voting session, replacing its block log
    */
   async saveVotingSession(session: VotingSession): Promise<void> {
     const sessionDir = join(this.minutesDirectory, session.minuteId);
     await fs.mkdir(sessionDir, { recursive: true });
     await fs.mkdir(join(sessionDir, 'votes'), { recursive: true });
 
-    const sessionFile = join(sessionDir, 'voting_session.json');
+    await this.sessionStore.write(session);
+    await this.sessionIndex.recordSession(session);
+  }
+
+  /**
+   * Append records to the session log. Sessions still stored as legacy JSON
+   * are migrated by writing the full log once.
+   */
+  private async appendToSession(session: VotingSession, records: SessionLogRecord[]): Promise<void> {
+    if (await this.sessionStore.exists(session.minuteId)) {
+      await this.sessionStore.append(session.minuteId, records);
+      await this.sessionIndex.recordSession(session);
+    } else {
+      await this.saveVotingSession(session);
+    }
+  }
+
+  /**
+   * Load the verified-prefix checkpoint stored next to the session
+   */
+  async loadChainCheckpoint(minuteId: string): Promise<ChainCheckpoint | undefined> {
+    const checkpointFile = join(this.minutesDirectory, minuteId, 'chain_checkpoint.json');
+
+    try {
+      const content = await fs.readFile(checkpointFile, 'utf-8');
+      const data = JSON.parse(content);
+
+      return {
+        verifiedIndex: data.verifiedIndex,
+        verifiedHash: data.verifiedHash,
+        verifiedAt: new Date(data.verifiedAt)
+      };
+    } catch (error) {
+      // No checkpoint yet (or unreadable): verification starts from block 1
+      return undefined;
+    }
+  }
+
+  /**
+   * Save the verified-prefix checkpoint next to the session
+   */
+  async saveChainCheckpoint(minuteId: string, checkpoint: ChainCheckpoint): Promise<void> {
+    const checkpointFile = join(this.minutesDirectory, minuteId, 'chain_checkpoint.json');
     const serialized = {
-      ...session,
-      startTime: session.startTime.toISOString(),
-      endTime: session.endTime.toISOString(),
-      chain: session.chain.map(block => ({
-        ...block,
-        timestamp: block.timestamp.toISOString()
-      }))
+      ...checkpoint,
+      verifiedAt: checkpoint.verifiedAt.toISOString()
     };
 
-    await fs.writeFile(sessionFile, JSON.stringify(serialized, null, 2), 'utf-8');
+    await fs.writeFile(checkpointFile, JSON.stringify(serialized, null, 2), 'utf-8');
+  }
+
+  /**
+   * Load a session together with its checkpointed chain
+   */
+  private async loadVotingChain(minuteId: string): Promise<{ session: VotingSession; votingChain: VotingChain }> {
+    const session = await this.loadVotingSession(minuteId);
+    const checkpoint = await this.loadChainCheckpoint(minuteId);
+    return { session, votingChain: new VotingChain(session, checkpoint) };
+  }
+
+  /**
+   * Serialize chain writes for a minute, across processes too
+   */
+  private withSessionLock<T>(minuteId: string, fn: () => Promise<T>): Promise<T> {
+    return withFileLock(join(this.minutesDirectory, minuteId, SESSION_LOCK_FILE), fn);
   }
 
   /**
@@ -99,61 +171,64 @@ export class VotingManager {
     modelId: string,
     votes: ProposalVote[]
   ): Promise<VotingBlock> {
-    const session = await this.loadVotingSession(minuteId);
-    const votingChain = new VotingChain(session);
-
-    // Validate model is eligible
-    if (!session.participants.includes(modelId)) {
-      throw new Error(`Model ${modelId} is not eligible to vote in this session`);
-    }
-
-    // Check if already voted
-    const existingVote = session.chain.find(block =>
-      block.type === 'vote' && block.model === modelId
-    );
-    if (existingVote) {
-      throw new Error(`Model ${modelId} has already voted`);
-    }
+    // Load, duplicate check and append must not interleave: two writers on
+    // the same chain head would fork the block log
+    return this.withSessionLock(minuteId, async () => {
+      const { session, votingChain } = await this.loadVotingChain(minuteId);
+
+      // Validate model is eligible
+      if (!session.participants.includes(modelId)) {
+        throw new Error(`Model ${modelId} is not eligible to vote in this session`);
+      }
 
-    // Validate session is active
-    if (session.status !== 'Active') {
-      throw new Error(`Voting session ${minuteId} is not active`);
-    }
+      // Check if already voted
+      const existingVote = session.chain.find(block =>
+        block.type === 'vote' && block.model === modelId
+      );
+      if (existingVote) {
+        throw new Error(`Model ${modelId} has already voted`);
+      }
 
-    const now = new Date();
-    if (now > session.endTime) {
-      throw new Error(`Voting session ${minuteId} has ended`);
-    }
+      // Validate session is active
+      if (session.status !== 'Active') {
+        throw new Error(`Voting session ${minuteId} is not active`);
+      }
 
-    // Create vote file
-    const voteFile = `votes/${modelId}.json`;
-    const voteFilePath = join(this.minutesDirectory, minuteId, voteFile);
+      const now = new Date();
+      if (now > session.endTime) {
+        throw new Error(`Voting session ${minuteId} has ended`);
+      }
 
-    const voteData = {
-      model: modelId,
-      timestamp: now.toISOString(),
-      proposals: votes
-    };
+      // Create vote file
+      const voteFile = `votes/${modelId}.json`;
+      const voteFilePath = join(this.minutesDirectory, minuteId, voteFile);
 
-    await fs.writeFile(voteFilePath, JSON.stringify(voteData, null, 2), 'utf-8');
+      const voteData = {
+        model: modelId,
+        timestamp: now.toISOString(),
+        proposals: votes
+      };
 
-    // Calculate vote file hash
-    const voteFileContent = await fs.readFile(voteFilePath, 'utf-8');
-    const voteFileHash = createHash('sha256').update(voteFileContent, 'utf8').digest('hex');
+      // Hash exactly the bytes being written
+      const voteFileContent = JSON.stringify(voteData, null, 2);
+      await fs.writeFile(voteFilePath, voteFileContent, 'utf-8');
+      const voteFileHash = createHash('sha256').update(voteFileContent, 'utf8').digest('hex');
 
-    const voteBlockData: VoteData = {
-      voteFile,
-      voteFileHash,
-      votes
-    };
+      const voteBlockData: VoteData = {
+        voteFile,
+        voteFileHash,
+        votes
+      };
 
-    // Add to chain
-    const block = votingChain.addVoteBlock(modelId, voteBlockData);
+      // Add to chain
+      const block = votingChain.addVoteBlock(modelId, voteBlockData);
 
-    // Update session
-    await this.saveVotingSession(votingChain.getSession());
+      // Update session
+      await this.appendToSession(session, [{ type: 'block', block }]);
+      await this.saveChainCheckpoint(minuteId, votingChain.getCheckpoint());
 
-    return block;
+      return block;
+    });
   }
 
   /**
@@ -161,7 +236,10 @@ export class VotingManager {
    */
   async canFinalize(minuteId: string): Promise<{ canFinalize: boolean; reason: string }> {
     const session = await this.loadVotingSession(minuteId);
-    const votingChain = new VotingChain(session);
+    return this.checkFinalization(session, new VotingChain(session));
+  }
+
+  private checkFinalization(session: VotingSession, votingChain: VotingChain): { canFinalize: boolean; reason: string } {
     const progress = votingChain.getVotingProgress();
 
     if (progress.isFinalized) {
@@ -192,128 +270,144 @@ export class VotingManager {
    * Finalize voting session and calculate results
    */
   async finalizeVoting(minuteId: string, reporterModel: string): Promise<ProposalResult[]> {
-    const session = await this.loadVotingSession(minuteId);
-    const votingChain = new VotingChain(session);
+    return this.withSessionLock(minuteId, async () => {
+      const { session, votingChain } = await this.loadVotingChain(minuteId);
 
-    const canFinalizeResult = await this.canFinalize(minuteId);
-    if (!canFinalizeResult.canFinalize) {
-      throw new Error(`Cannot finalize: ${canFinalizeResult.reason}`);
-    }
-
-    // Calculate results
-    const results = this.calculateResults(session);
-
-    // Create results file
-    const resultsFile = 'results.json';
-    const resultsFilePath = join(this.minutesDirectory, minuteId, resultsFile);
-
-    const resultsData = {
-      minute_id: minuteId,
-      generated_by: reporterModel,
-      timestamp: new Date().toISOString(),
-      auto_generated: true,
-      results: results.map(result => ({
-        proposal_id: result.proposalId,
-        score: result.totalScore,
-        status: result.status,
-        participation: result.participantCount,
-        breakdown: result.voteBreakdown
-      }))
-    };
-
-    await fs.writeFile(resultsFilePath, JSON.stringify(resultsData, null, 2), 'utf-8');
-
-    // Calculate results file hash
-    const resultsFileContent = await fs.readFile(resultsFilePath, 'utf-8');
-    const resultsFileHash = createHash('sha256').update(resultsFileContent, 'utf8').digest('hex');
+      const canFinalizeResult = this.checkFinalization(session, votingChain);
+      if (!canFinalizeResult.canFinalize) {
+        throw new Error(`Cannot finalize: ${canFinalizeResult.reason}`);
+      }
 
-    const resultBlockData: ResultData = {
-      resultFile: resultsFile,
-      resultFileHash: resultsFileHash,
-      results,
-      autoGenerated: true
-    };
+      // Calculate results
+      const results = await this.calculateResults(session);
+      const voteMerkleRoot = votingChain.getVoteMerkleRoot();
+      const voteCount = votingChain.getVoteCount();
+
+      // Create results file
+      const resultsFile = 'results.json';
+      const resultsFilePath = join(this.minutesDirectory, minuteId, resultsFile);
+
+      const resultsData = {
+        minute_id: minuteId,
+        generated_by: reporterModel,
+        timestamp: new Date().toISOString(),
+        auto_generated: true,
+        vote_merkle_root: voteMerkleRoot,
+        vote_count: voteCount,
+        results: results.map(result => ({
+          proposal_id: result.proposalId,
+          score: result.totalScore,
+          status: result.status,
+          participation: result.participantCount,
+          breakdown: result.voteBreakdown
+        }))
+      };
+
+      // Hash exactly the bytes being written
+      const resultsFileContent = JSON.stringify(resultsData, null, 2);
+      await fs.writeFile(resultsFilePath, resultsFileContent, 'utf-8');
+      const resultsFileHash = createHash('sha256').update(resultsFileContent, 'utf8').digest('hex');
+
+      const resultBlockData: ResultData = {
+        resultFile: resultsFile,
+        resultFileHash: resultsFileHash,
+        results,
+        autoGenerated: true,
+        voteMerkleRoot,
+        voteCount
+      };
+
+      // Add finalize block to chain
+      const block = votingChain.addFinalizeBlock(reporterModel, resultBlockData);
+
+      // Save updated session
+      await this.appendToSession(session, [
+        { type: 'block', block },
+        { type: 'status', status: session.status }
+      ]);
+      await this.saveChainCheckpoint(minuteId, votingChain.getCheckpoint());
+
+      return results;
+    });
+  }
 
-    // Add finalize block to chain
-    votingChain.addFinalizeBlock(reporterModel, resultBlockData);
+  /**
+   * Validate a minute's final_report.json against gov/schemas/minutes_report.schema.json
+   */
+  async validateMinutesReport(minuteId: string): Promise<{ isValid: boolean; errors: string[] }> {
+    const reportFile = join(this.minutesDirectory, minuteId, 'final_report.json');
 
-    // Save updated session
-    await this.saveVotingSession(votingChain.getSession());
+    let report: unknown;
+    try {
+      report = JSON.parse(await fs.readFile(reportFile, 'utf-8'));
+    } catch (error) {
+      return {
+        isValid: false,
+        errors: [`Cannot read final_report.json: ${error instanceof Error ? error.message : String(error)}`]
+      };
+    }
 
-    return results;
+    const result = validateSchema('minutes_report', report);
+    return { isValid: result.valid, errors: formatSchemaErrors(result.errors) };
   }
 
   /**
-   * Calculate voting results from all votes
+   * Inclusion proof for a model's vote. Finalized sessions prove against
+   * the root recorded in the finalize block.
    */
-  private calculateResults(session: VotingSession): ProposalResult[] {
-    const voteBlocks = session.chain.filter(block => block.type === 'vote');
-    const proposalResults: Map<string, ProposalResult> = new Map();
-
-    // Initialize results for all proposals
-    session.proposals.forEach(proposalId => {
-      proposalResults.set(proposalId, {
-        proposalId,
-        totalScore: 0,
-        participantCount: 0,
-        status: 'Rejected',
-        voteBreakdown: {
-          approve: 0,
-          reject: 0,
-          abstain: 0,
-          averageWeight: 0
-        }
-      });
-    });
+  async getVoteInclusionProof(minuteId: string, modelId: string): Promise<VoteInclusionProof> {
+    const { session, votingChain } = await this.loadVotingChain(minuteId);
+    const finalized = this.findFinalizeData(session);
+    return votingChain.getVoteInclusionProof(modelId, finalized?.voteCount);
+  }
 
-    // Process all votes
-    const allWeights: Map<string, number[]> = new Map();
-
-    voteBlocks.forEach(block => {
-      const voteData = block.data as VoteData;
-
-      voteData.votes.forEach(vote => {
-        const result = proposalResults.get(vote.proposalId);
-        if (!result) return;
-
-        result.participantCount++;
-        result.totalScore += vote.weight;
-
-        // Track weights for average calculation
-        if (!allWeights.has(vote.proposalId)) {
-          allWeights.set(vote.proposalId, []);
-        }
-        allWeights.get(vote.proposalId)!.push(vote.weight);
-
-        // Categorize vote (weights 7+ = approve, 1-3 = reject, 4-6 = abstain)
-        if (vote.weight >= 7) {
-          result.voteBreakdown.approve++;
-        } else if (vote.weight <= 3) {
-          result.voteBreakdown.reject++;
-        } else {
-          result.voteBreakdown.abstain++;
-        }
-      });
-    });
+  /**
+   * Verify a vote inclusion proof against this minute's committed root:
+   * the finalize block's root, or the current root for open sessions and
+   * sessions finalized before roots were recorded
+   */
+  async verifyVoteInclusionProof(minuteId: string, proof: VoteInclusionProof): Promise<boolean> {
+    if (proof.minuteId !== minuteId) {
+      return false;
+    }
 
-    // Calculate final results
-    proposalResults.forEach((result, proposalId) => {
-      const weights = allWeights.get(proposalId) || [];
-      result.voteBreakdown.averageWeight = weights.length > 0
-        ? weights.reduce((sum, w) => sum + w, 0) / weights.length
-        : 0;
+    const { session, votingChain } = await this.loadVotingChain(minuteId);
+    const finalized = this.findFinalizeData(session);
+    const expectedRoot = finalized?.voteMerkleRoot ?? votingChain.getVoteMerkleRoot();
 
-      // Determine approval status
-      const participationRate = result.participantCount / session.participants.length;
-      const approvalRate = result.voteBreakdown.approve / result.participantCount;
+    return VotingChain.verifyVoteInclusionProof(proof, expectedRoot);
+  }
 
-      const quorumMet = participationRate >= session.quorumThreshold;
-      const approvalMet = approvalRate >= session.approvalThreshold;
+  private findFinalizeData(session: VotingSession): ResultData | undefined {
+    const block = session.chain.find(candidate => candidate.type === 'finalize');
+    return block ? block.data as ResultData : undefined;
+  }
 
-      result.status = (quorumMet && approvalMet) ? 'Approved' : 'Rejected';
+  /**
+   * Tally the vote files recorded on the chain, checking each against its
+   * block's hash
+   */
+  private async calculateResults(session: VotingSession): Promise<ProposalResult[]> {
+    const voteData = session.chain
+      .filter(block => block.type === 'vote')
+      .map(block => block.data as VoteData);
+
+    const report = await this.tallyEngine.tally(session.minuteId, {
+      files: voteData.map(data => data.voteFile),
+      expectedHashes: new Map(voteData.map(data => [data.voteFile, data.voteFileHash]))
     });
 
-    return Array.from(proposalResults.values()).sort((a, b) => b.totalScore - a.totalScore);
+    if (report.rejected.length > 0) {
+      const problems = report.rejected.map(issue => `${issue.file}: ${issue.reason}`).join('; ');
+      throw new Error(`Cannot finalize: ${problems}`);
+    }
+
+    return toProposalResults(report.proposals, {
+      proposals: session.proposals,
+      participantCount: session.participants.length,
+      quorumThreshold: session.quorumThreshold,
+      approvalThreshold: session.approvalThreshold
+    });
   }
 
   /**
@@ -326,12 +420,33 @@ export class VotingManager {
   }
 
   /**
-   * Verify voting chain integrity
+   * Verify voting chain integrity. Only blocks after the stored checkpoint
+   * are rehashed unless `fullRescan` is set (e.g. for audits). Read-only
+   * unless `saveCheckpoint` is set; writers already advance the checkpoint.
    */
-  async verifyVotingIntegrity(minuteId: string) {
-    const session = await this.loadVotingSession(minuteId);
-    const votingChain = new VotingChain(session);
-    return votingChain.verifyChainIntegrity();
+  async verifyVotingIntegrity(
+    minuteId: string,
+    options: ChainVerificationOptions = {}
+  ): Promise<ChainVerificationResult> {
+    const { saveCheckpoint, ...verification } = options;
+    const verify = async () => {
+      const { votingChain } = await this.loadVotingChain(minuteId);
+      return votingChain.verifyChainIntegrity(verification);
+    };
+
+    if (!saveCheckpoint) {
+      return verify();
+    }
+
+    // Under the session lock, so a concurrent vote cannot be overwritten
+    // by an older checkpoint
+    return this.withSessionLock(minuteId, async () => {
+      const result = await verify();
+      if (result.isValid) {
+        await this.saveChainCheckpoint(minuteId, result.checkpoint);
+      }
+      return result;
+    });
   }
 
   /**
@@ -342,29 +457,32 @@ export class VotingManager {
   }
 
   /**
-   * Get list of active voting sessions
+   * Index summaries of active voting sessions (no session bodies are parsed)
    */
-  async getActiveSessions(): Promise<VotingSession[]> {
+  async getActiveSessionSummaries(): Promise<SessionIndexEntry[]> {
     try {
-      const entries = await fs.readdir(this.minutesDirectory, { withFileTypes: true });
-      const minuteDirs = entries.filter(entry => entry.isDirectory()).map(entry => entry.name);
-
-      const activeSessions: VotingSession[] = [];
-
-      for (const minuteDir of minuteDirs) {
-        try {
-          const session = await this.loadVotingSession(minuteDir);
-          if (session.status === 'Active') {
-            activeSessions.push(session);
-          }
-        } catch (error) {
-          // Skip directories without valid sessions
-        }
-      }
-
-      return activeSessions;
+      const entries = await this.sessionIndex.entries();
+      return entries.filter(entry => entry.status === 'Active');
     } catch (error) {
       return [];
     }
   }
+
+  /**
+   * Get list of active voting sessions
+   */
+  async getActiveSessions(): Promise<VotingSession[]> {
+    const summaries = await this.getActiveSessionSummaries();
+    const activeSessions: VotingSession[] = [];
+
+    for (const summary of summaries) {
+      try {
+        activeSessions.push(await this.loadVotingSession(summary.minuteId));
+      } catch (error) {
+        // Skip sessions that became unreadable since indexing
+      }
+    }
+
+    return activeSessions;
+  }
 }
@@ -1,5 +1,23 @@
-/**
- * Voting module exports
- */
-
-export { VotingManager } from './VotingManager.js';
+/**
+ * Voting module exports
+ */
+
+export { VotingManager } from './VotingManager.js';
+export { VotingSessionStore, SESSION_LOG_FILE, SESSION_LOG_VERSION } from './SessionStore.js';
+export type { SessionHeader, SessionLogRecord, SessionStoreOptions } from './SessionStore.js';
+export { SessionIndex, SESSION_INDEX_FILE } from './SessionIndex.js';
+export type { SessionIndexEntry } from './SessionIndex.js';
+export { TallyEngine, TALLY_AGGREGATE_FILE, normalizeVoteDocument, voteSigningPayload, toProposalResults } from './TallyEngine.js';
+export type {
+  TallyEngineOptions,
+  TallyOptions,
+  TallyReport,
+  TallyIssue,
+  TalliedVote,
+  ProposalTally,
+  ResultRules,
+  VoteSignature,
+  VoteSignatureVerifier
+} from './TallyEngine.js';
+export { createSignatureVerifier, signVote } from './SignatureVerifier.js';
+export type { SignatureVerifierOptions } from './SignatureVerifier.js';
@@ -233,7 +233,7 @@ export async function maintenanceWorkflow(
   const cleanedNotifications = await notificationManager.cleanupOldNotifications(cleanupDays);
 
   // Get all sessions for processing (maintenance tasks)
-  const activeSessions = await votingManager.getActiveSessions();
+  const activeSessions = await votingManager.getActiveSessionSummaries();
 
   return {
     cleanedNotifications,
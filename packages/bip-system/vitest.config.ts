@@ -3,6 +3,7 @@
  */
 
 import { defineConfig } from 'vitest/config';
+import { BenchJsonReporter } from '../../scripts/bench/json-reporter.js';
 
 export default defineConfig({
   test: {
@@ -21,6 +22,10 @@ export default defineConfig({
       ]
     },
     testTimeout: 10000,
-    hookTimeout: 10000
+    hookTimeout: 10000,
+    benchmark: {
+      include: ['src/**/*.bench.ts'],
+      reporters: ['default', new BenchJsonReporter()]
+    }
   }
 });
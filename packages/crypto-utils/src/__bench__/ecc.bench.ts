@@ -0,0 +1,20 @@
+/**
+ * @fileoverview Benchmarks for ECCService signing and verification
+ */
+
+import { bench, describe } from 'vitest';
+import { ECCService } from '../ecc/index.js';
+
+const message = JSON.stringify({ proposalId: 'P042', modelId: 'claude-4-sonnet', weight: 8 });
+const keyPair = await ECCService.generateKeyPair();
+const signature = await ECCService.signMessage(message, keyPair.privateKey);
+
+describe('ECCService', () => {
+  bench('signMessage', async () => {
+    await ECCService.signMessage(message, keyPair.privateKey);
+  });
+
+  bench('verifySignature', async () => {
+    await ECCService.verifySignature(message, signature, keyPair.publicKey);
+  });
+});
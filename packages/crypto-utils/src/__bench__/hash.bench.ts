@@ -0,0 +1,26 @@
+/**
+ * @fileoverview Benchmarks for VoteHashService
+ */
+
+import { bench, describe } from 'vitest';
+import { VoteHashService } from '../hash.js';
+import type { Vote } from '@cmmv-hive/shared-types';
+
+const vote: Vote = {
+  proposalId: 'P042',
+  modelId: 'claude-4-sonnet',
+  weight: 8,
+  signature: '',
+  timestamp: new Date('2025-09-08T10:00:00.000Z'),
+  justification: 'Improves verification throughput without changing the chain format.'
+};
+
+describe('VoteHashService', () => {
+  bench('generateVoteHash', () => {
+    VoteHashService.generateVoteHash(vote);
+  });
+
+  bench('verifyVoteHash', () => {
+    VoteHashService.verifyVoteHash(vote, 'a'.repeat(64));
+  });
+});
@@ -0,0 +1,53 @@
+/**
+ * @fileoverview Benchmarks for SignatureService batch verification
+ */
+
+import { bench, describe } from 'vitest';
+import { ECCService } from '../ecc/index.js';
+import { SignatureService } from '../signature/index.js';
+import type { SignedMessage } from '@cmmv-hive/shared-types';
+
+const MODEL_COUNT = 16;
+const BATCH_SIZES = [64, 512];
+
+const models = await Promise.all(Array.from({ length: MODEL_COUNT }, async (_, i) => {
+  const keyPair = await ECCService.generateKeyPair();
+  const modelName = `model-${i}`;
+
+  return {
+    keyPair,
+    identity: {
+      modelName,
+      provider: 'bench',
+      publicKey: Buffer.from(keyPair.publicKey).toString('hex'),
+      keyId: `key-${i}`,
+      createdAt: new Date(),
+      expiresAt: new Date(Date.now() + 24 * 60 * 60 * 1000),
+      signature: ''
+    }
+  };
+}));
+
+const identities = models.map(model => model.identity);
+
+async function signedBatch(size: number): Promise<SignedMessage[]> {
+  return Promise.all(Array.from({ length: size }, (_, i) => {
+    const model = models[i % models.length]!;
+    return SignatureService.signMessage(
+      `vote ${i}`,
+      model.keyPair.privateKey,
+      'vote',
+      { modelId: model.identity.modelName }
+    );
+  }));
+}
+
+for (const size of BATCH_SIZES) {
+  const batch = await signedBatch(size);
+
+  describe(`SignatureService (${size} signatures)`, () => {
+    bench('batchVerifySignatures', async () => {
+      await SignatureService.batchVerifySignatures(batch, identities);
+    }, { iterations: 5 });
+  });
+}
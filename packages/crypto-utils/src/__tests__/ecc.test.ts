@@ -85,6 +85,27 @@ describe('ECCService', () => {
       expect(verification.isValid).toBe(false);
     });
 
+    it('should sign a pre-hashed digest with a known signer key', async () => {
+      const digest = ECCService.hashMessage(testMessage);
+      const signature = await ECCService.signMessage(digest, keyPair.privateKey, {
+        prehashed: true,
+        signerPublicKey: keyPair.publicKey,
+        verifyRecovery: true,
+      });
+
+      const verification = await ECCService.verifySignature(testMessage, signature, keyPair.publicKey);
+      expect(verification.isValid).toBe(true);
+
+      const recoveredKey = await ECCService.recoverPublicKey(testMessage, signature);
+      expect(recoveredKey).toEqual(keyPair.publicKey);
+    });
+
+    it('should reject a pre-hashed message that is not a digest', async () => {
+      await expect(
+        ECCService.signMessage(testMessage, keyPair.privateKey, { prehashed: true })
+      ).rejects.toThrow('32-byte digest');
+    });
+
     it('should reject signature with wrong public key', async () => {
       const signature = await ECCService.signMessage(testMessage, keyPair.privateKey);
       // Use deterministic different seed to guarantee a different key under mocked RNG
@@ -27,6 +27,28 @@ describe('VoteHashService', () => {
       expect(/^[a-f0-9]{64}$/.test(hash1)).toBe(true);
     });
 
+    it('should hash the current contents of a mutated vote', () => {
+      const vote: Vote = {
+        proposalId: 'test-proposal-123',
+        modelId: 'test-model-456',
+        weight: 8,
+        timestamp: new Date('2024-01-01T12:00:00Z')
+      };
+
+      const before = VoteHashService.generateVoteHash(vote);
+      expect(VoteHashService.canonicalVoteBytes(vote)).toContain('2024-01-01T12:00:00.000Z');
+
+      vote.timestamp.setUTCFullYear(2025);
+      const after = VoteHashService.generateVoteHash(vote);
+
+      expect(after).not.toBe(before);
+      expect(after).toBe(VoteHashService.generateVoteHash({ ...vote, timestamp: new Date('2025-01-01T12:00:00Z') }));
+
+      // readonly is compile-time only: a tampered vote must not verify
+      (vote as { weight: number }).weight = 1;
+      expect(VoteHashService.verifyVoteHash(vote, after)).toBe(false);
+    });
+
     it('should generate different hashes for different votes', () => {
       const vote1: Vote = {
         proposalId: 'proposal-1',
@@ -20,6 +20,61 @@ describe('SignatureService', () => {
     const verification = await ECCService.verifySignedMessage(signed, keyPair.publicKey);
     expect(verification.isValid).toBe(true);
   });
+
+  it('should batch verify signatures and report throughput', async () => {
+    const keyPair = await ECCService.generateKeyPair();
+    const identity = {
+      modelName: 'model-B',
+      provider: 'provider-y',
+      publicKey: Buffer.from(keyPair.publicKey).toString('hex'),
+      keyId: 'test-key',
+      createdAt: new Date(),
+      expiresAt: new Date(Date.now() + 60_000),
+      signature: '',
+    };
+
+    const valid = await SignatureService.signMessage('vote A', keyPair.privateKey, 'vote', { modelId: 'model-B' });
+    const tampered = { ...valid, content: 'vote B' };
+    const unknown = await SignatureService.signMessage('vote C', keyPair.privateKey, 'vote', { modelId: 'model-Z' });
+
+    const report = await SignatureService.batchVerify([valid, tampered, unknown], [identity]);
+
+    expect(report.results.map(r => r.isValid)).toEqual([true, false, false]);
+    expect(report.results[2]!.error).toBe('Model identity not found');
+    expect(report.validSignatures).toBe(1);
+    expect(report.invalidSignatures).toBe(2);
+    expect(report.workersUsed).toBe(0);
+    expect(report.signaturesPerSecond).toBeGreaterThan(0);
+  });
+
+  it('should give the same results through pooled workers across batches', async () => {
+    const keyPair = await ECCService.generateKeyPair();
+    const identity = {
+      modelName: 'model-W',
+      provider: 'provider-w',
+      publicKey: Buffer.from(keyPair.publicKey).toString('hex'),
+      keyId: 'worker-key',
+      createdAt: new Date(),
+      expiresAt: new Date(Date.now() + 60_000),
+      signature: '',
+    };
+    const messages = await Promise.all(['a', 'b', 'c', 'd'].map(content =>
+      SignatureService.signMessage(content, keyPair.privateKey, 'vote', { modelId: 'model-W' })
+    ));
+    const batch = [...messages, { ...messages[0]!, content: 'forged' }];
+
+    try {
+      // Workers are reused by the second batch; chunks of a worker that cannot
+      // start (e.g. when running from source) fall back to the calling thread
+      for (let round = 0; round < 2; round++) {
+        const report = await SignatureService.batchVerify(batch, [identity], { workers: 2, minBatchSizeForWorkers: 1 });
+        expect(report.results.map(r => r.isValid)).toEqual([true, true, true, true, false]);
+        expect(report.workersUsed).toBeLessThanOrEqual(2);
+      }
+    } finally {
+      await SignatureService.terminateWorkers();
+    }
+  });
 });
 
 
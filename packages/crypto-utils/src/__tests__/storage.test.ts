@@ -37,6 +37,68 @@ describe('SecureKeyStorage', () => {
     const list = await SecureKeyStorage.listStoredKeys();
     expect(list.length).toBeGreaterThan(0);
   });
-});
 
+  it('should record KDF parameters and keep reading entries stored under older settings', async () => {
+    const keyPair = await ECCService.generateKeyPair();
+    await SecureKeyStorage.storePrivateKey('test-key-4', keyPair.privateKey, 'pass-4');
+
+    SecureKeyStorage.configure({ kdf: { algorithm: 'scrypt', cost: 1024 } });
+    try {
+      await SecureKeyStorage.storePrivateKey('test-key-5', keyPair.privateKey, 'pass-5');
+
+      const legacy = await SecureKeyStorage.retrievePrivateKey('test-key-4', 'pass-4');
+      const upgraded = await SecureKeyStorage.retrievePrivateKey('test-key-5', 'pass-5');
+      expect(Buffer.from(legacy).equals(Buffer.from(keyPair.privateKey))).toBe(true);
+      expect(Buffer.from(upgraded).equals(Buffer.from(keyPair.privateKey))).toBe(true);
+    } finally {
+      SecureKeyStorage.configure({ kdf: SecureKeyStorage.LEGACY_KDF });
+    }
+  });
+
+  it('should reject scrypt settings that cannot derive a key', async () => {
+    for (const kdf of [
+      { algorithm: 'scrypt', cost: 2 },
+      { algorithm: 'scrypt', cost: 1000 },
+      { algorithm: 'scrypt', cost: 1024, parallelization: 0 },
+      { algorithm: 'scrypt', cost: 1024, parallelization: 1000 },
+      { algorithm: 'scrypt', cost: 1024, blockSize: 64 },
+      { algorithm: 'scrypt', cost: 2 ** 24 },
+    ] as const) {
+      expect(() => SecureKeyStorage.configure({ kdf })).toThrow(/scrypt/);
+    }
+
+    // Largest accepted parallelization at the minimum cost still unlocks
+    const keyPair = await ECCService.generateKeyPair();
+    SecureKeyStorage.configure({ kdf: { algorithm: 'scrypt', cost: 1024, blockSize: 1, parallelization: 16 } });
+    try {
+      await SecureKeyStorage.storePrivateKey('test-key-7', keyPair.privateKey, 'pass-7');
+      const retrieved = await SecureKeyStorage.retrievePrivateKey('test-key-7', 'pass-7');
+      expect(Buffer.from(retrieved).equals(Buffer.from(keyPair.privateKey))).toBe(true);
+    } finally {
+      SecureKeyStorage.configure({ kdf: SecureKeyStorage.LEGACY_KDF });
+    }
+  });
+
+  it('should serve unlocked keys from the cache until locked', async () => {
+    const keyPair = await ECCService.generateKeyPair();
+    const keyId = 'test-key-6';
+    await SecureKeyStorage.storePrivateKey(keyId, keyPair.privateKey, 'pass-6');
+
+    SecureKeyStorage.configure({ unlockCache: { ttlMs: 60000 } });
+    try {
+      const first = await SecureKeyStorage.retrievePrivateKey(keyId, 'pass-6');
+      first.fill(0); // callers own their copy
 
+      const second = await SecureKeyStorage.retrievePrivateKey(keyId, 'pass-6');
+      expect(Buffer.from(second).equals(Buffer.from(keyPair.privateKey))).toBe(true);
+      expect(SecureKeyStorage.getStorageStats().unlockedKeys).toBe(1);
+
+      await expect(SecureKeyStorage.retrievePrivateKey(keyId, 'wrong-pass')).rejects.toBeInstanceOf(Error);
+
+      expect(SecureKeyStorage.lockKey(keyId)).toBe(true);
+      expect(SecureKeyStorage.getStorageStats().unlockedKeys).toBe(0);
+    } finally {
+      SecureKeyStorage.configure({ unlockCache: null });
+    }
+  });
+});
@@ -16,6 +16,23 @@ import type {
   SignatureVerificationResult
 } from '@cmmv-hive/shared-types';
 
+/**
+ * Public key decoded to a curve point, reusable across verifications
+ */
+export type DecodedPublicKey = InstanceType<typeof secp256k1.ProjectivePoint>;
+
+/**
+ * Options for ECCService.signMessage
+ */
+export interface SignMessageOptions {
+  /** Treat the message as an already computed 32-byte SHA-256 digest */
+  readonly prehashed?: boolean;
+  /** Signer public key, if known, used by verifyRecovery instead of re-deriving it */
+  readonly signerPublicKey?: Uint8Array;
+  /** Recover the public key once and check it matches the signer (audit mode) */
+  readonly verifyRecovery?: boolean;
+}
+
 /**
  * Core ECC Cryptography Service
  * Implements secp256k1 elliptic curve operations for digital signatures
@@ -128,50 +145,55 @@ export class ECCService {
    */
   static async signMessage(
     message: string | Uint8Array,
-    privateKey: Uint8Array
+    privateKey: Uint8Array,
+    options: SignMessageOptions = {}
   ): Promise<ECCSignature> {
-    this.ensureHashProvidersConfigured();
-    // Convert message to bytes if needed
-    const messageBytes = typeof message === 'string'
-      ? new TextEncoder().encode(message)
-      : message;
+    const messageHash = options.prehashed
+      ? ECCService.assertDigest(message)
+      : ECCService.hashMessage(message);
+
+    const signature = ECCService.signDigest(messageHash, privateKey);
+
+    if (options.verifyRecovery) {
+      const signerPub = options.signerPublicKey ?? secp256k1.getPublicKey(privateKey, true);
+      const recovered = new secp256k1.Signature(
+        ECCService.bytesToBigint(signature.r as Uint8Array),
+        ECCService.bytesToBigint(signature.s as Uint8Array),
+        signature.recovery
+      ).recoverPublicKey(messageHash).toRawBytes(signerPub.length === 33);
+
+      if (!Buffer.from(recovered).equals(Buffer.from(signerPub))) {
+        throw new Error('Recovered public key does not match signer public key');
+      }
+    }
 
-    // Hash the message using SHA-256
-    const buffer = messageBytes.buffer instanceof ArrayBuffer
-      ? messageBytes.buffer.slice(messageBytes.byteOffset, messageBytes.byteOffset + messageBytes.byteLength)
-      : messageBytes.slice();
-    const subtle = (globalThis as any).crypto?.subtle ?? nodeWebCrypto?.subtle;
-    if (!subtle) throw new Error('WebCrypto subtle API not available for hashing');
-    const messageHash = await subtle.digest('SHA-256', buffer);
-    const messageHashArray = new Uint8Array(messageHash);
+    return signature;
+  }
+
+  /**
+   * Sign a 32-byte digest synchronously. The recovery id is taken from the
+   * underlying secp256k1 signature, so signing costs one scalar multiplication.
+   */
+  static signDigest(digest: Uint8Array, privateKey: Uint8Array): ECCSignature {
+    this.ensureHashProvidersConfigured();
+    ECCService.assertDigest(digest);
 
     // Sign using deterministic nonce (RFC 6979)
-    const sigObj: any = secp256k1.sign(messageHashArray, privateKey);
-    const rBytes = new Uint8Array(32).map((_, i) => Number((sigObj.r as bigint >> BigInt((31 - i) * 8)) & 0xffn));
-    const sBytes = new Uint8Array(32).map((_, i) => Number((sigObj.s as bigint >> BigInt((31 - i) * 8)) & 0xffn));
-
-    // Derive recovery id by matching recovered public key to the signer public key
-    const compact = new Uint8Array([...rBytes, ...sBytes]);
-    const sig = secp256k1.Signature.fromCompact(compact);
-    const signerPub = secp256k1.getPublicKey(privateKey, true);
-    let recid = 0;
-    for (let i = 0; i <= 3; i++) {
-      try {
-        const rec = secp256k1.Signature
-          .fromCompact(compact)
-          .addRecoveryBit(i)
-          .recoverPublicKey(messageHashArray)
-          .toRawBytes(true);
-        if (Buffer.from(rec).equals(Buffer.from(signerPub))) {
-          recid = i;
-          break;
-        }
-      } catch {
-        // ignore and try next
-      }
-    }
+    const sig = secp256k1.sign(digest, privateKey);
+    const compact = sig.toCompactRawBytes();
 
-    return { r: rBytes, s: sBytes, recovery: recid };
+    return {
+      r: compact.slice(0, 32),
+      s: compact.slice(32, 64),
+      recovery: sig.recovery ?? 0,
+    };
+  }
+
+  private static assertDigest(message: string | Uint8Array): Uint8Array {
+    if (typeof message === 'string' || message.length !== 32) {
+      throw new Error('Pre-hashed message must be a 32-byte digest');
+    }
+    return message;
   }
 
   /**
@@ -232,6 +254,68 @@ export class ECCService {
     }
   }
 
+  /**
+   * Hash a message with SHA-256 synchronously using Node's crypto
+   */
+  static hashMessage(message: string | Uint8Array): Uint8Array {
+    const digest = createHash('sha256').update(message).digest();
+    return new Uint8Array(digest.buffer, digest.byteOffset, digest.byteLength);
+  }
+
+  /**
+   * Read the r/s components as scalars. Byte arrays are viewed in place and
+   * parsed once instead of being rebuilt byte by byte.
+   */
+  static signatureScalars(signature: ECCSignature): { r: bigint; s: bigint } {
+    return {
+      r: typeof signature.r === 'bigint' ? signature.r : ECCService.bytesToBigint(signature.r),
+      s: typeof signature.s === 'bigint' ? signature.s : ECCService.bytesToBigint(signature.s),
+    };
+  }
+
+  /**
+   * Decode a compressed or uncompressed public key into a curve point so
+   * repeated verifications against the same key skip decompression
+   */
+  static decodePublicKey(publicKey: Uint8Array): DecodedPublicKey {
+    return secp256k1.ProjectivePoint.fromHex(publicKey);
+  }
+
+  /**
+   * Verify an ECDSA signature over a precomputed 32-byte SHA-256 digest
+   */
+  static verifyDigest(
+    digest: Uint8Array,
+    signature: ECCSignature,
+    publicKey: Uint8Array | DecodedPublicKey
+  ): boolean {
+    try {
+      const { r, s } = ECCService.signatureScalars(signature);
+      const sig = new secp256k1.Signature(r, s);
+      // verify() accepts an already decoded point as well as encoded key bytes
+      return secp256k1.verify(sig, digest, publicKey as Uint8Array);
+    } catch {
+      return false;
+    }
+  }
+
+  /**
+   * Canonical string form of a signable message, as covered by its signature
+   */
+  static canonicalMessageContent(message: SignableMessage): string {
+    return JSON.stringify({
+      content: message.content,
+      type: message.type,
+      context: message.context,
+      timestamp: message.timestamp.toISOString(),
+    });
+  }
+
+  private static bytesToBigint(bytes: Uint8Array): bigint {
+    if (bytes.length === 0) return 0n;
+    return BigInt('0x' + Buffer.from(bytes.buffer, bytes.byteOffset, bytes.byteLength).toString('hex'));
+  }
+
   /**
    * Create a signable message with timestamp and context
    */
@@ -256,12 +340,7 @@ export class ECCService {
     privateKey: Uint8Array
   ): Promise<SignedMessage> {
     // Create canonical representation for signing
-    const canonicalContent = JSON.stringify({
-      content: message.content,
-      type: message.type,
-      context: message.context,
-      timestamp: message.timestamp.toISOString(),
-    });
+    const canonicalContent = this.canonicalMessageContent(message);
 
     const signature = await this.signMessage(canonicalContent, privateKey);
 
@@ -283,12 +362,7 @@ export class ECCService {
     publicKey: Uint8Array
   ): Promise<SignatureVerificationResult> {
     // Recreate the canonical content that was signed
-    const canonicalContent = JSON.stringify({
-      content: signedMessage.content,
-      type: signedMessage.type,
-      context: signedMessage.context,
-      timestamp: signedMessage.timestamp.toISOString(),
-    });
+    const canonicalContent = this.canonicalMessageContent(signedMessage);
 
     return this.verifySignature(canonicalContent, signedMessage.signature, publicKey);
   }
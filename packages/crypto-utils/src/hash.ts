@@ -19,10 +19,19 @@ export class VoteHashService {
    * This ensures all models use the same hashing method for consistency
    */
   static generateVoteHash(vote: Vote): string {
+    // Never cached: verification must hash the vote as it is now, and
+    // readonly fields can still be mutated at runtime
     const canonicalData = this.createCanonicalVoteData(vote);
     return this.hashData(canonicalData);
   }
 
+  /**
+   * Canonical serialization of a vote, as hashed by generateVoteHash
+   */
+  static canonicalVoteBytes(vote: Vote): string {
+    return this.createCanonicalVoteData(vote);
+  }
+
   /**
    * Generate SHA256 hash for a proposal signature
    * Used for proposal integrity verification
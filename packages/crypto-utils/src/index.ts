@@ -5,13 +5,22 @@
  */
 
 // Core ECC operations
-export { ECCService } from './ecc/index.js';
+export {
+  ECCService,
+  type DecodedPublicKey,
+  type SignMessageOptions,
+} from './ecc/index.js';
 
 // Digital signature service
-export { SignatureService } from './signature/index.js';
+export {
+  SignatureService,
+  type BatchVerificationOptions,
+  type BatchVerificationReport,
+} from './signature/index.js';
 
 // Secure key storage
 export { SecureKeyStorage } from './storage/index.js';
+export type { KeyStorageOptions, UnlockCacheOptions } from './storage/index.js';
 
 // Vote hash service for standardized SHA256 generation
 export { VoteHashService } from './hash.js';
@@ -27,4 +36,5 @@ export type {
   SignatureVerificationResult,
   KeyStorageEntry,
   KeyMetadata,
+  KdfParameters,
 } from '@cmmv-hive/shared-types';
@@ -4,8 +4,11 @@
  * @version 1.0.0
  */
 
-import { ECCService } from '../ecc/index.js';
+import { ECCService, type DecodedPublicKey } from '../ecc/index.js';
+import type { VerificationJob, VerificationOutcome, VerificationReply } from './verify-worker.js';
 import { createHash } from 'crypto';
+import { performance } from 'perf_hooks';
+import { Worker } from 'worker_threads';
 import type {
   ECCKeyPair,
   ECCSignature,
@@ -15,12 +18,72 @@ import type {
   SignatureVerificationResult
 } from '@cmmv-hive/shared-types';
 
+/**
+ * Options for batch signature verification
+ */
+export interface BatchVerificationOptions {
+  /** Worker threads to fan out across; 0 verifies on the calling thread */
+  readonly workers?: number;
+  /** Smallest batch worth the cost of copying jobs to workers (default 256) */
+  readonly minBatchSizeForWorkers?: number;
+}
+
+/**
+ * Per-message results plus aggregate throughput for a batch
+ */
+export interface BatchVerificationReport {
+  readonly results: SignatureVerificationResult[];
+  readonly totalMessages: number;
+  readonly validSignatures: number;
+  readonly invalidSignatures: number;
+  readonly totalTimeMs: number;
+  readonly signaturesPerSecond: number;
+  readonly workersUsed: number;
+}
+
+/**
+ * Public key decoded once and reused across verifications
+ */
+interface CachedPublicKey {
+  readonly bytes: Uint8Array;
+  readonly point: DecodedPublicKey;
+}
+
+/**
+ * Message prepared for verification: digest computed, key resolved
+ */
+interface PreparedVerification {
+  readonly index: number;
+  readonly digest: Uint8Array;
+  readonly signature: ECCSignature;
+  readonly key: CachedPublicKey;
+}
+
+/**
+ * Verification worker kept alive between batches
+ */
+interface PooledWorker {
+  readonly worker: Worker;
+  readonly pending: Map<number, { resolve(outcomes: VerificationOutcome[]): void; reject(error: Error): void }>;
+}
+
 /**
  * Digital Signature Service for AI Model Authentication
  * Provides high-level interface for model identity and signature operations
  */
 export class SignatureService {
   private static readonly KEY_EXPIRATION_DAYS = 365; // 1 year
+  private static readonly DECODED_KEY_CACHE_SIZE = 1024;
+  private static readonly DEFAULT_MIN_BATCH_FOR_WORKERS = 256;
+
+  // Hex public key -> decoded point (null when the key is invalid), least
+  // recently used first out
+  private static readonly decodedKeyCache = new Map<string, CachedPublicKey | null>();
+
+  // Started on first use and grown to the largest worker count requested.
+  // Idle workers are unref'd so they never keep the process alive.
+  private static readonly workerPool: PooledWorker[] = [];
+  private static nextWorkerJobId = 1;
 
   /**
    * Create a new model identity with cryptographic keys
@@ -187,31 +250,244 @@ export class SignatureService {
     signedMessages: SignedMessage[],
     modelIdentities: ModelIdentity[]
   ): Promise<SignatureVerificationResult[]> {
-    const results: SignatureVerificationResult[] = [];
+    const report = await this.batchVerify(signedMessages, modelIdentities);
+    return report.results;
+  }
+
+  /**
+   * Verify a batch of signed messages with synchronous hashing and public keys
+   * decoded once per identity, optionally fanning out across worker threads
+   */
+  static async batchVerify(
+    signedMessages: SignedMessage[],
+    modelIdentities: ModelIdentity[],
+    options: BatchVerificationOptions = {}
+  ): Promise<BatchVerificationReport> {
+    const startTime = performance.now();
+    const results = new Array<SignatureVerificationResult>(signedMessages.length);
+    const prepared: PreparedVerification[] = [];
 
     // Create a map for faster lookups
     const identityMap = new Map(
       modelIdentities.map(identity => [identity.modelName, identity])
     );
 
-    // Process in parallel for better performance
-    const promises = signedMessages.map(async (message) => {
+    signedMessages.forEach((message, index) => {
       const identity = identityMap.get(message.context?.modelId as string);
       if (!identity) {
+        results[index] = this.failedVerification('Model identity not found');
+        return;
+      }
+
+      const key = this.getDecodedPublicKey(identity);
+      if (!key) {
+        results[index] = this.failedVerification('Invalid public key format');
+        return;
+      }
+
+      prepared.push({
+        index,
+        digest: ECCService.hashMessage(ECCService.canonicalMessageContent(message)),
+        signature: message.signature,
+        key,
+      });
+    });
+
+    const requestedWorkers = Math.max(0, Math.floor(options.workers ?? 0));
+    const minBatch = options.minBatchSizeForWorkers ?? this.DEFAULT_MIN_BATCH_FOR_WORKERS;
+    let workersUsed = 0;
+
+    if (requestedWorkers > 0 && prepared.length >= minBatch) {
+      workersUsed = await this.verifyInWorkers(prepared, requestedWorkers, results);
+    } else {
+      this.verifyInline(prepared, results);
+    }
+
+    const totalTimeMs = performance.now() - startTime;
+    const validSignatures = results.filter(r => r.isValid).length;
+
+    return {
+      results,
+      totalMessages: signedMessages.length,
+      validSignatures,
+      invalidSignatures: signedMessages.length - validSignatures,
+      totalTimeMs,
+      signaturesPerSecond: totalTimeMs > 0 ? (signedMessages.length / totalTimeMs) * 1000 : 0,
+      workersUsed,
+    };
+  }
+
+  /**
+   * Resolve and cache the decoded public key of a model identity
+   */
+  private static getDecodedPublicKey(identity: ModelIdentity): CachedPublicKey | null {
+    const cached = this.decodedKeyCache.get(identity.publicKey);
+    if (cached !== undefined) {
+      this.decodedKeyCache.delete(identity.publicKey);
+      this.decodedKeyCache.set(identity.publicKey, cached);
+      return cached;
+    }
+
+    let entry: CachedPublicKey | null = null;
+    try {
+      const bytes = new Uint8Array(Buffer.from(identity.publicKey, 'hex'));
+      entry = { bytes, point: ECCService.decodePublicKey(bytes) };
+    } catch {
+      entry = null;
+    }
+
+    if (this.decodedKeyCache.size >= this.DECODED_KEY_CACHE_SIZE) {
+      const oldest = this.decodedKeyCache.keys().next().value;
+      if (oldest !== undefined) {
+        this.decodedKeyCache.delete(oldest);
+      }
+    }
+    this.decodedKeyCache.set(identity.publicKey, entry);
+
+    return entry;
+  }
+
+  private static verifyInline(
+    prepared: PreparedVerification[],
+    results: SignatureVerificationResult[]
+  ): void {
+    for (const job of prepared) {
+      const start = performance.now();
+      const isValid = ECCService.verifyDigest(job.digest, job.signature, job.key.point);
+
+      results[job.index] = {
+        isValid,
+        ...(isValid ? {} : { error: 'Signature verification failed' }),
+        verifiedAt: new Date(),
+        verificationTimeMs: performance.now() - start,
+      };
+    }
+  }
+
+  /**
+   * Terminate the pooled verification workers; the next worker batch starts new ones
+   */
+  static async terminateWorkers(): Promise<void> {
+    const workers = this.workerPool.splice(0);
+    await Promise.all(workers.map(pooled => pooled.worker.terminate()));
+  }
+
+  /**
+   * Pooled workers to spread a batch across, starting any that are missing
+   */
+  private static getWorkers(count: number): PooledWorker[] {
+    const workerUrl = new URL('./verify-worker.js', import.meta.url);
+
+    while (this.workerPool.length < count) {
+      let worker: Worker;
+      try {
+        worker = new Worker(workerUrl);
+      } catch {
+        break;
+      }
+
+      const pooled: PooledWorker = { worker, pending: new Map() };
+      const fail = (error: Error): void => {
+        const index = this.workerPool.indexOf(pooled);
+        if (index >= 0) {
+          this.workerPool.splice(index, 1);
+        }
+        for (const waiter of pooled.pending.values()) {
+          waiter.reject(error);
+        }
+        pooled.pending.clear();
+      };
+
+      worker.on('message', (reply: VerificationReply) => {
+        const waiter = pooled.pending.get(reply.id);
+        if (!waiter) return;
+        pooled.pending.delete(reply.id);
+        if (pooled.pending.size === 0) {
+          worker.unref();
+        }
+        waiter.resolve(reply.outcomes);
+      });
+      worker.on('error', fail);
+      worker.on('exit', code => fail(new Error(`Verification worker exited with code ${code}`)));
+      worker.unref();
+      this.workerPool.push(pooled);
+    }
+
+    return this.workerPool.slice(0, count);
+  }
+
+  private static runOnWorker(pooled: PooledWorker, jobs: VerificationJob[]): Promise<VerificationOutcome[]> {
+    return new Promise((resolve, reject) => {
+      const id = this.nextWorkerJobId++;
+      pooled.pending.set(id, { resolve, reject });
+      // Held while a batch is outstanding so the process waits for the reply
+      pooled.worker.ref();
+      pooled.worker.postMessage({ id, jobs });
+    });
+  }
+
+  /**
+   * Split prepared verifications across pooled worker threads. Chunks whose
+   * worker fails are verified on the calling thread instead.
+   */
+  private static async verifyInWorkers(
+    prepared: PreparedVerification[],
+    workerCount: number,
+    results: SignatureVerificationResult[]
+  ): Promise<number> {
+    const workers = this.getWorkers(Math.min(workerCount, prepared.length));
+    if (workers.length === 0) {
+      this.verifyInline(prepared, results);
+      return 0;
+    }
+
+    const count = workers.length;
+    const chunkSize = Math.ceil(prepared.length / count);
+    let workersUsed = 0;
+
+    await Promise.all(Array.from({ length: count }, async (_, w) => {
+      const chunk = prepared.slice(w * chunkSize, (w + 1) * chunkSize);
+      if (chunk.length === 0) return;
+
+      const jobs: VerificationJob[] = chunk.map(job => {
+        const compact = ECCService.signatureToCompact(job.signature).signature;
         return {
-          isValid: false,
-          error: 'Model identity not found',
-          verifiedAt: new Date(),
-          verificationTimeMs: 0,
+          digest: job.digest,
+          r: compact.subarray(0, 32),
+          s: compact.subarray(32, 64),
+          publicKey: job.key.bytes,
         };
+      });
+
+      try {
+        const outcomes = await this.runOnWorker(workers[w]!, jobs);
+
+        chunk.forEach((job, i) => {
+          const outcome = outcomes[i];
+          const isValid = outcome?.isValid ?? false;
+          results[job.index] = {
+            isValid,
+            ...(isValid ? {} : { error: 'Signature verification failed' }),
+            verifiedAt: new Date(),
+            verificationTimeMs: outcome?.verificationTimeMs ?? 0,
+          };
+        });
+        workersUsed++;
+      } catch {
+        this.verifyInline(chunk, results);
       }
-      return this.verifySignature(message, identity);
-    });
+    }));
 
-    const batchResults = await Promise.all(promises);
-    results.push(...batchResults);
+    return workersUsed;
+  }
 
-    return results;
+  private static failedVerification(error: string): SignatureVerificationResult {
+    return {
+      isValid: false,
+      error,
+      verifiedAt: new Date(),
+      verificationTimeMs: 0,
+    };
   }
 
   /**
@@ -235,8 +511,10 @@ export class SignatureService {
     invalidSignatures: number;
     averageVerificationTime: number;
     successRate: number;
+    signaturesPerSecond: number;
   }> {
-    const results = await this.batchVerifySignatures(signedMessages, modelIdentities);
+    const report = await this.batchVerify(signedMessages, modelIdentities);
+    const results = report.results;
 
     const validCount = results.filter(r => r.isValid).length;
     const totalTime = results.reduce((sum, r) => sum + r.verificationTimeMs, 0);
@@ -248,6 +526,7 @@ export class SignatureService {
       invalidSignatures: results.length - validCount,
       averageVerificationTime: Math.round(averageTime * 100) / 100,
       successRate: results.length > 0 ? (validCount / results.length) * 100 : 0,
+      signaturesPerSecond: Math.round(report.signaturesPerSecond * 100) / 100,
     };
   }
 }
@@ -0,0 +1,88 @@
+/**
+ * @fileoverview Worker thread entry point for batch signature verification
+ * @author CMMV-Hive Team
+ * @version 1.0.0
+ */
+
+import { parentPort } from 'worker_threads';
+import { performance } from 'perf_hooks';
+import { ECCService, type DecodedPublicKey } from '../ecc/index.js';
+
+/**
+ * Single verification unit shipped to a worker
+ */
+export interface VerificationJob {
+  /** SHA-256 digest of the canonical message */
+  readonly digest: Uint8Array;
+  /** 32-byte r component */
+  readonly r: Uint8Array;
+  /** 32-byte s component */
+  readonly s: Uint8Array;
+  /** Encoded signer public key */
+  readonly publicKey: Uint8Array;
+}
+
+/**
+ * Verification outcome returned by a worker
+ */
+export interface VerificationOutcome {
+  readonly isValid: boolean;
+  readonly verificationTimeMs: number;
+}
+
+/**
+ * Batch posted to a pooled worker; replies carry the same id
+ */
+export interface VerificationRequest {
+  readonly id: number;
+  readonly jobs: VerificationJob[];
+}
+
+export interface VerificationReply {
+  readonly id: number;
+  readonly outcomes: VerificationOutcome[];
+}
+
+// Decoded keys survive across batches handled by this worker, least
+// recently used first out (same bound as SignatureService's cache)
+const DECODED_KEY_CACHE_SIZE = 1024;
+const decodedKeys = new Map<string, DecodedPublicKey | null>();
+
+function decode(publicKey: Uint8Array): DecodedPublicKey | null {
+  const keyHex = Buffer.from(publicKey.buffer, publicKey.byteOffset, publicKey.byteLength).toString('hex');
+  let decoded = decodedKeys.get(keyHex);
+
+  if (decoded !== undefined) {
+    decodedKeys.delete(keyHex);
+  } else {
+    try {
+      decoded = ECCService.decodePublicKey(publicKey);
+    } catch {
+      decoded = null;
+    }
+
+    if (decodedKeys.size >= DECODED_KEY_CACHE_SIZE) {
+      const oldest = decodedKeys.keys().next().value;
+      if (oldest !== undefined) {
+        decodedKeys.delete(oldest);
+      }
+    }
+  }
+  decodedKeys.set(keyHex, decoded);
+
+  return decoded;
+}
+
+parentPort?.on('message', ({ id, jobs }: VerificationRequest) => {
+  const outcomes: VerificationOutcome[] = jobs.map(job => {
+    const start = performance.now();
+    const point = decode(job.publicKey);
+    const isValid = point !== null &&
+      ECCService.verifyDigest(job.digest, { r: job.r, s: job.s, recovery: 0 }, point);
+
+    return { isValid, verificationTimeMs: performance.now() - start };
+  });
+
+  const reply: VerificationReply = { id, outcomes };
+  parentPort?.postMessage(reply);
+});
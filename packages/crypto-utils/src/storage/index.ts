@@ -4,16 +4,52 @@
  * @version 1.0.0
  */
 
-import { randomBytes, createCipheriv, createDecipheriv, pbkdf2Sync } from 'crypto';
+import {
+  randomBytes,
+  createCipheriv,
+  createDecipheriv,
+  createHmac,
+  timingSafeEqual,
+  pbkdf2,
+  scrypt
+} from 'crypto';
 import * as secp256k1 from '@noble/secp256k1';
 import { ECCService } from '../ecc/index.js';
 import type {
   ECCKeyPair,
   KeyStorageEntry,
   KeyMetadata,
+  KdfParameters,
   ModelIdentity
 } from '@cmmv-hive/shared-types';
 
+/**
+ * In-memory cache of unlocked keys
+ */
+export interface UnlockCacheOptions {
+  /** How long an unlocked key stays cached */
+  readonly ttlMs: number;
+  /** Maximum number of cached keys (oldest evicted first) */
+  readonly maxEntries?: number;
+}
+
+/**
+ * Storage-wide settings
+ */
+export interface KeyStorageOptions {
+  /** KDF settings for newly stored keys; existing keys keep their own */
+  readonly kdf?: KdfParameters;
+  /** Enable (or, with null, disable and wipe) the unlocked key cache */
+  readonly unlockCache?: UnlockCacheOptions | null;
+}
+
+interface UnlockedKey {
+  readonly privateKey: Uint8Array;
+  readonly passphraseTag: Buffer;
+  readonly expiresAt: number;
+  readonly timer: ReturnType<typeof setTimeout>;
+}
+
 /**
  * Secure Key Storage Service
  * Provides encrypted storage and management of cryptographic keys
@@ -24,9 +60,64 @@ export class SecureKeyStorage {
   private static readonly IV_LENGTH = 12; // AES-GCM recommended IV length
   private static readonly SALT_LENGTH = 32;
   private static readonly TAG_LENGTH = 16;
-  private static readonly PBKDF2_ITERATIONS = 100000;
+
+  // scrypt bounds accepted in KDF headers and configuration
+  private static readonly SCRYPT_MIN_COST = 1024;
+  private static readonly SCRYPT_MAX_BLOCK_SIZE = 32;
+  private static readonly SCRYPT_MAX_PARALLELIZATION = 16;
+  private static readonly SCRYPT_MAX_MEMORY = 1024 * 1024 * 1024;
+  private static readonly SCRYPT_MEMORY_SLACK = 1024 * 1024;
+
+  /** Parameters of entries stored before KDF headers existed */
+  static readonly LEGACY_KDF: KdfParameters = { algorithm: 'pbkdf2-sha256', iterations: 100000 };
 
   private static inMemoryStorage = new Map<string, KeyStorageEntry>();
+  private static kdfParameters: KdfParameters = SecureKeyStorage.LEGACY_KDF;
+  private static unlockCacheOptions: UnlockCacheOptions | null = null;
+  private static unlockedKeys = new Map<string, UnlockedKey>();
+  private static readonly cacheSecret = randomBytes(32);
+
+  /**
+   * Configure KDF settings and the unlocked key cache
+   */
+  static configure(options: KeyStorageOptions): void {
+    if (options.kdf) {
+      this.validateKdf(options.kdf);
+      this.kdfParameters = options.kdf;
+    }
+
+    if (options.unlockCache !== undefined) {
+      if (options.unlockCache && !(options.unlockCache.ttlMs > 0)) {
+        throw new Error('Unlock cache TTL must be positive');
+      }
+      this.unlockCacheOptions = options.unlockCache;
+      if (!options.unlockCache) {
+        this.lockAllKeys();
+      }
+    }
+  }
+
+  /**
+   * Remove a key from the unlocked cache, zeroizing it
+   */
+  static lockKey(keyId: string): boolean {
+    const unlocked = this.unlockedKeys.get(keyId);
+    if (!unlocked) return false;
+
+    clearTimeout(unlocked.timer);
+    unlocked.privateKey.fill(0);
+    this.unlockedKeys.delete(keyId);
+    return true;
+  }
+
+  /**
+   * Zeroize and drop every cached unlocked key
+   */
+  static lockAllKeys(): void {
+    for (const keyId of [...this.unlockedKeys.keys()]) {
+      this.lockKey(keyId);
+    }
+  }
 
   /**
    * Store an encrypted private key
@@ -38,15 +129,10 @@ export class SecureKeyStorage {
     metadata: Partial<KeyMetadata> = {}
   ): Promise<void> {
     const salt = randomBytes(this.SALT_LENGTH);
+    const kdf = this.kdfParameters;
 
     // Derive encryption key from passphrase
-    const encryptionKey = pbkdf2Sync(
-      passphrase,
-      salt,
-      this.PBKDF2_ITERATIONS,
-      this.KEY_LENGTH,
-      'sha256'
-    );
+    const encryptionKey = await this.deriveKey(passphrase, salt, kdf);
 
     const iv = randomBytes(this.IV_LENGTH);
 
@@ -60,6 +146,7 @@ export class SecureKeyStorage {
     ]);
 
     const authTag = cipher.getAuthTag();
+    encryptionKey.fill(0);
 
     // Store the encrypted key with metadata
     const storageEntry: KeyStorageEntry = {
@@ -80,13 +167,16 @@ export class SecureKeyStorage {
         usageCount: 0,
         ...metadata,
       },
+      kdf,
     };
 
+    this.lockKey(keyId);
     this.inMemoryStorage.set(keyId, storageEntry);
   }
 
   /**
-   * Retrieve and decrypt a private key
+   * Retrieve and decrypt a private key. With the unlock cache enabled, a key
+   * unlocked recently with the same passphrase is returned without the KDF.
    */
   static async retrievePrivateKey(
     keyId: string,
@@ -102,6 +192,12 @@ export class SecureKeyStorage {
       throw new Error(`Key ${keyId} has expired`);
     }
 
+    const cached = this.getUnlockedKey(keyId, passphrase);
+    if (cached) {
+      this.recordUsage(entry);
+      return cached;
+    }
+
     try {
       const encryptedData = Buffer.from(entry.encryptedPrivateKey, 'base64');
 
@@ -114,33 +210,31 @@ export class SecureKeyStorage {
       );
       const encryptedKey = encryptedData.subarray(this.SALT_LENGTH + this.IV_LENGTH + this.TAG_LENGTH);
 
-      // Derive decryption key
-      const decryptionKey = pbkdf2Sync(
-        passphrase,
-        salt,
-        this.PBKDF2_ITERATIONS,
-        this.KEY_LENGTH,
-        'sha256'
-      );
+      // Derive decryption key with the parameters the key was stored under
+      const decryptionKey = await this.deriveKey(passphrase, salt, entry.kdf ?? this.LEGACY_KDF);
 
       // Create decipher
       const decipher = createDecipheriv(this.ALGORITHM, decryptionKey, iv);
       decipher.setAuthTag(authTag);
 
       // Decrypt the private key
-      const decryptedKey = Buffer.concat([
-        decipher.update(encryptedKey),
-        decipher.final()
-      ]);
-
-      // Update usage metadata (create new object to avoid readonly issues)
-      entry.metadata = {
-        ...entry.metadata,
-        usageCount: entry.metadata.usageCount + 1,
-        lastUsed: new Date(),
-      };
-
-      return new Uint8Array(decryptedKey);
+      let decryptedKey: Buffer;
+      try {
+        decryptedKey = Buffer.concat([
+          decipher.update(encryptedKey),
+          decipher.final()
+        ]);
+      } finally {
+        decryptionKey.fill(0);
+      }
+
+      this.recordUsage(entry);
+
+      const privateKey = new Uint8Array(decryptedKey);
+      decryptedKey.fill(0);
+      this.cacheUnlockedKey(keyId, passphrase, privateKey);
+
+      return privateKey;
     } catch (error) {
       throw new Error(`Failed to decrypt key ${keyId}: ${error instanceof Error ? error.message : 'Unknown error'}`);
     }
@@ -189,6 +283,8 @@ export class SecureKeyStorage {
     };
 
     // Remove old key
+    oldPrivateKey.fill(0);
+    this.lockKey(oldKeyId);
     this.inMemoryStorage.delete(oldKeyId);
 
     return modelIdentity;
@@ -219,6 +315,7 @@ export class SecureKeyStorage {
    * Delete a stored key
    */
   static async deleteKey(keyId: string): Promise<boolean> {
+    this.lockKey(keyId);
     return this.inMemoryStorage.delete(keyId);
   }
 
@@ -249,6 +346,7 @@ export class SecureKeyStorage {
     activeKeys: number;
     expiredKeys: number;
     totalUsage: number;
+    unlockedKeys: number;
   } {
     const now = new Date();
     let activeKeys = 0;
@@ -269,6 +367,7 @@ export class SecureKeyStorage {
       activeKeys,
       expiredKeys,
       totalUsage,
+      unlockedKeys: this.unlockedKeys.size,
     };
   }
 
@@ -281,6 +380,7 @@ export class SecureKeyStorage {
 
     for (const [keyId, entry] of this.inMemoryStorage.entries()) {
       if (now > entry.expiresAt) {
+        this.lockKey(keyId);
         this.inMemoryStorage.delete(keyId);
         removedCount++;
       }
@@ -289,6 +389,128 @@ export class SecureKeyStorage {
     return removedCount;
   }
 
+  /**
+   * Derive an encryption key on the libuv thread pool
+   */
+  private static deriveKey(passphrase: string, salt: Buffer, kdf: KdfParameters): Promise<Buffer> {
+    this.validateKdf(kdf);
+
+    return new Promise((resolve, reject) => {
+      const done = (error: Error | null, key: Buffer) => (error ? reject(error) : resolve(key));
+
+      if (kdf.algorithm === 'scrypt') {
+        const cost = kdf.cost!;
+        const blockSize = kdf.blockSize ?? 8;
+        const parallelization = kdf.parallelization ?? 1;
+        scrypt(passphrase, salt, this.KEY_LENGTH, {
+          N: cost,
+          r: blockSize,
+          p: parallelization,
+          maxmem: this.scryptMemory(cost, blockSize, parallelization) + this.SCRYPT_MEMORY_SLACK,
+        }, done);
+      } else {
+        pbkdf2(passphrase, salt, kdf.iterations!, this.KEY_LENGTH, 'sha256', done);
+      }
+    });
+  }
+
+  private static validateKdf(kdf: KdfParameters): void {
+    if (kdf.algorithm === 'pbkdf2-sha256') {
+      if (!Number.isInteger(kdf.iterations) || kdf.iterations! < 1) {
+        throw new Error(`Invalid PBKDF2 iteration count: ${kdf.iterations}`);
+      }
+    } else if (kdf.algorithm === 'scrypt') {
+      const cost = kdf.cost ?? 0;
+      const blockSize = kdf.blockSize ?? 8;
+      const parallelization = kdf.parallelization ?? 1;
+      if (!Number.isInteger(cost) || cost < this.SCRYPT_MIN_COST || (cost & (cost - 1)) !== 0) {
+        throw new Error(`Invalid scrypt cost (must be a power of two, at least ${this.SCRYPT_MIN_COST}): ${kdf.cost}`);
+      }
+      if (!Number.isInteger(blockSize) || blockSize < 1 || blockSize > this.SCRYPT_MAX_BLOCK_SIZE) {
+        throw new Error(`Invalid scrypt block size (1-${this.SCRYPT_MAX_BLOCK_SIZE}): ${kdf.blockSize}`);
+      }
+      if (!Number.isInteger(parallelization) || parallelization < 1 || parallelization > this.SCRYPT_MAX_PARALLELIZATION) {
+        throw new Error(`Invalid scrypt parallelization (1-${this.SCRYPT_MAX_PARALLELIZATION}): ${kdf.parallelization}`);
+      }
+      // RFC 7914 requires N < 2^(16r)
+      if (blockSize < 4 && cost >= 2 ** (16 * blockSize)) {
+        throw new Error(`Invalid scrypt cost for block size ${blockSize}: ${kdf.cost}`);
+      }
+      if (this.scryptMemory(cost, blockSize, parallelization) > this.SCRYPT_MAX_MEMORY) {
+        throw new Error(`scrypt parameters need more than ${this.SCRYPT_MAX_MEMORY} bytes: N=${cost}, r=${blockSize}, p=${parallelization}`);
+      }
+    } else {
+      throw new Error(`Unsupported KDF algorithm: ${(kdf as KdfParameters).algorithm}`);
+    }
+  }
+
+  /**
+   * Bytes scrypt allocates: p blocks of 128r plus the (N + 2) * 128r work area
+   */
+  private static scryptMemory(cost: number, blockSize: number, parallelization: number): number {
+    return 128 * blockSize * (cost + parallelization + 2);
+  }
+
+  /**
+   * Copy of a cached unlocked key, if present, fresh and the passphrase matches
+   */
+  private static getUnlockedKey(keyId: string, passphrase: string): Uint8Array | null {
+    const unlocked = this.unlockedKeys.get(keyId);
+    if (!unlocked) return null;
+
+    if (Date.now() >= unlocked.expiresAt) {
+      this.lockKey(keyId);
+      return null;
+    }
+
+    if (!timingSafeEqual(unlocked.passphraseTag, this.passphraseTag(keyId, passphrase))) {
+      return null;
+    }
+
+    return unlocked.privateKey.slice();
+  }
+
+  private static cacheUnlockedKey(keyId: string, passphrase: string, privateKey: Uint8Array): void {
+    const options = this.unlockCacheOptions;
+    if (!options) return;
+
+    this.lockKey(keyId);
+
+    if (options.maxEntries !== undefined) {
+      while (this.unlockedKeys.size >= Math.max(1, options.maxEntries)) {
+        const oldest = this.unlockedKeys.keys().next().value;
+        if (oldest === undefined) break;
+        this.lockKey(oldest);
+      }
+    }
+
+    const timer = setTimeout(() => this.lockKey(keyId), options.ttlMs);
+    timer.unref?.();
+
+    this.unlockedKeys.set(keyId, {
+      privateKey: privateKey.slice(),
+      passphraseTag: this.passphraseTag(keyId, passphrase),
+      expiresAt: Date.now() + options.ttlMs,
+      timer,
+    });
+  }
+
+  /**
+   * Per-process keyed tag of the passphrase; the passphrase itself is never cached
+   */
+  private static passphraseTag(keyId: string, passphrase: string): Buffer {
+    return createHmac('sha256', this.cacheSecret).update(keyId).update('\0').update(passphrase).digest();
+  }
+
+  private static recordUsage(entry: KeyStorageEntry): void {
+    // Update usage metadata (create new object to avoid readonly issues)
+    entry.metadata = {
+      ...entry.metadata,
+      usageCount: entry.metadata.usageCount + 1,
+      lastUsed: new Date(),
+    };
+  }
+
   /**
    * Derive public key from private key
    */
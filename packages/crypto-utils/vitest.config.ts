@@ -0,0 +1,25 @@
+/**
+ * @fileoverview Vitest configuration for Crypto Utils
+ */
+
+import { defineConfig } from 'vitest/config';
+import { resolve } from 'path';
+import { BenchJsonReporter } from '../../scripts/bench/json-reporter.js';
+
+export default defineConfig({
+  test: {
+    globals: true,
+    environment: 'node',
+    include: ['src/**/*.test.ts'],
+    exclude: ['node_modules/**', 'dist/**'],
+    benchmark: {
+      include: ['src/**/*.bench.ts'],
+      reporters: ['default', new BenchJsonReporter()]
+    }
+  },
+  resolve: {
+    alias: {
+      '@cmmv-hive/shared-types': resolve(__dirname, '../shared-types/src')
+    }
+  }
+});
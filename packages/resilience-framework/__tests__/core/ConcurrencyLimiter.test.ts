@@ -0,0 +1,134 @@
+/**
+ * Concurrency Limiter Tests
+ * BIP-03 Implementation - Core Infrastructure Tests
+ */
+
+import { describe, it, expect, beforeEach, afterEach, vi } from 'vitest';
+import {
+  ConcurrencyLimiter,
+  DEFAULT_CONCURRENCY_LIMITER_CONFIG,
+  type ConcurrencyLimiterConfig,
+  type ConcurrencySaturationEvent
+} from '../../src/core/ConcurrencyLimiter.js';
+import { DegradationController } from '../../src/recovery/DegradationController.js';
+import { LoadShedError } from '../../src/types/index.js';
+
+const config = (overrides: Partial<ConcurrencyLimiterConfig>): ConcurrencyLimiterConfig => ({
+  ...DEFAULT_CONCURRENCY_LIMITER_CONFIG,
+  ...overrides,
+});
+
+describe('ConcurrencyLimiter', () => {
+  beforeEach(() => {
+    vi.useFakeTimers();
+  });
+
+  afterEach(() => {
+    vi.useRealTimers();
+  });
+
+  it('should queue by priority and shed low-priority work while saturated', async () => {
+    const limiter = new ConcurrencyLimiter(config({ initialLimit: 2 }));
+    const events: ConcurrencySaturationEvent['type'][] = [];
+    const shed: string[] = [];
+    limiter.addListener({
+      onSaturationChange: event => events.push(event.type),
+      onTaskShed: (_modelId, priority, reason) => shed.push(`${priority}:${reason}`),
+    });
+
+    const first = await limiter.acquire('model-a');
+    const second = await limiter.acquire('model-a');
+    const queuedNormal = limiter.acquire('model-a', 'normal');
+    const queuedCritical = limiter.acquire('model-a', 'critical');
+
+    await expect(limiter.acquire('model-a', 'low')).rejects.toBeInstanceOf(LoadShedError);
+    expect(events).toEqual(['saturated']);
+    expect(shed).toEqual(['low:low_priority']);
+    expect(limiter.getStatistics('model-a')).toMatchObject({ inFlight: 2, queued: 2, saturated: true });
+
+    first.release('ignored');
+    const critical = await queuedCritical;
+    expect(critical.priority).toBe('critical');
+
+    critical.release('ignored');
+    const normal = await queuedNormal;
+    second.release('ignored');
+    expect(events).toEqual(['saturated', 'recovered']);
+
+    normal.release('ignored');
+    expect(limiter.getStatistics('model-a')).toMatchObject({ inFlight: 0, queued: 0, admitted: 4, shed: 1 });
+  });
+
+  it('should evict lower-priority waiters when the queue is full and time out the rest', async () => {
+    const limiter = new ConcurrencyLimiter(config({ initialLimit: 1, maxQueueSize: 1, queueTimeoutMs: 1000 }));
+    const held = await limiter.acquire('model-a');
+
+    const evicted = limiter.acquire('model-a', 'normal');
+    const waiting = limiter.acquire('model-a', 'high');
+    await expect(evicted).rejects.toThrow(/evicted/);
+    await expect(limiter.acquire('model-a', 'normal')).rejects.toThrow(/queue_full/);
+
+    vi.advanceTimersByTime(1000);
+    await expect(waiting).rejects.toThrow(/queue_timeout/);
+
+    held.release('success');
+    expect(limiter.getStatistics('model-a')).toMatchObject({ inFlight: 0, queued: 0, shed: 3 });
+  });
+
+  it('should shrink the gradient limit when latency rises above the baseline', async () => {
+    const limiter = new ConcurrencyLimiter(config({ initialLimit: 10 }));
+
+    const call = async (rttMs: number) => {
+      const permit = await limiter.acquire('model-a');
+      vi.advanceTimersByTime(rttMs);
+      permit.release('success');
+    };
+
+    for (let i = 0; i < 20; i++) await call(10);
+    expect(limiter.getStatistics('model-a')?.limit).toBe(10); // app-limited: no growth
+
+    for (let i = 0; i < 30; i++) await call(100);
+    const stats = limiter.getStatistics('model-a')!;
+    expect(stats.limit).toBeLessThan(10);
+    expect(stats.shortRttMs).toBeGreaterThan(stats.longRttMs * 1.5);
+  });
+
+  it('should back off multiplicatively on drops with AIMD', async () => {
+    const limiter = new ConcurrencyLimiter(config({ algorithm: 'aimd', initialLimit: 10, backoffRatio: 0.5 }));
+
+    const permit = await limiter.acquire('model-a');
+    permit.release('dropped');
+    permit.release('dropped'); // Double release is ignored
+
+    expect(limiter.getStatistics('model-a')?.limit).toBe(5);
+  });
+
+  it('should scale usable capacity with the capacity factor', async () => {
+    const limiter = new ConcurrencyLimiter(config({ initialLimit: 10 }));
+    await limiter.acquire('model-a');
+
+    limiter.setCapacityFactor(0.5);
+    expect(limiter.getStatistics('model-a')?.limit).toBe(5);
+
+    limiter.setCapacityFactor(1);
+    expect(limiter.getStatistics('model-a')?.limit).toBe(10);
+  });
+
+  it('should escalate degradation on saturation and revert once every model recovers', async () => {
+    const limiter = new ConcurrencyLimiter(config({ initialLimit: 1, queueTimeoutMs: 60000 }));
+    const controller = new DegradationController();
+    controller.attachConcurrencyLimiter(limiter);
+
+    const held = await limiter.acquire('model-a');
+    const queued = limiter.acquire('model-a');
+    await vi.waitFor(() => expect(controller.getCurrentStatus().level).toBe('minimal'));
+    expect(controller.getSaturatedModels()).toEqual(['model-a']);
+
+    held.release('ignored');
+    (await queued).release('ignored');
+    await vi.waitFor(() => expect(controller.getCurrentStatus().level).toBe('none'));
+    expect(controller.getSaturatedModels()).toEqual([]);
+
+    controller.detachConcurrencyLimiter();
+  });
+});
@@ -0,0 +1,163 @@
+/**
+ * Health Probe Engine Tests
+ * BIP-03 Implementation - Core Infrastructure Tests
+ */
+
+import { describe, it, expect, beforeAll, afterAll, beforeEach, afterEach, vi } from 'vitest';
+import * as http from 'http';
+import type { AddressInfo } from 'net';
+import { HealthProbeEngine, matchesExpectedResponse } from '../../src/core/HealthProbeEngine.js';
+import { MetricsCollector } from '../../src/monitoring/MetricsCollector.js';
+
+describe('HealthProbeEngine', () => {
+  let server: http.Server;
+  let baseUrl: string;
+  let requests: string[];
+  let engine: HealthProbeEngine;
+
+  beforeAll(async () => {
+    server = http.createServer((req, res) => {
+      requests.push(req.url ?? '');
+      if (req.url === '/down') {
+        res.writeHead(503).end();
+        return;
+      }
+      if (req.url === '/hang') {
+        return;
+      }
+      if (req.url === '/trickle') {
+        // Keeps the socket busy without ever finishing the body
+        res.writeHead(200, { 'Content-Type': 'application/json' });
+        const timer = setInterval(() => res.write(' '), 20);
+        res.on('close', () => clearInterval(timer));
+        return;
+      }
+      res.writeHead(200, { 'Content-Type': 'application/json' });
+      res.end(JSON.stringify({ version: 2, status: 'ok', checks: [1, 2] }));
+    });
+    await new Promise<void>(resolve => server.listen(0, '127.0.0.1', resolve));
+    baseUrl = `http://127.0.0.1:${(server.address() as AddressInfo).port}`;
+  });
+
+  afterAll(async () => {
+    server.closeAllConnections();
+    await new Promise(resolve => server.close(resolve));
+  });
+
+  beforeEach(() => {
+    requests = [];
+    engine = new HealthProbeEngine();
+  });
+
+  afterEach(() => {
+    engine.destroy();
+  });
+
+  it('should share one request between models probing the same endpoint in a tick', async () => {
+    await Promise.all(['model-a', 'model-b', 'model-c'].map(modelId =>
+      engine.probe(modelId, `${baseUrl}/health`, { timeout: 1000 })
+    ));
+
+    expect(requests).toEqual(['/health']);
+    expect(engine.getPooledHosts()).toEqual([baseUrl]);
+  });
+
+  it('should match expected responses per model against one parsed body', async () => {
+    const results = await Promise.allSettled([
+      engine.probe('model-a', `${baseUrl}/health`, {
+        timeout: 1000,
+        expectedResponse: { status: 'ok', checks: [1, 2], version: 2 },
+      }),
+      engine.probe('model-b', `${baseUrl}/health`, {
+        timeout: 1000,
+        expectedResponse: { status: 'degraded', checks: [1, 2], version: 2 },
+      }),
+    ]);
+
+    expect(results[0]!.status).toBe('fulfilled');
+    expect(results[1]!.status).toBe('rejected');
+    expect(requests).toHaveLength(1);
+  });
+
+  it('should reject non-2xx responses', async () => {
+    await expect(engine.probe('model-a', `${baseUrl}/down`, { timeout: 1000 }))
+      .rejects.toThrow('Health check failed with status 503');
+  });
+
+  it('should bound the whole exchange by the timeout', async () => {
+    const started = Date.now();
+    await expect(engine.probe('model-a', `${baseUrl}/trickle`, { timeout: 150 }))
+      .rejects.toThrow(/timeout/);
+    expect(Date.now() - started).toBeLessThan(1000);
+  });
+
+  it('should run a shared request under the smallest probe timeout', async () => {
+    const started = Date.now();
+    const results = await Promise.allSettled([
+      engine.probe('model-a', `${baseUrl}/hang`, { timeout: 5000 }),
+      engine.probe('model-b', `${baseUrl}/hang`, { timeout: 100 }),
+    ]);
+
+    expect(results.map(result => result.status)).toEqual(['rejected', 'rejected']);
+    expect(Date.now() - started).toBeLessThan(2000);
+    expect(requests).toEqual(['/hang']);
+  });
+
+  it('should feed probe latencies into the metrics collector', async () => {
+    const collector = new MetricsCollector();
+    collector.trackHealthProbes(engine);
+
+    await engine.probe('model-a', `${baseUrl}/health`, { timeout: 1000 });
+    await engine.probe('model-b', `${baseUrl}/down`, { timeout: 1000 }).catch(() => undefined);
+
+    expect(collector.getProbeLatency('model-a').count).toBe(1);
+    const all = collector.getProbeLatency();
+    expect(all.count).toBe(2);
+    expect(all.failures).toBe(1);
+    expect(collector.getTimeSeries('model-a.probeLatency')).toHaveLength(1);
+  });
+
+  it('should track the shared engine while collecting', async () => {
+    const collector = new MetricsCollector({
+      collectionInterval: 10000,
+      retentionPeriod: 86400000,
+      batchSize: 100,
+      enableRealTimeMetrics: false,
+    });
+    await collector.startCollection();
+
+    await HealthProbeEngine.shared().probe('model-c', `${baseUrl}/health`, { timeout: 1000 });
+    expect(collector.getProbeLatency('model-c').count).toBe(1);
+
+    await collector.stopCollection();
+    await HealthProbeEngine.shared().probe('model-c', `${baseUrl}/health`, { timeout: 1000 });
+    expect(collector.getProbeLatency('model-c').count).toBe(1);
+    HealthProbeEngine.shared().destroy();
+  });
+
+  it('should age probe failures out with the latency window', () => {
+    vi.useFakeTimers();
+    try {
+      const collector = new MetricsCollector();
+      collector.recordProbeLatency('model-a', 10, false);
+      collector.recordProbeLatency('model-a', 10, true);
+      expect(collector.getProbeLatency('model-a')).toMatchObject({ count: 2, failures: 1 });
+
+      vi.advanceTimersByTime(10 * 60 * 1000);
+      expect(collector.getProbeLatency('model-a')).toMatchObject({ count: 0, failures: 0 });
+    } finally {
+      vi.useRealTimers();
+    }
+  });
+});
+
+describe('matchesExpectedResponse', () => {
+  it('should compare structurally regardless of key order', () => {
+    expect(matchesExpectedResponse({ a: 1, b: { c: [1, 'x'] } }, { b: { c: [1, 'x'] }, a: 1 })).toBe(true);
+    expect(matchesExpectedResponse({ a: 1, b: 2 }, { a: 1 })).toBe(false);
+    expect(matchesExpectedResponse({ a: 1 }, { a: 1, b: undefined })).toBe(true);
+    expect(matchesExpectedResponse([1, 2], [2, 1])).toBe(false);
+    expect(matchesExpectedResponse({ a: null }, { a: null })).toBe(true);
+    expect(matchesExpectedResponse('1', 1)).toBe(false);
+  });
+});
@@ -0,0 +1,102 @@
+/**
+ * Retry Manager Tests
+ * BIP-03 Implementation - Core Infrastructure Tests
+ */
+
+import { describe, it, expect, beforeEach, vi } from 'vitest';
+import { RetryManager } from '../../src/core/RetryManager.js';
+import { RetryBudget } from '../../src/core/RetryBudget.js';
+import { MetricsCollector } from '../../src/monitoring/MetricsCollector.js';
+import { CircuitBreakerError, ResilienceError, RetryOptions } from '../../src/types/index.js';
+
+const fastOptions: RetryOptions = {
+  maxRetries: 3,
+  baseDelay: 1,
+  maxDelay: 5,
+  backoffMultiplier: 2,
+  jitter: false,
+};
+
+const retryable = () => new ResilienceError('temporarily unavailable', 'MODEL_UNAVAILABLE', 'model-a', true);
+
+describe('RetryManager', () => {
+  let budget: RetryBudget;
+  let retryManager: RetryManager;
+
+  beforeEach(() => {
+    budget = new RetryBudget({ retryRatio: 0.5, minRetriesPerSecond: 0, maxTokens: 1 });
+    retryManager = new RetryManager(fastOptions, budget);
+  });
+
+  it('should retry retryable errors until success', async () => {
+    const fn = vi.fn()
+      .mockRejectedValueOnce(retryable())
+      .mockResolvedValue('ok');
+
+    await expect(retryManager.executeWithRetry(fn)).resolves.toBe('ok');
+    expect(fn).toHaveBeenCalledTimes(2);
+  });
+
+  it('should stop retrying once the target budget is spent', async () => {
+    const fn = vi.fn().mockRejectedValue(retryable());
+
+    // Budget starts empty (no refill floor); two requests deposit one token
+    await expect(retryManager.executeWithRetry(fn, undefined, { target: 'model-a' })).rejects.toThrow();
+    await expect(retryManager.executeWithRetry(fn, undefined, { target: 'model-a' })).rejects.toThrow();
+
+    const stats = budget.getStatistics('model-a');
+    expect(stats.requests).toBe(2);
+    expect(stats.retries).toBe(1);
+    expect(stats.suppressedRetries).toBe(2);
+    expect(stats.amplification).toBe(1.5);
+    expect(fn).toHaveBeenCalledTimes(3);
+  });
+
+  it('should not retry against an open circuit breaker', async () => {
+    const fn = vi.fn().mockRejectedValue(new CircuitBreakerError('model-a', 'open'));
+
+    await expect(retryManager.executeWithRetry(fn)).rejects.toThrow(CircuitBreakerError);
+    expect(fn).toHaveBeenCalledOnce();
+  });
+
+  it('should consult the circuit breaker state between attempts', async () => {
+    const fn = vi.fn().mockRejectedValue(retryable());
+    const circuitBreaker = {
+      getStatus: () => ({ state: 'open' as const, failureCount: 5, successCount: 0 }),
+    };
+
+    await expect(retryManager.executeWithRetry(fn, undefined, { circuitBreaker })).rejects.toThrow('temporarily unavailable');
+    expect(fn).toHaveBeenCalledOnce();
+  });
+
+  it('should keep full and decorrelated jitter within bounds', () => {
+    for (const jitterMode of ['full', 'decorrelated'] as const) {
+      const options: RetryOptions = { ...fastOptions, baseDelay: 100, maxDelay: 800, jitter: true, jitterMode };
+      const manager = new RetryManager(options, budget) as any;
+      let previous = options.baseDelay;
+
+      for (let attempt = 0; attempt < 50; attempt++) {
+        const delay: number = manager.calculateDelay(attempt % 5, options, previous);
+        expect(delay).toBeGreaterThanOrEqual(jitterMode === 'full' ? 0 : 100);
+        expect(delay).toBeLessThanOrEqual(jitterMode === 'full' ? 100 * Math.pow(2, attempt % 5) : Math.min(800, previous * 3));
+        previous = delay;
+      }
+    }
+  });
+});
+
+describe('Retry amplification metric', () => {
+  it('should report amplification from the tracked budget', async () => {
+    const budget = new RetryBudget({ retryRatio: 1, minRetriesPerSecond: 0, maxTokens: 10 });
+    const collector = new MetricsCollector();
+    collector.trackRetryBudget(budget);
+
+    budget.recordRequest('model-a');
+    budget.recordRequest('model-a');
+    budget.tryAcquireRetry('model-a');
+
+    const metrics = await collector.getSystemMetrics();
+    expect(metrics.retryAmplification).toBe(1.5);
+    expect(metrics.suppressedRetries).toBe(0);
+  });
+});
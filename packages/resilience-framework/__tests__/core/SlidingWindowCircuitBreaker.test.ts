@@ -0,0 +1,206 @@
+/**
+ * Sliding-Window Circuit Breaker Tests
+ * BIP-03 Implementation - Core Infrastructure Tests
+ */
+
+import { describe, it, expect, beforeEach, afterEach, vi } from 'vitest';
+import { SlidingWindowCircuitBreaker } from '../../src/core/SlidingWindowCircuitBreaker.js';
+import { CircuitBreakerFactory } from '../../src/core/CircuitBreaker.js';
+import { CircuitBreakerError, RequestCancelledError, ResilienceError, SlidingWindowCircuitBreakerConfig } from '../../src/types/index.js';
+
+const baseConfig: SlidingWindowCircuitBreakerConfig = {
+  failureThreshold: 3,
+  recoveryTimeout: 1000,
+  successThreshold: 2,
+  timeout: 500,
+  slidingWindowType: 'count',
+  slidingWindowSize: 10,
+  minimumNumberOfCalls: 4,
+  failureRateThreshold: 50,
+  slowCallRateThreshold: 100,
+  slowCallDurationThreshold: 200,
+};
+
+const fail = () => Promise.reject(new Error('fail'));
+const succeed = () => Promise.resolve('ok');
+const sleep = (ms: number) => new Promise<void>(resolve => setTimeout(resolve, ms));
+
+describe('SlidingWindowCircuitBreaker', () => {
+  let circuitBreaker: SlidingWindowCircuitBreaker;
+  const modelId = 'sliding-model';
+
+  beforeEach(() => {
+    circuitBreaker = new SlidingWindowCircuitBreaker(modelId, baseConfig);
+  });
+
+  it('should not evaluate the failure rate before the minimum number of calls', async () => {
+    for (let i = 0; i < 3; i++) {
+      await expect(circuitBreaker.execute(fail)).rejects.toThrow('fail');
+    }
+
+    expect(circuitBreaker.getStatus().state).toBe('closed');
+    expect(circuitBreaker.getMetrics().failureRate).toBe(-1);
+  });
+
+  it('should open when the failure rate reaches the threshold', async () => {
+    await circuitBreaker.execute(succeed);
+    await circuitBreaker.execute(succeed);
+    await expect(circuitBreaker.execute(fail)).rejects.toThrow('fail');
+    expect(circuitBreaker.getStatus().state).toBe('closed');
+
+    await expect(circuitBreaker.execute(fail)).rejects.toThrow('fail');
+    expect(circuitBreaker.getStatus().state).toBe('open');
+
+    await expect(circuitBreaker.execute(succeed)).rejects.toThrow(CircuitBreakerError);
+    expect(circuitBreaker.getMetrics().notPermittedCalls).toBe(1);
+  });
+
+  it('should evict old outcomes from a count window', async () => {
+    const breaker = new SlidingWindowCircuitBreaker(modelId, { ...baseConfig, slidingWindowSize: 4 });
+
+    await expect(breaker.execute(fail)).rejects.toThrow('fail');
+    for (let i = 0; i < 6; i++) {
+      await breaker.execute(succeed);
+    }
+
+    const metrics = breaker.getMetrics();
+    expect(metrics.bufferedCalls).toBe(4);
+    expect(metrics.failedCalls).toBe(0);
+  });
+
+  it('should expire outcomes from a time window', async () => {
+    const breaker = new SlidingWindowCircuitBreaker(modelId, {
+      ...baseConfig,
+      slidingWindowType: 'time',
+      slidingWindowSize: 1,
+    });
+
+    await expect(breaker.execute(fail)).rejects.toThrow('fail');
+    await expect(breaker.execute(fail)).rejects.toThrow('fail');
+    expect(breaker.getMetrics().bufferedCalls).toBe(2);
+
+    await sleep(1100);
+    expect(breaker.getMetrics().bufferedCalls).toBe(0);
+
+    await breaker.execute(succeed);
+    expect(breaker.getMetrics().bufferedCalls).toBe(1);
+  });
+
+  it('should open on slow calls', async () => {
+    const breaker = new SlidingWindowCircuitBreaker(modelId, {
+      ...baseConfig,
+      minimumNumberOfCalls: 2,
+      slowCallRateThreshold: 50,
+      slowCallDurationThreshold: 20,
+    });
+
+    const slow = () => sleep(40).then(() => 'slow');
+
+    await expect(breaker.execute(slow)).resolves.toBe('slow');
+    expect(breaker.getMetrics().slowCalls).toBe(1);
+
+    await expect(breaker.execute(slow)).resolves.toBe('slow');
+    expect(breaker.getStatus().state).toBe('open');
+  });
+
+  it('should time out calls with one shared timer', async () => {
+    const breaker = new SlidingWindowCircuitBreaker(modelId, { ...baseConfig, timeout: 50 });
+    const hang = () => new Promise<string>(() => {});
+
+    const first = breaker.execute(hang);
+    const second = breaker.execute(hang);
+
+    await expect(first).rejects.toThrow(ResilienceError);
+    await expect(second).rejects.toThrow('Circuit breaker timeout');
+    expect(breaker.getMetrics().failedCalls).toBe(2);
+  });
+
+  it('should admit only the permitted calls in half-open state and close on success', async () => {
+    const breaker = new SlidingWindowCircuitBreaker(modelId, { ...baseConfig, recoveryTimeout: 50 });
+    await breaker.trip('test');
+    expect(breaker.getStatus().state).toBe('open');
+
+    await sleep(60);
+
+    let release!: () => void;
+    const gate = new Promise<void>(resolve => { release = resolve; });
+    const trial = () => gate.then(() => 'ok');
+
+    const first = breaker.execute(trial);
+    const second = breaker.execute(trial);
+    expect(breaker.getStatus().state).toBe('half-open');
+    await expect(breaker.execute(trial)).rejects.toThrow(CircuitBreakerError);
+
+    release();
+    await expect(first).resolves.toBe('ok');
+    await expect(second).resolves.toBe('ok');
+    expect(breaker.getStatus().state).toBe('closed');
+  });
+
+  it('should not record cancelled calls and return their half-open permits', async () => {
+    const cancel = () => Promise.reject(new RequestCancelledError(modelId));
+    for (let i = 0; i < 4; i++) {
+      await expect(circuitBreaker.execute(cancel)).rejects.toThrow(RequestCancelledError);
+    }
+    expect(circuitBreaker.getMetrics().bufferedCalls).toBe(0);
+
+    const breaker = new SlidingWindowCircuitBreaker(modelId, { ...baseConfig, recoveryTimeout: 50 });
+    await breaker.trip();
+    await sleep(60);
+
+    await expect(breaker.execute(cancel)).rejects.toThrow(RequestCancelledError);
+    await expect(breaker.execute(cancel)).rejects.toThrow(RequestCancelledError);
+    await breaker.execute(succeed);
+    await breaker.execute(succeed);
+    expect(breaker.getStatus().state).toBe('closed');
+  });
+
+  it('should reopen when a half-open trial fails', async () => {
+    const breaker = new SlidingWindowCircuitBreaker(modelId, { ...baseConfig, recoveryTimeout: 50 });
+    await breaker.trip();
+    await sleep(60);
+
+    await breaker.execute(succeed);
+    await expect(breaker.execute(fail)).rejects.toThrow('fail');
+
+    expect(breaker.getStatus().state).toBe('open');
+  });
+
+  it('should deliver listener events in batches', async () => {
+    const onExecution = vi.fn();
+    const onStateChange = vi.fn();
+    circuitBreaker.addListener({ onExecution, onStateChange });
+
+    await circuitBreaker.execute(succeed);
+    await circuitBreaker.trip('manual');
+    expect(onExecution).not.toHaveBeenCalled();
+
+    circuitBreaker.flushEvents();
+    expect(onExecution).toHaveBeenCalledOnce();
+    expect(onStateChange).toHaveBeenCalledWith(expect.objectContaining({
+      from: 'closed',
+      to: 'open',
+      trigger: 'manual_trip',
+      reason: 'manual',
+    }));
+  });
+});
+
+describe('CircuitBreakerFactory with sliding windows', () => {
+  afterEach(() => {
+    CircuitBreakerFactory.setDefaultConfig(undefined);
+    for (const modelId of CircuitBreakerFactory.getAll().keys()) {
+      CircuitBreakerFactory.remove(modelId);
+    }
+  });
+
+  it('should hand out a sliding-window breaker for a sliding-window config', () => {
+    const circuitBreaker = CircuitBreakerFactory.getOrCreate('sliding-1', baseConfig);
+    expect(circuitBreaker).toBeInstanceOf(SlidingWindowCircuitBreaker);
+  });
+
+  it('should use the default config when none is given', () => {
+    CircuitBreakerFactory.setDefaultConfig(baseConfig);
+    expect(CircuitBreakerFactory.getOrCreate('sliding-2')).toBeInstanceOf(SlidingWindowCircuitBreaker);
+  });
+});
@@ -0,0 +1,120 @@
+/**
+ * Timer Wheel Scheduler Tests
+ * BIP-03 Implementation - Core Infrastructure Tests
+ */
+
+import { describe, it, expect, beforeEach, afterEach } from 'vitest';
+import { TimerWheelScheduler } from '../../src/core/TimerWheelScheduler.js';
+import { HealthChecker } from '../../src/core/HealthChecker.js';
+
+const sleep = (ms: number) => new Promise(resolve => setTimeout(resolve, ms));
+
+describe('TimerWheelScheduler', () => {
+  let scheduler: TimerWheelScheduler;
+
+  beforeEach(() => {
+    scheduler = new TimerWheelScheduler({ tickMs: 5 });
+  });
+
+  afterEach(() => {
+    scheduler.shutdown();
+  });
+
+  it('should run periodic tasks until cancelled', async () => {
+    let runs = 0;
+    const handle = scheduler.schedule(() => { runs++; }, { name: 'tick', intervalMs: 20 });
+
+    await sleep(110);
+    handle.cancel();
+    const seen = runs;
+
+    expect(seen).toBeGreaterThanOrEqual(3);
+    expect(handle.getStatistics().runs).toBe(seen);
+
+    await sleep(50);
+    expect(runs).toBe(seen);
+    expect(scheduler.size).toBe(0);
+  });
+
+  it('should skip ticks while the previous run is still in progress', async () => {
+    let concurrent = 0;
+    let maxConcurrent = 0;
+    const handle = scheduler.schedule(async () => {
+      concurrent++;
+      maxConcurrent = Math.max(maxConcurrent, concurrent);
+      await sleep(60);
+      concurrent--;
+    }, { name: 'slow', intervalMs: 10 });
+
+    await sleep(150);
+    const stats = handle.getStatistics();
+
+    expect(maxConcurrent).toBe(1);
+    expect(stats.skippedRuns).toBeGreaterThan(0);
+    expect(stats.overruns).toBeGreaterThan(0);
+  });
+
+  it('should bound concurrent runs per task class', async () => {
+    scheduler.setConcurrencyLimit('probe', 2);
+    let active = 0;
+    let maxActive = 0;
+
+    const handles = Array.from({ length: 6 }, (_, i) => scheduler.schedule(async () => {
+      active++;
+      maxActive = Math.max(maxActive, active);
+      await sleep(15);
+      active--;
+    }, { name: `probe-${i}`, intervalMs: 20, taskClass: 'probe' }));
+
+    await sleep(120);
+
+    expect(maxActive).toBe(2);
+    expect(handles.some(h => h.getStatistics().deferredRuns > 0)).toBe(true);
+    expect(handles.every(h => h.getStatistics().runs > 0)).toBe(true);
+  });
+
+  it('should record lag and keep running after a task throws', async () => {
+    let runs = 0;
+    const handle = scheduler.schedule(() => {
+      runs++;
+      throw new Error('boom');
+    }, { name: 'failing', intervalMs: 15 });
+
+    await sleep(80);
+    const stats = handle.getStatistics();
+
+    expect(runs).toBeGreaterThanOrEqual(2);
+    expect(stats.errors).toBe(stats.runs);
+    expect(stats.maxLagMs).toBeGreaterThanOrEqual(0);
+  });
+
+  it('should fire tasks placed on higher wheel levels', async () => {
+    // 4-slot levels: a 120ms interval at 5ms ticks needs a cascade
+    const small = new TimerWheelScheduler({ tickMs: 5, wheelBits: 2, levels: 3 });
+    let runs = 0;
+    small.schedule(() => { runs++; }, { name: 'far', intervalMs: 120 });
+
+    await sleep(70);
+    expect(runs).toBe(0);
+
+    await sleep(100);
+    expect(runs).toBe(1);
+    small.shutdown();
+  });
+
+  it('should drive health checks for registered models', async () => {
+    const healthChecker = new HealthChecker({ interval: 20, timeout: 100, retries: 0 }, scheduler);
+    await healthChecker.registerModel({ id: 'model-a', name: 'A', provider: 'test', capabilities: [] });
+    await healthChecker.startMonitoring();
+
+    await sleep(60);
+    const stats = scheduler.getStatistics();
+
+    expect(stats).toHaveLength(1);
+    expect(stats[0]!.name).toBe('health-check:model-a');
+    expect(stats[0]!.taskClass).toBe('health-check');
+
+    await healthChecker.stopMonitoring();
+    expect(scheduler.size).toBe(0);
+  });
+});
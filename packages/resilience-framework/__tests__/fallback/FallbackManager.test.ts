@@ -17,6 +17,8 @@ import {
   AIResponse,
   FallbackConfig
 } from '../../src/types/index.js';
+import { CircuitBreakerFactory } from '../../src/core/CircuitBreaker.js';
+import { ConcurrencyLimiter } from '../../src/core/ConcurrencyLimiter.js';
 
 describe('FallbackManager', () => {
   let fallbackManager: FallbackManager;
@@ -259,6 +261,137 @@ describe('FallbackManager', () => {
     });
   });
 
+  describe('Hedged Fallback', () => {
+    beforeEach(async () => {
+      await CircuitBreakerFactory.resetAll();
+      fallbackManager.configureRouting({ retryOnFailure: false });
+    });
+
+    const hedgedConfig = (overrides: Partial<FallbackConfig> = {}): FallbackConfig => ({
+      primary: primaryModel,
+      fallbacks: fallbackModels,
+      strategy: 'hedged',
+      timeout: 5000,
+      hedgeDelay: 50,
+      ...overrides,
+    });
+
+    it('should hedge a slow primary and cancel it when the hedge wins', async () => {
+      mockExecutor.setResponse(primaryModel.id, 'Slow primary', 500);
+      mockExecutor.setResponse('gpt-5', 'Fast hedge', 10);
+      mockExecutor.setResponse('deepseek-v3', 'Unused', 10);
+
+      const start = Date.now();
+      const result = await fallbackManager.executeWithFallback(testTask, hedgedConfig());
+
+      expect(result.success).toBe(true);
+      expect(result.result).toBe('Fast hedge');
+      expect(result.fallbackUsed).toBe(true);
+      expect(result.hedgeCount).toBe(1);
+      expect(result.wastedWorkMs).toBeGreaterThanOrEqual(50);
+      expect(Date.now() - start).toBeLessThan(400);
+      expect(mockExecutor.cancelled).toEqual([primaryModel.id]);
+      expect(result.metadata?.cancelledModels).toEqual([primaryModel.id]);
+    });
+
+    it('should not count a cancelled hedge against the breaker', async () => {
+      mockExecutor.setResponse(primaryModel.id, 'Slow primary', 500);
+      mockExecutor.setResponse('gpt-5', 'Fast hedge', 10);
+
+      await fallbackManager.executeWithFallback(testTask, hedgedConfig());
+      await new Promise(resolve => setTimeout(resolve, 20));
+
+      const status = CircuitBreakerFactory.getOrCreate(primaryModel.id).getStatus();
+      expect(mockExecutor.cancelled).toEqual([primaryModel.id]);
+      expect(status.successCount).toBe(0);
+      expect(status.failureCount).toBe(0);
+      expect(CircuitBreakerFactory.getOrCreate('gpt-5').getStatus().successCount).toBe(1);
+    });
+
+    it('should abort every attempt once the overall timeout elapses', async () => {
+      mockExecutor.setResponse(primaryModel.id, 'Slow primary', 1000);
+      mockExecutor.setResponse('gpt-5', 'Slow hedge', 1000);
+
+      const start = Date.now();
+      const result = await fallbackManager.executeWithFallback(testTask, hedgedConfig({ timeout: 150 }));
+
+      expect(result.success).toBe(false);
+      expect((result.error?.cause as Error | undefined)?.message).toMatch(/timed out after 150ms/);
+      expect(Date.now() - start).toBeLessThan(600);
+      expect(mockExecutor.cancelled.sort()).toEqual(['claude-4-sonnet', 'gpt-5']);
+    });
+
+    it('should not hedge when the primary answers before the delay', async () => {
+      mockExecutor.setResponse(primaryModel.id, 'Primary response', 5);
+      mockExecutor.setResponse('gpt-5', 'Hedge', 5);
+
+      const result = await fallbackManager.executeWithFallback(testTask, hedgedConfig({ hedgeDelay: 200 }));
+
+      expect(result.modelUsed).toBe(primaryModel.id);
+      expect(result.hedgeCount).toBe(0);
+      expect(result.wastedWorkMs).toBe(0);
+      expect(mockExecutor.calls).toEqual([primaryModel.id]);
+    });
+
+    it('should move on immediately when the primary fails', async () => {
+      mockExecutor.setFailure(primaryModel.id, new Error('Primary failed'));
+      mockExecutor.setResponse('gpt-5', 'Secondary response', 5);
+
+      const result = await fallbackManager.executeWithFallback(testTask, hedgedConfig({ hedgeDelay: 1000 }));
+
+      expect(result.success).toBe(true);
+      expect(result.modelUsed).toBe('gpt-5');
+      expect(result.hedgeCount).toBe(0);
+    });
+
+    it('should derive the hedge delay from rolling latency percentiles', async () => {
+      mockExecutor.setResponse(primaryModel.id, 'Primary response', 5);
+
+      for (let i = 0; i < 20; i++) {
+        await fallbackManager.executeWithFallback(testTask, hedgedConfig({ hedgeDelay: 1000 }));
+      }
+
+      const metrics = fallbackManager.getPerformanceMetrics().get(primaryModel.id);
+      expect(metrics?.p95ResponseTime).toBeDefined();
+
+      mockExecutor.setResponse(primaryModel.id, 'Slow primary', 400);
+      mockExecutor.setResponse('gpt-5', 'Fast hedge', 5);
+
+      // Fallback delay is ignored once 20 samples exist: p95 is a few ms
+      const result = await fallbackManager.executeWithFallback(testTask, hedgedConfig({ hedgeDelay: 1000 }));
+      expect(result.modelUsed).toBe('gpt-5');
+      expect(result.metadata?.hedgeDelay).toBeLessThan(100);
+    });
+  });
+
+  describe('Concurrency Limiting', () => {
+    beforeEach(async () => {
+      await CircuitBreakerFactory.resetAll();
+    });
+
+    it('should not take a permit for a model whose circuit is open', async () => {
+      const limiter = new ConcurrencyLimiter();
+      const acquire = vi.spyOn(limiter, 'acquire');
+      const limited = new FallbackManager(mockExecutor, limiter);
+      limited.configureRouting({ retryOnFailure: false });
+
+      await CircuitBreakerFactory.getOrCreate(primaryModel.id).trip('test');
+      mockExecutor.setResponse('gpt-5', 'Fallback response');
+
+      const result = await limited.executeWithFallback(testTask, {
+        primary: primaryModel,
+        fallbacks: fallbackModels,
+        strategy: 'sequential',
+        timeout: 5000,
+      });
+
+      expect(result.modelUsed).toBe('gpt-5');
+      expect(acquire.mock.calls.map(call => call[0])).toEqual(['gpt-5']);
+      expect(limiter.getStatistics(primaryModel.id)).toBeUndefined();
+      expect(limiter.getStatistics('gpt-5')?.inFlight).toBe(0);
+    });
+  });
+
   describe('Performance Metrics and Weights', () => {
     it('should update performance metrics after execution', async () => {
       const config: FallbackConfig = {
@@ -331,6 +464,8 @@ describe('FallbackManager', () => {
  */
 class MockModelExecutor implements ModelExecutor {
   private responses = new Map<string, { response?: string; error?: Error; delay?: number }>();
+  readonly calls: string[] = [];
+  readonly cancelled: string[] = [];
 
   setResponse(modelId: string, response: string, delay: number = 0): void {
     this.responses.set(modelId, { response, delay });
@@ -340,15 +475,21 @@ class MockModelExecutor implements ModelExecutor {
     this.responses.set(modelId, { error });
   }
 
-  async execute(model: ModelIdentity, task: AITask): Promise<AIResponse> {
+  async execute(model: ModelIdentity, task: AITask, signal?: AbortSignal): Promise<AIResponse> {
     const config = this.responses.get(model.id);
+    this.calls.push(model.id);
 
     if (!config) {
       throw new Error(`No mock configuration for model ${model.id}`);
     }
 
     if (config.delay) {
-      await this.delay(config.delay);
+      await this.delay(config.delay, signal);
+    }
+
+    if (signal?.aborted) {
+      this.cancelled.push(model.id);
+      throw new Error(`Request to ${model.id} aborted`);
     }
 
     if (config.error) {
@@ -366,7 +507,13 @@ class MockModelExecutor implements ModelExecutor {
     };
   }
 
-  private delay(ms: number): Promise<void> {
-    return new Promise(resolve => setTimeout(resolve, ms));
+  private delay(ms: number, signal?: AbortSignal): Promise<void> {
+    return new Promise(resolve => {
+      const timer = setTimeout(resolve, ms);
+      signal?.addEventListener('abort', () => {
+        clearTimeout(timer);
+        resolve();
+      }, { once: true });
+    });
   }
 }
@@ -0,0 +1,188 @@
+/**
+ * Alert Pipeline Tests
+ * BIP-03 Implementation - Phase 3: Monitoring & Alerting Tests
+ */
+
+import { describe, it, expect } from 'vitest';
+import { AlertManager, type AlertConfig, type AlertDeliveryStatus } from '../../src/monitoring/AlertManager.js';
+import { AlertDeliveryQueue } from '../../src/monitoring/AlertDeliveryQueue.js';
+import type { ModelMetrics } from '../../src/monitoring/MetricsCollector.js';
+
+const sleep = (ms: number) => new Promise(resolve => setTimeout(resolve, ms));
+
+const slowModelRule: AlertConfig = {
+  id: 'slow-model',
+  name: 'Slow Model',
+  description: 'Model response time too high',
+  severity: 'warning',
+  channels: ['console'],
+  enabled: true,
+  cooldownPeriod: 60000,
+  condition: { metric: 'model.averageResponseTime', operator: 'gt', threshold: 1000 },
+};
+
+const modelMetrics = (modelId: string, averageResponseTime: number): ModelMetrics => ({
+  modelId,
+  timestamp: new Date(),
+  requests: 10,
+  successes: 10,
+  failures: 0,
+  averageResponseTime,
+  lastResponseTime: averageResponseTime,
+  successRate: 1,
+  healthStatus: 'healthy',
+  circuitBreakerState: 'closed',
+  uptime: 1,
+});
+
+describe('AlertManager pipeline', () => {
+  it('should deduplicate per rule and model fingerprint', async () => {
+    const alertManager = new AlertManager({}, { groupWait: 0 });
+    alertManager.removeAlertConfig('model-high-response-time');
+    alertManager.addAlertConfig(slowModelRule);
+
+    for (let i = 0; i < 5; i++) {
+      await alertManager.processModelMetrics(modelMetrics('model-a', 2000));
+    }
+    await alertManager.processModelMetrics(modelMetrics('model-b', 2000));
+
+    const active = alertManager.getActiveAlerts();
+    expect(active.map(alert => alert.modelId).sort()).toEqual(['model-a', 'model-b']);
+    expect(alertManager.getDeduplicationStats().deduplicated).toBe(4);
+  });
+
+  it('should group alerts of one rule into a single notification', async () => {
+    const alertManager = new AlertManager({}, { groupWait: 20 });
+    alertManager.removeAlertConfig('model-high-response-time');
+    alertManager.addAlertConfig(slowModelRule);
+
+    const deliveries: AlertDeliveryStatus[] = [];
+    alertManager.addListener({ onDeliveryStatus: status => deliveries.push(status) });
+
+    await alertManager.processModelMetrics(modelMetrics('model-a', 2000));
+    await alertManager.processModelMetrics(modelMetrics('model-b', 3000));
+    await alertManager.processModelMetrics(modelMetrics('model-c', 4000));
+    expect(deliveries).toHaveLength(0);
+
+    await alertManager.flushAlerts();
+
+    expect(deliveries).toHaveLength(1);
+    expect(deliveries[0]!.alertId).toContain('slow-model-group-');
+    expect(alertManager.getDeduplicationStats().grouped).toBe(2);
+    expect(alertManager.getDeliveryStats().get('console')!.sent).toBe(1);
+  });
+
+  it('should only evaluate rules for the reported metric', async () => {
+    const alertManager = new AlertManager({}, { groupWait: 0 });
+    let evaluated = 0;
+    const rule = { ...slowModelRule, id: 'counted', condition: { ...slowModelRule.condition, metric: 'model.failures' } };
+    alertManager.addAlertConfig(new Proxy(rule, {
+      get(target, key) {
+        if (key === 'enabled') evaluated++;
+        return Reflect.get(target, key);
+      },
+    }));
+
+    await alertManager.processSystemMetrics({
+      timestamp: new Date(),
+      systemUptime: 0,
+      totalRequests: 10,
+      successfulRequests: 10,
+      failedRequests: 0,
+      averageResponseTime: 10,
+      activeModels: 1,
+      healthyModels: 1,
+      circuitBreakersOpen: 0,
+      fallbacksTriggered: 0,
+    });
+    expect(evaluated).toBe(0);
+
+    await alertManager.processModelMetrics(modelMetrics('model-a', 10));
+    expect(evaluated).toBe(1);
+  });
+
+  it('should surface failed deliveries as drops after retries', async () => {
+    const alertManager = new AlertManager({}, {
+      groupWait: 0,
+      queue: { maxRetries: 1, retryBaseDelay: 5 },
+    });
+    alertManager.removeAlertConfig('model-high-response-time');
+    alertManager.addAlertConfig({ ...slowModelRule, channels: ['webhook'] }); // no webhook configured
+
+    await alertManager.processModelMetrics(modelMetrics('model-a', 2000));
+    await alertManager.flushAlerts();
+
+    const stats = alertManager.getDeliveryStats().get('webhook')!;
+    expect(stats.retries).toBe(1);
+    expect(stats.dropped).toBe(1);
+    expect(stats.failed).toBe(2);
+    expect(stats.queueDepth).toBe(0);
+  });
+
+  it('should resolve an alert superseded by a newer one', async () => {
+    const alertManager = new AlertManager({}, { groupWait: 0 });
+    alertManager.removeAlertConfig('model-high-response-time');
+    alertManager.addAlertConfig({ ...slowModelRule, cooldownPeriod: 0 });
+
+    const resolved: string[] = [];
+    alertManager.addListener({ onAlertResolved: alertId => resolved.push(alertId) });
+
+    await alertManager.processModelMetrics(modelMetrics('model-a', 2000));
+    const [first] = alertManager.getActiveAlerts();
+    await sleep(2); // alert ids carry a millisecond timestamp
+    await alertManager.processModelMetrics(modelMetrics('model-a', 3000));
+
+    const active = alertManager.getActiveAlerts();
+    expect(active).toHaveLength(1);
+    expect(active[0]!.id).not.toBe(first!.id);
+    expect(resolved).toEqual([first!.id]);
+  });
+});
+
+describe('AlertDeliveryQueue', () => {
+  it('should batch and rate limit sends', async () => {
+    const batches: number[][] = [];
+    const queue = new AlertDeliveryQueue<number>(async batch => {
+      batches.push(batch);
+      return true;
+    }, { batchSize: 3, ratePerSecond: 50, burst: 1 });
+
+    for (let i = 0; i < 7; i++) queue.enqueue(i);
+    expect(batches).toEqual([]);
+
+    await Promise.resolve();
+    expect(batches).toEqual([[0, 1, 2]]);
+    expect(queue.getStats().queueDepth).toBe(4);
+
+    await sleep(80);
+    await queue.drain();
+
+    expect(batches).toEqual([[0, 1, 2], [3, 4, 5], [6]]);
+    expect(queue.getStats().rateLimited).toBeGreaterThan(0);
+  });
+
+  it('should pace retries through the rate limit', async () => {
+    const sentAt: number[] = [];
+    const queue = new AlertDeliveryQueue<number>(async () => {
+      sentAt.push(Date.now());
+      return sentAt.length > 1; // first attempt fails
+    }, { batchSize: 1, ratePerSecond: 10, burst: 1, maxRetries: 1, retryBaseDelay: 1 });
+
+    queue.enqueue(0);
+    await queue.drain();
+
+    expect(sentAt).toHaveLength(2);
+    expect(sentAt[1]! - sentAt[0]!).toBeGreaterThanOrEqual(80); // one token per 100ms
+    expect(queue.getStats()).toMatchObject({ retries: 1, dropped: 0, queueDepth: 0 });
+  });
+
+  it('should drop the oldest items when full', () => {
+    const queue = new AlertDeliveryQueue<number>(async () => true, { maxQueueSize: 2, batchSize: 1, burst: 1, ratePerSecond: 20 });
+
+    for (let i = 0; i < 5; i++) queue.enqueue(i);
+
+    const stats = queue.getStats();
+    expect(stats.queueDepth).toBe(2);
+    expect(stats.dropped).toBe(3);
+  });
+});
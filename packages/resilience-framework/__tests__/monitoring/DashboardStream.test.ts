@@ -0,0 +1,242 @@
+/**
+ * Dashboard Delta Stream Tests
+ * BIP-03 Implementation - Phase 3: Monitoring & Alerting Tests
+ */
+
+import { describe, it, expect, beforeEach } from 'vitest';
+import { Dashboard, type DashboardSnapshot, type ModelGridWidget, type ChartWidget } from '../../src/monitoring/Dashboard.js';
+import { DashboardStream, type DashboardDelta } from '../../src/monitoring/DashboardStream.js';
+import type { ModelMetrics, SystemMetrics } from '../../src/monitoring/MetricsCollector.js';
+
+const systemMetrics: SystemMetrics = {
+  timestamp: new Date(),
+  systemUptime: 0,
+  totalRequests: 0,
+  successfulRequests: 0,
+  failedRequests: 0,
+  averageResponseTime: 0,
+  activeModels: 0,
+  healthyModels: 0,
+  circuitBreakersOpen: 0,
+  fallbacksTriggered: 0,
+};
+
+const row = (id: string, responseTime: number) => ({
+  id,
+  name: id,
+  status: 'healthy' as const,
+  responseTime,
+  successRate: 1,
+  circuitBreakerState: 'closed' as const,
+});
+
+const snapshot = (rows: ModelGridWidget['models'], points: number[], status = 'operational'): DashboardSnapshot => {
+  const grid: ModelGridWidget = { type: 'model-grid', models: rows };
+  const chart: ChartWidget = {
+    type: 'chart',
+    chartType: 'line',
+    timeRange: { start: new Date(0), end: new Date(10000) },
+    series: [{ name: 'latency', data: points.map(x => ({ x: new Date(x), y: x / 10 })) }],
+  };
+
+  return {
+    timestamp: new Date(),
+    widgets: new Map<string, any>([
+      ['grid', grid],
+      ['chart', chart],
+      ['status', { type: 'status', status, message: '', uptime: 0 }],
+    ]),
+    systemMetrics,
+    modelMetrics: new Map(),
+    activeAlerts: [],
+  };
+};
+
+describe('DashboardStream', () => {
+  let stream: DashboardStream;
+
+  beforeEach(() => {
+    stream = new DashboardStream();
+  });
+
+  it('should send full state for a fresh cursor', () => {
+    stream.publish(snapshot([row('a', 100), row('b', 200)], [1000, 2000]));
+    const delta = stream.getDelta(0);
+
+    expect(delta.full).toBe(true);
+    expect(delta.widgets.map(w => w.kind).sort()).toEqual(['points', 'replace', 'rows']);
+  });
+
+  it('should only include changed rows and appended points', () => {
+    stream.publish(snapshot([row('a', 100), row('b', 200)], [1000, 2000]));
+    const cursor = stream.cursor;
+
+    stream.publish(snapshot([row('a', 100), row('b', 250)], [1000, 2000, 3000]));
+    const delta = stream.getDelta(cursor);
+
+    expect(delta.full).toBe(false);
+    const rows = delta.widgets.find(w => w.kind === 'rows');
+    expect(rows && rows.kind === 'rows' && rows.upserts.map(r => r.id)).toEqual(['b']);
+
+    const points = delta.widgets.find(w => w.kind === 'points');
+    expect(points && points.kind === 'points' && points.series[0]).toEqual({
+      name: 'latency',
+      trimBefore: 0,
+      points: [{ x: 3000, y: 300 }],
+    });
+
+    // Unchanged status widget is omitted
+    expect(delta.widgets.some(w => w.widgetId === 'status')).toBe(false);
+  });
+
+  it('should report removed rows and replaced widgets', () => {
+    stream.publish(snapshot([row('a', 100), row('b', 200)], [1000]));
+    const cursor = stream.cursor;
+
+    stream.publish(snapshot([row('a', 100)], [1000], 'degraded'));
+    const delta = stream.getDelta(cursor);
+
+    const rows = delta.widgets.find(w => w.kind === 'rows');
+    expect(rows && rows.kind === 'rows' && rows.removed).toEqual(['b']);
+    expect(delta.widgets.find(w => w.widgetId === 'status')?.kind).toBe('replace');
+  });
+
+  it('should encode chart deltas as columns', () => {
+    stream.publish(snapshot([], [1000, 2000]));
+    const delta = stream.getDelta(0, 'columnar');
+    const chart = delta.widgets.find(w => w.kind === 'points');
+    const series = chart && chart.kind === 'points' ? chart.series[0] : undefined;
+
+    expect(series && 'timestamps' in series && Array.from(series.timestamps)).toEqual([1000, 2000]);
+    expect(series && 'values' in series && Array.from(series.values)).toEqual([100, 200]);
+  });
+
+  it('should carry chart metadata in full frames and report removed series', () => {
+    const chart = (series: ChartWidget['series']): DashboardSnapshot => {
+      const widget: ChartWidget = {
+        type: 'chart',
+        chartType: 'line',
+        timeRange: { start: new Date(0), end: new Date(10000) },
+        xAxis: { label: 'time' },
+        yAxis: { label: 'ms', min: 0 },
+        series,
+      };
+      return { ...snapshot([], []), widgets: new Map<string, any>([['chart', widget]]) };
+    };
+    const latency = (style: 'solid' | 'dashed') => ({
+      name: 'latency',
+      color: '#f00',
+      style,
+      data: [{ x: 1000, y: 1, label: 'deploy' }, { x: 2000, y: 2 }],
+    });
+    const errors = { name: 'errors', data: [{ x: 1000, y: 0 }] };
+
+    stream.publish(chart([latency('solid'), errors]));
+    const first = stream.getDelta(0).widgets[0]!;
+    expect(first.kind === 'points' && first).toMatchObject({
+      full: true,
+      xAxis: { label: 'time' },
+      yAxis: { label: 'ms', min: 0 },
+      series: [
+        { name: 'latency', color: '#f00', style: 'solid', points: [{ x: 1000, y: 1, label: 'deploy' }, { x: 2000, y: 2 }] },
+        { name: 'errors' },
+      ],
+    });
+    const columnar = stream.getDelta(0, 'columnar').widgets[0]!;
+    const columns = columnar.kind === 'points' ? columnar.series[0] : undefined;
+    expect(columns && 'labels' in columns && columns.labels).toEqual(['deploy', null]);
+
+    let cursor = stream.cursor;
+    stream.publish(chart([latency('solid')]));
+    const removal = stream.getDelta(cursor).widgets[0]!;
+    expect(removal.kind === 'points' && removal).toMatchObject({ full: false, series: [], removed: ['errors'] });
+    expect(removal.kind === 'points' && 'xAxis' in removal).toBe(false);
+
+    // A style change resends the chart with its metadata
+    cursor = stream.cursor;
+    stream.publish(chart([latency('dashed')]));
+    const restyled = stream.getDelta(cursor).widgets[0]!;
+    expect(restyled.kind === 'points' && restyled).toMatchObject({
+      full: true,
+      xAxis: { label: 'time' },
+      series: [{ name: 'latency', style: 'dashed' }],
+    });
+  });
+
+  it('should fall back to full state for cursors beyond the history', () => {
+    const short = new DashboardStream(2);
+    short.publish(snapshot([row('a', 1)], [1]));
+    for (let i = 2; i < 6; i++) {
+      short.publish(snapshot([row('a', i)], [i]));
+    }
+
+    expect(short.getDelta(1).full).toBe(true);
+    expect(short.getDelta(short.cursor - 1).full).toBe(false);
+  });
+
+  it('should conflate updates while a subscriber is busy', async () => {
+    const frames: DashboardDelta[] = [];
+    let release!: () => void;
+
+    stream.publish(snapshot([row('a', 100)], [1000]));
+    const subscription = stream.subscribe(delta => {
+      frames.push(delta);
+      return new Promise<void>(resolve => { release = resolve; });
+    });
+
+    stream.publish(snapshot([row('a', 110)], [1000, 2000]));
+    stream.publish(snapshot([row('a', 120)], [1000, 2000, 3000]));
+    expect(frames).toHaveLength(1);
+
+    release();
+    await new Promise(resolve => setTimeout(resolve, 0));
+
+    expect(frames).toHaveLength(2);
+    const merged = frames[1]!.widgets.find(w => w.kind === 'points');
+    const mergedSeries = merged && merged.kind === 'points' ? merged.series[0] : undefined;
+    expect(mergedSeries && 'points' in mergedSeries && mergedSeries.points.map(p => p.x)).toEqual([2000, 3000]);
+    expect(subscription.conflatedFrames).toBe(1);
+
+    release();
+    await new Promise(resolve => setTimeout(resolve, 0));
+    expect(subscription.cursor).toBe(stream.cursor);
+    subscription.unsubscribe();
+  });
+});
+
+describe('Dashboard subscriptions', () => {
+  it('should stream model changes from the dashboard', async () => {
+    const dashboard = new Dashboard();
+    const frames: DashboardDelta[] = [];
+    const metrics = (modelId: string, averageResponseTime: number): ModelMetrics => ({
+      modelId,
+      timestamp: new Date(),
+      requests: 1,
+      successes: 1,
+      failures: 0,
+      averageResponseTime,
+      lastResponseTime: averageResponseTime,
+      successRate: 1,
+      healthStatus: 'healthy',
+      circuitBreakerState: 'closed',
+      uptime: 1,
+    });
+
+    await dashboard.start();
+    dashboard.subscribe(delta => { frames.push(delta); });
+
+    dashboard.updateModelMetrics('model-a', metrics('model-a', 100));
+    await dashboard.refresh();
+    dashboard.updateModelMetrics('model-b', metrics('model-b', 200));
+    await dashboard.refresh();
+
+    expect(frames[0]!.full).toBe(true);
+    const last = frames[frames.length - 1]!;
+    const rows = last.widgets.find(w => w.kind === 'rows');
+    expect(rows && rows.kind === 'rows' && rows.upserts.map(r => r.id)).toEqual(['model-b']);
+
+    const polled = JSON.parse(dashboard.exportDelta(last.cursor));
+    expect(polled.widgets).toEqual([]);
+    dashboard.stop();
+  });
+});
@@ -9,6 +9,8 @@ import {
   AlertManager,
   Dashboard,
   Analytics,
+  MetricRollup,
+  DEFAULT_ROLLUP_CONFIG,
   type SystemMetrics,
   type ModelMetrics,
   type Alert,
@@ -68,6 +70,38 @@ describe('Monitoring Integration', () => {
       const systemMetrics = metricsCollector.getSystemMetrics();
       expect(systemMetrics).toBeDefined();
     });
+
+    it('should cap time series at the configured capacity', () => {
+      const collector = new MetricsCollector({
+        collectionInterval: 10000,
+        retentionPeriod: 86400000,
+        batchSize: 100,
+        enableRealTimeMetrics: false,
+        timeSeriesCapacity: 100,
+      });
+
+      for (let i = 0; i < 250; i++) {
+        collector.recordRequest('ring-model', true, i);
+      }
+
+      const series = collector.getTimeSeries('ring-model.responseTime');
+      expect(series).toHaveLength(100);
+      expect(series[0]!.value).toBe(150);
+      expect(series[99]!.value).toBe(249);
+    });
+
+    it('should round-trip time series through export and import', () => {
+      metricsCollector.recordRequest('export-model', true, 42, { region: 'eu' });
+
+      const exported = metricsCollector.exportMetrics();
+      const restored = new MetricsCollector();
+      restored.importMetrics(exported);
+
+      const series = restored.getTimeSeries('export-model.responseTime');
+      expect(series).toHaveLength(1);
+      expect(series[0]!.value).toBe(42);
+      expect(series[0]!.metadata).toEqual({ region: 'eu' });
+    });
   });
 
   describe('AlertManager', () => {
@@ -277,6 +311,106 @@ describe('Monitoring Integration', () => {
       expect(highSeverityAnomalies.length).toBeGreaterThan(0);
     });
 
+    it('should answer period percentiles from streaming sketches', () => {
+      const now = Date.now();
+      for (let i = 1; i <= 1000; i++) {
+        analytics.addMetricData('sketch.latency', {
+          timestamp: new Date(now - i * 1000),
+          value: i,
+        });
+      }
+
+      const stats = analytics.getMetricStatistics('sketch.latency', 'hour');
+
+      expect(stats.count).toBe(1000);
+      expect(stats.min).toBe(1);
+      expect(stats.max).toBe(1000);
+      expect(stats.mean).toBeCloseTo(500.5, 5);
+      // Default sketch keeps estimates within 1% relative error
+      expect(Math.abs(stats.median - 500) / 500).toBeLessThan(0.02);
+      expect(Math.abs(stats.p99 - 990) / 990).toBeLessThan(0.02);
+    });
+
+    it('should read long periods from coarse rollup tiers', () => {
+      const minute = 60 * 1000;
+      const now = Date.now();
+      // Three days of one point per minute
+      for (let i = 3 * 24 * 60; i > 0; i--) {
+        analytics.addMetricData('rollup.latency', {
+          timestamp: new Date(now - i * minute),
+          value: 100 + (i % 60),
+        });
+      }
+
+      const status = analytics.getDataRetentionStatus();
+      expect(status.totalDataPoints).toBe(121); // 2 hours of raw points, both ends inclusive
+      expect(status.tiers['1m']).toBeLessThanOrEqual(25 * 60);
+      expect(status.tiers['1h']).toBeGreaterThanOrEqual(72);
+
+      const daySeries = analytics.getRollupSeries('rollup.latency', 'day');
+      expect(daySeries.length).toBeGreaterThan(1000);
+      expect(daySeries.length).toBeLessThanOrEqual(24 * 60 + 1);
+
+      const weekSeries = analytics.getRollupSeries('rollup.latency', 'week');
+      expect(weekSeries.length).toBeLessThanOrEqual(3 * 24 + 1);
+
+      const buckets = analytics.getRollupBuckets('rollup.latency', '1h', new Date(now - 3 * 24 * 60 * minute));
+      const total = buckets.reduce((sum, bucket) => sum + bucket.count, 0);
+      expect(total).toBe(3 * 24 * 60);
+      for (const bucket of buckets) {
+        expect(bucket.min).toBeLessThanOrEqual(bucket.mean);
+        expect(bucket.max).toBeGreaterThanOrEqual(bucket.mean);
+        expect(bucket.sketch.count).toBe(bucket.count);
+      }
+    });
+
+    it('should fall back to 1m buckets once raw capacity no longer covers the period', () => {
+      const minute = 60 * 1000;
+      const now = Date.now();
+      const rollup = new MetricRollup({ ...DEFAULT_ROLLUP_CONFIG, rawCapacity: 30 });
+
+      for (let i = 59; i >= 0; i--) {
+        rollup.add(now - i * minute, i);
+      }
+
+      // Raw retention covers an hour, but only the last 30 points are held
+      expect(rollup.tierFor(60 * minute, now)).toBe('1m');
+      expect(rollup.tierFor(20 * minute, now)).toBe('raw');
+      expect(rollup.series('1m', now - 60 * minute, now)).toHaveLength(60);
+    });
+
+    it('should forecast and flag anomalies from online state', () => {
+      const minute = 60 * 1000;
+      const start = Date.now() - 120 * minute;
+      for (let i = 0; i < 100; i++) {
+        analytics.addMetricData('online.metric', {
+          timestamp: new Date(start + i * minute),
+          value: 200 + i,
+        });
+      }
+
+      expect(analytics.detectAnomalies('day')).toHaveLength(0);
+
+      const forecast = analytics.generateForecast('online.metric', 2);
+      expect(forecast).not.toBeNull();
+      expect(forecast!.accuracy).toBeGreaterThan(95);
+      const [first] = forecast!.predictions;
+      // Trend continues at ~1 per minute from the last point
+      expect(first!.predictedValue).toBeGreaterThan(299);
+      expect(first!.confidenceInterval.lower).toBeLessThanOrEqual(first!.predictedValue);
+      expect(first!.confidenceInterval.upper).toBeGreaterThanOrEqual(first!.predictedValue);
+
+      analytics.addMetricData('online.metric', {
+        timestamp: new Date(start + 100 * minute),
+        value: 5000,
+      });
+
+      const anomalies = analytics.detectAnomalies('day');
+      expect(anomalies).toHaveLength(1);
+      expect(anomalies[0]!.severity).toBe('high');
+      expect(anomalies[0]!.expectedValue).toBeCloseTo(300, 0);
+    });
+
     it('should generate capacity recommendations', () => {
       // Add test data indicating performance issues
       const testSystemMetrics: SystemMetrics = {
@@ -0,0 +1,234 @@
+/**
+ * Tracer Tests
+ * BIP-03 Implementation - Phase 3: Monitoring & Alerting Tests
+ */
+
+import { describe, it, expect, beforeEach, vi } from 'vitest';
+import {
+  Tracer,
+  DEFAULT_TRACER_CONFIG,
+  SpanRingBuffer,
+  OtlpHttpExporter,
+  SPAN_NAMES,
+  summarizeSpans,
+  toOtlpJson,
+  type SpanData
+} from '../../src/monitoring/Tracer.js';
+import { RetryManager } from '../../src/core/RetryManager.js';
+import { RetryBudget } from '../../src/core/RetryBudget.js';
+import { TimerWheelScheduler } from '../../src/core/TimerWheelScheduler.js';
+import { OptimizationEngine } from '../../src/recovery/OptimizationEngine.js';
+import { CircuitBreakerError, ResilienceError } from '../../src/types/index.js';
+
+const tick = () => new Promise(resolve => setTimeout(resolve, 1));
+
+const byName = (spans: SpanData[], name: string) => spans.filter(span => span.name === name);
+
+describe('Tracer', () => {
+  let tracer: Tracer;
+
+  beforeEach(() => {
+    tracer = new Tracer({ headSampleRate: 1 });
+  });
+
+  it('should propagate parents across awaits and concurrent branches', async () => {
+    await tracer.withSpan('root', async () => {
+      await Promise.all(['a', 'b'].map(id => tracer.withSpan(`branch.${id}`, async () => {
+        await tick();
+        await tracer.withSpan(`leaf.${id}`, async () => tick());
+      })));
+    }, { component: 'model-a' });
+
+    const spans = tracer.getBuffer().toArray();
+    const root = byName(spans, 'root')[0]!;
+    expect(spans).toHaveLength(5);
+    expect(new Set(spans.map(span => span.traceId)).size).toBe(1);
+    expect(root.parentSpanId).toBeUndefined();
+
+    for (const id of ['a', 'b']) {
+      const branch = byName(spans, `branch.${id}`)[0]!;
+      const leaf = byName(spans, `leaf.${id}`)[0]!;
+      expect(branch.parentSpanId).toBe(root.spanId);
+      expect(leaf.parentSpanId).toBe(branch.spanId);
+      expect(leaf.attributes.component).toBe('model-a');
+    }
+  });
+
+  it('should keep only failing or slow traces when not head-sampled', async () => {
+    tracer = new Tracer({
+      headSampleRate: 0,
+      tailSampling: { enabled: true, keepErrors: true, latencyThresholdMs: 20 },
+    });
+
+    await tracer.withSpan('fast', async () => tracer.withSpan('child', async () => 'ok'));
+    await expect(tracer.withSpan('failing', async () => {
+      await tracer.withSpan('child', async () => { throw new Error('boom'); });
+    })).rejects.toThrow('boom');
+    await tracer.withSpan('slow', () => new Promise(resolve => setTimeout(resolve, 30)));
+
+    const spans = tracer.getBuffer().toArray();
+    expect(spans.map(span => span.name)).toEqual(['child', 'failing', 'slow']);
+    expect(spans.every(span => span.sampling === 'tail')).toBe(true);
+    expect(byName(spans, 'child')[0]!.statusMessage).toBe('boom');
+    expect(tracer.getStats()).toMatchObject({ tracesStarted: 3, tracesKept: { head: 0, tail: 2 }, tracesDropped: 1 });
+  });
+
+  it('should not record anything for unsampled traces without tail sampling', async () => {
+    tracer = new Tracer({
+      headSampleRate: 0,
+      tailSampling: { enabled: false, keepErrors: true, latencyThresholdMs: 0 },
+    });
+
+    await tracer.withSpan('root', async span => {
+      expect(span.isRecording).toBe(false);
+      await tracer.withSpan('child', async child => expect(child.isRecording).toBe(false));
+    });
+
+    expect(tracer.getBuffer().size).toBe(0);
+    expect(tracer.getStats().tracesStarted).toBe(1);
+  });
+
+  it('should split breaker rejections from model calls', async () => {
+    let open = false;
+    const breaker = {
+      execute: <T>(fn: () => Promise<T>): Promise<T> =>
+        open ? Promise.reject(new CircuitBreakerError('model-a', 'open')) : fn(),
+    };
+
+    await tracer.withSpan('root', async () => {
+      await tracer.traceBreakerCall(breaker, 'model-a', async () => 'ok');
+      open = true;
+      await expect(tracer.traceBreakerCall(breaker, 'model-a', async () => 'ok')).rejects.toThrow(CircuitBreakerError);
+    });
+
+    const spans = tracer.getBuffer().toArray();
+    expect(byName(spans, SPAN_NAMES.circuitBreaker).map(span => span.status)).toEqual(['ok', 'rejected']);
+    expect(byName(spans, SPAN_NAMES.modelCall)).toHaveLength(1);
+
+    const breakdown = summarizeSpans(spans).get('model-a')!;
+    expect(breakdown).toMatchObject({ modelCalls: 1, breakerCalls: 2, breakerRejections: 1 });
+  });
+
+  it('should trace retry backoff sleeps', async () => {
+    const budget = new RetryBudget({ retryRatio: 1, minRetriesPerSecond: 100, maxTokens: 10 });
+    const retryManager = new RetryManager(
+      { maxRetries: 3, baseDelay: 1, maxDelay: 5, backoffMultiplier: 2, jitter: false },
+      budget,
+      tracer
+    );
+    let calls = 0;
+
+    await tracer.withSpan('root', () => retryManager.executeWithRetry(async () => {
+      if (++calls < 3) throw new ResilienceError('unavailable', 'MODEL_UNAVAILABLE', 'model-a', true);
+      return 'ok';
+    }, undefined, { target: 'model-a' }));
+
+    const backoffs = byName(tracer.getBuffer().toArray(), SPAN_NAMES.backoff);
+    expect(backoffs.map(span => span.attributes['retry.attempt'])).toEqual([1, 2]);
+    expect(backoffs.every(span => span.attributes.component === 'model-a')).toBe(true);
+    expect(summarizeSpans(tracer.getBuffer().toArray()).get('model-a')!.backoffs).toBe(2);
+  });
+
+  it('should feed optimization bottleneck analysis from the ring buffer', async () => {
+    const engine = new OptimizationEngine(undefined, TimerWheelScheduler.shared(), tracer);
+
+    for (let i = 0; i < 25; i++) {
+      await tracer.withSpan(SPAN_NAMES.bipOperation, async () => {
+        const end = tracer.now();
+        tracer.recordSpan(SPAN_NAMES.queue, end - 50, end, { 'queue.reason': 'coalesced' });
+      }, { component: 'bip.validation' });
+    }
+
+    const breakdown = engine.getLatencyBreakdown('bip.validation');
+    expect(breakdown).toMatchObject({ requests: 25, queued: 25 });
+
+    const recommendations = await engine.getOptimizationRecommendations('bip.validation');
+    expect(recommendations.map(rec => rec.technique)).toContain('resource_scaling');
+    expect(engine.getBottleneckHistory(1)[0]).toMatchObject({ type: 'queue_congestion', component: 'bip.validation' });
+  });
+
+  it('should summarize the ring buffer once per monitoring tick', async () => {
+    const engine = new OptimizationEngine(undefined, TimerWheelScheduler.shared(), tracer);
+    for (const component of ['model-a', 'model-b', 'model-c']) {
+      await tracer.withSpan(SPAN_NAMES.modelCall, async () => tick(), { component });
+    }
+
+    const reads = vi.spyOn(tracer.getBuffer(), 'toArray');
+    await (engine as any).monitorPerformance();
+    expect(reads).toHaveBeenCalledTimes(1);
+
+    // Outside a tick, queries read the current buffer
+    engine.getLatencyBreakdown('model-a');
+    expect(reads).toHaveBeenCalledTimes(2);
+  });
+
+  it('should leave tail sampling off by default', async () => {
+    expect(DEFAULT_TRACER_CONFIG.tailSampling.enabled).toBe(false);
+
+    const unsampled = new Tracer({ headSampleRate: 0 });
+    await unsampled.withSpan('root', async () => undefined);
+    expect(unsampled.getStats().tracesDropped).toBe(1);
+    expect(unsampled.getBuffer().size).toBe(0);
+  });
+});
+
+describe('SpanRingBuffer', () => {
+  it('should keep the most recent spans in order', () => {
+    const buffer = new SpanRingBuffer(3);
+    const span = (n: number): SpanData => ({
+      traceId: 't', spanId: `s${n}`, name: 'x', startTime: n, endTime: n, duration: 0,
+      status: 'ok', attributes: {}, sampling: 'head',
+    });
+
+    [1, 2, 3, 4, 5].forEach(n => buffer.push(span(n)));
+
+    expect(buffer.size).toBe(3);
+    expect(buffer.toArray().map(s => s.spanId)).toEqual(['s3', 's4', 's5']);
+    expect(buffer.toArray(4).map(s => s.spanId)).toEqual(['s4', 's5']);
+  });
+});
+
+describe('OtlpHttpExporter', () => {
+  it('should post OTLP JSON in batches', async () => {
+    const tracer = new Tracer({ headSampleRate: 1 });
+    const requests: Array<{ url: string; body: any }> = [];
+    const exporter = new OtlpHttpExporter(
+      { endpoint: 'http://collector:4318/', maxBatchSize: 2, serviceName: 'test' },
+      async (url, init) => {
+        requests.push({ url, body: JSON.parse(init.body) });
+        return { ok: true, status: 200 };
+      }
+    );
+    tracer.addExporter(exporter);
+
+    await tracer.withSpan('root', async () => {
+      await tracer.withSpan('child', async () => 1, { attempt: 1, ratio: 0.5, hedged: false });
+    });
+    await tracer.withSpan('other', async () => 'ok');
+    await exporter.shutdown();
+
+    expect(requests.map(request => request.url)).toEqual(['http://collector:4318/v1/traces', 'http://collector:4318/v1/traces']);
+    const spans = requests.flatMap(request => request.body.resourceSpans[0].scopeSpans[0].spans);
+    expect(spans.map((span: any) => span.name)).toEqual(['child', 'root', 'other']);
+    expect(exporter.getStats()).toMatchObject({ exported: 3, dropped: 0, queued: 0 });
+
+    const child = spans[0];
+    expect(child.parentSpanId).toBe(spans[1].spanId);
+    expect(child.traceId).toMatch(/^[0-9a-f]{32}$/);
+    expect(BigInt(child.endTimeUnixNano) >= BigInt(child.startTimeUnixNano)).toBe(true);
+    expect(child.attributes).toContainEqual({ key: 'attempt', value: { intValue: '1' } });
+    expect(child.attributes).toContainEqual({ key: 'ratio', value: { doubleValue: 0.5 } });
+    expect(child.attributes).toContainEqual({ key: 'hedged', value: { boolValue: false } });
+  });
+
+  it('should map breaker rejections to OTLP error status', () => {
+    const [span] = (toOtlpJson([{
+      traceId: 'a'.repeat(32), spanId: 'b'.repeat(16), name: SPAN_NAMES.circuitBreaker,
+      startTime: 1000.5, endTime: 1001, duration: 0.5, status: 'rejected',
+      statusMessage: 'Circuit breaker is open', attributes: {}, sampling: 'head',
+    }], 'test') as any).resourceSpans[0].scopeSpans[0].spans;
+
+    expect(span.status).toEqual({ code: 2, message: 'Circuit breaker is open' });
+    expect(span.startTimeUnixNano).toBe('1000500000');
+  });
+});
@@ -0,0 +1,199 @@
+/**
+ * Chaos Benchmark Tests
+ * BIP-03 Implementation - Phase 4: Advanced Features Tests
+ */
+
+import { describe, it, expect, vi } from 'vitest';
+import * as os from 'os';
+import * as path from 'path';
+import {
+  ChaosBenchmark,
+  FaultInjectingExecutor,
+  compareBenchmarkReports,
+  saveBenchmarkBaseline,
+  loadBenchmarkBaseline,
+  type BenchmarkPhaseResult,
+  type BenchmarkReport,
+} from '../../src/recovery/ChaosBenchmark.js';
+import { ChaosTestSuite } from '../../src/recovery/ChaosTestSuite.js';
+import { CircuitBreakerFactory } from '../../src/core/CircuitBreaker.js';
+import type { ModelIdentity } from '../../src/types/index.js';
+
+const model = (id: string): ModelIdentity => ({ id, name: id, provider: 'bench' });
+const models = [model('bench-a'), model('bench-b')];
+
+const phaseResult = (name: string, p99: number, goodput: number, successRate = 1): BenchmarkPhaseResult => ({
+  name,
+  targetRate: 100,
+  elapsedMs: 1000,
+  sent: 100,
+  succeeded: Math.round(successRate * 100),
+  failed: 100 - Math.round(successRate * 100),
+  timedOut: 0,
+  dropped: 0,
+  throughput: goodput,
+  goodput,
+  successRate,
+  fallbackRate: 0,
+  breakerOpenings: 0,
+  unroutable: 0,
+  latency: { count: 100, min: 1, mean: p99 / 2, p50: p99 / 2, p90: p99 * 0.9, p99, p999: p99, max: p99 },
+});
+
+const report = (phases: BenchmarkPhaseResult[], maxSustainableRate?: number): BenchmarkReport => ({
+  name: 'baseline',
+  startedAt: new Date(0).toISOString(),
+  phases,
+  ...(maxSustainableRate !== undefined ? { maxSustainableRate } : {}),
+});
+
+describe('ChaosBenchmark', () => {
+  it('should drive the open-loop rate and record latency per phase', async () => {
+    const benchmark = new ChaosBenchmark({
+      name: 'steady',
+      models,
+      baseLatencyMs: 5,
+      latencyJitterMs: 0,
+      phases: [{ name: 'steady', durationMs: 200, ratePerSecond: 100 }],
+    });
+
+    const result = await benchmark.run();
+    const steady = result.phases[0]!;
+
+    expect(steady.sent).toBe(20);
+    expect(steady.succeeded).toBe(20);
+    expect(steady.latency.count).toBe(20);
+    expect(steady.latency.p50).toBeGreaterThanOrEqual(4);
+    expect(steady.latency.max).toBeGreaterThanOrEqual(steady.latency.p99);
+    expect(steady.goodput).toBeGreaterThan(50);
+  });
+
+  it('should fail over to healthy models while a fault is injected', async () => {
+    const benchmark = new ChaosBenchmark({
+      name: 'failover',
+      models,
+      baseLatencyMs: 2,
+      latencyJitterMs: 0,
+      circuitBreaker: { failureThreshold: 3, recoveryTimeout: 60000, successThreshold: 1, timeout: 1000 },
+      phases: [{
+        name: 'primary-down',
+        durationMs: 200,
+        ratePerSecond: 100,
+        faults: [{ type: 'model_failure', targets: ['bench-a'] }],
+      }],
+    });
+
+    const faulted = (await benchmark.run()).phases[0]!;
+
+    expect(faulted.successRate).toBe(1);
+    expect(faulted.fallbackRate).toBeGreaterThan(0);
+    expect(faulted.breakerOpenings).toBe(1);
+  });
+
+  it('should count requests exceeding the budget as timeouts', async () => {
+    const benchmark = new ChaosBenchmark({
+      name: 'timeouts',
+      models: [model('bench-slow')],
+      requestTimeoutMs: 30,
+      phases: [{
+        name: 'hang',
+        durationMs: 50,
+        ratePerSecond: 100,
+        faults: [{ type: 'timeout_failure', timeoutMs: 60 }],
+      }],
+    });
+
+    const hang = (await benchmark.run()).phases[0]!;
+
+    expect(hang.timedOut).toBe(hang.sent);
+    expect(hang.latency.min).toBeGreaterThanOrEqual(29);
+  });
+
+  it('should abort timed-out requests and keep its breakers private', async () => {
+    const shared = CircuitBreakerFactory.getOrCreate('bench-stuck');
+    const benchmark = new ChaosBenchmark({
+      name: 'abort',
+      models: [model('bench-stuck')],
+      requestTimeoutMs: 20,
+      phases: [{
+        name: 'stuck',
+        durationMs: 50,
+        ratePerSecond: 100,
+        faults: [{ type: 'timeout_failure', timeoutMs: 10000 }],
+      }],
+    });
+
+    const injector = benchmark.getInjector();
+    const execute = injector.execute.bind(injector);
+    let running = 0;
+    vi.spyOn(injector, 'execute').mockImplementation((target, task, signal) => {
+      running++;
+      return execute(target, task, signal).finally(() => running--);
+    });
+
+    const stuck = (await benchmark.run()).phases[0]!;
+    await new Promise(resolve => setTimeout(resolve, 20));
+
+    expect(stuck.timedOut).toBe(stuck.sent);
+    expect(running).toBe(0);
+    expect(CircuitBreakerFactory.getOrCreate('bench-stuck')).toBe(shared);
+    expect(shared.getStatus().failureCount).toBe(0);
+    CircuitBreakerFactory.remove('bench-stuck');
+  });
+
+  it('should let ChaosTestSuite inject faults into benchmark traffic', async () => {
+    const suite = new ChaosTestSuite();
+    const benchmark = new ChaosBenchmark({ name: 'suite', models, phases: [] });
+    benchmark.attachToSuite(suite);
+
+    const injector = benchmark.getInjector();
+    await injector.injectFailure('network_latency', { latencyMs: 50, targets: ['bench-a'] });
+
+    expect(await injector.getActiveInjections()).toEqual(['network_latency-1']);
+  });
+});
+
+describe('FaultInjectingExecutor', () => {
+  it('should apply intermittent errors at the configured rate', async () => {
+    const rolls = [0.1, 0.9];
+    let roll = 0;
+    const executor = new FaultInjectingExecutor(0, 0, () => rolls[roll++ % rolls.length]!);
+    executor.inject({ type: 'intermittent_errors', errorRate: 0.5 });
+
+    const task = { id: 't', type: 'benchmark', payload: null };
+    // Each call draws jitter then the error roll
+    await expect(executor.execute(model('m'), task)).resolves.toBeDefined();
+    roll = 1;
+    await expect(executor.execute(model('m'), task)).rejects.toThrow('Injected failure');
+  });
+});
+
+describe('compareBenchmarkReports', () => {
+  it('should flag p99, goodput and capacity regressions', () => {
+    const baseline = report([phaseResult('steady', 100, 100), phaseResult('faulted', 200, 90)], 400);
+    const current = report([phaseResult('steady', 105, 99), phaseResult('faulted', 260, 80, 0.95)], 300);
+
+    const comparison = compareBenchmarkReports(current, baseline);
+
+    expect(comparison.regressed).toBe(true);
+    expect(comparison.phases[0]!.regressions).toEqual([]);
+    expect(comparison.phases[1]!.regressions).toHaveLength(3);
+    expect(comparison.maxRateChange).toBe(-0.25);
+    expect(comparison.regressions.some(r => r.startsWith('max sustainable rate'))).toBe(true);
+  });
+
+  it('should pass runs within thresholds', () => {
+    const baseline = report([phaseResult('steady', 100, 100)]);
+    const comparison = compareBenchmarkReports(report([phaseResult('steady', 80, 110)]), baseline);
+    expect(comparison.regressed).toBe(false);
+  });
+
+  it('should round-trip baselines through a file', async () => {
+    const file = path.join(os.tmpdir(), `chaos-baseline-${process.pid}.json`);
+    const baseline = report([phaseResult('steady', 100, 100)], 250);
+
+    expect(await loadBenchmarkBaseline(`${file}.missing`)).toBeUndefined();
+    await saveBenchmarkBaseline(file, baseline);
+    expect(await loadBenchmarkBaseline(file)).toEqual(baseline);
+  });
+});
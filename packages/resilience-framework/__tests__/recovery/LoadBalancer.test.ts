@@ -0,0 +1,158 @@
+/**
+ * Load Balancer Selection Tests
+ * BIP-03 Implementation - Phase 4: Advanced Features Tests
+ */
+
+import { describe, it, expect, beforeEach } from 'vitest';
+import { LoadBalancer, LoadBalancingAlgorithm } from '../../src/recovery/LoadBalancer.js';
+import { SelectionHeap } from '../../src/recovery/SelectionHeap.js';
+import { ConcurrencyLimiter, DEFAULT_CONCURRENCY_LIMITER_CONFIG } from '../../src/core/ConcurrencyLimiter.js';
+import type { AITask, ModelIdentity } from '../../src/types/index.js';
+
+const task: AITask = {
+  id: 'task-1',
+  type: 'text_generation',
+  payload: 'test',
+  priority: 'normal',
+  timeout: 1000,
+};
+
+const model = (id: string): ModelIdentity => ({
+  id,
+  name: id,
+  provider: 'test',
+  capabilities: ['text_generation'],
+});
+
+describe('LoadBalancer selection', () => {
+  let loadBalancer: LoadBalancer;
+
+  const useAlgorithm = (algorithm: LoadBalancingAlgorithm) => {
+    loadBalancer.updateConfiguration({ algorithm });
+  };
+
+  beforeEach(() => {
+    loadBalancer = new LoadBalancer();
+
+    const weights: Record<string, { weight: number; priority: number }> = {
+      a: { weight: 0.3, priority: 3 },
+      b: { weight: 0.1, priority: 8 },
+      c: { weight: 0.2, priority: 8 },
+    };
+
+    for (const [id, { weight, priority }] of Object.entries(weights)) {
+      loadBalancer.registerModel(model(id), { modelId: id, weight, priority, maxConnections: 10, enabled: true });
+    }
+  });
+
+  it('should spread least-connections picks as connections accumulate', async () => {
+    useAlgorithm('least_connections');
+
+    const picks: string[] = [];
+    for (let i = 0; i < 6; i++) {
+      picks.push((await loadBalancer.selectModel(task)).selectedModel.id);
+    }
+
+    expect(picks).toEqual(['a', 'b', 'c', 'a', 'b', 'c']);
+  });
+
+  it('should interleave weighted round robin in proportion to weights', async () => {
+    useAlgorithm('weighted_round_robin');
+
+    const picks: string[] = [];
+    for (let i = 0; i < 6; i++) {
+      picks.push((await loadBalancer.selectModel(task)).selectedModel.id);
+    }
+
+    expect(picks.filter(id => id === 'a')).toHaveLength(3);
+    expect(picks.filter(id => id === 'c')).toHaveLength(2);
+    expect(picks.filter(id => id === 'b')).toHaveLength(1);
+    expect(picks.slice(0, 2)).not.toEqual(['a', 'a']);
+  });
+
+  it('should choose the highest priority and keep registration order on ties', async () => {
+    useAlgorithm('priority_based');
+    expect((await loadBalancer.selectModel(task)).selectedModel.id).toBe('b');
+
+    loadBalancer.updateModelWeights([{ modelId: 'a', weight: 0.3, priority: 9, maxConnections: 10, enabled: true }]);
+    expect((await loadBalancer.selectModel(task)).selectedModel.id).toBe('a');
+  });
+
+  it('should drop disabled models from the candidate set', async () => {
+    useAlgorithm('round_robin');
+    loadBalancer.updateModelWeights([{ modelId: 'b', weight: 0.1, priority: 8, maxConnections: 10, enabled: false }]);
+
+    const decision = await loadBalancer.selectModel(task);
+    expect(decision.alternatives.map(m => m.id)).not.toContain('b');
+
+    const picks = new Set<string>();
+    for (let i = 0; i < 4; i++) {
+      picks.add((await loadBalancer.selectModel(task)).selectedModel.id);
+    }
+    expect([...picks].sort()).toEqual(['a', 'c']);
+  });
+
+  it('should follow response time updates for least response time', async () => {
+    useAlgorithm('least_response_time');
+    const metrics = (modelId: string, averageResponseTime: number) => ({
+      modelId,
+      averageResponseTime,
+      successRate: 1,
+      lastUpdated: new Date(),
+      requestCount: 10,
+    });
+
+    loadBalancer.updateModelPerformance('a', metrics('a', 900));
+    loadBalancer.updateModelPerformance('b', metrics('b', 400));
+    loadBalancer.updateModelPerformance('c', metrics('c', 700));
+    expect((await loadBalancer.selectModel(task)).selectedModel.id).toBe('b');
+
+    loadBalancer.updateModelPerformance('b', metrics('b', 1200));
+    expect((await loadBalancer.selectModel(task)).selectedModel.id).toBe('c');
+  });
+
+  it('should route around models the concurrency limiter reports as saturated', async () => {
+    useAlgorithm('priority_based');
+    const limiter = new ConcurrencyLimiter({ ...DEFAULT_CONCURRENCY_LIMITER_CONFIG, initialLimit: 1 });
+    loadBalancer.setConcurrencyLimiter(limiter);
+
+    const held = await limiter.acquire('b');
+    const queued = limiter.acquire('b');
+    expect((await loadBalancer.selectModel(task)).selectedModel.id).toBe('c');
+
+    held.release('ignored');
+    (await queued).release('ignored');
+    expect((await loadBalancer.selectModel(task)).selectedModel.id).toBe('b');
+  });
+
+  it('should only build alternatives when they are read', async () => {
+    useAlgorithm('round_robin');
+    const decision = await loadBalancer.selectModel(task);
+
+    expect(decision.alternatives.map(m => m.id)).toEqual(['b', 'c']);
+    expect(decision.alternatives).toBe(decision.alternatives);
+  });
+});
+
+describe('SelectionHeap', () => {
+  it('should re-order keys when scores change', () => {
+    const scores = new Map([['x', 3], ['y', 1], ['z', 2]]);
+    const heap = new SelectionHeap(key => scores.get(key)!);
+    heap.rebuild(['x', 'y', 'z']);
+    expect(heap.peek()).toBe('y');
+
+    scores.set('y', 5);
+    heap.update('y');
+    expect(heap.peek()).toBe('z');
+
+    heap.remove('z');
+    expect(heap.peek()).toBe('x');
+    expect(heap.size).toBe(2);
+  });
+
+  it('should break ties by insertion order', () => {
+    const heap = new SelectionHeap(() => 0);
+    heap.rebuild(['first', 'second', 'third']);
+    expect(heap.peek()).toBe('first');
+  });
+});
@@ -11,14 +11,29 @@ import {
   CircuitBreakerConfig,
   CircuitBreakerStatus,
   CircuitBreakerError,
-  ResilienceError
+  ResilienceError,
+  RequestCancelledError,
+  SlidingWindowCircuitBreakerConfig
 } from '../types/index.js';
+import { SlidingWindowCircuitBreaker } from './SlidingWindowCircuitBreaker.js';
+
+/**
+ * Common surface of the circuit breaker implementations
+ */
+export interface CircuitBreakerLike {
+  execute<T>(fn: () => Promise<T>): Promise<T>;
+  getStatus(): CircuitBreakerStatus;
+  reset(): Promise<void>;
+  trip(reason?: string): Promise<void>;
+  addListener(listener: CircuitBreakerListener): void;
+  removeListener(listener: CircuitBreakerListener): void;
+}
 
 /**
  * Circuit breaker implementation for AI model resilience
  * Prevents cascade failures by temporarily blocking requests to failing models
  */
-export class CircuitBreaker {
+export class CircuitBreaker implements CircuitBreakerLike {
   private state: CircuitBreakerState = 'closed';
   private failureCount = 0;
   private successCount = 0;
@@ -50,6 +65,7 @@ export class CircuitBreaker {
     const startTime = Date.now();
     let result: T;
     let error: Error | undefined;
+    let cancelled = false;
 
     try {
       // Execute with timeout
@@ -65,18 +81,26 @@ export class CircuitBreaker {
     } catch (err) {
       error = err instanceof Error ? err : new Error(String(err));
 
+      // A cancelled call is neither a success nor a failure
+      if (error instanceof RequestCancelledError) {
+        cancelled = true;
+        throw error;
+      }
+
       // Record failure
       await this.recordFailure(error);
       throw error;
     } finally {
       // Notify listeners of execution
-      this.notifyExecution({
-        modelId: this.modelId,
-        success: !error,
-        duration: Date.now() - startTime,
-        error,
-        circuitBreakerState: this.state,
-      });
+      if (!cancelled) {
+        this.notifyExecution({
+          modelId: this.modelId,
+          success: !error,
+          duration: Date.now() - startTime,
+          error,
+          circuitBreakerState: this.state,
+        });
+      }
     }
   }
 
@@ -329,22 +353,42 @@ export interface CircuitBreakerExecutionEvent {
  * Circuit breaker factory for creating configured instances
  */
 export class CircuitBreakerFactory {
-  private static readonly instances = new Map<string, CircuitBreaker>();
+  private static readonly instances = new Map<string, CircuitBreakerLike>();
+  private static defaultConfig: CircuitBreakerConfig | undefined;
 
   /**
-   * Get or create circuit breaker for a model
+   * Get or create circuit breaker for a model.
+   * A config with a sliding window yields a SlidingWindowCircuitBreaker.
    */
-  static getOrCreate(modelId: string, config?: CircuitBreakerConfig): CircuitBreaker {
+  static getOrCreate(modelId: string, config?: CircuitBreakerConfig): CircuitBreakerLike {
     let circuitBreaker = this.instances.get(modelId);
 
     if (!circuitBreaker) {
-      circuitBreaker = new CircuitBreaker(modelId, config);
+      circuitBreaker = this.create(modelId, config);
       this.instances.set(modelId, circuitBreaker);
     }
 
     return circuitBreaker;
   }
 
+  /**
+   * Create a circuit breaker without registering it, for callers that
+   * keep their own breakers apart from the process-wide ones
+   */
+  static create(modelId: string, config?: CircuitBreakerConfig): CircuitBreakerLike {
+    const effective = config ?? this.defaultConfig;
+    return effective && isSlidingWindowConfig(effective)
+      ? new SlidingWindowCircuitBreaker(modelId, effective)
+      : new CircuitBreaker(modelId, effective);
+  }
+
+  /**
+   * Set the config used when getOrCreate is called without one
+   */
+  static setDefaultConfig(config: CircuitBreakerConfig | undefined): void {
+    this.defaultConfig = config;
+  }
+
   /**
    * Remove circuit breaker for a model
    */
@@ -355,7 +399,7 @@ export class CircuitBreakerFactory {
   /**
    * Get all circuit breakers
    */
-  static getAll(): Map<string, CircuitBreaker> {
+  static getAll(): Map<string, CircuitBreakerLike> {
     return new Map(this.instances);
   }
 
@@ -378,3 +422,10 @@ export class CircuitBreakerFactory {
     return status;
   }
 }
+
+/**
+ * Check whether a config selects the sliding-window implementation
+ */
+export function isSlidingWindowConfig(config: CircuitBreakerConfig): config is SlidingWindowCircuitBreakerConfig {
+  return 'slidingWindowType' in config;
+}
@@ -0,0 +1,589 @@
+/**
+ * Adaptive Concurrency Limiter
+ * BIP-03 Implementation - Core Infrastructure Phase 1
+ *
+ * Per-model in-flight limits sized from observed round-trip times, in the
+ * style of Netflix concurrency-limits. The gradient algorithm compares a
+ * short RTT average against a long baseline and shrinks the limit when
+ * latency climbs; AIMD grows the limit additively and cuts it on drops.
+ * When a model is saturated, low-priority tasks are shed first, the rest
+ * wait in a bounded priority queue, and listeners hear about it at once.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+import { AITask, LoadShedError, ResilienceError } from '../types/index.js';
+
+/**
+ * Task priority used for admission; AITask.priority defaults to 'normal'
+ */
+export type TaskPriority = NonNullable<AITask['priority']>;
+
+/**
+ * Limit adjustment algorithm
+ */
+export type ConcurrencyLimitAlgorithm = 'gradient' | 'aimd';
+
+/**
+ * How a permitted call ended. 'dropped' marks overload (timeouts, rejections)
+ * and shrinks the limit; 'ignored' releases the slot without an RTT sample.
+ */
+export type LimiterOutcome = 'success' | 'dropped' | 'ignored';
+
+/**
+ * Why a task was shed
+ */
+export type ShedReason = 'low_priority' | 'queue_full' | 'queue_timeout' | 'evicted';
+
+/**
+ * Limiter configuration
+ */
+export interface ConcurrencyLimiterConfig {
+  readonly algorithm: ConcurrencyLimitAlgorithm;
+  readonly initialLimit: number;
+  readonly minLimit: number;
+  readonly maxLimit: number;
+  readonly smoothing: number; // gradient: weight of each new limit estimate, 0-1
+  readonly rttTolerance: number; // gradient: short/long RTT ratio tolerated before shrinking
+  readonly shortWindow: number; // gradient: EWMA span (samples) of the short RTT average
+  readonly longWindow: number; // gradient: EWMA span (samples) of the long RTT baseline
+  readonly backoffRatio: number; // multiplicative decrease on drops, 0-1
+  readonly aimdRttThresholdMs: number; // aimd: RTT above this counts as a drop
+  readonly lowPriorityShare: number; // fraction of the limit low-priority tasks may use
+  readonly maxQueueSize: number; // waiting tasks per model
+  readonly queueTimeoutMs: number; // max wait for a slot before shedding
+  readonly recoveryUtilization: number; // in-flight/limit below which saturation ends
+}
+
+/**
+ * Default limiter configuration
+ */
+export const DEFAULT_CONCURRENCY_LIMITER_CONFIG: ConcurrencyLimiterConfig = {
+  algorithm: 'gradient',
+  initialLimit: 20,
+  minLimit: 1,
+  maxLimit: 200,
+  smoothing: 0.2,
+  rttTolerance: 1.5,
+  shortWindow: 10,
+  longWindow: 600,
+  backoffRatio: 0.9,
+  aimdRttThresholdMs: 10000,
+  lowPriorityShare: 0.8,
+  maxQueueSize: 50,
+  queueTimeoutMs: 5000,
+  recoveryUtilization: 0.8,
+};
+
+/**
+ * Saturation transitions, pushed to listeners as they happen
+ */
+export interface ConcurrencySaturationEvent {
+  readonly type: 'saturated' | 'recovered';
+  readonly modelId: string;
+  readonly limit: number;
+  readonly inFlight: number;
+  readonly queued: number;
+  readonly shed: number; // tasks shed since saturation began
+  readonly shortRttMs: number;
+  readonly longRttMs: number;
+  readonly timestamp: Date;
+}
+
+/**
+ * Limiter listener interface
+ */
+export interface ConcurrencyLimiterListener {
+  onSaturationChange?(event: ConcurrencySaturationEvent): void;
+  onTaskShed?(modelId: string, priority: TaskPriority, reason: ShedReason): void;
+}
+
+/**
+ * Per-model limiter state
+ */
+export interface ConcurrencyLimitStatistics {
+  readonly modelId: string;
+  readonly limit: number;
+  readonly inFlight: number;
+  readonly queued: number;
+  readonly saturated: boolean;
+  readonly admitted: number;
+  readonly shed: number;
+  readonly shortRttMs: number;
+  readonly longRttMs: number;
+}
+
+/**
+ * Slot held by an admitted call; release exactly once (extra calls are ignored)
+ */
+export interface ConcurrencyPermit {
+  readonly modelId: string;
+  readonly priority: TaskPriority;
+  readonly queuedMs: number;
+  release(outcome: LimiterOutcome): void;
+}
+
+const PRIORITY_RANK: Readonly<Record<TaskPriority, number>> = {
+  low: 0,
+  normal: 1,
+  high: 2,
+  critical: 3,
+};
+
+const QUEUED_PRIORITIES: readonly TaskPriority[] = ['critical', 'high', 'normal'];
+
+interface Waiter {
+  readonly priority: TaskPriority;
+  readonly enqueuedAt: number;
+  readonly resolve: (permit: ConcurrencyPermit) => void;
+  readonly reject: (error: Error) => void;
+  timer: ReturnType<typeof setTimeout> | undefined;
+  cleanup: (() => void) | undefined;
+}
+
+interface ModelLimit {
+  limit: number; // fractional; admission uses the floored capacity
+  inFlight: number;
+  queues: Record<TaskPriority, Waiter[]>;
+  queued: number;
+  saturated: boolean;
+  shedSinceSaturation: number;
+  admitted: number;
+  shed: number;
+  shortRtt: number;
+  longRtt: number;
+  samples: number;
+}
+
+/**
+ * Adaptive per-model concurrency limiter
+ */
+export class ConcurrencyLimiter {
+  private static sharedInstance: ConcurrencyLimiter | undefined;
+  private readonly models = new Map<string, ModelLimit>();
+  private readonly listeners = new Set<ConcurrencyLimiterListener>();
+  private capacityFactor = 1;
+
+  constructor(private readonly config: ConcurrencyLimiterConfig = DEFAULT_CONCURRENCY_LIMITER_CONFIG) {
+    if (config.minLimit < 1 || config.maxLimit < config.minLimit) {
+      throw new Error(`Invalid concurrency limits: min ${config.minLimit}, max ${config.maxLimit}`);
+    }
+  }
+
+  /**
+   * Process-wide limiter
+   */
+  static shared(): ConcurrencyLimiter {
+    if (!this.sharedInstance) {
+      this.sharedInstance = new ConcurrencyLimiter();
+    }
+    return this.sharedInstance;
+  }
+
+  /**
+   * Wait for a slot on the model. Rejects with LoadShedError when the task
+   * is shed and with a REQUEST_CANCELLED error when `signal` aborts first.
+   */
+  acquire(modelId: string, priority: TaskPriority = 'normal', signal?: AbortSignal): Promise<ConcurrencyPermit> {
+    if (signal?.aborted) {
+      return Promise.reject(cancelledError(modelId));
+    }
+
+    const state = this.stateFor(modelId);
+
+    if (this.hasRoom(state, priority)) {
+      return Promise.resolve(this.grant(modelId, state, priority, Date.now()));
+    }
+
+    // Low-priority shedding alone (the reserved share) is not saturation
+    if (state.inFlight >= this.capacity(state) || state.queued > 0) {
+      this.markSaturated(modelId, state);
+    }
+
+    if (priority === 'low') {
+      return Promise.reject(this.shed(modelId, state, priority, 'low_priority'));
+    }
+
+    if (state.queued >= this.config.maxQueueSize && !this.evictLowerThan(modelId, state, priority)) {
+      return Promise.reject(this.shed(modelId, state, priority, 'queue_full'));
+    }
+
+    return new Promise((resolve, reject) => {
+      const waiter: Waiter = {
+        priority,
+        enqueuedAt: Date.now(),
+        resolve,
+        reject,
+        timer: undefined,
+        cleanup: undefined,
+      };
+
+      waiter.timer = setTimeout(() => {
+        if (this.removeWaiter(state, waiter)) {
+          reject(this.shed(modelId, state, priority, 'queue_timeout'));
+        }
+      }, this.config.queueTimeoutMs);
+      waiter.timer.unref?.();
+
+      if (signal) {
+        const onAbort = () => {
+          if (this.removeWaiter(state, waiter)) {
+            reject(cancelledError(modelId));
+          }
+        };
+        signal.addEventListener('abort', onAbort, { once: true });
+        waiter.cleanup = () => signal.removeEventListener('abort', onAbort);
+      }
+
+      state.queues[priority].push(waiter);
+      state.queued++;
+    });
+  }
+
+  /**
+   * Run fn under a permit. Success feeds an RTT sample; a failure classified
+   * by `isDrop` (timeouts by default) shrinks the limit; other failures only
+   * release the slot.
+   */
+  async execute<T>(
+    modelId: string,
+    fn: () => Promise<T>,
+    options: { priority?: TaskPriority; signal?: AbortSignal; isDrop?: (error: unknown) => boolean } = {}
+  ): Promise<T> {
+    const permit = await this.acquire(modelId, options.priority, options.signal);
+    try {
+      const result = await fn();
+      permit.release('success');
+      return result;
+    } catch (error) {
+      permit.release((options.isDrop ?? isOverloadError)(error) ? 'dropped' : 'ignored');
+      throw error;
+    }
+  }
+
+  /**
+   * Scale every model's usable limit, e.g. 0.5 while degraded. 1 restores it.
+   */
+  setCapacityFactor(factor: number): void {
+    this.capacityFactor = Math.min(1, Math.max(0.01, factor));
+    for (const [modelId, state] of this.models) {
+      this.drain(modelId, state);
+    }
+  }
+
+  getCapacityFactor(): number {
+    return this.capacityFactor;
+  }
+
+  /**
+   * Whether the model currently has no room for normal-priority work
+   */
+  isSaturated(modelId: string): boolean {
+    return this.models.get(modelId)?.saturated ?? false;
+  }
+
+  getStatistics(modelId: string): ConcurrencyLimitStatistics | undefined {
+    const state = this.models.get(modelId);
+    return state ? this.toStatistics(modelId, state) : undefined;
+  }
+
+  getAllStatistics(): ConcurrencyLimitStatistics[] {
+    return Array.from(this.models, ([modelId, state]) => this.toStatistics(modelId, state));
+  }
+
+  addListener(listener: ConcurrencyLimiterListener): void {
+    this.listeners.add(listener);
+  }
+
+  removeListener(listener: ConcurrencyLimiterListener): void {
+    this.listeners.delete(listener);
+  }
+
+  /**
+   * Forget a model; queued tasks are shed
+   */
+  reset(modelId: string): void {
+    const state = this.models.get(modelId);
+    if (!state) return;
+
+    for (const priority of QUEUED_PRIORITIES) {
+      for (const waiter of state.queues[priority].splice(0)) {
+        this.clearWaiter(waiter);
+        waiter.reject(new LoadShedError(modelId, 'limiter reset'));
+      }
+    }
+    this.models.delete(modelId);
+  }
+
+  private stateFor(modelId: string): ModelLimit {
+    let state = this.models.get(modelId);
+    if (!state) {
+      state = {
+        limit: this.clampLimit(this.config.initialLimit),
+        inFlight: 0,
+        queues: { critical: [], high: [], normal: [], low: [] },
+        queued: 0,
+        saturated: false,
+        shedSinceSaturation: 0,
+        admitted: 0,
+        shed: 0,
+        shortRtt: 0,
+        longRtt: 0,
+        samples: 0,
+      };
+      this.models.set(modelId, state);
+    }
+    return state;
+  }
+
+  private capacity(state: ModelLimit): number {
+    return Math.max(this.config.minLimit, Math.floor(state.limit * this.capacityFactor));
+  }
+
+  /**
+   * Room for a task of this priority without queueing. Queued work of equal
+   * or higher priority goes first.
+   */
+  private hasRoom(state: ModelLimit, priority: TaskPriority): boolean {
+    const capacity = this.capacity(state);
+    const allowed = priority === 'low'
+      ? Math.max(1, Math.floor(capacity * this.config.lowPriorityShare))
+      : capacity;
+
+    if (state.inFlight >= allowed) return false;
+
+    for (const queued of QUEUED_PRIORITIES) {
+      if (PRIORITY_RANK[queued] < PRIORITY_RANK[priority]) break;
+      if (state.queues[queued].length > 0) return false;
+    }
+    return true;
+  }
+
+  private grant(modelId: string, state: ModelLimit, priority: TaskPriority, enqueuedAt: number): ConcurrencyPermit {
+    state.inFlight++;
+    state.admitted++;
+    const startTime = Date.now();
+    let released = false;
+
+    return {
+      modelId,
+      priority,
+      queuedMs: startTime - enqueuedAt,
+      release: (outcome: LimiterOutcome) => {
+        if (released) return;
+        released = true;
+        state.inFlight--;
+
+        // Only samples taken near the limit say anything about its size
+        const inFlightAtCompletion = state.inFlight + 1;
+        if (outcome !== 'ignored') {
+          this.adjustLimit(state, outcome, Date.now() - startTime, inFlightAtCompletion);
+        }
+
+        this.drain(modelId, state);
+      },
+    };
+  }
+
+  /**
+   * Hand freed slots to queued tasks, highest priority first
+   */
+  private drain(modelId: string, state: ModelLimit): void {
+    const capacity = this.capacity(state);
+
+    while (state.inFlight < capacity && state.queued > 0) {
+      const waiter = this.nextWaiter(state);
+      if (!waiter) break;
+      this.clearWaiter(waiter);
+      waiter.resolve(this.grant(modelId, state, waiter.priority, waiter.enqueuedAt));
+    }
+
+    if (state.saturated && state.queued === 0 &&
+        state.inFlight < capacity * this.config.recoveryUtilization) {
+      state.saturated = false;
+      this.notifySaturation(modelId, state, 'recovered');
+      state.shedSinceSaturation = 0;
+    }
+  }
+
+  private adjustLimit(state: ModelLimit, outcome: LimiterOutcome, rtt: number, inFlight: number): void {
+    const { minLimit, maxLimit, backoffRatio } = this.config;
+    const appLimited = inFlight * 2 < state.limit;
+
+    if (outcome === 'success') {
+      this.recordRtt(state, rtt);
+    }
+
+    if (this.config.algorithm === 'aimd') {
+      if (outcome === 'dropped' || rtt > this.config.aimdRttThresholdMs) {
+        state.limit = this.clampLimit(state.limit * backoffRatio);
+      } else if (!appLimited) {
+        state.limit = this.clampLimit(state.limit + 1 / state.limit);
+      }
+      return;
+    }
+
+    // Gradient: shrink when short-term RTT exceeds the tolerated baseline
+    if (outcome === 'dropped') {
+      state.limit = this.clampLimit(state.limit * backoffRatio);
+      return;
+    }
+    if (state.samples === 0 || state.shortRtt <= 0) return;
+
+    const gradient = Math.max(0.5, Math.min(1, this.config.rttTolerance * state.longRtt / state.shortRtt));
+    if (appLimited && gradient >= 1) return; // not enough load to justify growth
+
+    const queueAllowance = Math.sqrt(state.limit);
+    const estimate = state.limit * gradient + queueAllowance;
+    const smoothed = state.limit * (1 - this.config.smoothing) + estimate * this.config.smoothing;
+    state.limit = Math.min(maxLimit, Math.max(minLimit, smoothed));
+  }
+
+  private recordRtt(state: ModelLimit, rtt: number): void {
+    const sample = Math.max(0, rtt);
+
+    if (state.samples === 0) {
+      state.shortRtt = sample;
+      state.longRtt = sample;
+    } else {
+      state.shortRtt += (sample - state.shortRtt) * 2 / (this.config.shortWindow + 1);
+      state.longRtt += (sample - state.longRtt) * 2 / (this.config.longWindow + 1);
+
+      // After a latency shift the baseline catches up instead of pinning the limit low
+      if (state.longRtt > 2 * state.shortRtt) {
+        state.longRtt *= 0.95;
+      }
+    }
+    state.samples++;
+  }
+
+  private clampLimit(limit: number): number {
+    return Math.min(this.config.maxLimit, Math.max(this.config.minLimit, limit));
+  }
+
+  private markSaturated(modelId: string, state: ModelLimit): void {
+    if (state.saturated) return;
+    state.saturated = true;
+    state.shedSinceSaturation = 0;
+    this.notifySaturation(modelId, state, 'saturated');
+  }
+
+  /**
+   * Shed the newest queued task of lower priority to make room
+   */
+  private evictLowerThan(modelId: string, state: ModelLimit, priority: TaskPriority): boolean {
+    for (let i = QUEUED_PRIORITIES.length - 1; i >= 0; i--) {
+      const queuedPriority = QUEUED_PRIORITIES[i]!;
+      if (PRIORITY_RANK[queuedPriority] >= PRIORITY_RANK[priority]) return false;
+
+      const victim = state.queues[queuedPriority].pop();
+      if (victim) {
+        state.queued--;
+        this.clearWaiter(victim);
+        victim.reject(this.shed(modelId, state, victim.priority, 'evicted'));
+        return true;
+      }
+    }
+    return false;
+  }
+
+  private nextWaiter(state: ModelLimit): Waiter | undefined {
+    for (const priority of QUEUED_PRIORITIES) {
+      const waiter = state.queues[priority].shift();
+      if (waiter) {
+        state.queued--;
+        return waiter;
+      }
+    }
+    return undefined;
+  }
+
+  private removeWaiter(state: ModelLimit, waiter: Waiter): boolean {
+    const queue = state.queues[waiter.priority];
+    const index = queue.indexOf(waiter);
+    if (index === -1) return false;
+
+    queue.splice(index, 1);
+    state.queued--;
+    this.clearWaiter(waiter);
+    return true;
+  }
+
+  private clearWaiter(waiter: Waiter): void {
+    if (waiter.timer) clearTimeout(waiter.timer);
+    waiter.timer = undefined;
+    waiter.cleanup?.();
+    waiter.cleanup = undefined;
+  }
+
+  private shed(modelId: string, state: ModelLimit, priority: TaskPriority, reason: ShedReason): LoadShedError {
+    state.shed++;
+    state.shedSinceSaturation++;
+
+    this.listeners.forEach(listener => {
+      try {
+        listener.onTaskShed?.(modelId, priority, reason);
+      } catch (error) {
+        console.error('🚦 Error notifying limiter listener:', error);
+      }
+    });
+
+    return new LoadShedError(modelId, reason);
+  }
+
+  private notifySaturation(modelId: string, state: ModelLimit, type: ConcurrencySaturationEvent['type']): void {
+    const event: ConcurrencySaturationEvent = {
+      type,
+      modelId,
+      limit: this.capacity(state),
+      inFlight: state.inFlight,
+      queued: state.queued,
+      shed: state.shedSinceSaturation,
+      shortRttMs: state.shortRtt,
+      longRttMs: state.longRtt,
+      timestamp: new Date(),
+    };
+
+    this.listeners.forEach(listener => {
+      try {
+        listener.onSaturationChange?.(event);
+      } catch (error) {
+        console.error('🚦 Error notifying limiter listener:', error);
+      }
+    });
+  }
+
+  private toStatistics(modelId: string, state: ModelLimit): ConcurrencyLimitStatistics {
+    return {
+      modelId,
+      limit: this.capacity(state),
+      inFlight: state.inFlight,
+      queued: state.queued,
+      saturated: state.saturated,
+      admitted: state.admitted,
+      shed: state.shed,
+      shortRttMs: state.shortRtt,
+      longRttMs: state.longRtt,
+    };
+  }
+}
+
+/**
+ * Timeouts and shed/breaker rejections signal overload; other errors do not
+ */
+export function isOverloadError(error: unknown): boolean {
+  if (error instanceof ResilienceError) {
+    return error.code === 'TIMEOUT' || error.code === 'LOAD_SHED';
+  }
+  return error instanceof Error && /timeout|timed out/i.test(error.message);
+}
+
+function cancelledError(modelId: string): ResilienceError {
+  return new ResilienceError(
+    `Request to model ${modelId} was cancelled`,
+    'REQUEST_CANCELLED',
+    modelId,
+    false
+  );
+}
@@ -15,6 +15,8 @@ import {
   AlertEvent,
   AlertSeverity
 } from '../types/index.js';
+import { TimerWheelScheduler, ScheduledTaskHandle } from './TimerWheelScheduler.js';
+import { HealthProbeEngine } from './HealthProbeEngine.js';
 
 /**
  * Health checker for monitoring AI model availability and performance
@@ -22,7 +24,7 @@ import {
 export class HealthChecker {
   private readonly models = new Map<string, ModelHealth>();
   private readonly configs = new Map<string, HealthCheckConfig>();
-  private readonly intervals = new Map<string, NodeJS.Timeout>();
+  private readonly intervals = new Map<string, ScheduledTaskHandle>();
   private readonly listeners = new Set<HealthCheckListener>();
   private isRunning = false;
 
@@ -30,7 +32,9 @@ export class HealthChecker {
     interval: 30000, // 30 seconds
     timeout: 5000,   // 5 seconds
     retries: 3,
-  }) {}
+  },
+  private readonly scheduler: TimerWheelScheduler = TimerWheelScheduler.shared(),
+  private readonly probeEngine: HealthProbeEngine = HealthProbeEngine.shared()) {}
 
   /**
    * Register a model for health monitoring
@@ -67,7 +71,7 @@ export class HealthChecker {
     // Stop monitoring
     const interval = this.intervals.get(modelId);
     if (interval) {
-      clearInterval(interval);
+      interval.cancel();
       this.intervals.delete(modelId);
     }
 
@@ -100,7 +104,7 @@ export class HealthChecker {
 
     // Clear all intervals
     for (const interval of this.intervals.values()) {
-      clearInterval(interval);
+      interval.cancel();
     }
     this.intervals.clear();
   }
@@ -213,15 +217,20 @@ export class HealthChecker {
     // Perform initial health check
     await this.checkModelHealth(modelId);
 
-    // Set up periodic health checks
-    const interval = setInterval(async () => {
+    // Set up periodic health checks; the scheduler skips a tick while a check is still running
+    const interval = this.scheduler.schedule(async () => {
       try {
         await this.checkModelHealth(modelId);
       } catch (error) {
         // Log error but continue monitoring
         console.error(`Health check failed for model ${modelId}:`, error);
       }
-    }, config.interval);
+    }, {
+      name: `health-check:${modelId}`,
+      intervalMs: config.interval,
+      taskClass: 'health-check',
+      alignToInterval: true, // models sharing an interval probe in the same tick
+    });
 
     this.intervals.set(modelId, interval);
   }
@@ -285,24 +294,11 @@ export class HealthChecker {
     // In real implementation, this would call the actual model endpoint
 
     if (config.endpoint) {
-      // HTTP health check
-      const response = await fetch(config.endpoint, {
-        method: 'GET',
-        headers: { 'Content-Type': 'application/json' },
-        signal: AbortSignal.timeout(config.timeout),
+      // HTTP health check, pooled and batched per endpoint host
+      await this.probeEngine.probe(modelId, config.endpoint, {
+        timeout: config.timeout,
+        ...(config.expectedResponse ? { expectedResponse: config.expectedResponse } : {}),
       });
-
-      if (!response.ok) {
-        throw new Error(`Health check failed with status ${response.status}`);
-      }
-
-      if (config.expectedResponse) {
-        const body = await response.json();
-        // Simple equality check - could be more sophisticated
-        if (JSON.stringify(body) !== JSON.stringify(config.expectedResponse)) {
-          throw new Error('Health check response does not match expected');
-        }
-      }
     } else {
       // Simple ping-style check
       // Simulate model availability check
@@ -0,0 +1,308 @@
+/**
+ * Health Probe Engine Implementation
+ * BIP-03 Implementation - Core Infrastructure Phase 1
+ *
+ * HTTP health probes over one keep-alive agent per endpoint origin.
+ * Probes requested in the same tick are flushed together; models that
+ * share an endpoint URL share a single request, and response bodies are
+ * parsed once and matched structurally against each expected response.
+ * A shared request runs under the smallest timeout of its probes, and the
+ * timeout bounds the whole exchange, not just socket inactivity.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+import * as http from 'http';
+import * as https from 'https';
+
+/**
+ * Probe engine configuration
+ */
+export interface HealthProbeEngineConfig {
+  readonly maxSocketsPerHost: number;
+  readonly keepAliveMsecs: number;
+}
+
+/**
+ * Default probe engine: up to 8 pooled sockets per origin
+ */
+export const DEFAULT_HEALTH_PROBE_CONFIG: HealthProbeEngineConfig = {
+  maxSocketsPerHost: 8,
+  keepAliveMsecs: 30000,
+};
+
+/**
+ * Outcome of a single model's probe
+ */
+export interface HealthProbeResult {
+  readonly modelId: string;
+  readonly endpoint: string;
+  readonly host: string;
+  readonly ok: boolean;
+  readonly status: number; // 0 when no response was received
+  readonly latencyMs: number;
+  readonly error?: Error;
+}
+
+/**
+ * Probe result listener
+ */
+export interface HealthProbeListener {
+  onProbe(result: HealthProbeResult): void;
+}
+
+interface ProbeWaiter {
+  readonly modelId: string;
+  readonly expectedResponse: unknown;
+  resolve(): void;
+  reject(error: Error): void;
+}
+
+interface PendingRequest {
+  readonly url: URL;
+  timeout: number;
+  readonly waiters: ProbeWaiter[];
+}
+
+/**
+ * Pooled, batched HTTP health prober
+ */
+export class HealthProbeEngine {
+  private static sharedInstance: HealthProbeEngine | undefined;
+
+  private readonly agents = new Map<string, http.Agent>();
+  private readonly listeners = new Set<HealthProbeListener>();
+  private pending = new Map<string, PendingRequest>();
+  private flushScheduled = false;
+
+  constructor(private readonly config: HealthProbeEngineConfig = DEFAULT_HEALTH_PROBE_CONFIG) {}
+
+  /**
+   * Process-wide engine used by HealthChecker instances by default
+   */
+  static shared(): HealthProbeEngine {
+    if (!this.sharedInstance) {
+      this.sharedInstance = new HealthProbeEngine();
+    }
+    return this.sharedInstance;
+  }
+
+  /**
+   * Probe an endpoint for a model; rejects on a non-2xx status, a
+   * network error, a timeout or a response that does not match
+   */
+  probe(
+    modelId: string,
+    endpoint: string,
+    options: { timeout: number; expectedResponse?: unknown }
+  ): Promise<void> {
+    return new Promise<void>((resolve, reject) => {
+      const url = new URL(endpoint);
+      let request = this.pending.get(url.href);
+      if (!request) {
+        request = { url, timeout: options.timeout, waiters: [] };
+        this.pending.set(url.href, request);
+      } else {
+        // No probe may wait longer than it asked for
+        request.timeout = Math.min(request.timeout, options.timeout);
+      }
+
+      request.waiters.push({ modelId, expectedResponse: options.expectedResponse, resolve, reject });
+
+      if (!this.flushScheduled) {
+        this.flushScheduled = true;
+        setImmediate(() => this.flush());
+      }
+    });
+  }
+
+  /**
+   * Add probe result listener
+   */
+  addListener(listener: HealthProbeListener): void {
+    this.listeners.add(listener);
+  }
+
+  /**
+   * Remove probe result listener
+   */
+  removeListener(listener: HealthProbeListener): void {
+    this.listeners.delete(listener);
+  }
+
+  /**
+   * Origins with a pooled agent
+   */
+  getPooledHosts(): string[] {
+    return Array.from(this.agents.keys());
+  }
+
+  /**
+   * Close pooled connections
+   */
+  destroy(): void {
+    for (const agent of this.agents.values()) {
+      agent.destroy();
+    }
+    this.agents.clear();
+  }
+
+  private flush(): void {
+    this.flushScheduled = false;
+    const batch = this.pending;
+    this.pending = new Map();
+
+    for (const request of batch.values()) {
+      void this.execute(request);
+    }
+  }
+
+  private async execute(request: PendingRequest): Promise<void> {
+    const startTime = Date.now();
+    const host = request.url.origin;
+    let status = 0;
+    let body: string | undefined;
+    let failure: Error | undefined;
+
+    try {
+      ({ status, body } = await this.send(request.url, request.timeout));
+      if (status < 200 || status >= 300) {
+        failure = new Error(`Health check failed with status ${status}`);
+      }
+    } catch (error) {
+      failure = error instanceof Error ? error : new Error(String(error));
+    }
+
+    const latencyMs = Date.now() - startTime;
+    let parsed: { value: unknown } | undefined;
+
+    for (const waiter of request.waiters) {
+      let error = failure;
+
+      if (!error && waiter.expectedResponse !== undefined) {
+        try {
+          parsed ??= { value: JSON.parse(body ?? '') };
+          if (!matchesExpectedResponse(parsed.value, waiter.expectedResponse)) {
+            error = new Error('Health check response does not match expected');
+          }
+        } catch {
+          error = new Error('Health check response is not valid JSON');
+        }
+      }
+
+      this.notify({
+        modelId: waiter.modelId,
+        endpoint: request.url.href,
+        host,
+        ok: error === undefined,
+        status,
+        latencyMs,
+        ...(error ? { error } : {}),
+      });
+
+      if (error) {
+        waiter.reject(error);
+      } else {
+        waiter.resolve();
+      }
+    }
+  }
+
+  private send(url: URL, timeout: number): Promise<{ status: number; body: string }> {
+    const transport = url.protocol === 'https:' ? https : http;
+
+    return new Promise((resolve, reject) => {
+      // One deadline for connect, headers and body; a slow trickle cannot
+      // keep the probe alive the way a socket idle timeout would
+      const signal = AbortSignal.timeout(timeout);
+      const fail = (error: Error): void => {
+        reject(signal.aborted ? new Error(`Health check timeout for ${url.href}`) : error);
+      };
+
+      const req = transport.request(url, {
+        method: 'GET',
+        agent: this.getAgent(url),
+        headers: { Accept: 'application/json' },
+        signal,
+      }, res => {
+        const chunks: Buffer[] = [];
+        res.on('data', (chunk: Buffer) => chunks.push(chunk));
+        res.on('end', () => resolve({
+          status: res.statusCode ?? 0,
+          body: Buffer.concat(chunks).toString('utf8'),
+        }));
+        res.on('error', fail);
+        res.on('close', () => {
+          if (!res.complete) fail(new Error(`Health check response aborted for ${url.href}`));
+        });
+      });
+
+      req.on('error', fail);
+      req.end();
+    });
+  }
+
+  private getAgent(url: URL): http.Agent {
+    let agent = this.agents.get(url.origin);
+    if (!agent) {
+      const options = {
+        keepAlive: true,
+        keepAliveMsecs: this.config.keepAliveMsecs,
+        maxSockets: this.config.maxSocketsPerHost,
+      };
+      agent = url.protocol === 'https:' ? new https.Agent(options) : new http.Agent(options);
+      this.agents.set(url.origin, agent);
+    }
+    return agent;
+  }
+
+  private notify(result: HealthProbeResult): void {
+    for (const listener of this.listeners) {
+      try {
+        listener.onProbe(result);
+      } catch (error) {
+        console.error('Error notifying health probe listener:', error);
+      }
+    }
+  }
+}
+
+/**
+ * Structural equality between a parsed JSON body and an expected value.
+ * Key order is ignored and expected keys set to undefined count as absent,
+ * matching what a JSON round trip of the expected value would produce.
+ */
+export function matchesExpectedResponse(actual: unknown, expected: unknown): boolean {
+  if (actual === expected) return true;
+  if (expected instanceof Date) return actual === expected.toISOString();
+  if (typeof expected !== 'object' || expected === null) return false;
+  if (typeof actual !== 'object' || actual === null) return false;
+
+  if (Array.isArray(expected)) {
+    if (!Array.isArray(actual) || actual.length !== expected.length) return false;
+    for (let i = 0; i < expected.length; i++) {
+      // JSON serializes undefined array entries as null
+      if (!matchesExpectedResponse(actual[i], expected[i] === undefined ? null : expected[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  if (Array.isArray(actual)) return false;
+
+  const actualRecord = actual as Record<string, unknown>;
+  const expectedRecord = expected as Record<string, unknown>;
+  let expectedKeys = 0;
+
+  for (const key of Object.keys(expectedRecord)) {
+    const value = expectedRecord[key];
+    if (value === undefined || typeof value === 'function') continue;
+    expectedKeys++;
+    if (!Object.prototype.hasOwnProperty.call(actualRecord, key)) return false;
+    if (!matchesExpectedResponse(actualRecord[key], value)) return false;
+  }
+
+  return Object.keys(actualRecord).length === expectedKeys;
+}
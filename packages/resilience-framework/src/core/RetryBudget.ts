@@ -0,0 +1,175 @@
+/**
+ * Retry Budget Implementation
+ * BIP-03 Implementation - Core Infrastructure Phase 1
+ *
+ * Per-target token buckets that cap retries to a fraction of request
+ * volume. Every request deposits `retryRatio` tokens, every retry spends
+ * one, and a small time-based refill lets low-traffic targets still retry.
+ * When a provider degrades, retries stop once the budget is spent instead
+ * of multiplying load by `maxRetries`.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+/**
+ * Retry budget configuration
+ */
+export interface RetryBudgetConfig {
+  readonly retryRatio: number; // retries allowed per request, e.g. 0.2
+  readonly minRetriesPerSecond: number; // refill floor independent of traffic
+  readonly maxTokens: number; // burst capacity per target
+}
+
+/**
+ * Default retry budget: 20% retries plus 10 retries/second per target
+ */
+export const DEFAULT_RETRY_BUDGET_CONFIG: RetryBudgetConfig = {
+  retryRatio: 0.2,
+  minRetriesPerSecond: 10,
+  maxTokens: 100,
+};
+
+/**
+ * Retry counters for a target
+ */
+export interface RetryBudgetStatistics {
+  readonly requests: number;
+  readonly retries: number;
+  readonly suppressedRetries: number;
+  readonly amplification: number; // (requests + retries) / requests; 1 = no retries
+  readonly availableTokens: number;
+}
+
+interface BudgetBucket {
+  tokens: number;
+  lastRefill: number;
+  requests: number;
+  retries: number;
+  suppressedRetries: number;
+}
+
+/**
+ * Shared per-target retry budget
+ */
+export class RetryBudget {
+  private static sharedInstance: RetryBudget | undefined;
+  private readonly buckets = new Map<string, BudgetBucket>();
+
+  constructor(private readonly config: RetryBudgetConfig = DEFAULT_RETRY_BUDGET_CONFIG) {}
+
+  /**
+   * Process-wide budget used by RetryManager instances by default
+   */
+  static shared(): RetryBudget {
+    if (!this.sharedInstance) {
+      this.sharedInstance = new RetryBudget();
+    }
+    return this.sharedInstance;
+  }
+
+  /**
+   * Record a new (non-retry) request to a target
+   */
+  recordRequest(target: string): void {
+    const bucket = this.refill(target);
+    bucket.requests++;
+    bucket.tokens = Math.min(this.config.maxTokens, bucket.tokens + this.config.retryRatio);
+  }
+
+  /**
+   * Spend one token for a retry. Returns false when the budget is exhausted.
+   */
+  tryAcquireRetry(target: string): boolean {
+    const bucket = this.refill(target);
+
+    if (bucket.tokens < 1) {
+      bucket.suppressedRetries++;
+      return false;
+    }
+
+    bucket.tokens -= 1;
+    bucket.retries++;
+    return true;
+  }
+
+  /**
+   * Get counters for one target, or aggregated over all targets
+   */
+  getStatistics(target?: string): RetryBudgetStatistics {
+    const buckets = target !== undefined
+      ? [this.buckets.get(target)].filter((b): b is BudgetBucket => b !== undefined)
+      : Array.from(this.buckets.keys()).map(key => this.refill(key));
+
+    let requests = 0;
+    let retries = 0;
+    let suppressedRetries = 0;
+    let availableTokens = 0;
+
+    for (const bucket of buckets) {
+      requests += bucket.requests;
+      retries += bucket.retries;
+      suppressedRetries += bucket.suppressedRetries;
+      availableTokens += bucket.tokens;
+    }
+
+    if (target !== undefined && buckets.length === 0) {
+      availableTokens = this.initialTokens();
+    }
+
+    return {
+      requests,
+      retries,
+      suppressedRetries,
+      amplification: requests > 0 ? (requests + retries) / requests : 1,
+      availableTokens,
+    };
+  }
+
+  /**
+   * Targets with recorded activity
+   */
+  getTargets(): string[] {
+    return Array.from(this.buckets.keys());
+  }
+
+  /**
+   * Forget all targets
+   */
+  reset(): void {
+    this.buckets.clear();
+  }
+
+  private refill(target: string): BudgetBucket {
+    const now = Date.now();
+    let bucket = this.buckets.get(target);
+
+    if (!bucket) {
+      bucket = {
+        tokens: this.initialTokens(),
+        lastRefill: now,
+        requests: 0,
+        retries: 0,
+        suppressedRetries: 0,
+      };
+      this.buckets.set(target, bucket);
+      return bucket;
+    }
+
+    const elapsedSeconds = (now - bucket.lastRefill) / 1000;
+    if (elapsedSeconds > 0) {
+      bucket.tokens = Math.min(
+        this.config.maxTokens,
+        bucket.tokens + elapsedSeconds * this.config.minRetriesPerSecond
+      );
+      bucket.lastRefill = now;
+    }
+
+    return bucket;
+  }
+
+  private initialTokens(): number {
+    // One second's worth of the refill floor
+    return Math.min(this.config.maxTokens, this.config.minRetriesPerSecond);
+  }
+}
@@ -10,6 +10,17 @@ import {
   RetryOptions,
   ResilienceError
 } from '../types/index.js';
+import type { CircuitBreakerLike } from './CircuitBreaker.js';
+import { RetryBudget } from './RetryBudget.js';
+import { Tracer, SPAN_NAMES } from '../monitoring/Tracer.js';
+
+/**
+ * Per-call retry context
+ */
+export interface RetryContext {
+  readonly target?: string; // retry budget key, typically the model ID
+  readonly circuitBreaker?: Pick<CircuitBreakerLike, 'getStatus'>; // no retries while open
+}
 
 /**
  * Retry manager with exponential backoff and jitter
@@ -23,7 +34,9 @@ export class RetryManager {
       backoffMultiplier: 2,
       jitter: true,
       retryableErrors: ['ECONNRESET', 'ENOTFOUND', 'TIMEOUT', 'MODEL_UNAVAILABLE'],
-    }
+    },
+    private readonly budget: RetryBudget = RetryBudget.shared(),
+    private readonly tracer: Tracer = Tracer.shared()
   ) {}
 
   /**
@@ -31,11 +44,17 @@ export class RetryManager {
    */
   async executeWithRetry<T>(
     fn: () => Promise<T>,
-    options?: Partial<RetryOptions>
+    options?: Partial<RetryOptions>,
+    context: RetryContext = {}
   ): Promise<T> {
     const config = { ...this.defaultOptions, ...options };
     let lastError: Error | undefined;
     let attempt = 0;
+    let previousDelay = config.baseDelay;
+
+    if (context.target !== undefined) {
+      this.budget.recordRequest(context.target);
+    }
 
     while (attempt <= config.maxRetries) {
       try {
@@ -60,11 +79,26 @@ export class RetryManager {
           break;
         }
 
+        // Retrying against an open breaker only adds rejected calls
+        if (this.isBreakerOpen(lastError, context)) {
+          throw lastError;
+        }
+
+        // Shared budget: stop amplifying load on a degraded target
+        if (context.target !== undefined && !this.budget.tryAcquireRetry(context.target)) {
+          throw lastError;
+        }
+
         // Calculate delay and wait
-        const delay = this.calculateDelay(attempt, config);
+        const delay = this.calculateDelay(attempt, config, previousDelay);
+        previousDelay = delay;
         console.log(`Retry attempt ${attempt + 1}/${config.maxRetries} after ${delay}ms delay`);
 
-        await this.delay(delay);
+        await this.tracer.withSpan(SPAN_NAMES.backoff, () => this.delay(delay), {
+          'retry.attempt': attempt + 1,
+          'retry.delay_ms': delay,
+          ...(context.target !== undefined && { component: context.target }),
+        });
         attempt++;
       }
     }
@@ -82,14 +116,15 @@ export class RetryManager {
   async executeWithTimeoutAndRetry<T>(
     fn: () => Promise<T>,
     timeout: number,
-    options?: Partial<RetryOptions>
+    options?: Partial<RetryOptions>,
+    context?: RetryContext
   ): Promise<T> {
     return this.executeWithRetry(async () => {
       return Promise.race([
         fn(),
         this.createTimeoutPromise<T>(timeout)
       ]);
-    }, options);
+    }, options, context);
   }
 
   /**
@@ -99,10 +134,23 @@ export class RetryManager {
     return new BatchRetryExecutor<T>(this, options);
   }
 
+  /**
+   * Get the retry budget this manager draws from
+   */
+  getRetryBudget(): RetryBudget {
+    return this.budget;
+  }
+
   /**
    * Calculate delay for next retry attempt
    */
-  private calculateDelay(attempt: number, options: RetryOptions): number {
+  private calculateDelay(attempt: number, options: RetryOptions, previousDelay: number): number {
+    if (options.jitter && options.jitterMode === 'decorrelated') {
+      const upper = Math.max(options.baseDelay, previousDelay * 3);
+      const delay = options.baseDelay + Math.random() * (upper - options.baseDelay);
+      return Math.max(0, Math.round(Math.min(delay, options.maxDelay)));
+    }
+
     // Calculate exponential backoff
     let delay = options.baseDelay * Math.pow(options.backoffMultiplier, attempt);
 
@@ -111,14 +159,28 @@ export class RetryManager {
 
     // Add jitter if enabled
     if (options.jitter) {
-      const jitterAmount = delay * 0.1; // 10% jitter
-      const jitter = (Math.random() - 0.5) * 2 * jitterAmount;
-      delay += jitter;
+      if (options.jitterMode === 'full') {
+        delay = Math.random() * delay;
+      } else {
+        const jitterAmount = delay * 0.1; // 10% jitter
+        const jitter = (Math.random() - 0.5) * 2 * jitterAmount;
+        delay += jitter;
+      }
     }
 
     return Math.max(0, Math.round(delay));
   }
 
+  /**
+   * Check whether the target's circuit breaker is rejecting calls
+   */
+  private isBreakerOpen(error: Error, context: RetryContext): boolean {
+    if (error instanceof ResilienceError && error.code === 'CIRCUIT_BREAKER_OPEN') {
+      return true;
+    }
+    return context.circuitBreaker?.getStatus().state === 'open';
+  }
+
   /**
    * Check if error is retryable
    */
@@ -0,0 +1,617 @@
+/**
+ * Sliding-Window Circuit Breaker
+ * BIP-03 Implementation - Core Infrastructure Phase 1
+ *
+ * Rate-based breaker in the style of resilience4j: outcomes are aggregated
+ * over the last N calls ('count') or the last N seconds ('time'), and the
+ * circuit opens when the failure rate or slow-call rate crosses its
+ * threshold. State checks and outcome recording are synchronous, a single
+ * reusable timer enforces call timeouts, and listener events are delivered
+ * in batches outside the call path.
+ *
+ * `successThreshold` is the number of trial calls permitted in half-open
+ * state; `failureThreshold` is not used (rates decide instead).
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+import {
+  CircuitBreakerState,
+  CircuitBreakerStatus,
+  CircuitBreakerError,
+  ResilienceError,
+  RequestCancelledError,
+  SlidingWindowCircuitBreakerConfig
+} from '../types/index.js';
+import type {
+  CircuitBreakerLike,
+  CircuitBreakerListener,
+  CircuitBreakerStateChangeEvent,
+  CircuitBreakerExecutionEvent
+} from './CircuitBreaker.js';
+
+/**
+ * Default sliding-window configuration
+ */
+export const DEFAULT_SLIDING_WINDOW_CONFIG: SlidingWindowCircuitBreakerConfig = {
+  failureThreshold: 5,
+  recoveryTimeout: 60000, // 1 minute
+  successThreshold: 3,
+  timeout: 30000, // 30 seconds
+  slidingWindowType: 'count',
+  slidingWindowSize: 100,
+  minimumNumberOfCalls: 10,
+  failureRateThreshold: 50,
+  slowCallRateThreshold: 100,
+  slowCallDurationThreshold: 10000,
+};
+
+/**
+ * Rates over the current window
+ */
+export interface SlidingWindowMetrics {
+  readonly bufferedCalls: number;
+  readonly failedCalls: number;
+  readonly slowCalls: number;
+  readonly failureRate: number; // percentage, -1 until minimumNumberOfCalls
+  readonly slowCallRate: number; // percentage, -1 until minimumNumberOfCalls
+  readonly notPermittedCalls: number;
+}
+
+const FAILED = 1;
+const SLOW = 2;
+
+/**
+ * Aggregated outcome counts over a sliding window
+ */
+interface OutcomeWindow {
+  record(flags: number, now: number): void;
+  totals(now: number): { calls: number; failed: number; slow: number };
+  clear(): void;
+}
+
+/**
+ * Last N outcomes in a ring of flag bytes
+ */
+class CountWindow implements OutcomeWindow {
+  private readonly outcomes: Uint8Array;
+  private head = 0;
+  private size = 0;
+  private failed = 0;
+  private slow = 0;
+
+  constructor(capacity: number) {
+    this.outcomes = new Uint8Array(capacity);
+  }
+
+  record(flags: number): void {
+    const capacity = this.outcomes.length;
+
+    if (this.size === capacity) {
+      const evicted = this.outcomes[this.head]!;
+      if (evicted & FAILED) this.failed--;
+      if (evicted & SLOW) this.slow--;
+    } else {
+      this.size++;
+    }
+
+    this.outcomes[this.head] = flags;
+    if (flags & FAILED) this.failed++;
+    if (flags & SLOW) this.slow++;
+    this.head = (this.head + 1) % capacity;
+  }
+
+  totals(): { calls: number; failed: number; slow: number } {
+    return { calls: this.size, failed: this.failed, slow: this.slow };
+  }
+
+  clear(): void {
+    this.head = 0;
+    this.size = 0;
+    this.failed = 0;
+    this.slow = 0;
+  }
+}
+
+/**
+ * Outcomes of the last N seconds in per-second buckets
+ */
+class TimeWindow implements OutcomeWindow {
+  private readonly epochs: Float64Array;
+  private readonly calls: Int32Array;
+  private readonly failedCounts: Int32Array;
+  private readonly slowCounts: Int32Array;
+  private latestEpoch = Number.NEGATIVE_INFINITY;
+  private totalCalls = 0;
+  private totalFailed = 0;
+  private totalSlow = 0;
+
+  constructor(private readonly seconds: number) {
+    this.epochs = new Float64Array(seconds).fill(Number.NEGATIVE_INFINITY);
+    this.calls = new Int32Array(seconds);
+    this.failedCounts = new Int32Array(seconds);
+    this.slowCounts = new Int32Array(seconds);
+  }
+
+  record(flags: number, now: number): void {
+    const slot = this.advance(Math.floor(now / 1000));
+    this.calls[slot]!++;
+    this.totalCalls++;
+    if (flags & FAILED) {
+      this.failedCounts[slot]!++;
+      this.totalFailed++;
+    }
+    if (flags & SLOW) {
+      this.slowCounts[slot]!++;
+      this.totalSlow++;
+    }
+  }
+
+  totals(now: number): { calls: number; failed: number; slow: number } {
+    this.advance(Math.floor(now / 1000));
+    return { calls: this.totalCalls, failed: this.totalFailed, slow: this.totalSlow };
+  }
+
+  clear(): void {
+    this.epochs.fill(Number.NEGATIVE_INFINITY);
+    this.calls.fill(0);
+    this.failedCounts.fill(0);
+    this.slowCounts.fill(0);
+    this.latestEpoch = Number.NEGATIVE_INFINITY;
+    this.totalCalls = 0;
+    this.totalFailed = 0;
+    this.totalSlow = 0;
+  }
+
+  /**
+   * Expire buckets that fell out of the window; returns the slot for epoch.
+   * Each bucket is expired at most once, so the cost is amortized O(1).
+   */
+  private advance(epoch: number): number {
+    if (epoch > this.latestEpoch) {
+      const from = Math.max(this.latestEpoch + 1, epoch - this.seconds + 1);
+      for (let e = from; e <= epoch; e++) {
+        this.expire(this.slotOf(e));
+      }
+      this.latestEpoch = epoch;
+    }
+
+    const slot = this.slotOf(epoch);
+    if (this.epochs[slot] !== epoch) {
+      this.expire(slot);
+      this.epochs[slot] = epoch;
+    }
+    return slot;
+  }
+
+  private expire(slot: number): void {
+    this.totalCalls -= this.calls[slot]!;
+    this.totalFailed -= this.failedCounts[slot]!;
+    this.totalSlow -= this.slowCounts[slot]!;
+    this.calls[slot] = 0;
+    this.failedCounts[slot] = 0;
+    this.slowCounts[slot] = 0;
+    this.epochs[slot] = Number.NEGATIVE_INFINITY;
+  }
+
+  private slotOf(epoch: number): number {
+    return ((epoch % this.seconds) + this.seconds) % this.seconds;
+  }
+}
+
+/**
+ * In-flight call awaiting completion or timeout
+ */
+interface PendingCall {
+  readonly deadline: number;
+  readonly startTime: number;
+  readonly generation: number;
+  settled: boolean;
+  reject: (error: Error) => void;
+}
+
+type QueuedEvent =
+  | { kind: 'state'; event: CircuitBreakerStateChangeEvent }
+  | { kind: 'execution'; event: CircuitBreakerExecutionEvent };
+
+/**
+ * Sliding-window circuit breaker
+ */
+export class SlidingWindowCircuitBreaker implements CircuitBreakerLike {
+  private state: CircuitBreakerState = 'closed';
+  private readonly window: OutcomeWindow;
+  private readonly listeners = new Set<CircuitBreakerListener>();
+  private lastFailureTime?: Date | undefined;
+  private openUntil = 0;
+  private generation = 0; // bumped on every transition; stale outcomes are ignored
+  private notPermittedCalls = 0;
+
+  // Half-open trial calls
+  private halfOpenPermits = 0;
+  private halfOpenCompleted = 0;
+  private halfOpenFailed = 0;
+  private halfOpenSlow = 0;
+
+  // Timeouts: deadlines are monotonic (fixed timeout), so a FIFO and one timer suffice
+  private pending: PendingCall[] = [];
+  private pendingHead = 0;
+  private inFlight = 0;
+  private timer: ReturnType<typeof setTimeout> | undefined;
+  private timerDeadline = Number.POSITIVE_INFINITY;
+
+  // Batched listener delivery
+  private eventQueue: QueuedEvent[] = [];
+  private flushScheduled = false;
+
+  constructor(
+    private readonly modelId: string,
+    private readonly config: SlidingWindowCircuitBreakerConfig = DEFAULT_SLIDING_WINDOW_CONFIG
+  ) {
+    if (!Number.isInteger(config.slidingWindowSize) || config.slidingWindowSize <= 0) {
+      throw new Error(`Invalid sliding window size: ${config.slidingWindowSize}`);
+    }
+
+    this.window = config.slidingWindowType === 'time'
+      ? new TimeWindow(config.slidingWindowSize)
+      : new CountWindow(config.slidingWindowSize);
+  }
+
+  /**
+   * Execute a function with circuit breaker protection
+   */
+  execute<T>(fn: () => Promise<T>): Promise<T> {
+    const now = Date.now();
+
+    if (!this.tryAcquirePermission(now)) {
+      this.notPermittedCalls++;
+      return Promise.reject(new CircuitBreakerError(this.modelId, this.state));
+    }
+
+    let promise: Promise<T>;
+    try {
+      promise = fn();
+    } catch (error) {
+      promise = Promise.reject(error);
+    }
+
+    return new Promise<T>((resolve, reject) => {
+      const call: PendingCall = {
+        deadline: now + this.config.timeout,
+        startTime: now,
+        generation: this.generation,
+        settled: false,
+        reject,
+      };
+      this.track(call);
+
+      promise.then(
+        value => {
+          if (call.settled) return;
+          this.complete(call, undefined);
+          resolve(value);
+        },
+        err => {
+          if (call.settled) return;
+          const error = err instanceof Error ? err : new Error(String(err));
+          if (error instanceof RequestCancelledError) {
+            this.abandon(call);
+          } else {
+            this.complete(call, error);
+          }
+          reject(error);
+        }
+      );
+    });
+  }
+
+  /**
+   * Get current circuit breaker status
+   */
+  getStatus(): CircuitBreakerStatus {
+    const totals = this.window.totals(Date.now());
+
+    return {
+      state: this.state,
+      failureCount: this.state === 'half-open' ? this.halfOpenFailed : totals.failed,
+      lastFailureTime: this.lastFailureTime,
+      nextRetryTime: this.state === 'open' ? new Date(this.openUntil) : undefined,
+      successCount: this.state === 'half-open'
+        ? this.halfOpenCompleted - this.halfOpenFailed
+        : totals.calls - totals.failed,
+    };
+  }
+
+  /**
+   * Get failure and slow-call rates over the current window
+   */
+  getMetrics(): SlidingWindowMetrics {
+    const totals = this.window.totals(Date.now());
+    const evaluated = totals.calls >= this.minimumCalls();
+
+    return {
+      bufferedCalls: totals.calls,
+      failedCalls: totals.failed,
+      slowCalls: totals.slow,
+      failureRate: evaluated ? (totals.failed / totals.calls) * 100 : -1,
+      slowCallRate: evaluated ? (totals.slow / totals.calls) * 100 : -1,
+      notPermittedCalls: this.notPermittedCalls,
+    };
+  }
+
+  /**
+   * Manually reset the circuit breaker
+   */
+  async reset(): Promise<void> {
+    this.lastFailureTime = undefined;
+    this.transition('closed', 'manual_reset');
+  }
+
+  /**
+   * Manually trip the circuit breaker
+   */
+  async trip(reason?: string): Promise<void> {
+    this.lastFailureTime = new Date();
+    this.transition('open', 'manual_trip', reason);
+  }
+
+  /**
+   * Add circuit breaker listener
+   */
+  addListener(listener: CircuitBreakerListener): void {
+    this.listeners.add(listener);
+  }
+
+  /**
+   * Remove circuit breaker listener
+   */
+  removeListener(listener: CircuitBreakerListener): void {
+    this.listeners.delete(listener);
+  }
+
+  /**
+   * Deliver queued listener events now
+   */
+  flushEvents(): void {
+    this.flushScheduled = false;
+    const events = this.eventQueue;
+    this.eventQueue = [];
+
+    for (const queued of events) {
+      for (const listener of this.listeners) {
+        try {
+          if (queued.kind === 'state') {
+            listener.onStateChange?.(queued.event);
+          } else {
+            listener.onExecution?.(queued.event);
+          }
+        } catch (error) {
+          console.error(`Error notifying circuit breaker ${queued.kind === 'state' ? 'state change' : 'execution'}:`, error);
+        }
+      }
+    }
+  }
+
+  /**
+   * Synchronous admission check
+   */
+  private tryAcquirePermission(now: number): boolean {
+    if (this.state === 'closed') {
+      return true;
+    }
+
+    if (this.state === 'open') {
+      if (now < this.openUntil) {
+        return false;
+      }
+      this.transition('half-open', 'recovery_timeout_elapsed');
+    }
+
+    // Half-open: admit a fixed number of trial calls
+    if (this.halfOpenPermits < this.permittedHalfOpenCalls()) {
+      this.halfOpenPermits++;
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * Drop a cancelled call without recording an outcome; a half-open trial
+   * permit it held goes back to the pool
+   */
+  private abandon(call: PendingCall): void {
+    call.settled = true;
+    this.untrack();
+
+    if (call.generation === this.generation && this.state === 'half-open' && this.halfOpenPermits > 0) {
+      this.halfOpenPermits--;
+    }
+  }
+
+  /**
+   * Record the outcome of a call and evaluate thresholds
+   */
+  private complete(call: PendingCall, error: Error | undefined): void {
+    call.settled = true;
+    this.untrack();
+
+    const now = Date.now();
+    const duration = now - call.startTime;
+
+    if (error) {
+      this.lastFailureTime = new Date(now);
+    }
+
+    // Outcomes of calls admitted before the last transition no longer count
+    if (call.generation === this.generation) {
+      const flags = (error ? FAILED : 0) | (duration > this.config.slowCallDurationThreshold ? SLOW : 0);
+
+      if (this.state === 'closed') {
+        this.window.record(flags, now);
+        this.evaluateWindow(now);
+      } else if (this.state === 'half-open') {
+        this.halfOpenCompleted++;
+        if (flags & FAILED) this.halfOpenFailed++;
+        if (flags & SLOW) this.halfOpenSlow++;
+        this.evaluateHalfOpen();
+      }
+    }
+
+    if (this.listeners.size > 0) {
+      this.enqueue({
+        kind: 'execution',
+        event: {
+          modelId: this.modelId,
+          success: !error,
+          duration,
+          error,
+          circuitBreakerState: this.state,
+        },
+      });
+    }
+  }
+
+  private evaluateWindow(now: number): void {
+    const totals = this.window.totals(now);
+    if (totals.calls < this.minimumCalls()) return;
+
+    if (this.exceedsThresholds(totals.calls, totals.failed, totals.slow)) {
+      this.transition('open', 'failure_rate_exceeded');
+    }
+  }
+
+  private evaluateHalfOpen(): void {
+    if (this.halfOpenCompleted < this.permittedHalfOpenCalls()) return;
+
+    if (this.exceedsThresholds(this.halfOpenCompleted, this.halfOpenFailed, this.halfOpenSlow)) {
+      this.transition('open', 'failure_rate_exceeded');
+    } else {
+      this.transition('closed', 'recovery_successful');
+    }
+  }
+
+  private exceedsThresholds(calls: number, failed: number, slow: number): boolean {
+    return (failed / calls) * 100 >= this.config.failureRateThreshold ||
+      (slow / calls) * 100 >= this.config.slowCallRateThreshold;
+  }
+
+  private transition(to: CircuitBreakerState, trigger: string, reason?: string): void {
+    const from = this.state;
+    this.state = to;
+    this.generation++;
+
+    this.window.clear();
+    this.halfOpenPermits = 0;
+    this.halfOpenCompleted = 0;
+    this.halfOpenFailed = 0;
+    this.halfOpenSlow = 0;
+    this.openUntil = to === 'open' ? Date.now() + this.config.recoveryTimeout : 0;
+
+    if (this.listeners.size > 0) {
+      this.enqueue({
+        kind: 'state',
+        event: {
+          modelId: this.modelId,
+          from,
+          to,
+          trigger,
+          reason,
+          timestamp: new Date(),
+          status: this.getStatus(),
+        },
+      });
+    }
+  }
+
+  private minimumCalls(): number {
+    const minimum = Math.max(1, this.config.minimumNumberOfCalls);
+    return this.config.slidingWindowType === 'count'
+      ? Math.min(minimum, this.config.slidingWindowSize)
+      : minimum;
+  }
+
+  private permittedHalfOpenCalls(): number {
+    return Math.max(1, this.config.successThreshold);
+  }
+
+  private enqueue(event: QueuedEvent): void {
+    this.eventQueue.push(event);
+    if (!this.flushScheduled) {
+      this.flushScheduled = true;
+      setImmediate(() => this.flushEvents());
+    }
+  }
+
+  /**
+   * Register an in-flight call with the shared timeout timer
+   */
+  private track(call: PendingCall): void {
+    this.pending.push(call);
+    this.inFlight++;
+
+    if (this.timer === undefined) {
+      this.armTimer(call.deadline);
+    }
+  }
+
+  private untrack(): void {
+    this.inFlight--;
+
+    if (this.inFlight === 0) {
+      // Nothing left to time out
+      if (this.timer !== undefined) {
+        clearTimeout(this.timer);
+        this.timer = undefined;
+        this.timerDeadline = Number.POSITIVE_INFINITY;
+      }
+      this.pending = [];
+      this.pendingHead = 0;
+    }
+  }
+
+  private armTimer(deadline: number): void {
+    this.timerDeadline = deadline;
+    this.timer = setTimeout(() => this.expireCalls(), Math.max(0, deadline - Date.now()));
+  }
+
+  /**
+   * Time out every call whose deadline passed, then re-arm for the next one
+   */
+  private expireCalls(): void {
+    this.timer = undefined;
+    const now = Math.max(Date.now(), this.timerDeadline);
+    this.timerDeadline = Number.POSITIVE_INFINITY;
+
+    while (this.pendingHead < this.pending.length) {
+      const call = this.pending[this.pendingHead]!;
+
+      if (call.settled) {
+        this.pendingHead++;
+        continue;
+      }
+      if (call.deadline > now) {
+        break;
+      }
+
+      this.pendingHead++;
+      const error = new ResilienceError(
+        `Circuit breaker timeout for model ${this.modelId}`,
+        'CIRCUIT_BREAKER_TIMEOUT',
+        this.modelId,
+        true
+      );
+      this.complete(call, error);
+      call.reject(error);
+    }
+
+    if (this.pendingHead > 1024 && this.pendingHead * 2 > this.pending.length) {
+      this.pending = this.pending.slice(this.pendingHead);
+      this.pendingHead = 0;
+    }
+
+    const next = this.pending[this.pendingHead];
+    if (next && this.timer === undefined) {
+      this.armTimer(next.deadline);
+    }
+  }
+}
@@ -0,0 +1,454 @@
+/**
+ * Timer Wheel Scheduler Implementation
+ * BIP-03 Implementation - Core Infrastructure Phase 1
+ *
+ * One hierarchical timer wheel drives every periodic background loop in
+ * the framework (health checks, metrics collection, recovery monitoring,
+ * dashboard refresh). Tasks due in the same tick fire together from a
+ * single timer, a task whose previous run is still in progress is skipped
+ * instead of stacking, and each task class has a concurrency limit so a
+ * burst of health probes cannot saturate the event loop.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+/**
+ * Scheduler configuration
+ */
+export interface TimerWheelSchedulerConfig {
+  readonly tickMs: number; // wheel resolution; intervals are rounded up to it
+  readonly wheelBits: number; // slots per level = 2^wheelBits
+  readonly levels: number;
+  readonly classConcurrency: Readonly<Record<string, number>>; // max concurrent runs per task class
+}
+
+/**
+ * Default scheduler: 50ms ticks, four 64-slot levels (~9.7 days of range)
+ */
+export const DEFAULT_TIMER_WHEEL_CONFIG: TimerWheelSchedulerConfig = {
+  tickMs: 50,
+  wheelBits: 6,
+  levels: 4,
+  classConcurrency: {
+    'health-check': 16,
+  },
+};
+
+/**
+ * Options for a periodic task
+ */
+export interface ScheduleOptions {
+  readonly name: string;
+  readonly intervalMs: number;
+  readonly taskClass?: string; // defaults to 'default' (unbounded)
+  readonly initialDelayMs?: number; // defaults to intervalMs
+  readonly alignToInterval?: boolean; // first run on a multiple of intervalMs, so peers share ticks
+}
+
+/**
+ * Per-task instrumentation
+ */
+export interface ScheduledTaskStatistics {
+  readonly id: number;
+  readonly name: string;
+  readonly taskClass: string;
+  readonly intervalMs: number;
+  readonly runs: number;
+  readonly errors: number;
+  readonly skippedRuns: number; // due while the previous run was still going
+  readonly coalescedTicks: number; // missed periods folded into one run
+  readonly deferredRuns: number; // waited for a task-class slot
+  readonly overruns: number; // runs that took longer than the interval
+  readonly lastLagMs: number; // start time minus due time
+  readonly maxLagMs: number;
+  readonly lastDurationMs: number;
+  readonly maxDurationMs: number;
+  readonly running: boolean;
+}
+
+/**
+ * Handle returned by schedule()
+ */
+export interface ScheduledTaskHandle {
+  readonly id: number;
+  cancel(): void;
+  getStatistics(): ScheduledTaskStatistics;
+}
+
+interface ScheduledTask {
+  readonly id: number;
+  readonly name: string;
+  readonly taskClass: string;
+  readonly intervalMs: number;
+  readonly fn: () => unknown;
+  dueAt: number; // wall-clock time the next run is due
+  dueTick: number;
+  level: number;
+  slot: number;
+  cancelled: boolean;
+  running: boolean;
+  queued: boolean;
+  queuedDueAt: number;
+  stats: {
+    runs: number;
+    errors: number;
+    skippedRuns: number;
+    coalescedTicks: number;
+    deferredRuns: number;
+    overruns: number;
+    lastLagMs: number;
+    maxLagMs: number;
+    lastDurationMs: number;
+    maxDurationMs: number;
+  };
+}
+
+interface TaskClassState {
+  limit: number;
+  active: number;
+  queue: ScheduledTask[];
+}
+
+/**
+ * Hierarchical timer wheel shared by the framework's background loops
+ */
+export class TimerWheelScheduler {
+  private static sharedInstance: TimerWheelScheduler | undefined;
+
+  private readonly config: TimerWheelSchedulerConfig;
+  private readonly slotMask: number;
+  private readonly wheels: Set<ScheduledTask>[][];
+  private readonly tasks = new Map<number, ScheduledTask>();
+  private readonly classes = new Map<string, TaskClassState>();
+  private readonly epoch = Date.now();
+  private currentTick = 0;
+  private nextId = 1;
+  private timer: NodeJS.Timeout | undefined;
+  private timerTick = -1;
+
+  constructor(config: Partial<TimerWheelSchedulerConfig> = {}) {
+    this.config = { ...DEFAULT_TIMER_WHEEL_CONFIG, ...config };
+    this.slotMask = (1 << this.config.wheelBits) - 1;
+    this.wheels = Array.from({ length: this.config.levels }, () =>
+      Array.from({ length: 1 << this.config.wheelBits }, () => new Set<ScheduledTask>())
+    );
+    this.currentTick = this.tickAt(this.epoch);
+  }
+
+  /**
+   * Process-wide scheduler used by framework components by default
+   */
+  static shared(): TimerWheelScheduler {
+    if (!this.sharedInstance) {
+      this.sharedInstance = new TimerWheelScheduler();
+    }
+    return this.sharedInstance;
+  }
+
+  /**
+   * Run `fn` every `intervalMs` until the handle is cancelled
+   */
+  schedule(fn: () => unknown, options: ScheduleOptions): ScheduledTaskHandle {
+    const intervalMs = Math.max(this.config.tickMs, options.intervalMs);
+    const now = Date.now();
+    const dueAt = options.alignToInterval
+      ? this.epoch + Math.ceil((now + 1 - this.epoch) / intervalMs) * intervalMs
+      : now + (options.initialDelayMs ?? intervalMs);
+    const task: ScheduledTask = {
+      id: this.nextId++,
+      name: options.name,
+      taskClass: options.taskClass ?? 'default',
+      intervalMs,
+      fn,
+      dueAt,
+      dueTick: 0,
+      level: 0,
+      slot: 0,
+      cancelled: false,
+      running: false,
+      queued: false,
+      queuedDueAt: 0,
+      stats: {
+        runs: 0,
+        errors: 0,
+        skippedRuns: 0,
+        coalescedTicks: 0,
+        deferredRuns: 0,
+        overruns: 0,
+        lastLagMs: 0,
+        maxLagMs: 0,
+        lastDurationMs: 0,
+        maxDurationMs: 0,
+      },
+    };
+
+    if (this.tasks.size === 0) {
+      // An idle wheel does not advance; catch up before placing
+      this.currentTick = this.tickAt(Date.now());
+    }
+
+    this.tasks.set(task.id, task);
+    this.insert(task);
+    this.arm();
+
+    return {
+      id: task.id,
+      cancel: () => this.cancel(task),
+      getStatistics: () => this.snapshot(task),
+    };
+  }
+
+  /**
+   * Set the maximum number of concurrent runs for a task class
+   */
+  setConcurrencyLimit(taskClass: string, limit: number): void {
+    const state = this.getClassState(taskClass);
+    state.limit = Math.max(1, limit);
+    this.drain(state);
+  }
+
+  /**
+   * Instrumentation for every scheduled task
+   */
+  getStatistics(): ScheduledTaskStatistics[] {
+    return Array.from(this.tasks.values(), task => this.snapshot(task));
+  }
+
+  /**
+   * Number of scheduled tasks
+   */
+  get size(): number {
+    return this.tasks.size;
+  }
+
+  /**
+   * Cancel every task and release the timer
+   */
+  shutdown(): void {
+    for (const task of Array.from(this.tasks.values())) {
+      this.cancel(task);
+    }
+  }
+
+  private cancel(task: ScheduledTask): void {
+    if (task.cancelled) return;
+
+    task.cancelled = true;
+    this.wheels[task.level]![task.slot]!.delete(task);
+    this.tasks.delete(task.id);
+
+    if (task.queued) {
+      const state = this.getClassState(task.taskClass);
+      state.queue = state.queue.filter(queued => queued !== task);
+      task.queued = false;
+    }
+
+    if (this.tasks.size === 0) {
+      this.disarm();
+    }
+  }
+
+  private tickAt(time: number): number {
+    return Math.floor((time - this.epoch) / this.config.tickMs);
+  }
+
+  private insert(task: ScheduledTask): void {
+    // Round up so a task never fires before it is due
+    task.dueTick = Math.max(
+      this.currentTick + 1,
+      Math.ceil((task.dueAt - this.epoch) / this.config.tickMs)
+    );
+    this.place(task);
+  }
+
+  private place(task: ScheduledTask): void {
+    const bits = this.config.wheelBits;
+    const delta = task.dueTick - this.currentTick;
+    let level = 0;
+
+    while (level < this.config.levels - 1 && delta >= 2 ** (bits * (level + 1))) {
+      level++;
+    }
+
+    // Beyond the top level's range the task parks in its furthest slot and re-cascades
+    const reach = 2 ** (bits * this.config.levels) - 1;
+    const tick = delta > reach ? this.currentTick + reach : task.dueTick;
+
+    task.level = level;
+    task.slot = Math.floor(tick / 2 ** (bits * level)) & this.slotMask;
+    this.wheels[level]![task.slot]!.add(task);
+  }
+
+  private advance(): void {
+    const target = this.tickAt(Date.now());
+    const bits = this.config.wheelBits;
+
+    while (this.currentTick < target && this.tasks.size > 0) {
+      this.currentTick++;
+
+      // Cascade higher levels whose slot boundary was crossed, top down
+      for (let level = this.config.levels - 1; level > 0; level--) {
+        const span = 2 ** (bits * level);
+        if (this.currentTick % span !== 0) continue;
+
+        const slot = this.wheels[level]![Math.floor(this.currentTick / span) & this.slotMask]!;
+        const entries = Array.from(slot);
+        slot.clear();
+        for (const task of entries) {
+          this.place(task);
+        }
+      }
+
+      const due = this.wheels[0]![this.currentTick & this.slotMask]!;
+      if (due.size === 0) continue;
+
+      const entries = Array.from(due);
+      due.clear();
+      for (const task of entries) {
+        this.fire(task);
+      }
+    }
+
+    if (this.tasks.size === 0) {
+      this.currentTick = target;
+    }
+  }
+
+  private fire(task: ScheduledTask): void {
+    const now = Date.now();
+    const scheduledAt = task.dueAt;
+
+    // Coalesce missed periods into this one run and re-arm for the next future slot
+    const missed = Math.max(0, Math.floor((now - scheduledAt) / task.intervalMs));
+    task.stats.coalescedTicks += missed;
+    task.dueAt = scheduledAt + (missed + 1) * task.intervalMs;
+    this.insert(task);
+
+    if (task.running || task.queued) {
+      task.stats.skippedRuns++;
+      return;
+    }
+
+    const state = this.getClassState(task.taskClass);
+    if (state.active >= state.limit) {
+      task.queued = true;
+      task.queuedDueAt = scheduledAt;
+      task.stats.deferredRuns++;
+      state.queue.push(task);
+      return;
+    }
+
+    this.run(task, state, scheduledAt);
+  }
+
+  private run(task: ScheduledTask, state: TaskClassState, scheduledAt: number): void {
+    const startedAt = Date.now();
+    const lag = startedAt - scheduledAt;
+    task.running = true;
+    task.stats.lastLagMs = lag;
+    task.stats.maxLagMs = Math.max(task.stats.maxLagMs, lag);
+    state.active++;
+
+    const finish = (): void => {
+      const duration = Date.now() - startedAt;
+      task.running = false;
+      task.stats.runs++;
+      task.stats.lastDurationMs = duration;
+      task.stats.maxDurationMs = Math.max(task.stats.maxDurationMs, duration);
+      if (duration > task.intervalMs) {
+        task.stats.overruns++;
+      }
+      state.active--;
+      this.drain(state);
+    };
+
+    new Promise<unknown>(resolve => resolve(task.fn()))
+      .catch(error => {
+        task.stats.errors++;
+        console.error(`⏱️ Scheduled task ${task.name} failed:`, error);
+      })
+      .finally(finish);
+  }
+
+  private drain(state: TaskClassState): void {
+    while (state.active < state.limit && state.queue.length > 0) {
+      const task = state.queue.shift()!;
+      task.queued = false;
+      if (!task.cancelled) {
+        this.run(task, state, task.queuedDueAt);
+      }
+    }
+  }
+
+  private getClassState(taskClass: string): TaskClassState {
+    let state = this.classes.get(taskClass);
+    if (!state) {
+      state = {
+        limit: this.config.classConcurrency[taskClass] ?? Infinity,
+        active: 0,
+        queue: [],
+      };
+      this.classes.set(taskClass, state);
+    }
+    return state;
+  }
+
+  /**
+   * Arm the single driving timer for the next tick that has work, so an
+   * idle wheel does not wake up every tickMs
+   */
+  private arm(): void {
+    if (this.tasks.size === 0) return;
+
+    const nextTick = this.nextWakeTick();
+    if (this.timer && this.timerTick <= nextTick) return;
+
+    this.disarm();
+    const delay = Math.max(0, this.epoch + nextTick * this.config.tickMs - Date.now());
+    this.timerTick = nextTick;
+    this.timer = setTimeout(() => {
+      this.timer = undefined;
+      this.timerTick = -1;
+      this.advance();
+      this.arm();
+    }, delay);
+    this.timer.unref?.();
+  }
+
+  private disarm(): void {
+    if (this.timer) {
+      clearTimeout(this.timer);
+      this.timer = undefined;
+      this.timerTick = -1;
+    }
+  }
+
+  private nextWakeTick(): number {
+    const size = this.slotMask + 1;
+
+    for (let offset = 1; offset < size; offset++) {
+      const tick = this.currentTick + offset;
+      if (tick % size === 0) {
+        // Level boundary: wake to cascade the next level down
+        return tick;
+      }
+      if (this.wheels[0]![tick & this.slotMask]!.size > 0) {
+        return tick;
+      }
+    }
+
+    return this.currentTick + size - (this.currentTick % size);
+  }
+
+  private snapshot(task: ScheduledTask): ScheduledTaskStatistics {
+    return {
+      id: task.id,
+      name: task.name,
+      taskClass: task.taskClass,
+      intervalMs: task.intervalMs,
+      running: task.running,
+      ...task.stats,
+    };
+  }
+}
@@ -5,4 +5,9 @@
 
 export * from './HealthChecker.js';
 export * from './CircuitBreaker.js';
+export * from './SlidingWindowCircuitBreaker.js';
 export * from './RetryManager.js';
+export * from './RetryBudget.js';
+export * from './TimerWheelScheduler.js';
+export * from './HealthProbeEngine.js';
+export * from './ConcurrencyLimiter.js';
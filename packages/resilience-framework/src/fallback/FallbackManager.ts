@@ -14,11 +14,15 @@ import {
   ModelIdentity,
   ResilienceExecutionResult,
   ResilienceError,
-  AllModelsFailedError
+  AllModelsFailedError,
+  RequestCancelledError
 } from '../types/index.js';
 
-import { CircuitBreakerFactory } from '../core/CircuitBreaker.js';
+import { CircuitBreakerFactory, type CircuitBreakerLike } from '../core/CircuitBreaker.js';
 import { RetryManager } from '../core/RetryManager.js';
+import { ConcurrencyLimiter, isOverloadError, type ConcurrencyPermit } from '../core/ConcurrencyLimiter.js';
+import { WindowedQuantileSketch } from '../monitoring/QuantileSketch.js';
+import { Tracer, SPAN_NAMES } from '../monitoring/Tracer.js';
 
 /**
  * Performance metrics for model routing decisions
@@ -31,6 +35,8 @@ export interface PerformanceMetrics {
   readonly requestCount: number;
   readonly errorRate?: number;
   readonly throughputRps?: number;
+  readonly p95ResponseTime?: number; // rolling window
+  readonly p99ResponseTime?: number; // rolling window
   readonly resourceUsage?: {
     cpu: number;
     memory: number;
@@ -58,6 +64,25 @@ interface FallbackExecutionContext {
   readonly startTime: Date;
   readonly attemptedModels: string[];
   readonly errors: Map<string, Error>;
+  readonly signal?: AbortSignal | undefined; // caller cancellation, applied to every attempt
+}
+
+/**
+ * Rolling latency window used for hedge delays
+ */
+const LATENCY_WINDOW_MS = 5 * 60 * 1000;
+const LATENCY_WINDOW_BUCKETS = 10;
+const HEDGE_MIN_SAMPLES = 20;
+const DEFAULT_HEDGE_DELAY_MS = 1000;
+
+/**
+ * In-flight attempt of the hedged strategy
+ */
+interface HedgeAttempt {
+  readonly model: ModelIdentity;
+  readonly controller: AbortController;
+  readonly startTime: number;
+  done: boolean;
 }
 
 /**
@@ -66,6 +91,9 @@ interface FallbackExecutionContext {
 export class FallbackManager {
   private readonly performanceMetrics = new Map<string, PerformanceMetrics>();
   private readonly retryManager = new RetryManager();
+  private readonly tracer = Tracer.shared();
+  private readonly latencyWindows = new Map<string, WindowedQuantileSketch>();
+  private circuitBreakerProvider = (modelId: string): CircuitBreakerLike => CircuitBreakerFactory.getOrCreate(modelId);
   private routingConfig: RoutingConfig = {
     defaultStrategy: 'sequential',
     modelWeights: {},
@@ -74,55 +102,68 @@ export class FallbackManager {
     retryOnFailure: true,
   };
 
+  /**
+   * @param concurrencyLimiter when given, every model call waits for a permit;
+   * shed tasks fail over to the next model like any other failure
+   */
   constructor(
-    private readonly modelExecutor: ModelExecutor = new DefaultModelExecutor()
+    private readonly modelExecutor: ModelExecutor = new DefaultModelExecutor(),
+    private readonly concurrencyLimiter?: ConcurrencyLimiter
   ) {}
 
   /**
    * Execute AI task with fallback strategy
+   *
+   * @param signal aborting it cancels the attempt in flight and any not yet started
    */
   async executeWithFallback<T>(
     task: AITask,
-    config: FallbackConfig
+    config: FallbackConfig,
+    signal?: AbortSignal
   ): Promise<ResilienceExecutionResult<T>> {
-    const context: FallbackExecutionContext = {
-      task,
-      config,
-      startTime: new Date(),
-      attemptedModels: [],
-      errors: new Map(),
-    };
+    return this.tracer.withSpan(SPAN_NAMES.fallback, async span => {
+      const context: FallbackExecutionContext = {
+        task,
+        config,
+        startTime: new Date(),
+        attemptedModels: [],
+        errors: new Map(),
+        signal,
+      };
 
-    try {
-      const result = await this.executeStrategy<T>(context);
+      try {
+        const result = await this.executeStrategy<T>(context);
 
-      // Update performance metrics
-      await this.updatePerformanceMetrics(result);
+        // Update performance metrics
+        await this.updatePerformanceMetrics(result);
 
-      return result;
-    } catch (error) {
-      // All models failed
-      const allModelsError = new AllModelsFailedError(
-        context.attemptedModels,
-        error instanceof Error ? error : new Error(String(error))
-      );
+        span.setAttribute('model.used', result.modelUsed);
+        return result;
+      } catch (error) {
+        // All models failed
+        const allModelsError = new AllModelsFailedError(
+          context.attemptedModels,
+          error instanceof Error ? error : new Error(String(error))
+        );
+        span.setStatus('error', allModelsError.message);
 
-      return {
-        result: undefined as T,
-        success: false,
-        modelUsed: 'none',
-        executionTime: Date.now() - context.startTime.getTime(),
-        fallbackUsed: true,
-        retryCount: 0,
-        circuitBreakerTriggered: false,
-        error: allModelsError,
-        metadata: {
-          attemptedModels: context.attemptedModels,
-          errors: Object.fromEntries(context.errors),
-          strategy: config.strategy,
-        },
-      };
-    }
+        return {
+          result: undefined as T,
+          success: false,
+          modelUsed: 'none',
+          executionTime: Date.now() - context.startTime.getTime(),
+          fallbackUsed: true,
+          retryCount: 0,
+          circuitBreakerTriggered: false,
+          error: allModelsError,
+          metadata: {
+            attemptedModels: context.attemptedModels,
+            errors: Object.fromEntries(context.errors),
+            strategy: config.strategy,
+          },
+        };
+      }
+    }, { 'fallback.strategy': config.strategy });
   }
 
   /**
@@ -149,6 +190,14 @@ export class FallbackManager {
     this.routingConfig = { ...this.routingConfig, ...config };
   }
 
+  /**
+   * Source of per-model circuit breakers; defaults to the process-wide
+   * CircuitBreakerFactory
+   */
+  setCircuitBreakerProvider(provider: ((modelId: string) => CircuitBreakerLike) | undefined): void {
+    this.circuitBreakerProvider = provider ?? (modelId => CircuitBreakerFactory.getOrCreate(modelId));
+  }
+
   /**
    * Get current performance metrics for all models
    */
@@ -185,6 +234,9 @@ export class FallbackManager {
       case 'random':
         return this.executeRandomFallback<T>(context);
 
+      case 'hedged':
+        return this.executeHedgedFallback<T>(context);
+
       default:
         throw new ResilienceError(
           `Unknown fallback strategy: ${strategy}`,
@@ -352,31 +404,247 @@ export class FallbackManager {
     };
   }
 
+  /**
+   * Execute hedged fallback strategy: start the primary, and if it has not
+   * answered within its latency percentile, race the next-best model as well.
+   * The first success wins and the remaining attempts are aborted; so are
+   * all attempts once `config.timeout` elapses.
+   */
+  private executeHedgedFallback<T>(
+    context: FallbackExecutionContext
+  ): Promise<ResilienceExecutionResult<T>> {
+    const { config, task } = context;
+    const models = [config.primary, ...this.sortModelsByWeight(config.fallbacks)];
+    const maxHedges = Math.max(0, config.maxHedges ?? 1);
+    const percentile = config.hedgePercentile ?? 95;
+
+    const attempts: HedgeAttempt[] = [];
+    let nextIndex = 0;
+    let inFlight = 0;
+    let hedgeCount = 0;
+    let wastedWorkMs = 0;
+    let lastHedgeDelay: number | undefined;
+    let settled = false;
+    let hedgeTimer: ReturnType<typeof setTimeout> | undefined;
+    let deadlineTimer: ReturnType<typeof setTimeout> | undefined;
+    let onAbort: (() => void) | undefined;
+
+    return new Promise((resolve, reject) => {
+      // Settle once: stop hedging and abort whatever is still running
+      const finish = (): string[] => {
+        settled = true;
+        if (hedgeTimer) clearTimeout(hedgeTimer);
+        if (deadlineTimer) clearTimeout(deadlineTimer);
+        if (onAbort) context.signal?.removeEventListener('abort', onAbort);
+
+        const now = Date.now();
+        const cancelledModels: string[] = [];
+        for (const other of attempts) {
+          if (!other.done) {
+            other.done = true;
+            wastedWorkMs += now - other.startTime;
+            cancelledModels.push(other.model.id);
+            other.controller.abort();
+          }
+        }
+        return cancelledModels;
+      };
+
+      const scheduleHedge = (model: ModelIdentity) => {
+        if (hedgeTimer) clearTimeout(hedgeTimer);
+        hedgeTimer = undefined;
+        if (nextIndex >= models.length || hedgeCount >= maxHedges) return;
+
+        lastHedgeDelay = this.getHedgeDelay(model.id, percentile, config.hedgeDelay);
+        hedgeTimer = setTimeout(() => {
+          hedgeTimer = undefined;
+          if (!settled && nextIndex < models.length && hedgeCount < maxHedges) {
+            const hedge = models[nextIndex]!;
+            hedgeCount++;
+            launch();
+            scheduleHedge(hedge);
+          }
+        }, lastHedgeDelay);
+      };
+
+      const launch = () => {
+        const model = models[nextIndex++]!;
+        const attempt: HedgeAttempt = {
+          model,
+          controller: new AbortController(),
+          startTime: Date.now(),
+          done: false,
+        };
+        attempts.push(attempt);
+        context.attemptedModels.push(model.id);
+        inFlight++;
+
+        this.executeOnModel<T>(model, task, context, attempt.controller.signal).then(
+          result => {
+            attempt.done = true;
+            inFlight--;
+            if (settled) return;
+
+            // Cancel the losers; their elapsed time is wasted work
+            const cancelledModels = finish();
+
+            resolve({
+              ...result,
+              fallbackUsed: model.id !== config.primary.id,
+              hedgeCount,
+              wastedWorkMs,
+              metadata: {
+                strategy: 'hedged',
+                attemptedModels: context.attemptedModels,
+                primaryModel: config.primary.id,
+                hedgeDelay: lastHedgeDelay,
+                cancelledModels,
+              },
+            });
+          },
+          error => {
+            if (attempt.done) return; // cancelled
+            attempt.done = true;
+            inFlight--;
+            context.errors.set(model.id, error instanceof Error ? error : new Error(String(error)));
+            if (settled) return;
+
+            if (nextIndex < models.length) {
+              // A failure moves on immediately, like the sequential strategy
+              const next = models[nextIndex]!;
+              launch();
+              scheduleHedge(next);
+            } else if (inFlight === 0) {
+              finish();
+              reject(new AllModelsFailedError(context.attemptedModels, error instanceof Error ? error : undefined));
+            }
+          }
+        );
+      };
+
+      if (models.length === 0) {
+        reject(new AllModelsFailedError(context.attemptedModels));
+        return;
+      }
+
+      if (config.timeout > 0) {
+        deadlineTimer = setTimeout(() => {
+          if (settled) return;
+          const cancelledModels = finish();
+          reject(new ResilienceError(
+            `Hedged fallback timed out after ${config.timeout}ms (cancelled: ${cancelledModels.join(', ')})`,
+            'FALLBACK_TIMEOUT',
+            undefined,
+            false
+          ));
+        }, config.timeout);
+      }
+
+      if (context.signal) {
+        if (context.signal.aborted) {
+          finish();
+          reject(cancelledError(config.primary.id));
+          return;
+        }
+
+        onAbort = () => {
+          if (settled) return;
+          finish();
+          reject(cancelledError(config.primary.id));
+        };
+        context.signal.addEventListener('abort', onAbort, { once: true });
+      }
+
+      launch();
+      scheduleHedge(models[0]!);
+    });
+  }
+
+  /**
+   * Delay before hedging a model: its rolling latency percentile once enough
+   * samples exist, otherwise the configured fallback delay
+   */
+  private getHedgeDelay(modelId: string, percentile: number, fallbackDelay?: number): number {
+    const sketch = this.latencyWindows.get(modelId)?.query();
+    if (sketch && sketch.count >= HEDGE_MIN_SAMPLES) {
+      return Math.max(0, sketch.quantile(Math.min(100, Math.max(0, percentile)) / 100));
+    }
+    return fallbackDelay ?? DEFAULT_HEDGE_DELAY_MS;
+  }
+
+  /**
+   * Record a successful call's latency in the model's rolling window
+   */
+  private recordLatency(modelId: string, latencyMs: number): void {
+    let window = this.latencyWindows.get(modelId);
+    if (!window) {
+      window = new WindowedQuantileSketch(LATENCY_WINDOW_MS, LATENCY_WINDOW_BUCKETS);
+      this.latencyWindows.set(modelId, window);
+    }
+    window.add(Date.now(), latencyMs);
+  }
+
   /**
    * Execute task on a specific model with circuit breaker and retry
    */
   private async executeOnModel<T>(
     model: ModelIdentity,
     task: AITask,
-    context: FallbackExecutionContext
+    context: FallbackExecutionContext,
+    signal: AbortSignal | undefined = context.signal
   ): Promise<ResilienceExecutionResult<T>> {
     const startTime = Date.now();
-    const circuitBreaker = CircuitBreakerFactory.getOrCreate(model.id);
+    const circuitBreaker = this.circuitBreakerProvider(model.id);
 
     let retryCount = 0;
     let circuitBreakerTriggered = false;
 
     try {
       const executeWithRetry = async (): Promise<T> => {
-        return circuitBreaker.execute(async () => {
-          const response = await this.modelExecutor.execute(model, task);
-          return response.result as T;
-        });
+        if (signal?.aborted) {
+          throw cancelledError(model.id);
+        }
+
+        const acquire = () => this.tracer.withSpan(SPAN_NAMES.queue,
+          () => this.concurrencyLimiter!.acquire(model.id, task.priority, signal),
+          { component: model.id, 'model.id': model.id });
+
+        // An open circuit rejects without queueing for, or holding, a slot
+        let permit: ConcurrencyPermit | undefined = this.concurrencyLimiter && !breakerRejects(circuitBreaker)
+          ? await acquire()
+          : undefined;
+
+        try {
+          const outcome = await this.tracer.traceBreakerCall(circuitBreaker, model.id, async () => {
+            // The circuit closed between the check and the call
+            if (this.concurrencyLimiter && !permit) {
+              permit = await acquire();
+            }
+
+            try {
+              const response = await this.modelExecutor.execute(model, task, signal);
+              return response.result as T;
+            } catch (error) {
+              // Breakers skip RequestCancelledError: a cancelled hedge says
+              // nothing about the model's health
+              if (signal?.aborted) throw cancelledError(model.id);
+              throw error;
+            }
+          });
+
+          permit?.release('success');
+          return outcome;
+        } catch (error) {
+          permit?.release(isOverloadError(error) ? 'dropped' : 'ignored');
+          throw error;
+        }
       };
 
-      const result = this.routingConfig.retryOnFailure
-        ? await this.retryManager.executeWithRetry(executeWithRetry)
-        : await executeWithRetry();
+      const result = await this.tracer.withSpan(SPAN_NAMES.fallbackAttempt, () => this.routingConfig.retryOnFailure
+        ? this.retryManager.executeWithRetry(executeWithRetry, undefined, { target: model.id, circuitBreaker })
+        : executeWithRetry(), { component: model.id, 'model.id': model.id });
+
+      this.recordLatency(model.id, Date.now() - startTime);
 
       return {
         result,
@@ -441,6 +709,11 @@ export class FallbackManager {
     const existing = this.performanceMetrics.get(result.modelUsed);
     const now = new Date();
 
+    const latency = this.latencyWindows.get(result.modelUsed)?.query();
+    const percentiles = latency && latency.count > 0
+      ? { p95ResponseTime: latency.quantile(0.95), p99ResponseTime: latency.quantile(0.99) }
+      : {};
+
     if (existing) {
       // Update existing metrics using exponential moving average
       const alpha = 0.1; // smoothing factor
@@ -453,6 +726,7 @@ export class FallbackManager {
         successRate: newSuccessRate,
         lastUpdated: now,
         requestCount: existing.requestCount + 1,
+        ...percentiles,
       };
 
       await this.updateModelWeights(updatedMetrics);
@@ -464,6 +738,7 @@ export class FallbackManager {
         successRate: result.success ? 1 : 0,
         lastUpdated: now,
         requestCount: 1,
+        ...percentiles,
       };
 
       await this.updateModelWeights(newMetrics);
@@ -475,19 +750,41 @@ export class FallbackManager {
  * Model executor interface for abstracting AI model execution
  */
 export interface ModelExecutor {
-  execute(model: ModelIdentity, task: AITask): Promise<AIResponse>;
+  /**
+   * Run a task on a model. Implementations should stop work and reject
+   * when `signal` is aborted (the hedged strategy cancels losing requests).
+   */
+  execute(model: ModelIdentity, task: AITask, signal?: AbortSignal): Promise<AIResponse>;
+}
+
+/**
+ * Error used for requests cancelled through their AbortSignal
+ */
+function cancelledError(modelId: string): ResilienceError {
+  return new RequestCancelledError(modelId);
+}
+
+/**
+ * Whether the breaker would reject a call now, read without changing its state
+ */
+function breakerRejects(circuitBreaker: CircuitBreakerLike): boolean {
+  const { state, nextRetryTime } = circuitBreaker.getStatus();
+  return state === 'open' && (!nextRetryTime || Date.now() < nextRetryTime.getTime());
 }
 
 /**
  * Default model executor implementation
  */
 export class DefaultModelExecutor implements ModelExecutor {
-  async execute(model: ModelIdentity, task: AITask): Promise<AIResponse> {
+  async execute(model: ModelIdentity, task: AITask, signal?: AbortSignal): Promise<AIResponse> {
     // Placeholder implementation - in real usage, this would call actual AI models
     const startTime = Date.now();
 
     // Simulate API call delay
-    await this.delay(Math.random() * 1000 + 500);
+    await this.delay(Math.random() * 1000 + 500, signal);
+    if (signal?.aborted) {
+      throw cancelledError(model.id);
+    }
 
     // Simulate occasional failures
     if (Math.random() < 0.1) { // 10% failure rate
@@ -509,7 +806,13 @@ export class DefaultModelExecutor implements ModelExecutor {
     };
   }
 
-  private delay(ms: number): Promise<void> {
-    return new Promise(resolve => setTimeout(resolve, ms));
+  private delay(ms: number, signal?: AbortSignal): Promise<void> {
+    return new Promise(resolve => {
+      const timer = setTimeout(resolve, ms);
+      signal?.addEventListener('abort', () => {
+        clearTimeout(timer);
+        resolve();
+      }, { once: true });
+    });
   }
 }
@@ -18,19 +18,68 @@ export {
 export {
   CircuitBreaker,
   CircuitBreakerFactory,
+  isSlidingWindowConfig,
+  type CircuitBreakerLike,
   type CircuitBreakerListener,
   type CircuitBreakerStateChangeEvent,
   type CircuitBreakerExecutionEvent
 } from './core/CircuitBreaker.js';
 
+export {
+  SlidingWindowCircuitBreaker,
+  DEFAULT_SLIDING_WINDOW_CONFIG,
+  type SlidingWindowMetrics
+} from './core/SlidingWindowCircuitBreaker.js';
+
 export {
   RetryManager,
   BatchRetryExecutor,
   RetryExhaustedError,
   RetryStatisticsCollector,
-  type RetryStatistics
+  type RetryStatistics,
+  type RetryContext
 } from './core/RetryManager.js';
 
+export {
+  RetryBudget,
+  DEFAULT_RETRY_BUDGET_CONFIG,
+  type RetryBudgetConfig,
+  type RetryBudgetStatistics
+} from './core/RetryBudget.js';
+
+export {
+  TimerWheelScheduler,
+  DEFAULT_TIMER_WHEEL_CONFIG,
+  type TimerWheelSchedulerConfig,
+  type ScheduleOptions,
+  type ScheduledTaskHandle,
+  type ScheduledTaskStatistics
+} from './core/TimerWheelScheduler.js';
+
+export {
+  HealthProbeEngine,
+  DEFAULT_HEALTH_PROBE_CONFIG,
+  matchesExpectedResponse,
+  type HealthProbeEngineConfig,
+  type HealthProbeResult,
+  type HealthProbeListener
+} from './core/HealthProbeEngine.js';
+
+export {
+  ConcurrencyLimiter,
+  DEFAULT_CONCURRENCY_LIMITER_CONFIG,
+  isOverloadError,
+  type ConcurrencyLimiterConfig,
+  type ConcurrencyLimitAlgorithm,
+  type ConcurrencyLimiterListener,
+  type ConcurrencyLimitStatistics,
+  type ConcurrencyPermit,
+  type ConcurrencySaturationEvent,
+  type LimiterOutcome,
+  type ShedReason,
+  type TaskPriority
+} from './core/ConcurrencyLimiter.js';
+
 // Fallback components
 export {
   FallbackManager,
@@ -46,16 +95,41 @@ export {
   AlertManager,
   Dashboard,
   Analytics,
+  MetricRollup,
+  OnlineForecaster,
+  Tracer,
+  SpanRingBuffer,
+  OtlpHttpExporter,
+  SPAN_NAMES,
+  summarizeSpans,
+  toOtlpJson,
   type SystemMetrics,
   type ModelMetrics,
   type MetricDataPoint,
+  type ProbeLatencySummary,
   type Alert,
   type AlertConfig,
+  type AlertPipelineOptions,
+  type ChannelDeliveryStats,
   type DashboardLayout,
   type DashboardSnapshot,
+  type DashboardDelta,
+  type DashboardSubscription,
+  type WidgetDelta,
+  type SeriesDelta,
   type PerformanceReport,
   type TrendAnalysis,
-  type AnomalyDetection
+  type AnomalyDetection,
+  type ForecastPrediction,
+  type RollupTier,
+  type RollupBucket,
+  type Span,
+  type SpanData,
+  type SpanStatus,
+  type SpanExporter,
+  type SpanLatencyBreakdown,
+  type TracerConfig,
+  type OtlpExporterConfig
 } from './monitoring/index.js';
 
 // Phase 4: Advanced Features
@@ -64,6 +138,11 @@ export {
   AutoRecovery,
   LoadBalancer,
   ChaosTestSuite,
+  ChaosBenchmark,
+  FaultInjectingExecutor,
+  compareBenchmarkReports,
+  saveBenchmarkBaseline,
+  loadBenchmarkBaseline,
   OptimizationEngine,
   type DegradationLevel,
   type DegradationStrategy,
@@ -76,6 +155,10 @@ export {
   type ModelLoadStats,
   type ChaosExperiment,
   type ExperimentResult,
+  type BenchmarkPhase,
+  type BenchmarkFault,
+  type BenchmarkReport,
+  type BenchmarkComparison,
   type OptimizationStrategy,
   type OptimizationResult,
   type BottleneckAnalysis
@@ -89,7 +172,10 @@ export type {
   CircuitBreakerState,
   CircuitBreakerConfig,
   CircuitBreakerStatus,
+  SlidingWindowType,
+  SlidingWindowCircuitBreakerConfig,
   RetryOptions,
+  JitterMode,
   FallbackStrategy,
   FallbackConfig,
   AITask,
@@ -0,0 +1,202 @@
+/**
+ * Alert Delivery Queue
+ * BIP-03 Implementation - Phase 3: Monitoring & Alerting
+ *
+ * Bounded per-channel notification queue. Items are sent in batches,
+ * paced by a token bucket so a noisy rule cannot saturate a webhook, and
+ * failed batches are retried with exponential backoff before being dropped.
+ * Retries take a token like any other send, ahead of new batches.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+/**
+ * Delivery queue configuration
+ */
+export interface AlertDeliveryQueueConfig {
+  readonly maxQueueSize: number; // oldest items are dropped beyond this
+  readonly batchSize: number; // items per send
+  readonly ratePerSecond: number; // sends per second
+  readonly burst: number; // sends allowed back to back
+  readonly maxRetries: number;
+  readonly retryBaseDelay: number; // milliseconds, doubled per attempt
+}
+
+/**
+ * Default queue: 1000 items, batches of 20, 5 sends/second, 3 retries
+ */
+export const DEFAULT_ALERT_DELIVERY_QUEUE_CONFIG: AlertDeliveryQueueConfig = {
+  maxQueueSize: 1000,
+  batchSize: 20,
+  ratePerSecond: 5,
+  burst: 5,
+  maxRetries: 3,
+  retryBaseDelay: 500,
+};
+
+/**
+ * Queue counters
+ */
+export interface AlertDeliveryQueueStats {
+  readonly queueDepth: number;
+  readonly inFlight: number;
+  readonly batches: number; // send attempts
+  readonly retries: number;
+  readonly dropped: number; // evicted by a full queue or out of retries
+  readonly rateLimited: number; // sends delayed by the rate limit
+}
+
+/**
+ * Batch sender; resolves true on success
+ */
+export type AlertBatchSender<T> = (batch: T[]) => Promise<boolean>;
+
+/**
+ * Rate-limited batching queue for one channel
+ */
+export class AlertDeliveryQueue<T> {
+  private readonly queue: T[] = [];
+  private readonly retryReady: Array<{ batch: T[]; attempt: number }> = []; // backoff elapsed, awaiting a token
+  private readonly config: AlertDeliveryQueueConfig;
+  private tokens: number;
+  private lastRefill = Date.now();
+  private inFlight = 0;
+  private timer: NodeJS.Timeout | undefined;
+  private pumpPending = false;
+  private idleWaiters: Array<() => void> = [];
+  private stats = { batches: 0, retries: 0, dropped: 0, rateLimited: 0 };
+
+  constructor(
+    private readonly send: AlertBatchSender<T>,
+    config: Partial<AlertDeliveryQueueConfig> = {},
+    private readonly onDrop?: (items: T[]) => void
+  ) {
+    const merged = { ...DEFAULT_ALERT_DELIVERY_QUEUE_CONFIG, ...config };
+    this.config = { ...merged, burst: Math.max(1, merged.burst) }; // a zero bucket would never send
+    this.tokens = this.config.burst;
+  }
+
+  /**
+   * Add an item; drops the oldest queued item when full
+   */
+  enqueue(item: T): void {
+    this.queue.push(item);
+
+    if (this.queue.length > this.config.maxQueueSize) {
+      const evicted = this.queue.splice(0, this.queue.length - this.config.maxQueueSize);
+      this.stats.dropped += evicted.length;
+      this.onDrop?.(evicted);
+    }
+
+    // Defer so items enqueued in the same tick share a batch
+    if (!this.pumpPending) {
+      this.pumpPending = true;
+      queueMicrotask(() => {
+        this.pumpPending = false;
+        this.pump();
+      });
+    }
+  }
+
+  /**
+   * Resolve once the queue is empty and nothing is in flight
+   */
+  drain(): Promise<void> {
+    if (this.isIdle()) {
+      return Promise.resolve();
+    }
+    return new Promise(resolve => this.idleWaiters.push(resolve));
+  }
+
+  getStats(): AlertDeliveryQueueStats {
+    return {
+      ...this.stats,
+      queueDepth: this.queue.length + this.retryReady.reduce((sum, retry) => sum + retry.batch.length, 0),
+      inFlight: this.inFlight,
+    };
+  }
+
+  private pump(): void {
+    if (this.timer) return;
+
+    while (this.retryReady.length > 0 || this.queue.length > 0) {
+      this.refill();
+
+      if (this.tokens < 1) {
+        this.stats.rateLimited++;
+        const wait = Math.ceil(((1 - this.tokens) / this.config.ratePerSecond) * 1000);
+        this.schedule(wait);
+        return;
+      }
+
+      this.tokens -= 1;
+      const retry = this.retryReady.shift();
+      if (retry) {
+        void this.sendBatch(retry.batch, retry.attempt);
+      } else {
+        void this.sendBatch(this.queue.splice(0, this.config.batchSize), 0);
+      }
+    }
+  }
+
+  private async sendBatch(batch: T[], attempt: number): Promise<void> {
+    this.inFlight++;
+    this.stats.batches++;
+
+    let success = false;
+    try {
+      success = await this.send(batch);
+    } catch {
+      success = false;
+    }
+
+    this.inFlight--;
+
+    if (!success) {
+      if (attempt < this.config.maxRetries) {
+        this.stats.retries++;
+        this.inFlight++; // keep drain() waiting through the backoff
+        const delay = this.config.retryBaseDelay * Math.pow(2, attempt);
+        const timer = setTimeout(() => {
+          this.inFlight--;
+          this.retryReady.push({ batch, attempt: attempt + 1 });
+          this.pump();
+        }, delay);
+        timer.unref?.();
+        return;
+      }
+
+      this.stats.dropped += batch.length;
+      this.onDrop?.(batch);
+    }
+
+    this.notifyIdle();
+  }
+
+  private schedule(delay: number): void {
+    this.timer = setTimeout(() => {
+      this.timer = undefined;
+      this.pump();
+    }, delay);
+  }
+
+  private refill(): void {
+    const now = Date.now();
+    const elapsed = (now - this.lastRefill) / 1000;
+    this.tokens = Math.min(this.config.burst, this.tokens + elapsed * this.config.ratePerSecond);
+    this.lastRefill = now;
+  }
+
+  private isIdle(): boolean {
+    return this.queue.length === 0 && this.retryReady.length === 0 && this.inFlight === 0;
+  }
+
+  private notifyIdle(): void {
+    if (!this.isIdle()) return;
+
+    const waiters = this.idleWaiters;
+    this.idleWaiters = [];
+    waiters.forEach(resolve => resolve());
+  }
+}
@@ -7,6 +7,11 @@
  */
 
 import { ModelMetrics, SystemMetrics } from './MetricsCollector.js';
+import {
+  AlertDeliveryQueue,
+  AlertDeliveryQueueConfig,
+  AlertDeliveryQueueStats,
+} from './AlertDeliveryQueue.js';
 
 /**
  * Alert severity levels
@@ -113,6 +118,34 @@ export interface AlertDeliveryStatus {
   readonly responseTime: number;
 }
 
+/**
+ * Alert pipeline options
+ */
+export interface AlertPipelineOptions {
+  readonly groupWait: number; // ms to collect alerts of one rule into a single notification; 0 disables
+  readonly queue: Partial<AlertDeliveryQueueConfig>;
+  readonly channelQueues?: Partial<Record<AlertChannel, Partial<AlertDeliveryQueueConfig>>>;
+}
+
+/**
+ * Default pipeline: 500ms grouping window, default queue settings
+ */
+export const DEFAULT_ALERT_PIPELINE_OPTIONS: AlertPipelineOptions = {
+  groupWait: 500,
+  queue: {},
+};
+
+/**
+ * Per-channel delivery statistics
+ */
+export interface ChannelDeliveryStats extends AlertDeliveryQueueStats {
+  readonly sent: number;
+  readonly succeeded: number;
+  readonly failed: number;
+  readonly averageResponseTime: number;
+  readonly successRate: number;
+}
+
 /**
  * Alert manager event listener
  */
@@ -129,7 +162,13 @@ export class AlertManager {
   private readonly configs = new Map<string, AlertConfig>();
   private readonly activeAlerts = new Map<string, Alert>();
   private readonly alertHistory: Alert[] = [];
-  private readonly lastTriggerTime = new Map<string, number>();
+  private readonly lastTriggerTime = new Map<string, number>(); // keyed by fingerprint
+  private readonly activeByFingerprint = new Map<string, string>();
+  private readonly rulesByMetric = new Map<string, Set<string>>();
+  private readonly pendingGroups = new Map<string, { alerts: Alert[]; timer: NodeJS.Timeout }>();
+  private readonly queues = new Map<AlertChannel, AlertDeliveryQueue<Alert>>();
+  private readonly options: AlertPipelineOptions;
+  private readonly pipelineStats = { deduplicated: 0, grouped: 0 };
   private readonly listeners = new Set<AlertManagerListener>();
   private readonly deliveryStats = new Map<AlertChannel, {
     sent: number;
@@ -139,8 +178,10 @@ export class AlertManager {
   }>();
 
   constructor(
-    private readonly channelConfig: ChannelConfig = {}
+    private readonly channelConfig: ChannelConfig = {},
+    options: Partial<AlertPipelineOptions> = {}
   ) {
+    this.options = { ...DEFAULT_ALERT_PIPELINE_OPTIONS, ...options };
     this.initializeDefaultAlerts();
     this.initializeDeliveryStats();
   }
@@ -149,7 +190,13 @@ export class AlertManager {
    * Add alert configuration
    */
   addAlertConfig(config: AlertConfig): void {
+    const previous = this.configs.get(config.id);
+    if (previous) {
+      this.unindexRule(previous);
+    }
+
     this.configs.set(config.id, config);
+    this.indexRule(config);
     console.log(`🚨 Alert configuration added: ${config.name}`);
   }
 
@@ -157,13 +204,16 @@ export class AlertManager {
    * Remove alert configuration
    */
   removeAlertConfig(configId: string): boolean {
+    const config = this.configs.get(configId);
     const removed = this.configs.delete(configId);
     if (removed) {
+      this.unindexRule(config!);
+
       // Resolve any active alerts for this config
-      const activeAlert = Array.from(this.activeAlerts.values())
-        .find(alert => alert.configId === configId);
+      const activeAlerts = Array.from(this.activeAlerts.values())
+        .filter(alert => alert.configId === configId);
 
-      if (activeAlert) {
+      for (const activeAlert of activeAlerts) {
         this.resolveAlert(activeAlert.id);
       }
 
@@ -232,15 +282,37 @@ export class AlertManager {
       return null;
     }
 
-    // Check cooldown period
-    const lastTrigger = this.lastTriggerTime.get(configId) || 0;
+    // Deduplicate by fingerprint: one alert per rule and model per cooldown period
+    const fingerprint = this.fingerprint(configId, modelId);
+    const lastTrigger = this.lastTriggerTime.get(fingerprint) || 0;
     const now = Date.now();
     if (now - lastTrigger < config.cooldownPeriod) {
+      this.pipelineStats.deduplicated++;
       return null; // Still in cooldown
     }
 
     const alert = await this.createAlert(config, value, modelId, metadata);
-    return await this.sendAlert(alert);
+    return this.sendAlert(alert);
+  }
+
+  /**
+   * Send pending grouped notifications now and wait for channel queues to drain
+   */
+  async flushAlerts(): Promise<void> {
+    for (const groupKey of Array.from(this.pendingGroups.keys())) {
+      this.flushGroup(groupKey);
+    }
+    await Promise.all(Array.from(this.queues.values(), queue => queue.drain()));
+  }
+
+  /**
+   * Deduplication and grouping counters
+   */
+  getDeduplicationStats(): { deduplicated: number; grouped: number; pendingGroups: number } {
+    return {
+      ...this.pipelineStats,
+      pendingGroups: this.pendingGroups.size,
+    };
   }
 
   /**
@@ -253,6 +325,10 @@ export class AlertManager {
     }
 
     this.activeAlerts.delete(alertId);
+    const fingerprint = this.fingerprint(alert.configId, alert.modelId);
+    if (this.activeByFingerprint.get(fingerprint) === alertId) {
+      this.activeByFingerprint.delete(fingerprint);
+    }
     this.listeners.forEach(listener => {
       listener.onAlertResolved?.(alertId);
     });
@@ -277,19 +353,22 @@ export class AlertManager {
   }
 
   /**
-   * Get delivery statistics
+   * Get delivery statistics, including queue depth and drop counters
    */
-  getDeliveryStats(): Map<AlertChannel, {
-    sent: number;
-    succeeded: number;
-    failed: number;
-    averageResponseTime: number;
-    successRate: number;
-  }> {
-    const stats = new Map();
+  getDeliveryStats(): Map<AlertChannel, ChannelDeliveryStats> {
+    const stats = new Map<AlertChannel, ChannelDeliveryStats>();
     for (const [channel, rawStats] of this.deliveryStats) {
+      const queueStats = this.queues.get(channel)?.getStats() ?? {
+        queueDepth: 0,
+        inFlight: 0,
+        batches: 0,
+        retries: 0,
+        dropped: 0,
+        rateLimited: 0,
+      };
       stats.set(channel, {
         ...rawStats,
+        ...queueStats,
         successRate: rawStats.sent > 0 ? rawStats.succeeded / rawStats.sent : 0,
       });
     }
@@ -336,7 +415,7 @@ export class AlertManager {
     };
 
     try {
-      const success = await this.deliverAlert(testAlert, channel);
+      const success = await this.deliverBatch(channel, [testAlert]);
       console.log(`🧪 Test alert ${success ? 'succeeded' : 'failed'} for channel: ${channel}`);
       return success;
     } catch (error) {
@@ -353,8 +432,14 @@ export class AlertManager {
     value: number,
     modelId?: string
   ): Promise<void> {
-    for (const config of this.configs.values()) {
-      if (!config.enabled || config.condition.metric !== metric) {
+    const ruleIds = this.rulesByMetric.get(metric);
+    if (!ruleIds) {
+      return;
+    }
+
+    for (const configId of ruleIds) {
+      const config = this.configs.get(configId);
+      if (!config || !config.enabled) {
         continue;
       }
 
@@ -389,7 +474,7 @@ export class AlertManager {
     modelId?: string,
     metadata?: Record<string, unknown>
   ): Promise<Alert> {
-    const alertId = `${config.id}-${Date.now()}`;
+    const alertId = `${config.id}${modelId ? `-${modelId}` : ''}-${Date.now()}`;
     const template = config.template || this.getDefaultTemplate(config);
 
     const alert: Alert = {
@@ -406,9 +491,20 @@ export class AlertManager {
       ...(metadata && { metadata }),
     };
 
+    // A newer alert with the same fingerprint supersedes the active one
+    const fingerprint = this.fingerprint(config.id, modelId);
+    const superseded = this.activeByFingerprint.get(fingerprint);
+    if (superseded) {
+      this.activeAlerts.delete(superseded);
+      this.listeners.forEach(listener => {
+        listener.onAlertResolved?.(superseded);
+      });
+    }
+
     this.activeAlerts.set(alertId, alert);
+    this.activeByFingerprint.set(fingerprint, alertId);
     this.alertHistory.push(alert);
-    this.lastTriggerTime.set(config.id, Date.now());
+    this.lastTriggerTime.set(fingerprint, Date.now());
 
     this.listeners.forEach(listener => {
       listener.onAlertTriggered?.(alert);
@@ -418,29 +514,97 @@ export class AlertManager {
   }
 
   /**
-   * Send alert to all configured channels
+   * Queue alert for grouped delivery to its configured channels
    */
-  private async sendAlert(alert: Alert): Promise<string> {
+  private sendAlert(alert: Alert): string {
     const config = this.configs.get(alert.configId);
     if (!config) {
       throw new Error(`Alert configuration not found: ${alert.configId}`);
     }
 
-    const deliveryPromises = config.channels.map(channel =>
-      this.deliverAlert(alert, channel)
-    );
+    if (this.options.groupWait <= 0) {
+      this.enqueueNotification(config, alert);
+      return alert.id;
+    }
 
-    const results = await Promise.allSettled(deliveryPromises);
-    const successCount = results.filter(r => r.status === 'fulfilled' && r.value).length;
+    const group = this.pendingGroups.get(config.id);
+    if (group) {
+      group.alerts.push(alert);
+    } else {
+      const timer = setTimeout(() => this.flushGroup(config.id), this.options.groupWait);
+      this.pendingGroups.set(config.id, { alerts: [alert], timer });
+    }
 
-    console.log(`🚨 Alert sent: ${alert.title} (${successCount}/${config.channels.length} channels)`);
     return alert.id;
   }
 
   /**
-   * Deliver alert to specific channel
+   * Turn a group window into a single notification
+   */
+  private flushGroup(groupKey: string): void {
+    const group = this.pendingGroups.get(groupKey);
+    if (!group) return;
+
+    clearTimeout(group.timer);
+    this.pendingGroups.delete(groupKey);
+
+    const config = this.configs.get(groupKey);
+    if (!config || group.alerts.length === 0) return;
+
+    if (group.alerts.length === 1) {
+      this.enqueueNotification(config, group.alerts[0]!);
+      return;
+    }
+
+    this.pipelineStats.grouped += group.alerts.length - 1;
+    this.enqueueNotification(config, this.createGroupNotification(config, group.alerts));
+  }
+
+  private enqueueNotification(config: AlertConfig, notification: Alert): void {
+    for (const channel of config.channels) {
+      this.getQueue(channel).enqueue(notification);
+    }
+    console.log(`🚨 Alert queued: ${notification.title} (${config.channels.length} channels)`);
+  }
+
+  private createGroupNotification(config: AlertConfig, alerts: Alert[]): Alert {
+    const latest = alerts[alerts.length - 1]!;
+    const modelIds = Array.from(new Set(alerts.map(alert => alert.modelId ?? 'system')));
+
+    return {
+      id: `${config.id}-group-${Date.now()}`,
+      configId: config.id,
+      timestamp: latest.timestamp,
+      severity: config.severity,
+      title: `${config.name}: ${alerts.length} alerts (${modelIds.join(', ')})`,
+      message: alerts.map(alert => alert.message).join('\n'),
+      metric: config.condition.metric,
+      value: latest.value,
+      threshold: config.condition.threshold,
+      metadata: {
+        groupedAlertIds: alerts.map(alert => alert.id),
+        modelIds,
+      },
+    };
+  }
+
+  private getQueue(channel: AlertChannel): AlertDeliveryQueue<Alert> {
+    let queue = this.queues.get(channel);
+    if (!queue) {
+      queue = new AlertDeliveryQueue<Alert>(
+        batch => this.deliverBatch(channel, batch),
+        { ...this.options.queue, ...this.options.channelQueues?.[channel] },
+        dropped => console.warn(`🚨 Dropped ${dropped.length} ${channel} alert notification(s)`)
+      );
+      this.queues.set(channel, queue);
+    }
+    return queue;
+  }
+
+  /**
+   * Deliver a batch of alerts to one channel in a single send
    */
-  private async deliverAlert(alert: Alert, channel: AlertChannel): Promise<boolean> {
+  private async deliverBatch(channel: AlertChannel, alerts: Alert[]): Promise<boolean> {
     const startTime = Date.now();
     let success = false;
     let error: string | undefined;
@@ -448,16 +612,16 @@ export class AlertManager {
     try {
       switch (channel) {
         case 'slack':
-          success = await this.deliverToSlack(alert);
+          success = await this.deliverToSlack(alerts);
           break;
         case 'email':
-          success = await this.deliverToEmail(alert);
+          success = await this.deliverToEmail(alerts);
           break;
         case 'webhook':
-          success = await this.deliverToWebhook(alert);
+          success = await this.deliverToWebhook(alerts);
           break;
         case 'console':
-          success = this.deliverToConsole(alert);
+          success = alerts.every(alert => this.deliverToConsole(alert));
           break;
         default:
           throw new Error(`Unknown alert channel: ${channel}`);
@@ -470,29 +634,31 @@ export class AlertManager {
     const responseTime = Date.now() - startTime;
 
     // Update delivery stats
-    this.updateDeliveryStats(channel, success, responseTime);
+    this.updateDeliveryStats(channel, success, responseTime, alerts.length);
 
     // Notify listeners
-    const status: AlertDeliveryStatus = {
-      alertId: alert.id,
-      channel,
-      success,
-      timestamp: new Date(),
-      responseTime,
-      ...(error && { error }),
-    };
+    for (const alert of alerts) {
+      const status: AlertDeliveryStatus = {
+        alertId: alert.id,
+        channel,
+        success,
+        timestamp: new Date(),
+        responseTime,
+        ...(error && { error }),
+      };
 
-    this.listeners.forEach(listener => {
-      listener.onDeliveryStatus?.(status);
-    });
+      this.listeners.forEach(listener => {
+        listener.onDeliveryStatus?.(status);
+      });
+    }
 
     return success;
   }
 
   /**
-   * Deliver alert to Slack
+   * Deliver alerts to Slack as one message
    */
-  private async deliverToSlack(alert: Alert): Promise<boolean> {
+  private async deliverToSlack(alerts: Alert[]): Promise<boolean> {
     const config = this.channelConfig.slack;
     if (!config) {
       throw new Error('Slack configuration not found');
@@ -502,8 +668,8 @@ export class AlertManager {
       channel: config.channel,
       username: config.username || 'CMMV-Hive Alert',
       icon_emoji: config.iconEmoji || ':warning:',
-      text: alert.title,
-      attachments: [{
+      text: alerts.length === 1 ? alerts[0]!.title : `${alerts.length} alerts`,
+      attachments: alerts.map(alert => ({
         color: this.getSeverityColor(alert.severity),
         fields: [
           { title: 'Metric', value: alert.metric, short: true },
@@ -513,7 +679,7 @@ export class AlertManager {
         ],
         text: alert.message,
         ts: Math.floor(alert.timestamp.getTime() / 1000),
-      }],
+      })),
     };
 
     // Simulate Slack API call (in real implementation, use actual HTTP request)
@@ -522,29 +688,34 @@ export class AlertManager {
   }
 
   /**
-   * Deliver alert to email
+   * Deliver alerts as one email
    */
-  private async deliverToEmail(alert: Alert): Promise<boolean> {
+  private async deliverToEmail(alerts: Alert[]): Promise<boolean> {
     const config = this.channelConfig.email;
     if (!config) {
       throw new Error('Email configuration not found');
     }
 
+    const first = alerts[0]!;
+    const subject = alerts.length === 1
+      ? `[${first.severity.toUpperCase()}] ${first.title}`
+      : `[${first.severity.toUpperCase()}] ${alerts.length} alerts`;
+
     // Simulate email sending (in real implementation, use nodemailer or similar)
     console.log('📧 Email alert:', {
       from: config.from,
       to: config.to,
-      subject: `[${alert.severity.toUpperCase()}] ${alert.title}`,
-      text: alert.message,
+      subject,
+      text: alerts.map(alert => `${alert.title}\n${alert.message}`).join('\n\n'),
     });
 
     return true; // Assume success for simulation
   }
 
   /**
-   * Deliver alert to webhook
+   * Deliver alerts to webhook in one request
    */
-  private async deliverToWebhook(alert: Alert): Promise<boolean> {
+  private async deliverToWebhook(alerts: Alert[]): Promise<boolean> {
     const config = this.channelConfig.webhook;
     if (!config) {
       throw new Error('Webhook configuration not found');
@@ -553,7 +724,7 @@ export class AlertManager {
     // Simulate webhook call (in real implementation, use fetch or axios)
     console.log('🔗 Webhook alert:', {
       url: config.url,
-      alert,
+      alerts,
     });
 
     return true; // Assume success for simulation
@@ -658,21 +829,46 @@ export class AlertManager {
   private updateDeliveryStats(
     channel: AlertChannel,
     success: boolean,
-    responseTime: number
+    responseTime: number,
+    count = 1
   ): void {
     const stats = this.deliveryStats.get(channel);
     if (!stats) return;
 
     const newStats = {
-      sent: stats.sent + 1,
-      succeeded: stats.succeeded + (success ? 1 : 0),
-      failed: stats.failed + (success ? 0 : 1),
-      averageResponseTime: (stats.averageResponseTime * stats.sent + responseTime) / (stats.sent + 1),
+      sent: stats.sent + count,
+      succeeded: stats.succeeded + (success ? count : 0),
+      failed: stats.failed + (success ? 0 : count),
+      averageResponseTime: (stats.averageResponseTime * stats.sent + responseTime * count) / (stats.sent + count),
     };
 
     this.deliveryStats.set(channel, newStats);
   }
 
+  /**
+   * Alerts of the same rule for the same model share a fingerprint
+   */
+  private fingerprint(configId: string, modelId?: string): string {
+    return `${configId}|${modelId ?? 'system'}`;
+  }
+
+  private indexRule(config: AlertConfig): void {
+    let rules = this.rulesByMetric.get(config.condition.metric);
+    if (!rules) {
+      rules = new Set();
+      this.rulesByMetric.set(config.condition.metric, rules);
+    }
+    rules.add(config.id);
+  }
+
+  private unindexRule(config: AlertConfig): void {
+    const rules = this.rulesByMetric.get(config.condition.metric);
+    rules?.delete(config.id);
+    if (rules && rules.size === 0) {
+      this.rulesByMetric.delete(config.condition.metric);
+    }
+  }
+
   /**
    * Get default alert template
    */
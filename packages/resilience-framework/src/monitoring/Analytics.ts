@@ -8,6 +8,14 @@
 
 import { MetricDataPoint, SystemMetrics, ModelMetrics } from './MetricsCollector.js';
 import { Alert } from './AlertManager.js';
+import {
+  QuantileSketch,
+  QuantileSketchConfig,
+  WindowedQuantileSketch,
+  DEFAULT_QUANTILE_SKETCH_CONFIG,
+} from './QuantileSketch.js';
+import { MetricRollup, RollupBucket, RollupConfig, RollupTier, DEFAULT_ROLLUP_CONFIG } from './MetricRollup.js';
+import { OnlineForecaster, OnlineForecastConfig, DEFAULT_ONLINE_FORECAST_CONFIG } from './OnlineForecaster.js';
 
 /**
  * Time period for analytics
@@ -130,28 +138,70 @@ export interface CapacityRecommendation {
   readonly implementationEffort: 'low' | 'medium' | 'high';
 }
 
+/**
+ * Analytics engine configuration
+ */
+export interface AnalyticsConfig {
+  readonly sketch: QuantileSketchConfig;
+  readonly windowBuckets: number; // sub-window sketches per analytics period
+  readonly rollup: RollupConfig;
+  readonly forecast: OnlineForecastConfig;
+  readonly maxAnomaliesPerMetric: number; // most recent online anomalies kept
+}
+
+/**
+ * Default analytics configuration
+ */
+export const DEFAULT_ANALYTICS_CONFIG: AnalyticsConfig = {
+  sketch: DEFAULT_QUANTILE_SKETCH_CONFIG,
+  windowBuckets: 12,
+  rollup: DEFAULT_ROLLUP_CONFIG,
+  forecast: DEFAULT_ONLINE_FORECAST_CONFIG,
+  maxAnomaliesPerMetric: 100,
+};
+
+/**
+ * One windowed sketch per analytics period
+ */
+type PeriodSketches = Map<AnalyticsPeriod, WindowedQuantileSketch>;
+
+const ANALYTICS_PERIODS: readonly AnalyticsPeriod[] = ['hour', 'day', 'week', 'month'];
+
 /**
  * Comprehensive performance analytics engine
  */
 export class Analytics {
   private readonly dataRetentionPeriod = 30 * 24 * 60 * 60 * 1000; // 30 days
-  private historicalData = new Map<string, MetricDataPoint[]>();
+  private metricRollups = new Map<string, MetricRollup>();
   private systemMetricsHistory: SystemMetrics[] = [];
   private modelMetricsHistory = new Map<string, ModelMetrics[]>();
   private alertHistory: Alert[] = [];
 
+  // Streaming quantile sketches, fed on ingestion
+  private metricSketches = new Map<string, PeriodSketches>();
+  private modelResponseTimeSketches = new Map<string, PeriodSketches>();
+  private modelSuccessRateSketches = new Map<string, PeriodSketches>();
+
+  // Online Holt state and the anomalies it flagged, updated per point
+  private forecasters = new Map<string, OnlineForecaster>();
+  private metricAnomalies = new Map<string, AnomalyDetection[]>();
+
+  constructor(private readonly config: AnalyticsConfig = DEFAULT_ANALYTICS_CONFIG) {}
+
   /**
    * Add metric data point for analysis
    */
   addMetricData(metric: string, dataPoint: MetricDataPoint): void {
-    let series = this.historicalData.get(metric);
-    if (!series) {
-      series = [];
-      this.historicalData.set(metric, series);
+    let rollup = this.metricRollups.get(metric);
+    if (!rollup) {
+      rollup = new MetricRollup(this.config.rollup);
+      this.metricRollups.set(metric, rollup);
     }
 
-    series.push(dataPoint);
-    this.cleanupOldData(metric);
+    rollup.add(dataPoint.timestamp.getTime(), dataPoint.value, dataPoint.metadata);
+
+    this.recordSketchValue(this.metricSketches, metric, dataPoint.timestamp, dataPoint.value);
+    this.updateForecaster(metric, dataPoint);
   }
 
   /**
@@ -174,6 +224,13 @@ export class Analytics {
 
     history.push(metrics);
     this.cleanupModelMetricsHistory(modelId);
+
+    this.recordSketchValue(
+      this.modelResponseTimeSketches, modelId, metrics.timestamp, metrics.averageResponseTime
+    );
+    this.recordSketchValue(
+      this.modelSuccessRateSketches, modelId, metrics.timestamp, metrics.successRate
+    );
   }
 
   /**
@@ -227,16 +284,13 @@ export class Analytics {
    */
   analyzeTrends(period: AnalyticsPeriod): TrendAnalysis[] {
     const trends: TrendAnalysis[] = [];
-    const timeRange = this.getTimeRange(period);
 
-    for (const [metric, data] of this.historicalData) {
-      const filteredData = data.filter(point =>
-        point.timestamp >= timeRange.start && point.timestamp <= timeRange.end
-      );
+    for (const metric of this.metricRollups.keys()) {
+      const series = this.getRollupSeries(metric, period);
 
-      if (filteredData.length < 5) continue; // Need minimum data points
+      if (series.length < 5) continue; // Need minimum data points
 
-      const trend = this.calculateTrend(metric, filteredData, period);
+      const trend = this.calculateTrend(metric, series, period);
       trends.push(trend);
     }
 
@@ -244,21 +298,18 @@ export class Analytics {
   }
 
   /**
-   * Detect anomalies in metrics
+   * Anomalies flagged online since the start of the period
    */
   detectAnomalies(period: AnalyticsPeriod): AnomalyDetection[] {
     const anomalies: AnomalyDetection[] = [];
-    const timeRange = this.getTimeRange(period);
-
-    for (const [metric, data] of this.historicalData) {
-      const filteredData = data.filter(point =>
-        point.timestamp >= timeRange.start && point.timestamp <= timeRange.end
-      );
+    const start = this.getTimeRange(period).start;
 
-      if (filteredData.length < 15) continue; // Need sufficient data for anomaly detection
-
-      const detected = this.detectMetricAnomalies(metric, filteredData);
-      anomalies.push(...detected);
+    for (const detected of this.metricAnomalies.values()) {
+      for (const anomaly of detected) {
+        if (anomaly.timestamp >= start) {
+          anomalies.push(anomaly);
+        }
+      }
     }
 
     return anomalies.sort((a, b) => b.deviationScore - a.deviationScore);
@@ -330,45 +381,35 @@ export class Analytics {
    * Forecast future metrics
    */
   generateForecast(metric: string, hoursAhead: number): ForecastPrediction | null {
-    const data = this.historicalData.get(metric);
-    if (!data || data.length < 50) {
+    const forecaster = this.forecasters.get(metric);
+    if (!forecaster || !forecaster.ready) {
       return null; // Need sufficient historical data
     }
 
-    // Use simple linear regression for prediction
-    const recentData = data.slice(-100); // Use last 100 data points
-    const { slope, intercept } = this.calculateLinearRegression(recentData);
-
+    // Read the online Holt state; no historical points are revisited
     const predictions: ForecastPrediction['predictions'] = [];
-    const now = new Date();
+    const now = Date.now();
     const hourMs = 60 * 60 * 1000;
 
     for (let i = 1; i <= hoursAhead; i++) {
-      const futureTime = new Date(now.getTime() + (i * hourMs));
-      const timeIndex = recentData.length + i;
-      const predictedValue = slope * timeIndex + intercept;
-
-      // Simple confidence interval (±20% for demonstration)
-      const confidenceRange = Math.abs(predictedValue) * 0.2;
+      const futureTime = now + (i * hourMs);
+      const forecast = forecaster.forecastAt(futureTime);
 
       predictions.push({
-        timestamp: futureTime,
-        predictedValue,
+        timestamp: new Date(futureTime),
+        predictedValue: forecast.value,
         confidenceInterval: {
-          lower: predictedValue - confidenceRange,
-          upper: predictedValue + confidenceRange,
+          lower: forecast.lower,
+          upper: forecast.upper,
         },
       });
     }
 
-    // Calculate historical accuracy (simplified)
-    const accuracy = Math.max(0, 100 - (Math.abs(slope) * 10)); // Rough accuracy estimation
-
     return {
       metric,
       timeHorizon: hoursAhead,
       predictions,
-      accuracy,
+      accuracy: forecaster.accuracy,
     };
   }
 
@@ -409,11 +450,51 @@ export class Analytics {
     };
   }
 
+  /**
+   * Statistical summary of a metric over a period, answered from its
+   * streaming sketch without touching raw data points
+   */
+  getMetricStatistics(metric: string, period: AnalyticsPeriod): StatisticalSummary {
+    return this.summarizeSketch(this.querySketch(this.metricSketches, metric, period));
+  }
+
+  /**
+   * Response time summary for a model over a period
+   */
+  getModelStatistics(modelId: string, period: AnalyticsPeriod): StatisticalSummary {
+    return this.summarizeSketch(this.querySketch(this.modelResponseTimeSketches, modelId, period));
+  }
+
+  /**
+   * Metric series over a period, read from the finest rollup tier that
+   * covers it (raw for an hour, 1m buckets for a day, 1h beyond that)
+   */
+  getRollupSeries(metric: string, period: AnalyticsPeriod): MetricDataPoint[] {
+    const rollup = this.metricRollups.get(metric);
+    if (!rollup) return [];
+
+    const duration = this.getPeriodDuration(period);
+    const now = Date.now();
+    return rollup.series(rollup.tierFor(duration, now), now - duration, Number.POSITIVE_INFINITY);
+  }
+
+  /**
+   * Aggregated buckets of a coarse tier within a time range
+   */
+  getRollupBuckets(
+    metric: string,
+    tier: Exclude<RollupTier, 'raw'>,
+    start: Date,
+    end: Date = new Date()
+  ): RollupBucket[] {
+    return this.metricRollups.get(metric)?.buckets(tier, start.getTime(), end.getTime()) ?? [];
+  }
+
   /**
    * Get available metrics for analysis
    */
   getAvailableMetrics(): string[] {
-    return Array.from(this.historicalData.keys()).sort();
+    return Array.from(this.metricRollups.keys()).sort();
   }
 
   /**
@@ -421,36 +502,33 @@ export class Analytics {
    */
   getDataRetentionStatus(): {
     totalMetrics: number;
-    totalDataPoints: number;
+    totalDataPoints: number; // raw points
     oldestDataPoint: Date | null;
     newestDataPoint: Date | null;
+    tiers: Record<RollupTier, number>; // raw points or non-empty buckets per tier
   } {
-    let totalDataPoints = 0;
+    const tiers: Record<RollupTier, number> = { raw: 0, '1m': 0, '1h': 0, '1d': 0 };
     let oldest: Date | null = null;
     let newest: Date | null = null;
 
-    for (const data of this.historicalData.values()) {
-      totalDataPoints += data.length;
+    for (const rollup of this.metricRollups.values()) {
+      const status = rollup.retentionStatus();
 
-      if (data.length > 0) {
-        const firstPoint = data[0];
-        const lastPoint = data[data.length - 1];
+      for (const tier of Object.keys(tiers) as RollupTier[]) {
+        const { size, oldest: first, newest: last } = status[tier];
+        tiers[tier] += size;
 
-        if (firstPoint && lastPoint) {
-          const first = firstPoint.timestamp;
-          const last = lastPoint.timestamp;
-
-          if (!oldest || first < oldest) oldest = first;
-          if (!newest || last > newest) newest = last;
-        }
+        if (first && (!oldest || first < oldest)) oldest = first;
+        if (last && (!newest || last > newest)) newest = last;
       }
     }
 
     return {
-      totalMetrics: this.historicalData.size,
-      totalDataPoints,
+      totalMetrics: this.metricRollups.size,
+      totalDataPoints: tiers.raw,
       oldestDataPoint: oldest,
       newestDataPoint: newest,
+      tiers,
     };
   }
 
@@ -458,10 +536,15 @@ export class Analytics {
    * Clear all analytics data
    */
   clearData(): void {
-    this.historicalData.clear();
+    this.metricRollups.clear();
     this.systemMetricsHistory = [];
     this.modelMetricsHistory.clear();
     this.alertHistory = [];
+    this.metricSketches.clear();
+    this.modelResponseTimeSketches.clear();
+    this.modelSuccessRateSketches.clear();
+    this.forecasters.clear();
+    this.metricAnomalies.clear();
     console.log('📊 Analytics data cleared');
   }
 
@@ -471,6 +554,14 @@ export class Analytics {
 
   private getTimeRange(period: AnalyticsPeriod): { start: Date; end: Date } {
     const now = new Date();
+
+    return {
+      start: new Date(now.getTime() - this.getPeriodDuration(period)),
+      end: now,
+    };
+  }
+
+  private getPeriodDuration(period: AnalyticsPeriod): number {
     let hoursBack: number;
 
     switch (period) {
@@ -480,10 +571,7 @@ export class Analytics {
       case 'month': hoursBack = 24 * 30; break;
     }
 
-    return {
-      start: new Date(now.getTime() - (hoursBack * 60 * 60 * 1000)),
-      end: now,
-    };
+    return hoursBack * 60 * 60 * 1000;
   }
 
   private getSystemMetricsInRange(start: Date, end: Date): SystemMetrics[] {
@@ -550,13 +638,14 @@ export class Analytics {
     }
 
     const responseTimes = filteredHistory.map(m => m.averageResponseTime);
-    const summary = this.calculateStatistics(responseTimes);
+    const summary = this.getModelStatistics(modelId, period);
 
     const successRates = filteredHistory.map(m => m.successRate);
-    const avgSuccessRate = successRates.reduce((sum, rate) => sum + rate, 0) / successRates.length;
+    const successRateSketch = this.querySketch(this.modelSuccessRateSketches, modelId, period);
+    const avgSuccessRate = successRateSketch.mean;
 
     const availability = avgSuccessRate; // Simplified
-    const reliability = this.calculateReliability(filteredHistory);
+    const reliability = this.calculateReliability(successRateSketch);
     const performance = this.calculatePerformanceScore(summary, avgSuccessRate, reliability);
 
     return {
@@ -609,37 +698,41 @@ export class Analytics {
     };
   }
 
-  private detectMetricAnomalies(metric: string, data: MetricDataPoint[]): AnomalyDetection[] {
-    const anomalies: AnomalyDetection[] = [];
-    const values = data.map(d => d.value);
-    const stats = this.calculateStatistics(values);
-
-    // Use Z-score for anomaly detection
-    for (let i = 0; i < data.length; i++) {
-      const point = data[i];
-      if (!point) continue;
-
-      const zScore = Math.abs((point.value - stats.mean) / stats.standardDeviation);
-
-      if (zScore > 2.5) { // 2.5 standard deviations
-        let severity: AnomalyDetection['severity'];
-        if (zScore > 4) severity = 'high';
-        else if (zScore > 3) severity = 'medium';
-        else severity = 'low';
-
-        anomalies.push({
-          timestamp: point.timestamp,
-          metric,
-          value: point.value,
-          expectedValue: stats.mean,
-          deviationScore: zScore,
-          severity,
-          description: `Value ${point.value.toFixed(2)} deviates ${zScore.toFixed(1)} standard deviations from mean ${stats.mean.toFixed(2)}`,
-        });
-      }
+  private updateForecaster(metric: string, dataPoint: MetricDataPoint): void {
+    let forecaster = this.forecasters.get(metric);
+    if (!forecaster) {
+      forecaster = new OnlineForecaster(this.config.forecast);
+      this.forecasters.set(metric, forecaster);
     }
 
-    return anomalies;
+    const residual = forecaster.update(dataPoint.timestamp.getTime(), dataPoint.value);
+    if (!residual || !residual.anomalous) return;
+
+    const { zScore, expected } = residual;
+    let severity: AnomalyDetection['severity'];
+    if (zScore > 4) severity = 'high';
+    else if (zScore > 3) severity = 'medium';
+    else severity = 'low';
+
+    let anomalies = this.metricAnomalies.get(metric);
+    if (!anomalies) {
+      anomalies = [];
+      this.metricAnomalies.set(metric, anomalies);
+    }
+
+    anomalies.push({
+      timestamp: dataPoint.timestamp,
+      metric,
+      value: dataPoint.value,
+      expectedValue: expected,
+      deviationScore: zScore,
+      severity,
+      description: `Value ${dataPoint.value.toFixed(2)} deviates ${zScore.toFixed(1)} standard deviations from forecast ${expected.toFixed(2)}`,
+    });
+
+    if (anomalies.length > this.config.maxAnomaliesPerMetric) {
+      anomalies.shift();
+    }
   }
 
   private generateRecommendations(
@@ -739,13 +832,59 @@ export class Analytics {
     return lowerValue * (1 - weight) + upperValue * weight;
   }
 
-  private calculateReliability(history: ModelMetrics[]): number {
+  private calculateReliability(successRates: QuantileSketch): number {
     // Simple reliability calculation based on consistent performance
-    const successRates = history.map(m => m.successRate);
-    const variance = this.calculateStatistics(successRates).standardDeviation;
+    const variance = successRates.standardDeviation;
     return Math.max(0, 1 - variance); // Lower variance = higher reliability
   }
 
+  private recordSketchValue(
+    sketches: Map<string, PeriodSketches>,
+    key: string,
+    timestamp: Date,
+    value: number
+  ): void {
+    let periods = sketches.get(key);
+    if (!periods) {
+      periods = new Map();
+      for (const period of ANALYTICS_PERIODS) {
+        periods.set(period, new WindowedQuantileSketch(
+          this.getPeriodDuration(period),
+          this.config.windowBuckets,
+          this.config.sketch
+        ));
+      }
+      sketches.set(key, periods);
+    }
+
+    const time = timestamp.getTime();
+    for (const sketch of periods.values()) {
+      sketch.add(time, value);
+    }
+  }
+
+  private querySketch(
+    sketches: Map<string, PeriodSketches>,
+    key: string,
+    period: AnalyticsPeriod
+  ): QuantileSketch {
+    const sketch = sketches.get(key)?.get(period);
+    return sketch ? sketch.query() : new QuantileSketch(this.config.sketch);
+  }
+
+  private summarizeSketch(sketch: QuantileSketch): StatisticalSummary {
+    return {
+      count: sketch.count,
+      min: sketch.min,
+      max: sketch.max,
+      mean: sketch.mean,
+      median: sketch.quantile(0.5),
+      p95: sketch.quantile(0.95),
+      p99: sketch.quantile(0.99),
+      standardDeviation: sketch.standardDeviation,
+    };
+  }
+
   private calculatePerformanceScore(
     summary: StatisticalSummary,
     successRate: number,
@@ -799,18 +938,6 @@ export class Analytics {
     };
   }
 
-  private cleanupOldData(metric: string): void {
-    const data = this.historicalData.get(metric);
-    if (!data) return;
-
-    const cutoffTime = new Date(Date.now() - this.dataRetentionPeriod);
-    const filtered = data.filter(point => point.timestamp >= cutoffTime);
-
-    if (filtered.length !== data.length) {
-      this.historicalData.set(metric, filtered);
-    }
-  }
-
   private cleanupSystemMetricsHistory(): void {
     const cutoffTime = new Date(Date.now() - this.dataRetentionPeriod);
     this.systemMetricsHistory = this.systemMetricsHistory.filter(
@@ -8,6 +8,15 @@
 
 import { SystemMetrics, ModelMetrics, MetricDataPoint } from './MetricsCollector.js';
 import { Alert, AlertSeverity } from './AlertManager.js';
+import { TimerWheelScheduler, ScheduledTaskHandle } from '../core/TimerWheelScheduler.js';
+import {
+  DashboardStream,
+  DashboardDelta,
+  DashboardDeltaHandler,
+  DashboardSubscription,
+  DashboardSubscriptionOptions,
+  SeriesEncoding,
+} from './DashboardStream.js';
 
 /**
  * Dashboard widget types
@@ -187,8 +196,9 @@ export class Dashboard {
   private layouts = new Map<string, DashboardLayout>();
   private currentLayout?: DashboardLayout;
   private currentSnapshot?: DashboardSnapshot;
-  private updateTimer?: NodeJS.Timeout;
+  private updateTimer?: ScheduledTaskHandle;
   private listeners = new Set<DashboardListener>();
+  private readonly stream = new DashboardStream();
   private isActive = false;
 
   // Data sources
@@ -197,7 +207,7 @@ export class Dashboard {
   private timeSeriesData = new Map<string, MetricDataPoint[]>();
   private activeAlerts: Alert[] = [];
 
-  constructor() {
+  constructor(private readonly scheduler: TimerWheelScheduler = TimerWheelScheduler.shared()) {
     this.initializeDefaultLayouts();
   }
 
@@ -226,6 +236,7 @@ export class Dashboard {
     }
 
     this.currentLayout = layout;
+    this.stream.reset();
     console.log(`📊 Dashboard layout activated: ${layout.name}`);
 
     if (this.isActive) {
@@ -271,7 +282,7 @@ export class Dashboard {
     this.isActive = false;
 
     if (this.updateTimer) {
-      clearTimeout(this.updateTimer);
+      this.updateTimer.cancel();
       this.updateTimer = undefined as any;
     }
 
@@ -352,6 +363,28 @@ export class Dashboard {
     }
   }
 
+  /**
+   * Export the changes since a cursor returned by a previous call (0 for everything)
+   */
+  exportDelta(cursor = 0): string {
+    return JSON.stringify(this.stream.getDelta(cursor));
+  }
+
+  /**
+   * Get the changes since a cursor without serializing them
+   */
+  getDelta(cursor = 0, encoding: SeriesEncoding = 'objects'): DashboardDelta {
+    return this.stream.getDelta(cursor, encoding);
+  }
+
+  /**
+   * Subscribe to per-widget deltas. The first frame carries full state; a
+   * handler that returns a promise receives one merged frame once it settles.
+   */
+  subscribe(handler: DashboardDeltaHandler, options?: DashboardSubscriptionOptions): DashboardSubscription {
+    return this.stream.subscribe(handler, options);
+  }
+
   /**
    * Add dashboard listener
    */
@@ -416,6 +449,7 @@ export class Dashboard {
       };
 
       this.currentSnapshot = snapshot;
+      this.stream.publish(snapshot);
 
       // Notify listeners
       this.listeners.forEach(listener => {
@@ -622,13 +656,13 @@ export class Dashboard {
    */
   private scheduleUpdate(): void {
     if (this.updateTimer) {
-      clearTimeout(this.updateTimer);
+      this.updateTimer.cancel();
     }
 
     if (this.isActive && this.currentLayout) {
-      this.updateTimer = setTimeout(
+      this.updateTimer = this.scheduler.schedule(
         () => this.updateDashboard(),
-        this.currentLayout.refreshInterval
+        { name: 'dashboard-refresh', intervalMs: this.currentLayout.refreshInterval }
       );
     }
   }
@@ -0,0 +1,606 @@
+/**
+ * Dashboard Delta Stream
+ * BIP-03 Implementation - Phase 3: Monitoring & Alerting
+ *
+ * Version-stamps dashboard state as snapshots are published so consumers
+ * only receive what changed since their cursor: replaced scalar widgets,
+ * changed model-grid rows and chart points appended since the last frame.
+ * Chart metadata (axes, series color and style) travels with every frame
+ * that resends a chart in full, which includes any frame after it changed.
+ * Push subscribers get at most one frame in flight; updates that arrive
+ * while a frame is being delivered are conflated into the next one.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+import type {
+  DashboardSnapshot,
+  ChartWidget,
+  ChartAxis,
+  ChartSeries,
+  ModelGridWidget,
+  MetricWidget,
+  StatusWidget,
+  AlertWidget,
+  PerformanceSummaryWidget,
+  TimeRange,
+} from './Dashboard.js';
+
+type WidgetData =
+  | MetricWidget
+  | ChartWidget
+  | StatusWidget
+  | AlertWidget
+  | ModelGridWidget
+  | PerformanceSummaryWidget;
+
+type ModelRow = ModelGridWidget['models'][number];
+
+/**
+ * Time-series point encoding for chart deltas
+ */
+export type SeriesEncoding = 'objects' | 'columnar';
+
+/**
+ * Points appended to one chart series
+ */
+export type SeriesDelta =
+  | {
+      readonly name: string;
+      readonly color?: string;
+      readonly style?: ChartSeries['style'];
+      readonly trimBefore: number; // clients drop points older than this (ms)
+      readonly points: Array<{ x: number; y: number; label?: string }>;
+    }
+  | {
+      readonly name: string;
+      readonly color?: string;
+      readonly style?: ChartSeries['style'];
+      readonly trimBefore: number;
+      readonly timestamps: Float64Array;
+      readonly values: Float64Array;
+      readonly labels?: Array<string | null>; // present when any point carries a label
+    };
+
+/**
+ * Change to a single widget
+ */
+export type WidgetDelta =
+  | { readonly widgetId: string; readonly kind: 'replace'; readonly data: WidgetData }
+  | { readonly widgetId: string; readonly kind: 'rows'; readonly upserts: ModelRow[]; readonly removed: string[] }
+  | {
+      readonly widgetId: string;
+      readonly kind: 'points';
+      readonly chartType: ChartWidget['chartType'];
+      readonly timeRange: TimeRange;
+      readonly xAxis?: ChartAxis;
+      readonly yAxis?: ChartAxis;
+      readonly full: boolean; // every series is complete; drop series not listed
+      readonly series: SeriesDelta[];
+      readonly removed: string[]; // series names removed since the cursor
+    };
+
+/**
+ * Changes since a cursor
+ */
+export interface DashboardDelta {
+  readonly cursor: number; // pass back to receive the next delta
+  readonly full: boolean; // the frame carries complete state; discard local state first
+  readonly timestamp: Date;
+  readonly widgets: WidgetDelta[];
+}
+
+/**
+ * Push subscription options
+ */
+export interface DashboardSubscriptionOptions {
+  readonly cursor?: number; // resume from a previous frame
+  readonly encoding?: SeriesEncoding;
+  readonly onError?: (error: Error) => void;
+}
+
+/**
+ * Handle returned by subscribe()
+ */
+export interface DashboardSubscription {
+  readonly id: number;
+  readonly cursor: number;
+  readonly deliveredFrames: number;
+  readonly conflatedFrames: number; // publishes merged because a frame was in flight
+  unsubscribe(): void;
+}
+
+/**
+ * Frame handler; returning a promise holds back the next frame until it settles
+ */
+export type DashboardDeltaHandler = (delta: DashboardDelta) => void | Promise<void>;
+
+interface Subscriber {
+  readonly id: number;
+  readonly handler: DashboardDeltaHandler;
+  readonly encoding: SeriesEncoding;
+  readonly onError: ((error: Error) => void) | undefined;
+  cursor: number;
+  inFlight: boolean;
+  pending: boolean;
+  active: boolean;
+  deliveredFrames: number;
+  conflatedFrames: number;
+}
+
+interface SeriesState {
+  // (seq, last x) pairs, appended when the series grows
+  history: Array<{ seq: number; lastX: number }>;
+}
+
+interface WidgetState {
+  version: number;
+  data: WidgetData;
+  rows?: Map<string, { version: number; row: ModelRow }>;
+  removedRows?: Map<string, number>;
+  series?: Map<string, SeriesState>;
+  removedSeries?: Map<string, number>;
+}
+
+/**
+ * Default number of publishes a cursor stays resumable for
+ */
+export const DEFAULT_DASHBOARD_HISTORY_LIMIT = 1024;
+
+/**
+ * Versioned dashboard state and push subscriptions
+ */
+export class DashboardStream {
+  private seq = 0;
+  private baseSeq = 0; // cursors at or below this need a full frame
+  private latest?: DashboardSnapshot;
+  private widgets = new Map<string, WidgetState>();
+  private readonly subscribers = new Map<number, Subscriber>();
+  private nextSubscriberId = 1;
+
+  constructor(private readonly historyLimit: number = DEFAULT_DASHBOARD_HISTORY_LIMIT) {}
+
+  /**
+   * Cursor of the latest published snapshot
+   */
+  get cursor(): number {
+    return this.seq;
+  }
+
+  /**
+   * Record a new snapshot and push deltas to subscribers
+   */
+  publish(snapshot: DashboardSnapshot): void {
+    this.seq++;
+    this.latest = snapshot;
+
+    for (const [widgetId, data] of snapshot.widgets) {
+      this.stamp(widgetId, data);
+    }
+
+    for (const widgetId of Array.from(this.widgets.keys())) {
+      if (!snapshot.widgets.has(widgetId)) {
+        // Widget set changed (layout switch): everyone resyncs
+        this.widgets.delete(widgetId);
+        this.baseSeq = this.seq - 1;
+      }
+    }
+
+    this.trimHistory();
+
+    for (const subscriber of this.subscribers.values()) {
+      this.deliver(subscriber);
+    }
+  }
+
+  /**
+   * Forget all versions; every cursor gets a full frame next
+   */
+  reset(): void {
+    this.widgets.clear();
+    this.baseSeq = this.seq;
+  }
+
+  /**
+   * Build the delta between a cursor and the latest snapshot
+   */
+  getDelta(cursor = 0, encoding: SeriesEncoding = 'objects'): DashboardDelta {
+    const full = cursor <= this.baseSeq || cursor > this.seq || cursor < this.seq - this.historyLimit;
+    const since = full ? 0 : cursor;
+    const widgets: WidgetDelta[] = [];
+
+    for (const [widgetId, state] of this.widgets) {
+      const delta = this.widgetDelta(widgetId, state, since, full, encoding);
+      if (delta) widgets.push(delta);
+    }
+
+    return {
+      cursor: this.seq,
+      full,
+      timestamp: this.latest?.timestamp ?? new Date(),
+      widgets,
+    };
+  }
+
+  /**
+   * Push deltas to a handler as snapshots are published
+   */
+  subscribe(handler: DashboardDeltaHandler, options: DashboardSubscriptionOptions = {}): DashboardSubscription {
+    const subscriber: Subscriber = {
+      id: this.nextSubscriberId++,
+      handler,
+      encoding: options.encoding ?? 'objects',
+      onError: options.onError,
+      cursor: options.cursor ?? 0,
+      inFlight: false,
+      pending: false,
+      active: true,
+      deliveredFrames: 0,
+      conflatedFrames: 0,
+    };
+    this.subscribers.set(subscriber.id, subscriber);
+
+    if (this.latest) {
+      this.deliver(subscriber);
+    }
+
+    const subscribers = this.subscribers;
+    return {
+      id: subscriber.id,
+      get cursor() { return subscriber.cursor; },
+      get deliveredFrames() { return subscriber.deliveredFrames; },
+      get conflatedFrames() { return subscriber.conflatedFrames; },
+      unsubscribe: () => {
+        subscriber.active = false;
+        subscribers.delete(subscriber.id);
+      },
+    };
+  }
+
+  /**
+   * Number of push subscribers
+   */
+  get subscriberCount(): number {
+    return this.subscribers.size;
+  }
+
+  private deliver(subscriber: Subscriber): void {
+    if (!subscriber.active) return;
+
+    if (subscriber.inFlight) {
+      if (subscriber.pending) subscriber.conflatedFrames++;
+      subscriber.pending = true;
+      return;
+    }
+
+    const delta = this.getDelta(subscriber.cursor, subscriber.encoding);
+    if (!delta.full && delta.widgets.length === 0) {
+      subscriber.cursor = delta.cursor;
+      return;
+    }
+
+    subscriber.inFlight = true;
+    subscriber.pending = false;
+
+    const settle = (error?: unknown): void => {
+      subscriber.inFlight = false;
+      if (error === undefined) {
+        subscriber.cursor = delta.cursor;
+        subscriber.deliveredFrames++;
+      } else {
+        const err = error instanceof Error ? error : new Error(String(error));
+        console.error('📊 Dashboard subscriber error:', err);
+        subscriber.onError?.(err);
+      }
+      if (subscriber.pending) {
+        this.deliver(subscriber);
+      }
+    };
+
+    try {
+      const result = subscriber.handler(delta);
+      if (result && typeof (result as Promise<void>).then === 'function') {
+        (result as Promise<void>).then(() => settle(), error => settle(error ?? new Error('Subscriber failed')));
+      } else {
+        settle();
+      }
+    } catch (error) {
+      settle(error ?? new Error('Subscriber failed'));
+    }
+  }
+
+  private stamp(widgetId: string, data: WidgetData): void {
+    let state = this.widgets.get(widgetId);
+    const isNew = !state || state.data.type !== data.type;
+
+    if (isNew) {
+      state = { version: this.seq, data };
+      this.widgets.set(widgetId, state);
+    }
+
+    const current = state!;
+
+    if (data.type === 'model-grid') {
+      this.stampRows(current, data, isNew);
+    } else if (data.type === 'chart') {
+      this.stampSeries(current, data, isNew);
+    } else if (!isNew && !deepEqual(current.data, data)) {
+      current.version = this.seq;
+    }
+
+    current.data = data;
+  }
+
+  private stampRows(state: WidgetState, data: ModelGridWidget, isNew: boolean): void {
+    const rows = (isNew ? undefined : state.rows) ?? new Map<string, { version: number; row: ModelRow }>();
+    const removed = (isNew ? undefined : state.removedRows) ?? new Map<string, number>();
+    const seen = new Set<string>();
+
+    for (const row of data.models) {
+      seen.add(row.id);
+      const previous = rows.get(row.id);
+      if (!previous || !deepEqual(previous.row, row)) {
+        rows.set(row.id, { version: this.seq, row });
+        removed.delete(row.id);
+      } else {
+        previous.row = row;
+      }
+    }
+
+    for (const id of Array.from(rows.keys())) {
+      if (!seen.has(id)) {
+        rows.delete(id);
+        removed.set(id, this.seq);
+      }
+    }
+
+    state.rows = rows;
+    state.removedRows = removed;
+  }
+
+  private stampSeries(state: WidgetState, data: ChartWidget, isNew: boolean): void {
+    const series = (isNew ? undefined : state.series) ?? new Map<string, SeriesState>();
+    const removed = (isNew ? undefined : state.removedSeries) ?? new Map<string, number>();
+    const previous = state.data as ChartWidget;
+
+    // Metadata changes resend the chart in full
+    if (!isNew && !deepEqual(chartMetadata(previous), chartMetadata(data))) {
+      state.version = this.seq;
+    }
+
+    const previousSeries = new Map<string, ChartSeries>(isNew ? [] : previous.series.map(entry => [entry.name, entry] as const));
+    const seen = new Set<string>();
+    for (const entry of data.series) {
+      seen.add(entry.name);
+      removed.delete(entry.name);
+
+      const before = previousSeries.get(entry.name);
+      if (before && (before.color !== entry.color || before.style !== entry.style)) {
+        state.version = this.seq;
+      }
+
+      const lastPoint = entry.data[entry.data.length - 1];
+      const lastX = lastPoint ? toMillis(lastPoint.x) : Number.NEGATIVE_INFINITY;
+      let seriesState = series.get(entry.name);
+
+      if (!seriesState) {
+        seriesState = { history: [] };
+        series.set(entry.name, seriesState);
+      }
+
+      const top = seriesState.history[seriesState.history.length - 1];
+      if (!top || lastX > top.lastX) {
+        seriesState.history.push({ seq: this.seq, lastX });
+      }
+    }
+
+    for (const name of Array.from(series.keys())) {
+      if (!seen.has(name)) {
+        series.delete(name);
+        removed.set(name, this.seq);
+      }
+    }
+
+    state.series = series;
+    state.removedSeries = removed;
+  }
+
+  private widgetDelta(
+    widgetId: string,
+    state: WidgetState,
+    since: number,
+    full: boolean,
+    encoding: SeriesEncoding
+  ): WidgetDelta | undefined {
+    const data = state.data;
+
+    if (data.type === 'model-grid') {
+      const upserts: ModelRow[] = [];
+      const removed: string[] = [];
+
+      for (const { version, row } of state.rows!.values()) {
+        if (full || version > since) upserts.push(row);
+      }
+      if (!full) {
+        for (const [id, version] of state.removedRows!) {
+          if (version > since) removed.push(id);
+        }
+      }
+
+      if (!full && upserts.length === 0 && removed.length === 0) return undefined;
+      return { widgetId, kind: 'rows', upserts, removed };
+    }
+
+    if (data.type === 'chart') {
+      const series: SeriesDelta[] = [];
+      const removed: string[] = [];
+      const forceAll = full || state.version > since;
+
+      for (const entry of data.series) {
+        const seriesState = state.series!.get(entry.name);
+        const fromX = forceAll || !seriesState ? Number.NEGATIVE_INFINITY : lastXAt(seriesState, since);
+        const start = firstIndexAfter(entry.data, fromX);
+        if (!forceAll && start >= entry.data.length) continue;
+
+        series.push(encodeSeries(entry, start, data.timeRange, encoding));
+      }
+      if (!forceAll) {
+        for (const [name, version] of state.removedSeries!) {
+          if (version > since) removed.push(name);
+        }
+      }
+
+      if (!forceAll && series.length === 0 && removed.length === 0) return undefined;
+      return {
+        widgetId,
+        kind: 'points',
+        chartType: data.chartType,
+        timeRange: data.timeRange,
+        ...(forceAll && data.xAxis !== undefined ? { xAxis: data.xAxis } : {}),
+        ...(forceAll && data.yAxis !== undefined ? { yAxis: data.yAxis } : {}),
+        full: forceAll,
+        series,
+        removed,
+      };
+    }
+
+    if (!full && state.version <= since) return undefined;
+    return { widgetId, kind: 'replace', data };
+  }
+
+  private trimHistory(): void {
+    const horizon = this.seq - this.historyLimit;
+
+    for (const state of this.widgets.values()) {
+      state.removedRows?.forEach((version, id) => {
+        if (version < horizon) state.removedRows!.delete(id);
+      });
+      state.removedSeries?.forEach((version, name) => {
+        if (version < horizon) state.removedSeries!.delete(name);
+      });
+
+      state.series?.forEach(seriesState => {
+        // Keep the newest entry at or below the horizon as the baseline
+        const history = seriesState.history;
+        let drop = 0;
+        while (drop + 1 < history.length && history[drop + 1]!.seq <= horizon) drop++;
+        if (drop > 0) history.splice(0, drop);
+      });
+    }
+  }
+}
+
+function lastXAt(state: SeriesState, seq: number): number {
+  const history = state.history;
+  let lo = 0;
+  let hi = history.length - 1;
+  let result = Number.NEGATIVE_INFINITY;
+
+  while (lo <= hi) {
+    const mid = (lo + hi) >> 1;
+    if (history[mid]!.seq <= seq) {
+      result = history[mid]!.lastX;
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+
+  return result;
+}
+
+function firstIndexAfter(points: ChartWidget['series'][number]['data'], x: number): number {
+  let lo = 0;
+  let hi = points.length;
+
+  while (lo < hi) {
+    const mid = (lo + hi) >> 1;
+    if (toMillis(points[mid]!.x) <= x) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  return lo;
+}
+
+function encodeSeries(
+  entry: ChartWidget['series'][number],
+  start: number,
+  timeRange: TimeRange,
+  encoding: SeriesEncoding
+): SeriesDelta {
+  const base = {
+    name: entry.name,
+    ...(entry.color !== undefined ? { color: entry.color } : {}),
+    ...(entry.style !== undefined ? { style: entry.style } : {}),
+    trimBefore: timeRange.start.getTime(),
+  };
+
+  if (encoding === 'columnar') {
+    const length = entry.data.length - start;
+    const timestamps = new Float64Array(length);
+    const values = new Float64Array(length);
+    let labels: Array<string | null> | undefined;
+    for (let i = 0; i < length; i++) {
+      const point = entry.data[start + i]!;
+      timestamps[i] = toMillis(point.x);
+      values[i] = point.y;
+      if (point.label !== undefined) {
+        labels ??= new Array<string | null>(length).fill(null);
+        labels[i] = point.label;
+      }
+    }
+    return { ...base, timestamps, values, ...(labels ? { labels } : {}) };
+  }
+
+  const points: Array<{ x: number; y: number; label?: string }> = [];
+  for (let i = start; i < entry.data.length; i++) {
+    const point = entry.data[i]!;
+    points.push(point.label !== undefined
+      ? { x: toMillis(point.x), y: point.y, label: point.label }
+      : { x: toMillis(point.x), y: point.y });
+  }
+  return { ...base, points };
+}
+
+/**
+ * Chart-level settings sent with full chart frames
+ */
+function chartMetadata(chart: ChartWidget): unknown {
+  return { chartType: chart.chartType, xAxis: chart.xAxis, yAxis: chart.yAxis };
+}
+
+function toMillis(x: number | Date): number {
+  return x instanceof Date ? x.getTime() : x;
+}
+
+function deepEqual(a: unknown, b: unknown): boolean {
+  if (a === b) return true;
+  if (a instanceof Date && b instanceof Date) return a.getTime() === b.getTime();
+  if (typeof a !== 'object' || typeof b !== 'object' || a === null || b === null) {
+    return Number.isNaN(a) && Number.isNaN(b);
+  }
+  if (Array.isArray(a) !== Array.isArray(b)) return false;
+
+  if (Array.isArray(a)) {
+    const other = b as unknown[];
+    if (a.length !== other.length) return false;
+    for (let i = 0; i < a.length; i++) {
+      if (!deepEqual(a[i], other[i])) return false;
+    }
+    return true;
+  }
+
+  const recordA = a as Record<string, unknown>;
+  const recordB = b as Record<string, unknown>;
+  const keysA = Object.keys(recordA);
+  if (keysA.length !== Object.keys(recordB).length) return false;
+
+  for (const key of keysA) {
+    if (!deepEqual(recordA[key], recordB[key])) return false;
+  }
+  return true;
+}
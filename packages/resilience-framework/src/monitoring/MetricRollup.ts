@@ -0,0 +1,316 @@
+/**
+ * Multi-Resolution Metric Rollups
+ * BIP-03 Implementation - Phase 3: Monitoring & Alerting
+ *
+ * Tiered downsampling for a single metric: recent raw points plus 1-minute,
+ * 1-hour and 1-day buckets. Each coarse tier is a fixed ring of buckets
+ * indexed by epoch, so a sample touches one bucket per tier and memory stays
+ * flat however long the retention is.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+import type { MetricDataPoint } from './MetricsCollector.js';
+import { TimeSeriesBuffer } from './TimeSeriesBuffer.js';
+import { QuantileSketch, QuantileSketchConfig, DEFAULT_QUANTILE_SKETCH_CONFIG } from './QuantileSketch.js';
+
+/**
+ * Storage tiers, finest first
+ */
+export type RollupTier = 'raw' | '1m' | '1h' | '1d';
+
+export const ROLLUP_TIERS: readonly RollupTier[] = ['raw', '1m', '1h', '1d'];
+
+/**
+ * Bucket width of each coarse tier
+ */
+export const ROLLUP_TIER_WIDTH: Readonly<Record<Exclude<RollupTier, 'raw'>, number>> = {
+  '1m': 60 * 1000,
+  '1h': 60 * 60 * 1000,
+  '1d': 24 * 60 * 60 * 1000,
+};
+
+/**
+ * Rollup configuration
+ */
+export interface RollupConfig {
+  readonly rawCapacity: number; // max raw points kept per metric
+  readonly retention: Readonly<Record<RollupTier, number>>; // ms kept per tier
+  readonly maxQueryPoints: number; // upper bound on points a period query reads
+  readonly sketch: QuantileSketchConfig;
+}
+
+/**
+ * Default rollup configuration
+ */
+export const DEFAULT_ROLLUP_CONFIG: RollupConfig = {
+  rawCapacity: 10000,
+  retention: {
+    raw: 2 * 60 * 60 * 1000, // 2 hours
+    '1m': 25 * 60 * 60 * 1000, // 25 hours
+    '1h': 31 * 24 * 60 * 60 * 1000, // 31 days
+    '1d': 365 * 24 * 60 * 60 * 1000, // 1 year
+  },
+  maxQueryPoints: 1440,
+  sketch: DEFAULT_QUANTILE_SKETCH_CONFIG,
+};
+
+/**
+ * Aggregated bucket of a coarse tier
+ */
+export interface RollupBucket {
+  readonly start: Date;
+  readonly end: Date;
+  readonly count: number;
+  readonly sum: number;
+  readonly min: number;
+  readonly max: number;
+  readonly mean: number;
+  readonly sketch: QuantileSketch;
+}
+
+/**
+ * Mutable ring slot; `epoch` is the bucket index since the Unix epoch
+ */
+interface RollupSlot {
+  epoch: number;
+  count: number;
+  sum: number;
+  min: number;
+  max: number;
+  sketch: QuantileSketch | undefined; // allocated on first use
+}
+
+/**
+ * Ring of fixed-width buckets covering the tier's retention
+ */
+class RollupRing {
+  private readonly slots: RollupSlot[];
+
+  constructor(
+    readonly width: number,
+    retention: number,
+    private readonly sketchConfig: QuantileSketchConfig
+  ) {
+    const length = Math.max(1, Math.ceil(retention / width));
+    this.slots = Array.from({ length }, () => ({
+      epoch: Number.NEGATIVE_INFINITY,
+      count: 0,
+      sum: 0,
+      min: 0,
+      max: 0,
+      sketch: undefined,
+    }));
+  }
+
+  add(timestamp: number, value: number): void {
+    const epoch = Math.floor(timestamp / this.width);
+    const slot = this.slots[this.slotOf(epoch)];
+    if (!slot) return;
+
+    if (slot.epoch < epoch) {
+      slot.epoch = epoch;
+      slot.count = 0;
+      slot.sum = 0;
+      slot.min = value;
+      slot.max = value;
+      slot.sketch?.clear();
+    } else if (slot.epoch > epoch) {
+      return; // Older than the retention this slot now covers
+    }
+
+    slot.count++;
+    slot.sum += value;
+    if (value < slot.min) slot.min = value;
+    if (value > slot.max) slot.max = value;
+
+    if (!slot.sketch) {
+      slot.sketch = new QuantileSketch(this.sketchConfig);
+    }
+    slot.sketch.add(value);
+  }
+
+  /**
+   * Non-empty buckets overlapping [start, end], oldest first
+   */
+  bucketsBetween(start: number, end: number): RollupBucket[] {
+    return this.liveSlots(start, end).map(slot => this.toBucket(slot));
+  }
+
+  /**
+   * Bucket means over [start, end] without copying sketches
+   */
+  meansBetween(start: number, end: number, tier: RollupTier): MetricDataPoint[] {
+    return this.liveSlots(start, end).map(slot => ({
+      timestamp: new Date(slot.epoch * this.width),
+      value: slot.sum / slot.count,
+      metadata: { tier, count: slot.count, min: slot.min, max: slot.max },
+    }));
+  }
+
+  /**
+   * Number of non-empty buckets and the bounds they cover
+   */
+  extent(): { buckets: number; oldest: number | null; newest: number | null } {
+    let buckets = 0;
+    let oldestEpoch = Number.POSITIVE_INFINITY;
+    let newestEpoch = Number.NEGATIVE_INFINITY;
+
+    for (const slot of this.slots) {
+      if (slot.count === 0) continue;
+      buckets++;
+      if (slot.epoch < oldestEpoch) oldestEpoch = slot.epoch;
+      if (slot.epoch > newestEpoch) newestEpoch = slot.epoch;
+    }
+
+    return buckets === 0
+      ? { buckets, oldest: null, newest: null }
+      : { buckets, oldest: oldestEpoch * this.width, newest: (newestEpoch + 1) * this.width };
+  }
+
+  clear(): void {
+    for (const slot of this.slots) {
+      slot.epoch = Number.NEGATIVE_INFINITY;
+      slot.count = 0;
+      slot.sum = 0;
+      slot.sketch?.clear();
+    }
+  }
+
+  private liveSlots(start: number, end: number): RollupSlot[] {
+    const startEpoch = Math.floor(start / this.width);
+    const endEpoch = Math.floor(end / this.width);
+    const live = this.slots.filter(slot =>
+      slot.count > 0 && slot.epoch >= startEpoch && slot.epoch <= endEpoch
+    );
+
+    return live.sort((a, b) => a.epoch - b.epoch);
+  }
+
+  private toBucket(slot: RollupSlot): RollupBucket {
+    const start = slot.epoch * this.width;
+
+    return {
+      start: new Date(start),
+      end: new Date(start + this.width),
+      count: slot.count,
+      sum: slot.sum,
+      min: slot.min,
+      max: slot.max,
+      mean: slot.sum / slot.count,
+      sketch: slot.sketch ? slot.sketch.clone() : new QuantileSketch(this.sketchConfig),
+    };
+  }
+
+  private slotOf(epoch: number): number {
+    const length = this.slots.length;
+    return ((epoch % length) + length) % length;
+  }
+}
+
+/**
+ * Raw points plus 1m/1h/1d rollups for one metric
+ */
+export class MetricRollup {
+  private readonly raw: TimeSeriesBuffer;
+  private readonly rings: Map<Exclude<RollupTier, 'raw'>, RollupRing>;
+
+  constructor(private readonly config: RollupConfig = DEFAULT_ROLLUP_CONFIG) {
+    this.raw = new TimeSeriesBuffer(config.rawCapacity);
+    this.rings = new Map();
+
+    for (const [tier, width] of Object.entries(ROLLUP_TIER_WIDTH) as Array<[Exclude<RollupTier, 'raw'>, number]>) {
+      this.rings.set(tier, new RollupRing(width, config.retention[tier], config.sketch));
+    }
+  }
+
+  /**
+   * Record a point in every tier
+   */
+  add(timestamp: number, value: number, metadata?: Record<string, unknown>): void {
+    if (!Number.isFinite(value)) return;
+
+    this.raw.push(timestamp, value, metadata);
+    this.raw.expireBefore(timestamp - this.config.retention.raw);
+
+    for (const ring of this.rings.values()) {
+      ring.add(timestamp, value);
+    }
+  }
+
+  /**
+   * Finest tier that still retains the whole range and reads at most
+   * `maxQueryPoints` buckets; raw is used only while its oldest point
+   * reaches back to the range start, since `rawCapacity` can evict points
+   * well inside the raw retention
+   */
+  tierFor(durationMs: number, now: number = Date.now()): RollupTier {
+    const oldestRaw = this.raw.oldestTimestamp;
+    if (this.config.retention.raw >= durationMs && oldestRaw !== null && oldestRaw <= now - durationMs) {
+      return 'raw';
+    }
+
+    for (const [tier, ring] of this.rings) {
+      if (this.config.retention[tier] >= durationMs &&
+          durationMs / ring.width <= this.config.maxQueryPoints) {
+        return tier;
+      }
+    }
+
+    return '1d';
+  }
+
+  /**
+   * Buckets of a coarse tier within the range
+   */
+  buckets(tier: Exclude<RollupTier, 'raw'>, start: number, end: number): RollupBucket[] {
+    return this.rings.get(tier)?.bucketsBetween(start, end) ?? [];
+  }
+
+  /**
+   * Series over the range at the given tier; coarse buckets are
+   * represented by their mean at the bucket start
+   */
+  series(tier: RollupTier, start: number, end: number): MetricDataPoint[] {
+    if (tier === 'raw') {
+      return this.raw.toArray(start, end);
+    }
+
+    return this.rings.get(tier)?.meansBetween(start, end, tier) ?? [];
+  }
+
+  /**
+   * Points or buckets held and the time span covered per tier
+   */
+  retentionStatus(): Record<RollupTier, { size: number; oldest: Date | null; newest: Date | null }> {
+    const oldest = this.raw.oldestTimestamp;
+    const newest = this.raw.newestTimestamp;
+
+    const status = {
+      raw: {
+        size: this.raw.size,
+        oldest: oldest === null ? null : new Date(oldest),
+        newest: newest === null ? null : new Date(newest),
+      },
+    } as Record<RollupTier, { size: number; oldest: Date | null; newest: Date | null }>;
+
+    for (const [tier, ring] of this.rings) {
+      const extent = ring.extent();
+      status[tier] = {
+        size: extent.buckets,
+        oldest: extent.oldest === null ? null : new Date(extent.oldest),
+        newest: extent.newest === null ? null : new Date(extent.newest),
+      };
+    }
+
+    return status;
+  }
+
+  clear(): void {
+    this.raw.clear();
+    for (const ring of this.rings.values()) {
+      ring.clear();
+    }
+  }
+}
@@ -7,6 +7,12 @@
  */
 
 import { ModelIdentity, ModelHealth } from '../types/index.js';
+import { TimeSeriesBuffer } from './TimeSeriesBuffer.js';
+import { RetryBudget } from '../core/RetryBudget.js';
+import { TimerWheelScheduler, ScheduledTaskHandle } from '../core/TimerWheelScheduler.js';
+import { HealthProbeEngine, type HealthProbeListener } from '../core/HealthProbeEngine.js';
+import { WindowedQuantileSketch } from './QuantileSketch.js';
+import { WindowedCounter } from './WindowedCounter.js';
 
 /**
  * System-wide metrics aggregation
@@ -22,6 +28,8 @@ export interface SystemMetrics {
   readonly healthyModels: number;
   readonly circuitBreakersOpen: number;
   readonly fallbacksTriggered: number;
+  readonly retryAmplification?: number; // attempts per logical request; 1 = no retries
+  readonly suppressedRetries?: number; // retries denied by the retry budget
 }
 
 /**
@@ -41,6 +49,18 @@ export interface ModelMetrics {
   readonly uptime: number;
 }
 
+/**
+ * Health probe latency distribution
+ */
+export interface ProbeLatencySummary {
+  readonly count: number;
+  readonly p50: number;
+  readonly p95: number;
+  readonly p99: number;
+  readonly max: number;
+  readonly failures: number;
+}
+
 /**
  * Time-series data point for analytics
  */
@@ -59,8 +79,18 @@ export interface MetricsConfig {
   readonly batchSize: number;
   readonly enableRealTimeMetrics: boolean;
   readonly metricsEndpoint?: string;
+  readonly timeSeriesCapacity?: number; // max points kept per metric
 }
 
+/**
+ * Default per-metric ring buffer capacity (one day of 1s samples)
+ */
+export const DEFAULT_TIME_SERIES_CAPACITY = 86400;
+
+const PROBE_LATENCY_ALL = '*';
+const PROBE_LATENCY_WINDOW_MS = 300000; // 5 minutes
+const PROBE_LATENCY_BUCKETS = 10;
+
 /**
  * Metrics collector event listener
  */
@@ -75,10 +105,10 @@ export interface MetricsListener {
  */
 export class MetricsCollector {
   private readonly metrics = new Map<string, ModelMetrics>();
-  private readonly timeSeries = new Map<string, MetricDataPoint[]>();
+  private readonly timeSeries = new Map<string, TimeSeriesBuffer>();
   private readonly listeners = new Set<MetricsListener>();
   private systemStartTime = new Date();
-  private collectionTimer?: NodeJS.Timeout;
+  private collectionTimer?: ScheduledTaskHandle;
   private isCollecting = false;
 
   // Aggregated counters
@@ -88,6 +118,10 @@ export class MetricsCollector {
   private responseTimesSum = 0;
   private circuitBreakersOpen = 0;
   private fallbacksTriggered = 0;
+  private retryBudget: RetryBudget = RetryBudget.shared();
+  private retryTotals = new Map<string, { requests: number; retries: number }>();
+  private readonly probeLatency = new Map<string, { window: WindowedQuantileSketch; failures: WindowedCounter }>();
+  private probeSource?: { engine: HealthProbeEngine; listener: HealthProbeListener };
 
   constructor(
     private readonly config: MetricsConfig = {
@@ -95,7 +129,8 @@ export class MetricsCollector {
       retentionPeriod: 86400000, // 24 hours
       batchSize: 100,
       enableRealTimeMetrics: true,
-    }
+    },
+    private readonly scheduler: TimerWheelScheduler = TimerWheelScheduler.shared()
   ) {}
 
   /**
@@ -110,12 +145,15 @@ export class MetricsCollector {
     this.systemStartTime = new Date();
 
     if (this.config.enableRealTimeMetrics) {
-      this.collectionTimer = setInterval(
+      this.collectionTimer = this.scheduler.schedule(
         () => this.collectSystemMetrics(),
-        this.config.collectionInterval
+        { name: 'metrics-collection', intervalMs: this.config.collectionInterval }
       );
     }
 
+    // Probe latencies come from the engine HealthChecker uses by default
+    this.trackHealthProbes(this.probeSource?.engine ?? HealthProbeEngine.shared());
+
     console.log('📊 MetricsCollector started');
   }
 
@@ -130,10 +168,14 @@ export class MetricsCollector {
     this.isCollecting = false;
 
     if (this.collectionTimer) {
-      clearInterval(this.collectionTimer);
+      this.collectionTimer.cancel();
       this.collectionTimer = undefined as any;
     }
 
+    if (this.probeSource) {
+      this.probeSource.engine.removeListener(this.probeSource.listener);
+    }
+
     console.log('📊 MetricsCollector stopped');
   }
 
@@ -219,6 +261,73 @@ export class MetricsCollector {
     }
   }
 
+  /**
+   * Report retry amplification from the given budget (the shared one by default)
+   */
+  trackRetryBudget(budget: RetryBudget): void {
+    this.retryBudget = budget;
+    this.retryTotals.clear();
+  }
+
+  /**
+   * Feed probe latencies from a health probe engine into the histograms
+   * (startCollection tracks the shared engine unless another was given)
+   */
+  trackHealthProbes(engine: HealthProbeEngine): void {
+    if (this.probeSource) {
+      this.probeSource.engine.removeListener(this.probeSource.listener);
+    }
+
+    const listener: HealthProbeListener = {
+      onProbe: result => this.recordProbeLatency(result.modelId, result.latencyMs, result.ok),
+    };
+    engine.addListener(listener);
+    this.probeSource = { engine, listener };
+  }
+
+  /**
+   * Record a health probe latency
+   */
+  recordProbeLatency(modelId: string, latencyMs: number, success: boolean): void {
+    const now = Date.now();
+
+    for (const key of [modelId, PROBE_LATENCY_ALL]) {
+      let entry = this.probeLatency.get(key);
+      if (!entry) {
+        entry = {
+          window: new WindowedQuantileSketch(PROBE_LATENCY_WINDOW_MS, PROBE_LATENCY_BUCKETS),
+          failures: new WindowedCounter(PROBE_LATENCY_WINDOW_MS, PROBE_LATENCY_BUCKETS),
+        };
+        this.probeLatency.set(key, entry);
+      }
+      entry.window.add(now, latencyMs);
+      if (!success) entry.failures.increment(now);
+    }
+
+    this.recordTimeSeries(`${modelId}.probeLatency`, latencyMs, { success });
+  }
+
+  /**
+   * Probe latency percentiles and failures over the last five minutes, for one model or all
+   */
+  getProbeLatency(modelId?: string): ProbeLatencySummary {
+    const entry = this.probeLatency.get(modelId ?? PROBE_LATENCY_ALL);
+    if (!entry) {
+      return { count: 0, p50: 0, p95: 0, p99: 0, max: 0, failures: 0 };
+    }
+
+    const now = Date.now();
+    const sketch = entry.window.query(now);
+    return {
+      count: sketch.count,
+      p50: sketch.quantile(0.5),
+      p95: sketch.quantile(0.95),
+      p99: sketch.quantile(0.99),
+      max: sketch.max,
+      failures: entry.failures.count(now),
+    };
+  }
+
   /**
    * Get current system metrics
    */
@@ -231,6 +340,7 @@ export class MetricsCollector {
 
     const healthyModels = Array.from(this.metrics.values())
       .filter(m => m.healthStatus === 'healthy').length;
+    const retries = this.retryBudget.getStatistics();
 
     return {
       timestamp: now,
@@ -243,6 +353,8 @@ export class MetricsCollector {
       healthyModels,
       circuitBreakersOpen: this.circuitBreakersOpen,
       fallbacksTriggered: this.fallbacksTriggered,
+      retryAmplification: retries.amplification,
+      suppressedRetries: retries.suppressedRetries,
     };
   }
 
@@ -268,17 +380,14 @@ export class MetricsCollector {
     startTime?: Date,
     endTime?: Date
   ): MetricDataPoint[] {
-    const data = this.timeSeries.get(metricName) || [];
-
-    if (!startTime && !endTime) {
-      return [...data];
+    const series = this.timeSeries.get(metricName);
+    if (!series) {
+      return [];
     }
 
-    return data.filter(point => {
-      if (startTime && point.timestamp < startTime) return false;
-      if (endTime && point.timestamp > endTime) return false;
-      return true;
-    });
+    series.expireBefore(Date.now() - this.config.retentionPeriod);
+
+    return series.toArray(startTime?.getTime(), endTime?.getTime());
   }
 
   /**
@@ -308,6 +417,7 @@ export class MetricsCollector {
   clearMetrics(): void {
     this.metrics.clear();
     this.timeSeries.clear();
+    this.probeLatency.clear();
     this.totalRequests = 0;
     this.successfulRequests = 0;
     this.failedRequests = 0;
@@ -328,7 +438,9 @@ export class MetricsCollector {
     return {
       system: this.getSystemMetrics() as any, // Will be resolved
       models: Object.fromEntries(this.metrics),
-      timeSeries: Object.fromEntries(this.timeSeries),
+      timeSeries: Object.fromEntries(
+        Array.from(this.timeSeries, ([metricName, series]) => [metricName, series.toArray()])
+      ),
     };
   }
 
@@ -347,7 +459,10 @@ export class MetricsCollector {
 
     if (data.timeSeries) {
       for (const [metricName, dataPoints] of Object.entries(data.timeSeries)) {
-        this.timeSeries.set(metricName, dataPoints);
+        this.timeSeries.set(
+          metricName,
+          TimeSeriesBuffer.fromPoints(dataPoints, this.getTimeSeriesCapacity())
+        );
       }
     }
   }
@@ -432,27 +547,25 @@ export class MetricsCollector {
     value: number,
     metadata?: Record<string, unknown>
   ): void {
-    const dataPoint: MetricDataPoint = {
-      timestamp: new Date(),
-      value,
-      ...(metadata && { metadata }),
-    };
+    const now = Date.now();
 
     let series = this.timeSeries.get(metricName);
     if (!series) {
-      series = [];
+      series = new TimeSeriesBuffer(this.getTimeSeriesCapacity());
       this.timeSeries.set(metricName, series);
     }
 
-    series.push(dataPoint);
+    series.push(now, value, metadata);
 
-    // Cleanup old data based on retention period
-    const cutoffTime = new Date(Date.now() - this.config.retentionPeriod);
-    const validData = series.filter(point => point.timestamp >= cutoffTime);
+    // Cleanup old data based on retention period (amortized O(1))
+    series.expireBefore(now - this.config.retentionPeriod);
+  }
 
-    if (validData.length !== series.length) {
-      this.timeSeries.set(metricName, validData);
-    }
+  /**
+   * Resolve the per-metric ring buffer capacity
+   */
+  private getTimeSeriesCapacity(): number {
+    return this.config.timeSeriesCapacity ?? DEFAULT_TIME_SERIES_CAPACITY;
   }
 
   /**
@@ -477,11 +590,29 @@ export class MetricsCollector {
       this.recordTimeSeries('system.averageResponseTime', systemMetrics.averageResponseTime);
       this.recordTimeSeries('system.activeModels', systemMetrics.activeModels);
       this.recordTimeSeries('system.healthyModels', systemMetrics.healthyModels);
+      this.recordTimeSeries('system.retryAmplification', this.intervalAmplification('*'));
+
+      for (const target of this.retryBudget.getTargets()) {
+        this.recordTimeSeries(`${target}.retryAmplification`, this.intervalAmplification(target));
+      }
     } catch (error) {
       console.error('❌ Error collecting system metrics:', error);
     }
   }
 
+  /**
+   * Retry amplification since the previous collection ('*' = all targets)
+   */
+  private intervalAmplification(key: string): number {
+    const stats = this.retryBudget.getStatistics(key === '*' ? undefined : key);
+    const previous = this.retryTotals.get(key) ?? { requests: 0, retries: 0 };
+    this.retryTotals.set(key, { requests: stats.requests, retries: stats.retries });
+
+    const requests = stats.requests - previous.requests;
+    const retries = stats.retries - previous.retries;
+    return requests > 0 ? (requests + retries) / requests : 1;
+  }
+
   /**
    * Calculate health status based on performance metrics
    */
@@ -0,0 +1,172 @@
+/**
+ * Online Forecasting
+ * BIP-03 Implementation - Phase 3: Monitoring & Alerting
+ *
+ * Holt double exponential smoothing (level + trend) updated once per sample.
+ * The one-step forecast error feeds EWMA residual statistics, which give
+ * forecast confidence intervals, a running accuracy figure and anomaly
+ * z-scores without revisiting historical points.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+/**
+ * Forecaster configuration
+ */
+export interface OnlineForecastConfig {
+  readonly levelSmoothing: number; // Holt alpha, 0-1
+  readonly trendSmoothing: number; // Holt beta, 0-1
+  readonly errorSmoothing: number; // EWMA weight of residual statistics, 0-1
+  readonly anomalyThreshold: number; // residual z-score flagged as anomalous
+  readonly warmupPoints: number; // samples before anomalies are reported
+  readonly minForecastPoints: number; // samples before forecasts are offered
+}
+
+/**
+ * Default forecaster configuration
+ */
+export const DEFAULT_ONLINE_FORECAST_CONFIG: OnlineForecastConfig = {
+  levelSmoothing: 0.3,
+  trendSmoothing: 0.1,
+  errorSmoothing: 0.1,
+  anomalyThreshold: 2.5,
+  warmupPoints: 15,
+  minForecastPoints: 50,
+};
+
+/**
+ * How a sample compared with the forecast made before it arrived
+ */
+export interface ForecastResidual {
+  readonly expected: number;
+  readonly zScore: number;
+  readonly anomalous: boolean;
+}
+
+/**
+ * Point forecast with a confidence interval
+ */
+export interface OnlineForecastPoint {
+  readonly value: number;
+  readonly lower: number;
+  readonly upper: number;
+}
+
+const Z_95 = 1.96;
+
+/**
+ * Per-metric Holt smoothing state
+ */
+export class OnlineForecaster {
+  private samples = 0;
+  private level = 0;
+  private trend = 0; // per millisecond
+  private lastTimestamp = 0;
+  private meanInterval = 0;
+
+  private residualMean = 0;
+  private residualVariance = 0;
+  private percentError = 0;
+
+  constructor(private readonly config: OnlineForecastConfig = DEFAULT_ONLINE_FORECAST_CONFIG) {}
+
+  get count(): number {
+    return this.samples;
+  }
+
+  /**
+   * Whether enough samples were seen to forecast
+   */
+  get ready(): boolean {
+    return this.samples >= this.config.minForecastPoints;
+  }
+
+  /**
+   * Historical one-step accuracy percentage (100 - EWMA of absolute percentage error)
+   */
+  get accuracy(): number {
+    return this.samples > 1 ? Math.max(0, 100 * (1 - this.percentError)) : 0;
+  }
+
+  /**
+   * Fold in a sample and return how far it was from the prior forecast.
+   * Out-of-order samples update the level without moving the trend.
+   */
+  update(timestamp: number, value: number): ForecastResidual | null {
+    if (!Number.isFinite(value)) return null;
+
+    if (this.samples === 0) {
+      this.level = value;
+      this.lastTimestamp = timestamp;
+      this.samples = 1;
+      return null;
+    }
+
+    const { levelSmoothing, trendSmoothing, errorSmoothing } = this.config;
+    const dt = Math.max(0, timestamp - this.lastTimestamp);
+    const expected = this.level + this.trend * dt;
+    const error = value - expected;
+
+    const zScore = Math.abs(error - this.residualMean) / this.residualScale(expected);
+    const anomalous = this.samples >= this.config.warmupPoints &&
+      zScore > this.config.anomalyThreshold;
+
+    // Holt level and trend
+    const previousLevel = this.level;
+    this.level = expected + levelSmoothing * error;
+    if (dt > 0) {
+      this.trend = trendSmoothing * ((this.level - previousLevel) / dt) + (1 - trendSmoothing) * this.trend;
+      this.meanInterval = this.meanInterval === 0
+        ? dt
+        : this.meanInterval + errorSmoothing * (dt - this.meanInterval);
+      this.lastTimestamp = timestamp;
+    }
+
+    // EWMA residual mean/variance and absolute percentage error
+    const deviation = error - this.residualMean;
+    this.residualMean += errorSmoothing * deviation;
+    this.residualVariance = (1 - errorSmoothing) * (this.residualVariance + errorSmoothing * deviation * deviation);
+
+    const percentError = Math.min(1, Math.abs(error) / Math.max(Math.abs(value), 1e-9));
+    this.percentError = this.samples === 1
+      ? percentError
+      : this.percentError + errorSmoothing * (percentError - this.percentError);
+
+    this.samples++;
+
+    return { expected, zScore, anomalous };
+  }
+
+  /**
+   * Forecast at an absolute time; the interval widens with the number of
+   * typical sampling intervals between the last sample and the target
+   */
+  forecastAt(timestamp: number): OnlineForecastPoint {
+    const horizon = Math.max(0, timestamp - this.lastTimestamp);
+    const value = this.level + this.trend * horizon;
+    const steps = this.meanInterval > 0 ? horizon / this.meanInterval : 0;
+    const spread = Z_95 * Math.sqrt(this.residualVariance) * Math.sqrt(1 + steps);
+
+    return { value, lower: value - spread, upper: value + spread };
+  }
+
+  reset(): void {
+    this.samples = 0;
+    this.level = 0;
+    this.trend = 0;
+    this.lastTimestamp = 0;
+    this.meanInterval = 0;
+    this.residualMean = 0;
+    this.residualVariance = 0;
+    this.percentError = 0;
+  }
+
+  /**
+   * Residual standard deviation, floored so a perfectly smooth warm-up does
+   * not turn the first wobble into an infinite z-score
+   */
+  private residualScale(expected: number): number {
+    return Math.max(Math.sqrt(this.residualVariance), Math.abs(expected) * 1e-3, 1e-9);
+  }
+}
@@ -0,0 +1,405 @@
+/**
+ * Quantile Sketches
+ * BIP-03 Implementation - Phase 3: Monitoring & Alerting
+ *
+ * Mergeable DDSketch-style quantile summaries. Values are mapped to
+ * logarithmically sized bins so every quantile estimate is within a fixed
+ * relative error of the true value, and sketches of different time windows
+ * can be merged by adding bin counts.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+/**
+ * Sketch configuration
+ */
+export interface QuantileSketchConfig {
+  readonly relativeAccuracy: number; // e.g. 0.01 for 1% relative error
+  readonly maxBins: number; // per-sign bin limit when boundedError is false
+  readonly boundedError: boolean; // never collapse bins; error bound holds for every quantile
+}
+
+/**
+ * Default sketch configuration
+ */
+export const DEFAULT_QUANTILE_SKETCH_CONFIG: QuantileSketchConfig = {
+  relativeAccuracy: 0.01,
+  maxBins: 2048,
+  boundedError: false,
+};
+
+/**
+ * Smallest magnitude tracked in log bins; anything below counts as zero
+ */
+const MIN_INDEXABLE_VALUE = 1e-9;
+
+/**
+ * Contiguous bin counts; `offset` is the bin index of counts[0]
+ */
+class DenseStore {
+  private counts = new Float64Array(0);
+  private offset = 0;
+  private minIndex = Number.POSITIVE_INFINITY;
+  private maxIndex = Number.NEGATIVE_INFINITY;
+  total = 0;
+
+  constructor(private readonly maxBins: number | undefined) {}
+
+  add(index: number, count: number): void {
+    if (this.maxBins !== undefined) {
+      const high = Math.max(this.maxIndex, index);
+      const newLow = high - this.maxBins + 1;
+
+      if (Math.min(this.minIndex, index) < newLow) {
+        // Collapse the lowest bins so the span stays within maxBins
+        let collapsed = 0;
+        for (let i = this.minIndex; i < newLow && i <= this.maxIndex; i++) {
+          collapsed += this.countAt(i);
+          this.setCount(i, 0);
+        }
+
+        if (collapsed > 0) {
+          this.minIndex = Math.max(this.minIndex, newLow);
+          this.maxIndex = Math.max(this.maxIndex, newLow);
+          this.increment(newLow, collapsed);
+        }
+
+        index = Math.max(index, newLow);
+      }
+    }
+
+    this.increment(index, count);
+    this.total += count;
+  }
+
+  merge(other: DenseStore): void {
+    for (let i = other.minIndex; i <= other.maxIndex; i++) {
+      const count = other.countAt(i);
+      if (count > 0) {
+        this.add(i, count);
+      }
+    }
+  }
+
+  /**
+   * Bin index holding the given rank, walking up (ascending) or down the bins
+   */
+  indexAtRank(rank: number, ascending: boolean): number {
+    let cumulative = 0;
+
+    if (ascending) {
+      for (let i = this.minIndex; i <= this.maxIndex; i++) {
+        cumulative += this.countAt(i);
+        if (cumulative > rank) return i;
+      }
+      return this.maxIndex;
+    }
+
+    for (let i = this.maxIndex; i >= this.minIndex; i--) {
+      cumulative += this.countAt(i);
+      if (cumulative > rank) return i;
+    }
+    return this.minIndex;
+  }
+
+  clear(): void {
+    this.counts.fill(0);
+    this.minIndex = Number.POSITIVE_INFINITY;
+    this.maxIndex = Number.NEGATIVE_INFINITY;
+    this.total = 0;
+  }
+
+  copyFrom(other: DenseStore): void {
+    this.counts = other.counts.slice();
+    this.offset = other.offset;
+    this.minIndex = other.minIndex;
+    this.maxIndex = other.maxIndex;
+    this.total = other.total;
+  }
+
+  private countAt(index: number): number {
+    return this.counts[index - this.offset] ?? 0;
+  }
+
+  private setCount(index: number, count: number): void {
+    const slot = index - this.offset;
+    if (slot >= 0 && slot < this.counts.length) {
+      this.counts[slot] = count;
+    }
+  }
+
+  private increment(index: number, count: number): void {
+    this.ensureCapacity(index);
+    const slot = index - this.offset;
+    this.counts[slot] = (this.counts[slot] ?? 0) + count;
+    if (index < this.minIndex) this.minIndex = index;
+    if (index > this.maxIndex) this.maxIndex = index;
+  }
+
+  private ensureCapacity(index: number): void {
+    if (index >= this.offset && index < this.offset + this.counts.length) {
+      return;
+    }
+
+    const empty = this.minIndex > this.maxIndex;
+    const low = empty ? index : Math.min(this.minIndex, index);
+    const high = empty ? index : Math.max(this.maxIndex, index);
+    const span = high - low + 1;
+
+    // Leave headroom on both sides so growth is amortized O(1)
+    const capacity = Math.max(32, span * 2);
+    const offset = low - Math.floor((capacity - span) / 2);
+    const counts = new Float64Array(capacity);
+
+    if (!empty) {
+      for (let i = this.minIndex; i <= this.maxIndex; i++) {
+        counts[i - offset] = this.countAt(i);
+      }
+    }
+
+    this.counts = counts;
+    this.offset = offset;
+  }
+}
+
+/**
+ * Mergeable quantile sketch with relative-error guarantees
+ */
+export class QuantileSketch {
+  private readonly gamma: number;
+  private readonly logGamma: number;
+  private readonly positive: DenseStore;
+  private readonly negative: DenseStore;
+  private zeroCount = 0;
+
+  // Exact moments alongside the approximate distribution
+  private countValue = 0;
+  private sumValue = 0;
+  private sumSquares = 0;
+  private minValue = Number.POSITIVE_INFINITY;
+  private maxValue = Number.NEGATIVE_INFINITY;
+
+  constructor(private readonly config: QuantileSketchConfig = DEFAULT_QUANTILE_SKETCH_CONFIG) {
+    if (config.relativeAccuracy <= 0 || config.relativeAccuracy >= 1) {
+      throw new Error(`Invalid relative accuracy: ${config.relativeAccuracy}`);
+    }
+
+    this.gamma = (1 + config.relativeAccuracy) / (1 - config.relativeAccuracy);
+    this.logGamma = Math.log(this.gamma);
+
+    const maxBins = config.boundedError ? undefined : config.maxBins;
+    this.positive = new DenseStore(maxBins);
+    this.negative = new DenseStore(maxBins);
+  }
+
+  get count(): number {
+    return this.countValue;
+  }
+
+  get sum(): number {
+    return this.sumValue;
+  }
+
+  get min(): number {
+    return this.countValue > 0 ? this.minValue : 0;
+  }
+
+  get max(): number {
+    return this.countValue > 0 ? this.maxValue : 0;
+  }
+
+  get mean(): number {
+    return this.countValue > 0 ? this.sumValue / this.countValue : 0;
+  }
+
+  /**
+   * Population standard deviation
+   */
+  get standardDeviation(): number {
+    if (this.countValue === 0) return 0;
+    const mean = this.mean;
+    const variance = this.sumSquares / this.countValue - mean * mean;
+    return Math.sqrt(Math.max(0, variance));
+  }
+
+  /**
+   * Add a value (optionally with a weight)
+   */
+  add(value: number, count = 1): void {
+    if (!Number.isFinite(value) || count <= 0) {
+      return;
+    }
+
+    if (value > MIN_INDEXABLE_VALUE) {
+      this.positive.add(this.indexOf(value), count);
+    } else if (value < -MIN_INDEXABLE_VALUE) {
+      this.negative.add(this.indexOf(-value), count);
+    } else {
+      this.zeroCount += count;
+    }
+
+    this.countValue += count;
+    this.sumValue += value * count;
+    this.sumSquares += value * value * count;
+    if (value < this.minValue) this.minValue = value;
+    if (value > this.maxValue) this.maxValue = value;
+  }
+
+  /**
+   * Merge another sketch built with the same relative accuracy
+   */
+  merge(other: QuantileSketch): void {
+    if (other.gamma !== this.gamma) {
+      throw new Error('Cannot merge sketches with different relative accuracy');
+    }
+
+    if (other.countValue === 0) {
+      return;
+    }
+
+    this.positive.merge(other.positive);
+    this.negative.merge(other.negative);
+    this.zeroCount += other.zeroCount;
+    this.countValue += other.countValue;
+    this.sumValue += other.sumValue;
+    this.sumSquares += other.sumSquares;
+    this.minValue = Math.min(this.minValue, other.minValue);
+    this.maxValue = Math.max(this.maxValue, other.maxValue);
+  }
+
+  /**
+   * Estimate the value at quantile q (0-1)
+   */
+  quantile(q: number): number {
+    if (this.countValue === 0) return 0;
+    if (q <= 0) return this.minValue;
+    if (q >= 1) return this.maxValue;
+
+    const rank = q * (this.countValue - 1);
+    let estimate: number;
+
+    if (rank < this.negative.total) {
+      // Most negative values first: highest magnitude index downward
+      estimate = -this.valueOf(this.negative.indexAtRank(rank, false));
+    } else if (rank < this.negative.total + this.zeroCount) {
+      estimate = 0;
+    } else {
+      const positiveRank = rank - this.negative.total - this.zeroCount;
+      estimate = this.valueOf(this.positive.indexAtRank(positiveRank, true));
+    }
+
+    return Math.min(this.maxValue, Math.max(this.minValue, estimate));
+  }
+
+  /**
+   * Reset to an empty sketch
+   */
+  clear(): void {
+    this.positive.clear();
+    this.negative.clear();
+    this.zeroCount = 0;
+    this.countValue = 0;
+    this.sumValue = 0;
+    this.sumSquares = 0;
+    this.minValue = Number.POSITIVE_INFINITY;
+    this.maxValue = Number.NEGATIVE_INFINITY;
+  }
+
+  /**
+   * Deep copy
+   */
+  clone(): QuantileSketch {
+    const copy = new QuantileSketch(this.config);
+    copy.positive.copyFrom(this.positive);
+    copy.negative.copyFrom(this.negative);
+    copy.zeroCount = this.zeroCount;
+    copy.countValue = this.countValue;
+    copy.sumValue = this.sumValue;
+    copy.sumSquares = this.sumSquares;
+    copy.minValue = this.minValue;
+    copy.maxValue = this.maxValue;
+    return copy;
+  }
+
+  private indexOf(magnitude: number): number {
+    return Math.ceil(Math.log(magnitude) / this.logGamma);
+  }
+
+  private valueOf(index: number): number {
+    return (2 * Math.pow(this.gamma, index)) / (this.gamma + 1);
+  }
+}
+
+/**
+ * Sliding-window sketch built from a ring of sub-window sketches. A query
+ * merges at most `bucketCount + 1` sketches regardless of how many values
+ * were added, so window percentiles cost constant time.
+ */
+export class WindowedQuantileSketch {
+  private readonly bucketWidth: number;
+  private readonly buckets: Array<{ epoch: number; sketch: QuantileSketch }>;
+
+  constructor(
+    private readonly windowMs: number,
+    bucketCount: number,
+    private readonly config: QuantileSketchConfig = DEFAULT_QUANTILE_SKETCH_CONFIG
+  ) {
+    if (windowMs <= 0 || bucketCount <= 0) {
+      throw new Error('Window size and bucket count must be positive');
+    }
+
+    this.bucketWidth = windowMs / bucketCount;
+    this.buckets = Array.from({ length: bucketCount + 1 }, () => ({
+      epoch: Number.NEGATIVE_INFINITY,
+      sketch: new QuantileSketch(config),
+    }));
+  }
+
+  /**
+   * Add a value observed at the given time
+   */
+  add(timestamp: number, value: number): void {
+    const epoch = Math.floor(timestamp / this.bucketWidth);
+    const bucket = this.buckets[this.slotOf(epoch)];
+    if (!bucket) return;
+
+    if (bucket.epoch < epoch) {
+      bucket.epoch = epoch;
+      bucket.sketch.clear();
+    } else if (bucket.epoch > epoch) {
+      return; // Older than the window this slot now covers
+    }
+
+    bucket.sketch.add(value);
+  }
+
+  /**
+   * Merge all sub-windows overlapping [now - windowMs, now]
+   */
+  query(now: number = Date.now()): QuantileSketch {
+    const endEpoch = Math.floor(now / this.bucketWidth);
+    const startEpoch = Math.floor((now - this.windowMs) / this.bucketWidth);
+    const result = new QuantileSketch(this.config);
+
+    for (const bucket of this.buckets) {
+      if (bucket.epoch >= startEpoch && bucket.epoch <= endEpoch) {
+        result.merge(bucket.sketch);
+      }
+    }
+
+    return result;
+  }
+
+  clear(): void {
+    for (const bucket of this.buckets) {
+      bucket.epoch = Number.NEGATIVE_INFINITY;
+      bucket.sketch.clear();
+    }
+  }
+
+  private slotOf(epoch: number): number {
+    const length = this.buckets.length;
+    return ((epoch % length) + length) % length;
+  }
+}
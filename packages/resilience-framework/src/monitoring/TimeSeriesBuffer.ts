@@ -0,0 +1,242 @@
+/**
+ * Time Series Ring Buffer
+ * BIP-03 Implementation - Phase 3: Monitoring & Alerting
+ *
+ * Fixed-capacity columnar storage for a single metric. Values and timestamps
+ * live in parallel typed arrays; appends are O(1) and retention expiry only
+ * advances the head pointer, so no per-sample array copies are made.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+import type { MetricDataPoint } from './MetricsCollector.js';
+
+const INITIAL_CAPACITY = 64;
+
+/**
+ * Per-metric columnar ring buffer
+ */
+export class TimeSeriesBuffer {
+  private values: Float64Array;
+  private timestamps: Float64Array;
+  private metadata: Array<Record<string, unknown> | undefined>;
+  private head = 0; // index of the oldest point
+  private count = 0;
+  private lastTimestamp = Number.NEGATIVE_INFINITY;
+
+  constructor(private readonly maxCapacity: number) {
+    if (!Number.isInteger(maxCapacity) || maxCapacity <= 0) {
+      throw new Error(`Invalid time series capacity: ${maxCapacity}`);
+    }
+
+    const initial = Math.min(INITIAL_CAPACITY, maxCapacity);
+    this.values = new Float64Array(initial);
+    this.timestamps = new Float64Array(initial);
+    this.metadata = new Array(initial);
+  }
+
+  /**
+   * Number of points currently held
+   */
+  get size(): number {
+    return this.count;
+  }
+
+  /**
+   * Maximum number of points before the oldest is overwritten
+   */
+  get capacity(): number {
+    return this.maxCapacity;
+  }
+
+  /**
+   * Timestamp of the oldest point held, or null when empty
+   */
+  get oldestTimestamp(): number | null {
+    return this.count > 0 ? (this.timestamps[this.head] ?? null) : null;
+  }
+
+  /**
+   * Timestamp of the newest point held, or null when empty
+   */
+  get newestTimestamp(): number | null {
+    return this.count > 0 ? (this.timestamps[this.physical(this.count - 1)] ?? null) : null;
+  }
+
+  /**
+   * Append a point. Timestamps lower than the newest stored point are clamped
+   * so the buffer stays sorted and range lookups can binary search.
+   */
+  push(timestamp: number, value: number, metadata?: Record<string, unknown>): void {
+    const ts = timestamp < this.lastTimestamp ? this.lastTimestamp : timestamp;
+
+    if (this.count === this.values.length) {
+      if (this.values.length < this.maxCapacity) {
+        this.grow();
+      } else {
+        // Full: overwrite the oldest point
+        this.metadata[this.head] = undefined;
+        this.head = (this.head + 1) % this.values.length;
+        this.count--;
+      }
+    }
+
+    const index = (this.head + this.count) % this.values.length;
+    this.values[index] = value;
+    this.timestamps[index] = ts;
+    this.metadata[index] = metadata;
+    this.count++;
+    this.lastTimestamp = ts;
+  }
+
+  /**
+   * Drop every point older than the cutoff. Each point is expired at most once,
+   * so the cost is amortized O(1) per append.
+   */
+  expireBefore(cutoff: number): void {
+    const length = this.values.length;
+
+    while (this.count > 0 && (this.timestamps[this.head] ?? 0) < cutoff) {
+      this.metadata[this.head] = undefined;
+      this.head = (this.head + 1) % length;
+      this.count--;
+    }
+
+    if (this.count === 0) {
+      this.head = 0;
+    }
+  }
+
+  /**
+   * Materialize points within the optional [startTime, endTime] range
+   */
+  toArray(startTime?: number, endTime?: number): MetricDataPoint[] {
+    const from = startTime === undefined ? 0 : this.lowerBound(startTime);
+    const to = endTime === undefined ? this.count : this.upperBound(endTime);
+    const result: MetricDataPoint[] = [];
+
+    for (let i = from; i < to; i++) {
+      result.push(this.pointAt(i));
+    }
+
+    return result;
+  }
+
+  /**
+   * Read only the numeric values within the optional range
+   */
+  valuesBetween(startTime?: number, endTime?: number): Float64Array {
+    const from = startTime === undefined ? 0 : this.lowerBound(startTime);
+    const to = endTime === undefined ? this.count : this.upperBound(endTime);
+    const result = new Float64Array(Math.max(0, to - from));
+
+    for (let i = from; i < to; i++) {
+      result[i - from] = this.values[this.physical(i)] ?? 0;
+    }
+
+    return result;
+  }
+
+  /**
+   * Remove all points while keeping the allocated storage
+   */
+  clear(): void {
+    this.metadata.fill(undefined);
+    this.head = 0;
+    this.count = 0;
+    this.lastTimestamp = Number.NEGATIVE_INFINITY;
+  }
+
+  /**
+   * Build a buffer from existing data points (e.g. imported metrics)
+   */
+  static fromPoints(points: readonly MetricDataPoint[], maxCapacity: number): TimeSeriesBuffer {
+    const buffer = new TimeSeriesBuffer(maxCapacity);
+    const sorted = [...points].sort(
+      (a, b) => new Date(a.timestamp).getTime() - new Date(b.timestamp).getTime()
+    );
+
+    for (const point of sorted) {
+      buffer.push(new Date(point.timestamp).getTime(), point.value, point.metadata);
+    }
+
+    return buffer;
+  }
+
+  private pointAt(logical: number): MetricDataPoint {
+    const index = this.physical(logical);
+    const metadata = this.metadata[index];
+
+    return {
+      timestamp: new Date(this.timestamps[index] ?? 0),
+      value: this.values[index] ?? 0,
+      ...(metadata && { metadata }),
+    };
+  }
+
+  private physical(logical: number): number {
+    return (this.head + logical) % this.values.length;
+  }
+
+  /**
+   * First logical index whose timestamp is >= time
+   */
+  private lowerBound(time: number): number {
+    let low = 0;
+    let high = this.count;
+
+    while (low < high) {
+      const mid = (low + high) >>> 1;
+      if ((this.timestamps[this.physical(mid)] ?? 0) < time) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+
+    return low;
+  }
+
+  /**
+   * First logical index whose timestamp is > time
+   */
+  private upperBound(time: number): number {
+    let low = 0;
+    let high = this.count;
+
+    while (low < high) {
+      const mid = (low + high) >>> 1;
+      if ((this.timestamps[this.physical(mid)] ?? 0) <= time) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+
+    return low;
+  }
+
+  /**
+   * Double the backing arrays (up to maxCapacity), unrolling the ring
+   */
+  private grow(): void {
+    const oldLength = this.values.length;
+    const newLength = Math.min(oldLength * 2, this.maxCapacity);
+    const values = new Float64Array(newLength);
+    const timestamps = new Float64Array(newLength);
+    const metadata = new Array<Record<string, unknown> | undefined>(newLength);
+
+    for (let i = 0; i < this.count; i++) {
+      const index = (this.head + i) % oldLength;
+      values[i] = this.values[index] ?? 0;
+      timestamps[i] = this.timestamps[index] ?? 0;
+      metadata[i] = this.metadata[index];
+    }
+
+    this.values = values;
+    this.timestamps = timestamps;
+    this.metadata = metadata;
+    this.head = 0;
+  }
+}
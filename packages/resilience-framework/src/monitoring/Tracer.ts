@@ -0,0 +1,775 @@
+/**
+ * Request Tracing
+ * BIP-03 Implementation - Phase 3: Monitoring & Alerting
+ *
+ * Spans propagated through AsyncLocalStorage along the execution path
+ * (operation → fallback → retry → circuit breaker → model call), so a
+ * request's total execution time splits into queueing, backoff sleep,
+ * breaker rejection and model call. Head sampling decides at the root span
+ * whether a trace is recorded; tail sampling additionally keeps unsampled
+ * traces that failed or were slow. Kept spans land in an in-process ring
+ * buffer and are handed to registered exporters such as OtlpHttpExporter.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+import { AsyncLocalStorage } from 'async_hooks';
+import { randomBytes } from 'crypto';
+import { performance } from 'perf_hooks';
+import type { CircuitBreakerLike } from '../core/CircuitBreaker.js';
+import { TimerWheelScheduler, ScheduledTaskHandle } from '../core/TimerWheelScheduler.js';
+
+/**
+ * Span names used along the resilience execution path
+ */
+export const SPAN_NAMES = {
+  bipOperation: 'bip.operation',
+  fallback: 'fallback.execute',
+  fallbackAttempt: 'fallback.attempt',
+  queue: 'queue',
+  backoff: 'retry.backoff',
+  circuitBreaker: 'circuit_breaker',
+  modelCall: 'model.call',
+} as const;
+
+export type SpanAttributeValue = string | number | boolean;
+export type SpanAttributes = Record<string, SpanAttributeValue>;
+
+/**
+ * 'rejected' marks a circuit breaker that refused the call without running it
+ */
+export type SpanStatus = 'ok' | 'error' | 'rejected';
+
+/**
+ * Finished span as stored in the ring buffer and passed to exporters
+ */
+export interface SpanData {
+  readonly traceId: string;
+  readonly spanId: string;
+  readonly parentSpanId?: string;
+  readonly name: string;
+  readonly startTime: number; // epoch milliseconds, sub-millisecond precision
+  readonly endTime: number;
+  readonly duration: number; // milliseconds
+  readonly status: SpanStatus;
+  readonly statusMessage?: string;
+  readonly attributes: Readonly<SpanAttributes>;
+  readonly sampling: 'head' | 'tail'; // only head-sampled spans are an unbiased sample
+}
+
+/**
+ * Tracer configuration
+ */
+export interface TracerConfig {
+  readonly enabled: boolean;
+  readonly headSampleRate: number; // 0-1, fraction of root spans recorded unconditionally
+  readonly tailSampling: {
+    readonly enabled: boolean; // record unsampled traces and keep the interesting ones
+    readonly keepErrors: boolean; // keep traces containing an error or rejected span
+    readonly latencyThresholdMs: number; // keep traces whose root took at least this long
+  };
+  readonly maxSpansPerTrace: number; // further spans of a trace are dropped
+  readonly bufferCapacity: number; // spans held by the in-process ring buffer
+}
+
+/**
+ * Default tracer configuration
+ */
+export const DEFAULT_TRACER_CONFIG: TracerConfig = {
+  enabled: true,
+  headSampleRate: 0.1,
+  // Off by default: tail sampling records every span of unsampled traces
+  // until their root ends, which costs most of the tracing overhead
+  tailSampling: {
+    enabled: false,
+    keepErrors: true,
+    latencyThresholdMs: 5000,
+  },
+  maxSpansPerTrace: 256,
+  bufferCapacity: 4096,
+};
+
+/**
+ * Receives the spans of every kept trace
+ */
+export interface SpanExporter {
+  export(spans: readonly SpanData[]): void;
+  shutdown?(): Promise<void>;
+}
+
+/**
+ * Tracer counters
+ */
+export interface TracerStats {
+  readonly tracesStarted: number;
+  readonly tracesKept: { head: number; tail: number };
+  readonly tracesDropped: number;
+  readonly spansRecorded: number;
+  readonly spansDropped: number; // over maxSpansPerTrace
+}
+
+/**
+ * Fixed-capacity buffer of the most recent finished spans
+ */
+export class SpanRingBuffer {
+  private readonly slots: Array<SpanData | undefined>;
+  private next = 0;
+  private count = 0;
+
+  constructor(readonly capacity: number) {
+    if (!Number.isInteger(capacity) || capacity <= 0) {
+      throw new Error(`Invalid span buffer capacity: ${capacity}`);
+    }
+    this.slots = new Array(capacity);
+  }
+
+  get size(): number {
+    return this.count;
+  }
+
+  push(span: SpanData): void {
+    this.slots[this.next] = span;
+    this.next = (this.next + 1) % this.capacity;
+    if (this.count < this.capacity) this.count++;
+  }
+
+  /**
+   * Spans oldest first, optionally only those that ended at or after `since`
+   */
+  toArray(since = Number.NEGATIVE_INFINITY): SpanData[] {
+    const spans: SpanData[] = [];
+    const start = (this.next - this.count + this.capacity) % this.capacity;
+    for (let i = 0; i < this.count; i++) {
+      const span = this.slots[(start + i) % this.capacity];
+      if (span && span.endTime >= since) spans.push(span);
+    }
+    return spans;
+  }
+
+  clear(): void {
+    this.slots.fill(undefined);
+    this.next = 0;
+    this.count = 0;
+  }
+}
+
+/**
+ * Spans of one trace waiting for the root to finish
+ */
+export interface TraceState {
+  readonly traceId: string;
+  readonly headSampled: boolean;
+  spans: SpanData[];
+  spanCount: number;
+  failed: boolean;
+  decided: boolean;
+  kept: boolean;
+}
+
+/**
+ * Live span; a no-op when its trace is not recorded
+ */
+export class Span {
+  private status: SpanStatus = 'ok';
+  private statusMessage?: string;
+  private ended = false;
+
+  constructor(
+    private readonly tracer: Tracer,
+    readonly trace: TraceState | null,
+    readonly spanId: string,
+    readonly parentSpanId: string | undefined,
+    readonly name: string,
+    readonly startTime: number,
+    private readonly attributes: SpanAttributes
+  ) {}
+
+  get isRecording(): boolean {
+    return this.trace !== null && !this.ended;
+  }
+
+  get traceId(): string | undefined {
+    return this.trace?.traceId;
+  }
+
+  getStatus(): SpanStatus {
+    return this.status;
+  }
+
+  getAttribute(key: string): SpanAttributeValue | undefined {
+    return this.attributes[key];
+  }
+
+  setAttribute(key: string, value: SpanAttributeValue): this {
+    if (this.trace) this.attributes[key] = value;
+    return this;
+  }
+
+  setStatus(status: SpanStatus, message?: string): this {
+    if (!this.trace) return this;
+    this.status = status;
+    if (message !== undefined) this.statusMessage = message;
+    return this;
+  }
+
+  end(endTime = now()): void {
+    if (this.ended) return;
+    this.ended = true;
+    if (!this.trace) return;
+
+    this.tracer.finishSpan(this.trace, {
+      traceId: this.trace.traceId,
+      spanId: this.spanId,
+      ...(this.parentSpanId !== undefined && { parentSpanId: this.parentSpanId }),
+      name: this.name,
+      startTime: this.startTime,
+      endTime,
+      duration: Math.max(0, endTime - this.startTime),
+      status: this.status,
+      ...(this.statusMessage !== undefined && { statusMessage: this.statusMessage }),
+      attributes: this.attributes,
+      sampling: this.trace.headSampled ? 'head' : 'tail',
+    }, this.parentSpanId === undefined);
+  }
+}
+
+/**
+ * AsyncLocalStorage-based tracer with head and tail sampling
+ */
+export class Tracer {
+  private static sharedInstance?: Tracer;
+
+  private config: TracerConfig;
+  private readonly storage = new AsyncLocalStorage<Span>();
+  private readonly exporters = new Set<SpanExporter>();
+  private buffer: SpanRingBuffer;
+  private readonly noopSpan: Span;
+  private stats = {
+    tracesStarted: 0,
+    tracesKept: { head: 0, tail: 0 },
+    tracesDropped: 0,
+    spansRecorded: 0,
+    spansDropped: 0,
+  };
+
+  constructor(config: Partial<TracerConfig> = {}, private readonly random: () => number = Math.random) {
+    this.config = { ...DEFAULT_TRACER_CONFIG, ...config };
+    this.buffer = new SpanRingBuffer(this.config.bufferCapacity);
+    this.noopSpan = new Span(this, null, '', undefined, '', 0, {});
+  }
+
+  /**
+   * Process-wide tracer used by the framework components by default
+   */
+  static shared(): Tracer {
+    if (!this.sharedInstance) {
+      this.sharedInstance = new Tracer();
+    }
+    return this.sharedInstance;
+  }
+
+  /**
+   * Replace the configuration; a new buffer capacity starts an empty buffer
+   */
+  configure(config: Partial<TracerConfig>): void {
+    this.config = { ...this.config, ...config };
+    if (this.config.bufferCapacity !== this.buffer.capacity) {
+      this.buffer = new SpanRingBuffer(this.config.bufferCapacity);
+    }
+  }
+
+  getConfig(): TracerConfig {
+    return this.config;
+  }
+
+  /**
+   * Ring buffer of spans from kept traces
+   */
+  getBuffer(): SpanRingBuffer {
+    return this.buffer;
+  }
+
+  addExporter(exporter: SpanExporter): void {
+    this.exporters.add(exporter);
+  }
+
+  removeExporter(exporter: SpanExporter): void {
+    this.exporters.delete(exporter);
+  }
+
+  /**
+   * Span of the current async context, if any
+   */
+  activeSpan(): Span | undefined {
+    return this.storage.getStore();
+  }
+
+  /**
+   * Run fn inside a child of the active span, or a new root span. The span
+   * ends when fn settles; a throw marks it as an error unless fn already set
+   * a status.
+   */
+  async withSpan<T>(
+    name: string,
+    fn: (span: Span) => Promise<T>,
+    attributes?: SpanAttributes
+  ): Promise<T> {
+    const parent = this.storage.getStore();
+    // Unrecorded traces still carry a context so children do not start new roots
+    if (!this.config.enabled || (parent && !parent.trace)) {
+      return fn(this.noopSpan);
+    }
+
+    const span = this.startSpan(name, parent, attributes);
+    try {
+      return await this.storage.run(span, () => fn(span));
+    } catch (error) {
+      if (span.getStatus() === 'ok') {
+        span.setStatus('error', error instanceof Error ? error.message : String(error));
+      }
+      throw error;
+    } finally {
+      span.end();
+    }
+  }
+
+  /**
+   * Record an already finished child of the active span (e.g. a measured wait)
+   */
+  recordSpan(
+    name: string,
+    startTime: number,
+    endTime: number,
+    attributes?: SpanAttributes,
+    status: SpanStatus = 'ok'
+  ): void {
+    const parent = this.storage.getStore();
+    if (!this.config.enabled || !parent?.trace) return;
+
+    const span = new Span(this, parent.trace, newSpanId(), parent.spanId, name, startTime, childAttributes(parent, attributes));
+    span.setStatus(status).end(endTime);
+  }
+
+  /**
+   * Trace a call through a circuit breaker: a circuit_breaker span whose
+   * status is 'rejected' when the breaker refused the call, and a model.call
+   * child around fn when it ran.
+   */
+  traceBreakerCall<T>(
+    circuitBreaker: Pick<CircuitBreakerLike, 'execute'>,
+    modelId: string,
+    fn: () => Promise<T>
+  ): Promise<T> {
+    const attributes = { component: modelId, 'model.id': modelId };
+
+    return this.withSpan(SPAN_NAMES.circuitBreaker, async span => {
+      let called = false;
+      try {
+        return await circuitBreaker.execute(() => {
+          called = true;
+          return this.withSpan(SPAN_NAMES.modelCall, fn, { ...attributes });
+        });
+      } catch (error) {
+        if (!called) {
+          span.setStatus('rejected', error instanceof Error ? error.message : String(error));
+        }
+        throw error;
+      }
+    }, attributes);
+  }
+
+  /**
+   * Current time on the span clock, for recordSpan
+   */
+  now(): number {
+    return now();
+  }
+
+  getStats(): TracerStats {
+    return {
+      ...this.stats,
+      tracesKept: { ...this.stats.tracesKept },
+    };
+  }
+
+  /**
+   * Drop buffered spans and counters
+   */
+  reset(): void {
+    this.buffer.clear();
+    this.stats = {
+      tracesStarted: 0,
+      tracesKept: { head: 0, tail: 0 },
+      tracesDropped: 0,
+      spansRecorded: 0,
+      spansDropped: 0,
+    };
+  }
+
+  /**
+   * Called by Span.end
+   */
+  finishSpan(trace: TraceState, data: SpanData, isRoot: boolean): void {
+    if (trace.spanCount >= this.config.maxSpansPerTrace && !isRoot) {
+      this.stats.spansDropped++;
+      return;
+    }
+    trace.spanCount++;
+    if (data.status !== 'ok') trace.failed = true;
+
+    if (trace.decided) {
+      // Late child of an already finished root, e.g. an abandoned hedge
+      if (trace.kept) this.emit([data]);
+      else this.stats.spansDropped++;
+      return;
+    }
+
+    trace.spans.push(data);
+    if (!isRoot) return;
+
+    trace.decided = true;
+    const tail = this.config.tailSampling;
+    trace.kept = trace.headSampled ||
+      (tail.keepErrors && trace.failed) ||
+      data.duration >= tail.latencyThresholdMs;
+
+    if (trace.kept) {
+      this.stats.tracesKept[trace.headSampled ? 'head' : 'tail']++;
+      this.emit(trace.spans);
+    } else {
+      this.stats.tracesDropped++;
+    }
+    trace.spans = [];
+  }
+
+  private startSpan(name: string, parent: Span | undefined, attributes?: SpanAttributes): Span {
+    if (parent?.trace) {
+      return new Span(this, parent.trace, newSpanId(), parent.spanId, name, now(), childAttributes(parent, attributes));
+    }
+
+    this.stats.tracesStarted++;
+    const headSampled = this.random() < this.config.headSampleRate;
+    if (!headSampled && !this.config.tailSampling.enabled) {
+      this.stats.tracesDropped++;
+      return this.noopSpan;
+    }
+
+    const trace: TraceState = {
+      traceId: randomBytes(16).toString('hex'),
+      headSampled,
+      spans: [],
+      spanCount: 0,
+      failed: false,
+      decided: false,
+      kept: false,
+    };
+    return new Span(this, trace, newSpanId(), undefined, name, now(), { ...attributes });
+  }
+
+  private emit(spans: readonly SpanData[]): void {
+    for (const span of spans) {
+      this.buffer.push(span);
+    }
+    this.stats.spansRecorded += spans.length;
+
+    this.exporters.forEach(exporter => {
+      try {
+        exporter.export(spans);
+      } catch (error) {
+        console.error('🔭 Error exporting spans:', error);
+      }
+    });
+  }
+}
+
+/**
+ * Per-component split of traced time
+ */
+export interface SpanLatencyBreakdown {
+  readonly component: string;
+  readonly requests: number; // root spans carrying this component
+  readonly requestErrors: number;
+  readonly requestMs: number;
+  readonly modelCalls: number;
+  readonly modelCallErrors: number;
+  readonly modelCallMs: number; // totals in milliseconds
+  readonly p95ModelCallMs: number;
+  readonly breakerCalls: number;
+  readonly breakerRejections: number;
+  readonly breakerRejectionMs: number;
+  readonly backoffs: number;
+  readonly backoffMs: number;
+  readonly queued: number;
+  readonly queueMs: number;
+  readonly firstSpanTime: number;
+  readonly lastSpanTime: number;
+}
+
+/**
+ * Group root, queue, backoff, breaker and model call spans by their
+ * `component` attribute. Other spans and spans without a component are
+ * ignored.
+ */
+export function summarizeSpans(
+  spans: readonly SpanData[],
+  options: { since?: number; headSampledOnly?: boolean } = {}
+): Map<string, SpanLatencyBreakdown> {
+  const since = options.since ?? Number.NEGATIVE_INFINITY;
+  const groups = new Map<string, {
+    breakdown: { -readonly [K in keyof SpanLatencyBreakdown]: SpanLatencyBreakdown[K] };
+    durations: number[];
+  }>();
+
+  for (const span of spans) {
+    if (span.endTime < since) continue;
+    if (options.headSampledOnly && span.sampling !== 'head') continue;
+    const component = span.attributes.component;
+    if (typeof component !== 'string') continue;
+
+    let group = groups.get(component);
+    if (!group) {
+      group = {
+        breakdown: {
+          component,
+          requests: 0,
+          requestErrors: 0,
+          requestMs: 0,
+          modelCalls: 0,
+          modelCallErrors: 0,
+          modelCallMs: 0,
+          p95ModelCallMs: 0,
+          breakerCalls: 0,
+          breakerRejections: 0,
+          breakerRejectionMs: 0,
+          backoffs: 0,
+          backoffMs: 0,
+          queued: 0,
+          queueMs: 0,
+          firstSpanTime: span.startTime,
+          lastSpanTime: span.endTime,
+        },
+        durations: [],
+      };
+      groups.set(component, group);
+    }
+
+    const b = group.breakdown;
+    switch (span.name) {
+      case SPAN_NAMES.modelCall:
+        b.modelCalls++;
+        b.modelCallMs += span.duration;
+        if (span.status !== 'ok') b.modelCallErrors++;
+        group.durations.push(span.duration);
+        break;
+      case SPAN_NAMES.circuitBreaker:
+        b.breakerCalls++;
+        if (span.status === 'rejected') {
+          b.breakerRejections++;
+          b.breakerRejectionMs += span.duration;
+        }
+        break;
+      case SPAN_NAMES.backoff:
+        b.backoffs++;
+        b.backoffMs += span.duration;
+        break;
+      case SPAN_NAMES.queue:
+        b.queued++;
+        b.queueMs += span.duration;
+        break;
+      default:
+        if (span.parentSpanId !== undefined) continue;
+        b.requests++;
+        b.requestMs += span.duration;
+        if (span.status !== 'ok') b.requestErrors++;
+    }
+    b.firstSpanTime = Math.min(b.firstSpanTime, span.startTime);
+    b.lastSpanTime = Math.max(b.lastSpanTime, span.endTime);
+  }
+
+  const result = new Map<string, SpanLatencyBreakdown>();
+  for (const [component, { breakdown, durations }] of groups) {
+    if (durations.length > 0) {
+      durations.sort((a, b) => a - b);
+      breakdown.p95ModelCallMs = durations[Math.min(durations.length - 1, Math.floor(durations.length * 0.95))] ?? 0;
+    }
+    result.set(component, breakdown);
+  }
+  return result;
+}
+
+/**
+ * OTLP/HTTP JSON exporter configuration
+ */
+export interface OtlpExporterConfig {
+  readonly endpoint: string; // collector base URL; spans are posted to <endpoint>/v1/traces
+  readonly serviceName: string;
+  readonly headers: Record<string, string>;
+  readonly maxBatchSize: number;
+  readonly maxQueueSize: number; // oldest spans are dropped beyond this
+  readonly flushIntervalMs: number;
+  readonly timeoutMs: number;
+}
+
+/**
+ * Default OTLP exporter configuration
+ */
+export const DEFAULT_OTLP_EXPORTER_CONFIG: OtlpExporterConfig = {
+  endpoint: 'http://localhost:4318',
+  serviceName: 'cmmv-hive-resilience',
+  headers: {},
+  maxBatchSize: 512,
+  maxQueueSize: 4096,
+  flushIntervalMs: 5000,
+  timeoutMs: 10000,
+};
+
+/**
+ * Batching exporter posting OTLP/HTTP JSON trace requests
+ */
+export class OtlpHttpExporter implements SpanExporter {
+  private readonly config: OtlpExporterConfig;
+  private queue: SpanData[] = [];
+  private flushing: Promise<void> | undefined;
+  private readonly flushTask: ScheduledTaskHandle;
+  private stats = { exported: 0, dropped: 0, failedRequests: 0 };
+
+  constructor(
+    config: Partial<OtlpExporterConfig> = {},
+    private readonly send: (url: string, init: { method: string; headers: Record<string, string>; body: string; signal: AbortSignal })
+      => Promise<{ ok: boolean; status: number }> = (url, init) => fetch(url, init),
+    scheduler: TimerWheelScheduler = TimerWheelScheduler.shared()
+  ) {
+    this.config = { ...DEFAULT_OTLP_EXPORTER_CONFIG, ...config };
+    this.flushTask = scheduler.schedule(
+      () => this.flush(),
+      { name: 'otlp-span-export', intervalMs: this.config.flushIntervalMs }
+    );
+  }
+
+  export(spans: readonly SpanData[]): void {
+    this.queue.push(...spans);
+    const overflow = this.queue.length - this.config.maxQueueSize;
+    if (overflow > 0) {
+      this.queue.splice(0, overflow);
+      this.stats.dropped += overflow;
+    }
+    if (this.queue.length >= this.config.maxBatchSize) {
+      void this.flush();
+    }
+  }
+
+  /**
+   * Post queued spans in batches; one request at a time
+   */
+  async flush(): Promise<void> {
+    if (this.flushing) {
+      return this.flushing;
+    }
+
+    this.flushing = (async () => {
+      while (this.queue.length > 0) {
+        const batch = this.queue.splice(0, this.config.maxBatchSize);
+        try {
+          const response = await this.send(`${this.config.endpoint.replace(/\/+$/, '')}/v1/traces`, {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/json', ...this.config.headers },
+            body: JSON.stringify(toOtlpJson(batch, this.config.serviceName)),
+            signal: AbortSignal.timeout(this.config.timeoutMs),
+          });
+          if (!response.ok) {
+            throw new Error(`collector responded with ${response.status}`);
+          }
+          this.stats.exported += batch.length;
+        } catch (error) {
+          this.stats.failedRequests++;
+          this.stats.dropped += batch.length;
+          console.error('🔭 OTLP span export failed:', error instanceof Error ? error.message : error);
+        }
+      }
+    })().finally(() => {
+      this.flushing = undefined;
+    });
+
+    return this.flushing;
+  }
+
+  async shutdown(): Promise<void> {
+    this.flushTask.cancel();
+    await this.flush();
+  }
+
+  getStats(): { exported: number; dropped: number; failedRequests: number; queued: number } {
+    return { ...this.stats, queued: this.queue.length };
+  }
+}
+
+/**
+ * OTLP status codes: UNSET 0, OK 1, ERROR 2
+ */
+const OTLP_STATUS_CODE: Record<SpanStatus, number> = { ok: 1, error: 2, rejected: 2 };
+const OTLP_SPAN_KIND_INTERNAL = 1;
+
+/**
+ * Encode spans as an OTLP/JSON ExportTraceServiceRequest
+ */
+export function toOtlpJson(spans: readonly SpanData[], serviceName: string): Record<string, unknown> {
+  return {
+    resourceSpans: [{
+      resource: { attributes: [otlpAttribute('service.name', serviceName)] },
+      scopeSpans: [{
+        scope: { name: '@cmmv-hive/resilience-framework', version: '1.0.0' },
+        spans: spans.map(span => ({
+          traceId: span.traceId,
+          spanId: span.spanId,
+          ...(span.parentSpanId !== undefined && { parentSpanId: span.parentSpanId }),
+          name: span.name,
+          kind: OTLP_SPAN_KIND_INTERNAL,
+          startTimeUnixNano: toUnixNano(span.startTime),
+          endTimeUnixNano: toUnixNano(span.endTime),
+          attributes: [
+            ...Object.entries(span.attributes).map(([key, value]) => otlpAttribute(key, value)),
+            otlpAttribute('resilience.status', span.status),
+            otlpAttribute('sampling', span.sampling),
+          ],
+          status: {
+            code: OTLP_STATUS_CODE[span.status],
+            ...(span.statusMessage !== undefined && { message: span.statusMessage }),
+          },
+        })),
+      }],
+    }],
+  };
+}
+
+function otlpAttribute(key: string, value: SpanAttributeValue): Record<string, unknown> {
+  const encoded = typeof value === 'string' ? { stringValue: value }
+    : typeof value === 'boolean' ? { boolValue: value }
+    : Number.isInteger(value) ? { intValue: String(value) }
+    : { doubleValue: value };
+  return { key, value: encoded };
+}
+
+function toUnixNano(epochMs: number): string {
+  const ms = Math.floor(epochMs);
+  const nanos = Math.round((epochMs - ms) * 1e6);
+  return (BigInt(ms) * 1_000_000n + BigInt(nanos)).toString();
+}
+
+/**
+ * Children inherit the parent's `component` unless they name their own
+ */
+function childAttributes(parent: Span, attributes?: SpanAttributes): SpanAttributes {
+  const component = parent.getAttribute('component');
+  return component === undefined || attributes?.component !== undefined
+    ? { ...attributes }
+    : { ...attributes, component };
+}
+
+function newSpanId(): string {
+  return randomBytes(8).toString('hex');
+}
+
+function now(): number {
+  return performance.timeOrigin + performance.now();
+}
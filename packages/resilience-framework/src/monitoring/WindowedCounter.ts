@@ -0,0 +1,73 @@
+/**
+ * Sliding-Window Event Counter
+ * BIP-03 Implementation - Phase 3: Monitoring & Alerting
+ *
+ * Counts events over a trailing window with a ring of sub-window counters
+ * indexed by epoch, the same layout WindowedQuantileSketch uses for values.
+ * Increments and queries cost O(bucket count) at most, and memory is fixed.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+export class WindowedCounter {
+  private readonly bucketWidth: number;
+  private readonly epochs: Float64Array;
+  private readonly counts: Float64Array;
+
+  constructor(private readonly windowMs: number, bucketCount: number) {
+    if (windowMs <= 0 || bucketCount <= 0) {
+      throw new Error('Window size and bucket count must be positive');
+    }
+
+    this.bucketWidth = windowMs / bucketCount;
+    this.epochs = new Float64Array(bucketCount + 1).fill(Number.NEGATIVE_INFINITY);
+    this.counts = new Float64Array(bucketCount + 1);
+  }
+
+  /**
+   * Count events observed at the given time
+   */
+  increment(timestamp: number, amount = 1): void {
+    const epoch = Math.floor(timestamp / this.bucketWidth);
+    const slot = this.slotOf(epoch);
+    const bucketEpoch = this.epochs[slot]!;
+
+    if (bucketEpoch < epoch) {
+      this.epochs[slot] = epoch;
+      this.counts[slot] = 0;
+    } else if (bucketEpoch > epoch) {
+      return; // Older than the window this slot now covers
+    }
+
+    this.counts[slot]! += amount;
+  }
+
+  /**
+   * Events in the sub-windows overlapping [now - windowMs, now]
+   */
+  count(now: number = Date.now()): number {
+    const endEpoch = Math.floor(now / this.bucketWidth);
+    const startEpoch = Math.floor((now - this.windowMs) / this.bucketWidth);
+    let total = 0;
+
+    for (let slot = 0; slot < this.epochs.length; slot++) {
+      const epoch = this.epochs[slot]!;
+      if (epoch >= startEpoch && epoch <= endEpoch) {
+        total += this.counts[slot]!;
+      }
+    }
+
+    return total;
+  }
+
+  clear(): void {
+    this.epochs.fill(Number.NEGATIVE_INFINITY);
+    this.counts.fill(0);
+  }
+
+  private slotOf(epoch: number): number {
+    const length = this.epochs.length;
+    return ((epoch % length) + length) % length;
+  }
+}
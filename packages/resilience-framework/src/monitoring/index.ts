@@ -4,6 +4,14 @@
  */
 
 export * from './MetricsCollector.js';
+export * from './TimeSeriesBuffer.js';
 export * from './AlertManager.js';
+export * from './AlertDeliveryQueue.js';
 export * from './Dashboard.js';
+export * from './DashboardStream.js';
 export * from './Analytics.js';
+export * from './QuantileSketch.js';
+export * from './WindowedCounter.js';
+export * from './MetricRollup.js';
+export * from './OnlineForecaster.js';
+export * from './Tracer.js';
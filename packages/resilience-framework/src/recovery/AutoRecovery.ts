@@ -7,6 +7,7 @@
  */
 
 import { ModelIdentity, ModelHealth, CircuitBreakerState } from '../types/index.js';
+import { TimerWheelScheduler, ScheduledTaskHandle } from '../core/TimerWheelScheduler.js';
 
 /**
  * Recovery strategy types
@@ -148,7 +149,7 @@ export class AutoRecovery {
   private recoveryHistory: RecoveryEvent[] = [];
   private listeners = new Set<RecoveryListener>();
   private isActive = false;
-  private monitoringInterval?: NodeJS.Timeout;
+  private monitoringInterval?: ScheduledTaskHandle;
 
   // Recovery tracking
   private modelHealthHistory = new Map<string, ModelHealth[]>();
@@ -158,7 +159,8 @@ export class AutoRecovery {
 
   constructor(
     private readonly defaultStrategy: RecoveryStrategy = 'adaptive',
-    private readonly maxConcurrentRecoveries: number = 3
+    private readonly maxConcurrentRecoveries: number = 3,
+    private readonly scheduler: TimerWheelScheduler = TimerWheelScheduler.shared()
   ) {
     this.initializeActionEffectiveness();
   }
@@ -172,9 +174,9 @@ export class AutoRecovery {
     }
 
     this.isActive = true;
-    this.monitoringInterval = setInterval(
+    this.monitoringInterval = this.scheduler.schedule(
       () => this.monitorSystemHealth(),
-      intervalMs
+      { name: 'auto-recovery', intervalMs }
     );
 
     console.log('🔄 AutoRecovery monitoring started');
@@ -191,7 +193,7 @@ export class AutoRecovery {
     this.isActive = false;
 
     if (this.monitoringInterval) {
-      clearInterval(this.monitoringInterval);
+      this.monitoringInterval.cancel();
       this.monitoringInterval = undefined as any;
     }
 
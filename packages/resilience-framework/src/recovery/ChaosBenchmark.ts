@@ -0,0 +1,659 @@
+/**
+ * Chaos Benchmark Harness
+ * BIP-03 Implementation - Phase 4: Advanced Features
+ *
+ * Drives open-loop request rates through LoadBalancer, FallbackManager and
+ * the per-model circuit breakers while chaos faults are injected, records a
+ * latency histogram and throughput per phase, and compares runs against a
+ * stored baseline so resilience changes can be checked for p99 or capacity
+ * regressions before rollout.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+import { promises as fs } from 'fs';
+import { ModelIdentity, AITask, AIResponse, FallbackStrategy, CircuitBreakerConfig } from '../types/index.js';
+import { FallbackManager, ModelExecutor } from '../fallback/FallbackManager.js';
+import { CircuitBreakerFactory, CircuitBreakerLike, CircuitBreakerListener } from '../core/CircuitBreaker.js';
+import { LoadBalancer } from './LoadBalancer.js';
+import { ChaosExperimentType, ChaosTestSuite, FailureInjector } from './ChaosTestSuite.js';
+import { QuantileSketch } from '../monitoring/QuantileSketch.js';
+
+/**
+ * Fault applied to benchmark traffic
+ */
+export interface BenchmarkFault {
+  readonly type: ChaosExperimentType;
+  readonly targets?: string[]; // model IDs; all models when omitted
+  readonly errorRate?: number; // 0-1, model_failure defaults to 1, intermittent_errors to 0.5
+  readonly latencyMs?: number; // network_latency: added to every call
+  readonly timeoutMs?: number; // timeout_failure: call hangs this long, then fails
+}
+
+/**
+ * One stage of a benchmark run
+ */
+export interface BenchmarkPhase {
+  readonly name: string;
+  readonly durationMs: number;
+  readonly ratePerSecond: number; // open-loop arrival rate
+  readonly faults?: BenchmarkFault[];
+}
+
+/**
+ * Service level used when searching for the maximum sustainable rate
+ */
+export interface BenchmarkSLO {
+  readonly p99Ms: number;
+  readonly minSuccessRate: number; // 0-1
+}
+
+/**
+ * Capacity search settings
+ */
+export interface CapacitySearchConfig {
+  readonly minRate: number;
+  readonly maxRate: number;
+  readonly stepDurationMs: number;
+  readonly iterations: number; // binary search steps
+  readonly slo: BenchmarkSLO;
+  readonly faults?: BenchmarkFault[];
+}
+
+/**
+ * Benchmark configuration
+ */
+export interface ChaosBenchmarkConfig {
+  readonly name: string;
+  readonly models: ModelIdentity[];
+  readonly phases: BenchmarkPhase[];
+  readonly strategy: FallbackStrategy;
+  readonly baseLatencyMs: number; // simulated model latency
+  readonly latencyJitterMs: number; // uniform jitter added to baseLatencyMs
+  readonly requestTimeoutMs: number; // end-to-end budget per request
+  readonly maxInFlight: number; // arrivals beyond this are dropped
+  readonly retryOnFailure: boolean; // retries add fixed backoff delays to every faulted call
+  readonly relativeAccuracy: number; // latency histogram precision
+  readonly circuitBreaker?: CircuitBreakerConfig;
+  readonly capacitySearch?: CapacitySearchConfig;
+  readonly random?: () => number; // inject for reproducible fault sampling
+}
+
+/**
+ * Default benchmark settings (phases and models must be supplied)
+ */
+export const DEFAULT_CHAOS_BENCHMARK_CONFIG: Omit<ChaosBenchmarkConfig, 'name' | 'models' | 'phases'> = {
+  strategy: 'sequential',
+  baseLatencyMs: 20,
+  latencyJitterMs: 10,
+  requestTimeoutMs: 2000,
+  maxInFlight: 1000,
+  retryOnFailure: false,
+  relativeAccuracy: 0.01,
+};
+
+/**
+ * Latency histogram summary in milliseconds
+ */
+export interface LatencySummary {
+  readonly count: number;
+  readonly min: number;
+  readonly mean: number;
+  readonly p50: number;
+  readonly p90: number;
+  readonly p99: number;
+  readonly p999: number;
+  readonly max: number;
+}
+
+/**
+ * Results for one phase
+ */
+export interface BenchmarkPhaseResult {
+  readonly name: string;
+  readonly targetRate: number;
+  readonly elapsedMs: number; // first arrival until the last request settled
+  readonly sent: number;
+  readonly succeeded: number;
+  readonly failed: number;
+  readonly timedOut: number;
+  readonly dropped: number; // rejected by maxInFlight
+  readonly throughput: number; // completed requests per second
+  readonly goodput: number; // successful requests per second
+  readonly successRate: number;
+  readonly fallbackRate: number; // share of successes served by a fallback model
+  readonly breakerOpenings: number;
+  readonly unroutable: number; // load balancer had no healthy model
+  readonly latency: LatencySummary;
+}
+
+/**
+ * Results for a full run
+ */
+export interface BenchmarkReport {
+  readonly name: string;
+  readonly startedAt: string;
+  readonly phases: BenchmarkPhaseResult[];
+  readonly maxSustainableRate?: number;
+}
+
+/**
+ * Allowed change before a metric counts as a regression (fractions)
+ */
+export interface RegressionThresholds {
+  readonly p99Increase: number;
+  readonly throughputDecrease: number;
+  readonly successRateDecrease: number; // absolute
+  readonly maxRateDecrease: number;
+}
+
+/**
+ * Default regression thresholds
+ */
+export const DEFAULT_REGRESSION_THRESHOLDS: RegressionThresholds = {
+  p99Increase: 0.1,
+  throughputDecrease: 0.05,
+  successRateDecrease: 0.01,
+  maxRateDecrease: 0.05,
+};
+
+/**
+ * Per-phase comparison against the baseline
+ */
+export interface PhaseComparison {
+  readonly name: string;
+  readonly p99Change: number; // relative
+  readonly throughputChange: number; // relative
+  readonly successRateChange: number; // absolute
+  readonly regressions: string[];
+}
+
+/**
+ * Run comparison against the baseline
+ */
+export interface BenchmarkComparison {
+  readonly regressed: boolean;
+  readonly phases: PhaseComparison[];
+  readonly maxRateChange?: number; // relative
+  readonly regressions: string[];
+}
+
+/**
+ * Model executor that simulates model latency and applies injected faults.
+ * It is also a FailureInjector, so ChaosTestSuite experiments can target
+ * benchmark traffic.
+ */
+export class FaultInjectingExecutor implements ModelExecutor, FailureInjector {
+  private readonly faults = new Map<string, BenchmarkFault>();
+  private nextInjectionId = 0;
+
+  constructor(
+    private readonly baseLatencyMs: number,
+    private readonly latencyJitterMs: number,
+    private readonly random: () => number = Math.random
+  ) {}
+
+  /**
+   * Apply a fault; returns its injection id
+   */
+  inject(fault: BenchmarkFault): string {
+    const injectionId = `${fault.type}-${++this.nextInjectionId}`;
+    this.faults.set(injectionId, fault);
+    return injectionId;
+  }
+
+  /**
+   * Remove every fault
+   */
+  clear(): void {
+    this.faults.clear();
+  }
+
+  async injectFailure(type: ChaosExperimentType, parameters: Record<string, unknown>): Promise<boolean> {
+    this.inject({
+      type,
+      ...(Array.isArray(parameters.targets) ? { targets: parameters.targets as string[] } : {}),
+      ...(typeof parameters.errorRate === 'number' ? { errorRate: parameters.errorRate } : {}),
+      ...(typeof parameters.latencyMs === 'number' ? { latencyMs: parameters.latencyMs } : {}),
+      ...(typeof parameters.timeoutMs === 'number' ? { timeoutMs: parameters.timeoutMs } : {}),
+    });
+    return true;
+  }
+
+  async removeFailure(injectionId: string): Promise<boolean> {
+    return this.faults.delete(injectionId);
+  }
+
+  async getActiveInjections(): Promise<string[]> {
+    return Array.from(this.faults.keys());
+  }
+
+  async execute(model: ModelIdentity, task: AITask, signal?: AbortSignal): Promise<AIResponse> {
+    const startTime = Date.now();
+    let latency = this.baseLatencyMs + this.random() * this.latencyJitterMs;
+    let errorRate = 0;
+    let hangMs = 0;
+
+    for (const fault of this.faults.values()) {
+      if (fault.targets && !fault.targets.includes(model.id)) continue;
+
+      switch (fault.type) {
+        case 'network_latency':
+          latency += fault.latencyMs ?? 1000;
+          break;
+        case 'timeout_failure':
+          hangMs = Math.max(hangMs, fault.timeoutMs ?? 5000);
+          break;
+        case 'intermittent_errors':
+          errorRate = Math.max(errorRate, fault.errorRate ?? 0.5);
+          break;
+        default:
+          errorRate = Math.max(errorRate, fault.errorRate ?? 1);
+      }
+    }
+
+    if (hangMs > 0) {
+      await delay(hangMs, signal);
+      throw new Error(`Model ${model.id} timed out after ${hangMs}ms`);
+    }
+
+    await delay(latency, signal);
+    if (signal?.aborted) {
+      throw new Error(`Request to model ${model.id} was cancelled`);
+    }
+
+    if (errorRate > 0 && this.random() < errorRate) {
+      throw new Error(`Injected failure on model ${model.id}`);
+    }
+
+    return {
+      taskId: task.id,
+      modelId: model.id,
+      result: `benchmark:${task.id}`,
+      success: true,
+      responseTime: Date.now() - startTime,
+      timestamp: new Date(),
+    };
+  }
+}
+
+/**
+ * Open-loop chaos benchmark
+ */
+export class ChaosBenchmark {
+  private readonly config: ChaosBenchmarkConfig;
+  private readonly executor: FaultInjectingExecutor;
+  private readonly fallbackManager: FallbackManager;
+  private readonly loadBalancer: LoadBalancer;
+  private readonly breakers = new Map<string, CircuitBreakerLike>(); // private to this benchmark
+  private requestSeq = 0;
+
+  constructor(config: Pick<ChaosBenchmarkConfig, 'name' | 'models' | 'phases'> & Partial<ChaosBenchmarkConfig>) {
+    if (config.models.length === 0) {
+      throw new Error('Benchmark requires at least one model');
+    }
+
+    this.config = { ...DEFAULT_CHAOS_BENCHMARK_CONFIG, ...config };
+    this.executor = new FaultInjectingExecutor(
+      this.config.baseLatencyMs,
+      this.config.latencyJitterMs,
+      this.config.random
+    );
+
+    this.fallbackManager = new FallbackManager(this.executor);
+    this.fallbackManager.configureRouting({ retryOnFailure: this.config.retryOnFailure });
+    this.fallbackManager.setCircuitBreakerProvider(modelId => this.breakerFor(modelId));
+
+    this.loadBalancer = new LoadBalancer({
+      algorithm: 'least_response_time',
+      weights: [],
+      healthCheckInterval: 30000,
+      failureThreshold: 5,
+      recoveryThreshold: 3,
+      sessionAffinity: false,
+      stickySessions: false,
+      adaptiveLearning: false,
+    });
+  }
+
+  /**
+   * Let a ChaosTestSuite inject faults into benchmark traffic
+   */
+  attachToSuite(suite: ChaosTestSuite): void {
+    const types: ChaosExperimentType[] = ['model_failure', 'network_latency', 'timeout_failure', 'intermittent_errors'];
+    types.forEach(type => suite.registerInjector(type, this.executor));
+  }
+
+  /**
+   * Fault injector driving the simulated models
+   */
+  getInjector(): FaultInjectingExecutor {
+    return this.executor;
+  }
+
+  /**
+   * Run every configured phase, then the capacity search if configured
+   */
+  async run(): Promise<BenchmarkReport> {
+    const startedAt = new Date().toISOString();
+    const phases: BenchmarkPhaseResult[] = [];
+
+    for (const phase of this.config.phases) {
+      phases.push(await this.runPhase(phase));
+    }
+
+    const maxSustainableRate = this.config.capacitySearch
+      ? await this.findMaxSustainableRate(this.config.capacitySearch)
+      : undefined;
+
+    return {
+      name: this.config.name,
+      startedAt,
+      phases,
+      ...(maxSustainableRate !== undefined ? { maxSustainableRate } : {}),
+    };
+  }
+
+  /**
+   * Binary search for the highest rate that meets the SLO
+   */
+  async findMaxSustainableRate(search: CapacitySearchConfig): Promise<number> {
+    let low = search.minRate;
+    let high = search.maxRate;
+    let best = 0;
+
+    for (let i = 0; i < search.iterations && low <= high; i++) {
+      const rate = Math.round((low + high) / 2);
+      const result = await this.runPhase({
+        name: `capacity-${rate}`,
+        durationMs: search.stepDurationMs,
+        ratePerSecond: rate,
+        ...(search.faults ? { faults: search.faults } : {}),
+      });
+
+      const meetsSLO = result.dropped === 0
+        && result.latency.p99 <= search.slo.p99Ms
+        && result.successRate >= search.slo.minSuccessRate;
+
+      if (meetsSLO) {
+        best = rate;
+        low = rate + 1;
+      } else {
+        high = rate - 1;
+      }
+    }
+
+    return best;
+  }
+
+  /**
+   * Run one phase with fresh load balancer and circuit breaker state
+   */
+  async runPhase(phase: BenchmarkPhase): Promise<BenchmarkPhaseResult> {
+    this.resetComponents();
+    this.executor.clear();
+    phase.faults?.forEach(fault => this.executor.inject(fault));
+
+    const histogram = new QuantileSketch({
+      relativeAccuracy: this.config.relativeAccuracy,
+      maxBins: 2048,
+      boundedError: false,
+    });
+    const counters = { sent: 0, succeeded: 0, failed: 0, timedOut: 0, dropped: 0, fallbacks: 0, breakerOpenings: 0, unroutable: 0 };
+
+    const breakers = this.config.models.map(model => this.breakerFor(model.id));
+    const breakerListener: CircuitBreakerListener = {
+      onStateChange: event => {
+        if (event.to === 'open') counters.breakerOpenings++;
+      },
+    };
+    breakers.forEach(breaker => breaker.addListener(breakerListener));
+
+    const pending = new Set<Promise<void>>();
+    const intervalMs = 1000 / phase.ratePerSecond;
+    const totalArrivals = Math.floor((phase.durationMs / 1000) * phase.ratePerSecond);
+    const start = Date.now();
+    let issued = 0;
+
+    try {
+      while (issued < totalArrivals) {
+        // Open loop: every arrival whose scheduled time has passed is issued now,
+        // independent of how many earlier requests are still running
+        const now = Date.now();
+        while (issued < totalArrivals && start + issued * intervalMs <= now) {
+          const scheduledAt = start + issued * intervalMs;
+          issued++;
+          counters.sent++;
+
+          if (pending.size >= this.config.maxInFlight) {
+            counters.dropped++;
+            continue;
+          }
+
+          const request: Promise<void> = this.issueRequest(scheduledAt, histogram, counters)
+            .finally(() => pending.delete(request));
+          pending.add(request);
+        }
+
+        if (issued < totalArrivals) {
+          await delay(Math.max(0, start + issued * intervalMs - Date.now()));
+        }
+      }
+
+      await Promise.all(pending);
+    } finally {
+      breakers.forEach(breaker => breaker.removeListener(breakerListener));
+      this.executor.clear();
+    }
+
+    const elapsedMs = Math.max(1, Date.now() - start);
+    const completed = counters.succeeded + counters.failed;
+
+    return {
+      name: phase.name,
+      targetRate: phase.ratePerSecond,
+      elapsedMs,
+      sent: counters.sent,
+      succeeded: counters.succeeded,
+      failed: counters.failed,
+      timedOut: counters.timedOut,
+      dropped: counters.dropped,
+      throughput: (completed / elapsedMs) * 1000,
+      goodput: (counters.succeeded / elapsedMs) * 1000,
+      successRate: counters.sent > 0 ? counters.succeeded / counters.sent : 1,
+      fallbackRate: counters.succeeded > 0 ? counters.fallbacks / counters.succeeded : 0,
+      breakerOpenings: counters.breakerOpenings,
+      unroutable: counters.unroutable,
+      latency: summarizeLatency(histogram),
+    };
+  }
+
+  /**
+   * Send one request through the load balancer and fallback chain.
+   * Latency is measured from the scheduled arrival, so queueing delay
+   * caused by a slow system is not hidden (no coordinated omission).
+   */
+  private async issueRequest(
+    scheduledAt: number,
+    histogram: QuantileSketch,
+    counters: { succeeded: number; failed: number; timedOut: number; fallbacks: number; unroutable: number }
+  ): Promise<void> {
+    const task: AITask = { id: `bench-${++this.requestSeq}`, type: 'benchmark', payload: null };
+    const [primary, ...fallbacks] = await this.route(task, counters);
+
+    // A timed-out request is aborted, so it stops occupying the models
+    const controller = new AbortController();
+    let timer: NodeJS.Timeout | undefined;
+    const timeout = new Promise<'timeout'>(resolve => {
+      timer = setTimeout(() => {
+        controller.abort();
+        resolve('timeout');
+      }, this.config.requestTimeoutMs);
+    });
+
+    const outcome = await Promise.race([
+      this.fallbackManager.executeWithFallback(task, {
+        primary: primary!,
+        fallbacks,
+        strategy: this.config.strategy,
+        timeout: this.config.requestTimeoutMs,
+      }, controller.signal),
+      timeout,
+    ]);
+    clearTimeout(timer);
+
+    const latency = Date.now() - scheduledAt;
+    histogram.add(latency);
+
+    if (outcome === 'timeout') {
+      counters.failed++;
+      counters.timedOut++;
+      this.loadBalancer.recordRequestCompletion(primary!.id, false, latency);
+      return;
+    }
+
+    if (outcome.success) {
+      counters.succeeded++;
+      if (outcome.fallbackUsed) counters.fallbacks++;
+    } else {
+      counters.failed++;
+    }
+
+    const servedBy = outcome.success ? outcome.modelUsed : primary!.id;
+    this.loadBalancer.recordRequestCompletion(servedBy, outcome.success, latency);
+  }
+
+  /**
+   * Primary model first, then fallbacks
+   */
+  private async route(task: AITask, counters: { unroutable: number }): Promise<ModelIdentity[]> {
+    try {
+      const decision = await this.loadBalancer.selectModel(task);
+      const alternatives = decision.alternatives;
+      // Unhealthy models stay at the end of the chain as a last resort
+      const rest = this.config.models.filter(model =>
+        model.id !== decision.selectedModel.id && !alternatives.some(alt => alt.id === model.id)
+      );
+      return [decision.selectedModel, ...alternatives, ...rest];
+    } catch {
+      counters.unroutable++;
+      return this.config.models;
+    }
+  }
+
+  private breakerFor(modelId: string): CircuitBreakerLike {
+    let breaker = this.breakers.get(modelId);
+    if (!breaker) {
+      breaker = CircuitBreakerFactory.create(modelId, this.config.circuitBreaker);
+      this.breakers.set(modelId, breaker);
+    }
+    return breaker;
+  }
+
+  private resetComponents(): void {
+    this.breakers.clear();
+    for (const model of this.config.models) {
+      this.loadBalancer.unregisterModel(model.id);
+      this.loadBalancer.registerModel(model);
+    }
+  }
+}
+
+/**
+ * Compare a run against a baseline; phases are matched by name
+ */
+export function compareBenchmarkReports(
+  current: BenchmarkReport,
+  baseline: BenchmarkReport,
+  thresholds: Partial<RegressionThresholds> = {}
+): BenchmarkComparison {
+  const limits = { ...DEFAULT_REGRESSION_THRESHOLDS, ...thresholds };
+  const regressions: string[] = [];
+  const phases: PhaseComparison[] = [];
+
+  for (const phase of current.phases) {
+    const base = baseline.phases.find(p => p.name === phase.name);
+    if (!base) continue;
+
+    const p99Change = relativeChange(phase.latency.p99, base.latency.p99);
+    const throughputChange = relativeChange(phase.goodput, base.goodput);
+    const successRateChange = phase.successRate - base.successRate;
+    const phaseRegressions: string[] = [];
+
+    if (p99Change > limits.p99Increase) {
+      phaseRegressions.push(`p99 ${base.latency.p99.toFixed(1)}ms -> ${phase.latency.p99.toFixed(1)}ms`);
+    }
+    if (throughputChange < -limits.throughputDecrease) {
+      phaseRegressions.push(`goodput ${base.goodput.toFixed(1)}/s -> ${phase.goodput.toFixed(1)}/s`);
+    }
+    if (successRateChange < -limits.successRateDecrease) {
+      phaseRegressions.push(`success rate ${(base.successRate * 100).toFixed(1)}% -> ${(phase.successRate * 100).toFixed(1)}%`);
+    }
+
+    regressions.push(...phaseRegressions.map(message => `${phase.name}: ${message}`));
+    phases.push({ name: phase.name, p99Change, throughputChange, successRateChange, regressions: phaseRegressions });
+  }
+
+  let maxRateChange: number | undefined;
+  if (current.maxSustainableRate !== undefined && baseline.maxSustainableRate !== undefined) {
+    maxRateChange = relativeChange(current.maxSustainableRate, baseline.maxSustainableRate);
+    if (maxRateChange < -limits.maxRateDecrease) {
+      regressions.push(`max sustainable rate ${baseline.maxSustainableRate}/s -> ${current.maxSustainableRate}/s`);
+    }
+  }
+
+  return {
+    regressed: regressions.length > 0,
+    phases,
+    ...(maxRateChange !== undefined ? { maxRateChange } : {}),
+    regressions,
+  };
+}
+
+/**
+ * Store a report as the baseline for later comparisons
+ */
+export async function saveBenchmarkBaseline(filePath: string, report: BenchmarkReport): Promise<void> {
+  await fs.writeFile(filePath, JSON.stringify(report, null, 2) + '\n', 'utf8');
+}
+
+/**
+ * Load a stored baseline; undefined when none exists yet
+ */
+export async function loadBenchmarkBaseline(filePath: string): Promise<BenchmarkReport | undefined> {
+  try {
+    return JSON.parse(await fs.readFile(filePath, 'utf8')) as BenchmarkReport;
+  } catch (error) {
+    if ((error as NodeJS.ErrnoException).code === 'ENOENT') return undefined;
+    throw error;
+  }
+}
+
+function summarizeLatency(histogram: QuantileSketch): LatencySummary {
+  return {
+    count: histogram.count,
+    min: histogram.min,
+    mean: histogram.mean,
+    p50: histogram.quantile(0.5),
+    p90: histogram.quantile(0.9),
+    p99: histogram.quantile(0.99),
+    p999: histogram.quantile(0.999),
+    max: histogram.max,
+  };
+}
+
+function relativeChange(current: number, baseline: number): number {
+  if (baseline === 0) return current === 0 ? 0 : Infinity;
+  return (current - baseline) / baseline;
+}
+
+function delay(ms: number, signal?: AbortSignal): Promise<void> {
+  return new Promise(resolve => {
+    const timer = setTimeout(resolve, ms);
+    signal?.addEventListener('abort', () => {
+      clearTimeout(timer);
+      resolve();
+    }, { once: true });
+  });
+}
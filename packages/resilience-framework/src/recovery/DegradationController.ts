@@ -7,6 +7,12 @@
  */
 
 import { ModelIdentity, ModelHealth } from '../types/index.js';
+import { TimerWheelScheduler, ScheduledTaskHandle } from '../core/TimerWheelScheduler.js';
+import type {
+  ConcurrencyLimiter,
+  ConcurrencyLimiterListener,
+  ConcurrencySaturationEvent
+} from '../core/ConcurrencyLimiter.js';
 
 /**
  * Degradation level
@@ -118,7 +124,7 @@ export class DegradationController {
   private appliedActions = new Map<string, DegradationAction[]>();
   private degradationHistory: DegradationEvent[] = [];
   private listeners = new Set<DegradationListener>();
-  private monitoringInterval?: NodeJS.Timeout;
+  private monitoringInterval?: ScheduledTaskHandle;
   private isActive = false;
 
   // Performance tracking
@@ -126,8 +132,15 @@ export class DegradationController {
   private modelMetrics = new Map<string, PerformanceMetrics>();
   private lastEvaluation = new Date();
 
+  // Concurrency saturation pushed by an attached limiter
+  private concurrencyLimiter: ConcurrencyLimiter | undefined;
+  private limiterListener: ConcurrencyLimiterListener | undefined;
+  private saturatedModels = new Set<string>();
+  private saturationTriggerReason: string | undefined;
+
   constructor(
-    private readonly strategies: DegradationStrategy[] = []
+    private readonly strategies: DegradationStrategy[] = [],
+    private readonly scheduler: TimerWheelScheduler = TimerWheelScheduler.shared()
   ) {
     this.initializeDefaultStrategies();
     this.strategies.forEach(strategy =>
@@ -144,9 +157,9 @@ export class DegradationController {
     }
 
     this.isActive = true;
-    this.monitoringInterval = setInterval(
+    this.monitoringInterval = this.scheduler.schedule(
       () => this.evaluateSystemHealth(),
-      intervalMs
+      { name: 'degradation-controller', intervalMs }
     );
 
     console.log('🔧 DegradationController monitoring started');
@@ -163,7 +176,7 @@ export class DegradationController {
     this.isActive = false;
 
     if (this.monitoringInterval) {
-      clearInterval(this.monitoringInterval);
+      this.monitoringInterval.cancel();
       this.monitoringInterval = undefined as any;
     }
 
@@ -194,6 +207,48 @@ export class DegradationController {
     this.modelMetrics.set(modelId, metrics);
   }
 
+  /**
+   * Receive saturation events from a concurrency limiter as they happen and
+   * drive its capacity from reduce_concurrency actions. A saturated model
+   * escalates to 'minimal' at once; once every saturated model recovers, a
+   * degradation started by saturation is reverted.
+   */
+  attachConcurrencyLimiter(limiter: ConcurrencyLimiter): void {
+    this.detachConcurrencyLimiter();
+
+    const listener: ConcurrencyLimiterListener = {
+      onSaturationChange: event => {
+        this.handleSaturationChange(event).catch(error =>
+          console.error('🔧 Error handling concurrency saturation:', error)
+        );
+      },
+    };
+
+    limiter.addListener(listener);
+    this.concurrencyLimiter = limiter;
+    this.limiterListener = listener;
+  }
+
+  /**
+   * Stop listening to the attached concurrency limiter
+   */
+  detachConcurrencyLimiter(): void {
+    if (this.concurrencyLimiter && this.limiterListener) {
+      this.concurrencyLimiter.removeListener(this.limiterListener);
+    }
+    this.concurrencyLimiter = undefined;
+    this.limiterListener = undefined;
+    this.saturatedModels.clear();
+    this.saturationTriggerReason = undefined;
+  }
+
+  /**
+   * Models the attached limiter currently reports as saturated
+   */
+  getSaturatedModels(): string[] {
+    return Array.from(this.saturatedModels);
+  }
+
   /**
    * Manually trigger degradation to specific level
    */
@@ -672,7 +727,7 @@ export class DegradationController {
   private async applyConcurrencyReduction(params: Record<string, unknown>): Promise<boolean> {
     const factor = params.factor as number || 0.5;
     console.log(`🔧 Applying concurrency reduction: ${(factor * 100).toFixed(0)}%`);
-    // Implementation would reduce max concurrent operations
+    this.concurrencyLimiter?.setCapacityFactor(factor);
     return true;
   }
 
@@ -730,6 +785,7 @@ export class DegradationController {
    */
   private async revertConcurrencyReduction(_params: Record<string, unknown>): Promise<boolean> {
     console.log(`🔧 Reverting concurrency reduction`);
+    this.concurrencyLimiter?.setCapacityFactor(1);
     return true;
   }
 
@@ -799,6 +855,39 @@ export class DegradationController {
     }
   }
 
+  private async handleSaturationChange(event: ConcurrencySaturationEvent): Promise<void> {
+    if (event.type === 'saturated') {
+      this.saturatedModels.add(event.modelId);
+
+      if (this.shouldEscalate('minimal')) {
+        const strategy = this.findStrategyForLevel('minimal');
+        if (!strategy) return;
+
+        const reason = `Concurrency saturated on ${event.modelId} ` +
+          `(limit ${event.limit}, ${event.queued} queued)`;
+        this.saturationTriggerReason = reason;
+        if (!await this.applyDegradation(strategy, reason, [event.modelId]) &&
+            this.saturationTriggerReason === reason) {
+          this.saturationTriggerReason = undefined;
+        }
+      }
+      return;
+    }
+
+    this.saturatedModels.delete(event.modelId);
+
+    // Only undo what saturation started; metric-driven escalations recover on their own
+    if (this.saturatedModels.size === 0 && this.saturationTriggerReason !== undefined) {
+      const triggeredBySaturation = this.currentLevel === 'minimal' &&
+        this.appliedActions.size === 1 && this.appliedActions.has(this.saturationTriggerReason);
+      this.saturationTriggerReason = undefined;
+
+      if (triggeredBySaturation) {
+        await this.revertDegradation();
+      }
+    }
+  }
+
   private findStrategyForLevel(level: DegradationLevel): DegradationStrategy | undefined {
     return Array.from(this.activeStrategies.values())
       .find(strategy => strategy.level === level);
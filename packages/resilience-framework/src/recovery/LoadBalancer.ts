@@ -8,6 +8,9 @@
 
 import { ModelIdentity, AITask, AIResponse } from '../types/index.js';
 import { PerformanceMetrics } from '../fallback/FallbackManager.js';
+import { SelectionHeap } from './SelectionHeap.js';
+import { TimerWheelScheduler, ScheduledTaskHandle } from '../core/TimerWheelScheduler.js';
+import type { ConcurrencyLimiter, ConcurrencyLimiterListener } from '../core/ConcurrencyLimiter.js';
 
 /**
  * Load balancing algorithms
@@ -143,13 +146,34 @@ export class LoadBalancer {
   private roundRobinIndex = 0;
   private adaptiveLearning = new Map<string, number>();
   private isActive = false;
-  private monitoringInterval?: NodeJS.Timeout;
+  private monitoringInterval?: ScheduledTaskHandle;
 
   // Performance tracking
   private performanceHistory = new Map<string, PerformanceMetrics[]>();
   private resourceMetrics = new Map<string, ResourceMetrics>();
   private geographicLocations = new Map<string, GeographicLocation>();
 
+  // Models a concurrency limiter reports as saturated; skipped while others have room
+  private concurrencyLimiter: ConcurrencyLimiter | undefined;
+  private limiterListener: ConcurrencyLimiterListener | undefined;
+  private saturatedModels = new Set<string>();
+
+  // Selection structures: rebuilt when membership, health or weights change,
+  // re-scored in O(log n) when load stats change
+  private structuresDirty = true;
+  private availableModels: ModelIdentity[] = [];
+  private priorityOrder: ModelIdentity[] = [];
+  private weightedSchedule: ModelIdentity[] = [];
+  private readonly connectionsHeap = new SelectionHeap(
+    id => this.loadStats.get(id)?.activeConnections ?? Infinity
+  );
+  private readonly responseTimeHeap = new SelectionHeap(
+    id => this.loadStats.get(id)?.averageResponseTime ?? Infinity
+  );
+  private readonly weightedConnectionsHeap = new SelectionHeap(
+    id => (this.loadStats.get(id)?.activeConnections ?? Infinity) / (this.weights.get(id)?.weight || 1)
+  );
+
   constructor(
     private config: LoadBalancingConfig = {
       algorithm: 'adaptive',
@@ -160,7 +184,8 @@ export class LoadBalancer {
       sessionAffinity: false,
       stickySessions: false,
       adaptiveLearning: true,
-    }
+    },
+    private readonly scheduler: TimerWheelScheduler = TimerWheelScheduler.shared()
   ) {}
 
   /**
@@ -172,9 +197,9 @@ export class LoadBalancer {
     }
 
     this.isActive = true;
-    this.monitoringInterval = setInterval(
+    this.monitoringInterval = this.scheduler.schedule(
       () => this.updateLoadStatistics(),
-      this.config.healthCheckInterval
+      { name: 'load-balancer', intervalMs: this.config.healthCheckInterval }
     );
 
     console.log(`⚖️ LoadBalancer started with ${this.config.algorithm} algorithm`);
@@ -191,13 +216,47 @@ export class LoadBalancer {
     this.isActive = false;
 
     if (this.monitoringInterval) {
-      clearInterval(this.monitoringInterval);
+      this.monitoringInterval.cancel();
       this.monitoringInterval = undefined as any;
     }
 
     console.log('⚖️ LoadBalancer stopped');
   }
 
+  /**
+   * Route around models the limiter reports as saturated. Pass undefined to
+   * detach. When every candidate is saturated, selection falls back to all
+   * of them and the limiter queues or sheds.
+   */
+  setConcurrencyLimiter(limiter: ConcurrencyLimiter | undefined): void {
+    if (this.concurrencyLimiter && this.limiterListener) {
+      this.concurrencyLimiter.removeListener(this.limiterListener);
+    }
+
+    this.concurrencyLimiter = limiter;
+    this.limiterListener = undefined;
+    this.saturatedModels.clear();
+    this.structuresDirty = true;
+
+    if (!limiter) return;
+
+    for (const stats of limiter.getAllStatistics()) {
+      if (stats.saturated) this.saturatedModels.add(stats.modelId);
+    }
+
+    this.limiterListener = {
+      onSaturationChange: event => {
+        if (event.type === 'saturated') {
+          this.saturatedModels.add(event.modelId);
+        } else {
+          this.saturatedModels.delete(event.modelId);
+        }
+        this.structuresDirty = true;
+      },
+    };
+    limiter.addListener(this.limiterListener);
+  }
+
   /**
    * Register a model for load balancing
    */
@@ -236,6 +295,7 @@ export class LoadBalancer {
     });
 
     this.healthChecks.set(model.id, true);
+    this.structuresDirty = true;
     console.log(`⚖️ Registered model: ${model.id}`);
   }
 
@@ -252,6 +312,7 @@ export class LoadBalancer {
       this.performanceHistory.delete(modelId);
       this.resourceMetrics.delete(modelId);
       this.geographicLocations.delete(modelId);
+      this.structuresDirty = true;
 
       // Remove sessions for this model
       for (const [sessionId, session] of this.sessions) {
@@ -284,14 +345,12 @@ export class LoadBalancer {
     if (sessionId && this.config.sessionAffinity) {
       const sessionModel = this.getSessionModel(sessionId);
       if (sessionModel && this.isModelHealthy(sessionModel.id)) {
-        return {
-          selectedModel: sessionModel,
+        return this.createDecision(sessionModel, availableModels, {
           algorithm: this.config.algorithm,
           reason: 'session_affinity',
-          alternatives: availableModels.filter(m => m.id !== sessionModel.id),
           confidence: 1.0,
           estimatedResponseTime: this.estimateResponseTime(sessionModel.id),
-        };
+        });
       }
     }
 
@@ -378,6 +437,7 @@ export class LoadBalancer {
     };
 
     this.loadStats.set(modelId, updatedStats);
+    this.refreshSelectionScores(modelId);
 
     // Update health status
     this.updateModelHealth(modelId);
@@ -417,6 +477,7 @@ export class LoadBalancer {
     weights.forEach(weight => {
       this.weights.set(weight.modelId, weight);
     });
+    this.structuresDirty = true;
 
     this.notifyLoadStatsUpdated();
     console.log(`⚖️ Updated weights for ${weights.length} models`);
@@ -542,18 +603,16 @@ export class LoadBalancer {
     const selectedModel = models[this.roundRobinIndex % models.length]!;
     this.roundRobinIndex++;
 
-    return {
-      selectedModel,
+    return this.createDecision(selectedModel, models, {
       algorithm: 'round_robin',
       reason: `Round robin selection (index: ${this.roundRobinIndex - 1})`,
-      alternatives: models.filter(m => m.id !== selectedModel.id),
       confidence: 0.8,
       estimatedResponseTime: this.estimateResponseTime(selectedModel.id),
-    };
+    });
   }
 
   private applyWeightedRoundRobin(models: ModelIdentity[]): LoadBalancingDecision {
-    const weightedModels = this.createWeightedModelList(models);
+    const weightedModels = this.weightedSchedule;
 
     if (weightedModels.length === 0) {
       throw new Error('No weighted models available for selection');
@@ -564,159 +623,121 @@ export class LoadBalancer {
 
     const weight = this.weights.get(selectedModel.id)?.weight || 1;
 
-    return {
-      selectedModel,
+    return this.createDecision(selectedModel, models, {
       algorithm: 'weighted_round_robin',
       reason: `Weighted round robin (weight: ${weight})`,
-      alternatives: models.filter(m => m.id !== selectedModel.id),
       confidence: 0.85,
       estimatedResponseTime: this.estimateResponseTime(selectedModel.id),
-    };
+    });
   }
 
   private applyLeastConnections(models: ModelIdentity[]): LoadBalancingDecision {
-    const selectedModel = models.reduce((best, current) => {
-      const bestStats = this.loadStats.get(best.id);
-      const currentStats = this.loadStats.get(current.id);
-
-      if (!bestStats) return current;
-      if (!currentStats) return best;
-
-      return currentStats.activeConnections < bestStats.activeConnections ? current : best;
-    });
-
+    const selectedModel = this.peekHeap(this.connectionsHeap);
     const connections = this.loadStats.get(selectedModel.id)?.activeConnections || 0;
 
-    return {
-      selectedModel,
+    return this.createDecision(selectedModel, models, {
       algorithm: 'least_connections',
       reason: `Least connections (${connections} active)`,
-      alternatives: models.filter(m => m.id !== selectedModel.id),
       confidence: 0.9,
       estimatedResponseTime: this.estimateResponseTime(selectedModel.id),
-    };
+    });
   }
 
   private applyLeastResponseTime(models: ModelIdentity[]): LoadBalancingDecision {
-    const selectedModel = models.reduce((best, current) => {
-      const bestStats = this.loadStats.get(best.id);
-      const currentStats = this.loadStats.get(current.id);
-
-      if (!bestStats) return current;
-      if (!currentStats) return best;
-
-      return currentStats.averageResponseTime < bestStats.averageResponseTime ? current : best;
-    });
-
+    const selectedModel = this.peekHeap(this.responseTimeHeap);
     const responseTime = this.loadStats.get(selectedModel.id)?.averageResponseTime || 0;
 
-    return {
-      selectedModel,
+    return this.createDecision(selectedModel, models, {
       algorithm: 'least_response_time',
       reason: `Fastest response time (${responseTime.toFixed(0)}ms avg)`,
-      alternatives: models.filter(m => m.id !== selectedModel.id),
       confidence: 0.95,
       estimatedResponseTime: responseTime,
-    };
+    });
   }
 
   private applyWeightedLeastConnections(models: ModelIdentity[]): LoadBalancingDecision {
-    const selectedModel = models.reduce((best, current) => {
-      const bestStats = this.loadStats.get(best.id);
-      const currentStats = this.loadStats.get(current.id);
-      const bestWeight = this.weights.get(best.id)?.weight || 1;
-      const currentWeight = this.weights.get(current.id)?.weight || 1;
-
-      if (!bestStats) return current;
-      if (!currentStats) return best;
-
-      const bestRatio = bestStats.activeConnections / bestWeight;
-      const currentRatio = currentStats.activeConnections / currentWeight;
-
-      return currentRatio < bestRatio ? current : best;
-    });
+    const selectedModel = this.peekHeap(this.weightedConnectionsHeap);
 
     const stats = this.loadStats.get(selectedModel.id);
     const weight = this.weights.get(selectedModel.id)?.weight || 1;
     const ratio = (stats?.activeConnections || 0) / weight;
 
-    return {
-      selectedModel,
+    return this.createDecision(selectedModel, models, {
       algorithm: 'weighted_least_connections',
       reason: `Weighted least connections (ratio: ${ratio.toFixed(2)})`,
-      alternatives: models.filter(m => m.id !== selectedModel.id),
       confidence: 0.92,
       estimatedResponseTime: this.estimateResponseTime(selectedModel.id),
-    };
+    });
   }
 
   private applyResourceBased(models: ModelIdentity[]): LoadBalancingDecision {
-    const selectedModel = models.reduce((best, current) => {
-      const bestResources = this.resourceMetrics.get(best.id);
-      const currentResources = this.resourceMetrics.get(current.id);
-
-      if (!bestResources) return current;
-      if (!currentResources) return best;
+    let selectedModel = models[models.length - 1]!;
+    let bestLoad = Infinity;
 
-      const bestLoad = (bestResources.cpu + bestResources.memory) / 2;
-      const currentLoad = (currentResources.cpu + currentResources.memory) / 2;
+    for (const model of models) {
+      const resources = this.resourceMetrics.get(model.id);
+      if (!resources) continue;
 
-      return currentLoad < bestLoad ? current : best;
-    });
+      const load = (resources.cpu + resources.memory) / 2;
+      if (load < bestLoad) {
+        bestLoad = load;
+        selectedModel = model;
+      }
+    }
 
-    const resources = this.resourceMetrics.get(selectedModel.id);
-    const load = resources ? (resources.cpu + resources.memory) / 2 : 0;
+    const load = bestLoad === Infinity ? 0 : bestLoad;
 
-    return {
-      selectedModel,
+    return this.createDecision(selectedModel, models, {
       algorithm: 'resource_based',
       reason: `Lowest resource utilization (${(load * 100).toFixed(1)}%)`,
-      alternatives: models.filter(m => m.id !== selectedModel.id),
       confidence: 0.88,
       estimatedResponseTime: this.estimateResponseTime(selectedModel.id),
-    };
+    });
   }
 
   private applyAdaptive(models: ModelIdentity[], task: AITask): LoadBalancingDecision {
     // Combine multiple factors with adaptive weights
-    const scores = models.map(model => {
-      const stats = this.loadStats.get(model.id);
-      const weight = this.weights.get(model.id);
-      const resources = this.resourceMetrics.get(model.id);
-      const learning = this.adaptiveLearning.get(model.id) || 0.5;
-
-      if (!stats || !weight) return { model, score: 0 };
-
-      // Calculate composite score
-      const responseTimeScore = Math.max(0, 1 - (stats.averageResponseTime / 10000));
-      const loadScore = Math.max(0, 1 - stats.currentLoad);
-      const healthScore = stats.healthScore;
-      const weightScore = weight.weight;
-      const resourceScore = resources ? 1 - ((resources.cpu + resources.memory) / 2) : 0.5;
-      const learningScore = learning;
-
-      const score = (
-        responseTimeScore * 0.25 +
-        loadScore * 0.20 +
-        healthScore * 0.20 +
-        weightScore * 0.15 +
-        resourceScore * 0.10 +
-        learningScore * 0.10
-      );
-
-      return { model, score };
-    });
+    let best = { model: models[0]!, score: -Infinity };
 
-    const best = scores.reduce((a, b) => a.score > b.score ? a : b);
+    for (const model of models) {
+      const score = this.adaptiveScore(model.id);
+      if (score >= best.score) {
+        best = { model, score };
+      }
+    }
 
-    return {
-      selectedModel: best.model,
+    return this.createDecision(best.model, models, {
       algorithm: 'adaptive',
       reason: `Adaptive selection (score: ${best.score.toFixed(3)})`,
-      alternatives: models.filter(m => m.id !== best.model.id),
       confidence: best.score,
       estimatedResponseTime: this.estimateResponseTime(best.model.id),
-    };
+    });
+  }
+
+  private adaptiveScore(modelId: string): number {
+    const stats = this.loadStats.get(modelId);
+    const weight = this.weights.get(modelId);
+    const resources = this.resourceMetrics.get(modelId);
+    const learning = this.adaptiveLearning.get(modelId) || 0.5;
+
+    if (!stats || !weight) return 0;
+
+    // Calculate composite score
+    const responseTimeScore = Math.max(0, 1 - (stats.averageResponseTime / 10000));
+    const loadScore = Math.max(0, 1 - stats.currentLoad);
+    const healthScore = stats.healthScore;
+    const weightScore = weight.weight;
+    const resourceScore = resources ? 1 - ((resources.cpu + resources.memory) / 2) : 0.5;
+    const learningScore = learning;
+
+    return (
+      responseTimeScore * 0.25 +
+      loadScore * 0.20 +
+      healthScore * 0.20 +
+      weightScore * 0.15 +
+      resourceScore * 0.10 +
+      learningScore * 0.10
+    );
   }
 
   private applyGeographic(models: ModelIdentity[], clientLocation?: GeographicLocation): LoadBalancingDecision {
@@ -725,60 +746,117 @@ export class LoadBalancer {
       return this.applyLeastResponseTime(models);
     }
 
-    const distances = models.map(model => {
-      const modelLocation = this.geographicLocations.get(model.id);
-      if (!modelLocation) return { model, distance: Infinity };
-
-      const distance = this.calculateDistance(clientLocation, modelLocation);
-      return { model, distance };
-    });
+    let closest = { model: models[0]!, distance: Infinity };
 
-    const closest = distances.reduce((a, b) => a.distance < b.distance ? a : b);
+    for (const model of models) {
+      const modelLocation = this.geographicLocations.get(model.id);
+      const distance = modelLocation ? this.calculateDistance(clientLocation, modelLocation) : Infinity;
+      if (distance <= closest.distance) {
+        closest = { model, distance };
+      }
+    }
 
-    return {
-      selectedModel: closest.model,
+    return this.createDecision(closest.model, models, {
       algorithm: 'geographic',
       reason: `Closest geographic location (${closest.distance.toFixed(0)}km)`,
-      alternatives: models.filter(m => m.id !== closest.model.id),
       confidence: 0.85,
       estimatedResponseTime: this.estimateResponseTime(closest.model.id),
-    };
+    });
   }
 
   private applyPriorityBased(models: ModelIdentity[]): LoadBalancingDecision {
-    const priorityModels = models
-      .map(model => ({
-        model,
-        priority: this.weights.get(model.id)?.priority || 1,
-      }))
-      .sort((a, b) => b.priority - a.priority);
-
-    if (priorityModels.length === 0) {
+    if (this.priorityOrder.length === 0) {
       throw new Error('No priority models available for selection');
     }
 
-    // Select highest priority model that's healthy
-    const selectedModel = priorityModels[0]!.model;
+    // Highest priority available model
+    const selectedModel = this.priorityOrder[0]!;
+    const priority = this.weights.get(selectedModel.id)?.priority || 1;
 
-    return {
-      selectedModel,
+    return this.createDecision(selectedModel, models, {
       algorithm: 'priority_based',
-      reason: `Highest priority (${priorityModels[0]!.priority})`,
-      alternatives: models.filter(m => m.id !== selectedModel.id),
+      reason: `Highest priority (${priority})`,
       confidence: 0.9,
       estimatedResponseTime: this.estimateResponseTime(selectedModel.id),
-    };
+    });
+  }
+
+  /**
+   * Build a decision whose alternatives are only materialized when read
+   */
+  private createDecision(
+    selectedModel: ModelIdentity,
+    pool: readonly ModelIdentity[],
+    fields: Omit<LoadBalancingDecision, 'selectedModel' | 'alternatives'>
+  ): LoadBalancingDecision {
+    let alternatives: ModelIdentity[] | undefined;
+
+    return Object.defineProperty({ selectedModel, ...fields }, 'alternatives', {
+      enumerable: true,
+      get: () => (alternatives ??= pool.filter(m => m.id !== selectedModel.id)),
+    }) as LoadBalancingDecision;
+  }
+
+  private peekHeap(heap: SelectionHeap): ModelIdentity {
+    const modelId = heap.peek();
+    const model = modelId !== undefined ? this.models.get(modelId) : undefined;
+
+    if (!model) {
+      throw new Error('No available models for load balancing');
+    }
+    return model;
   }
 
   /**
    * Helper methods
    */
   private getAvailableModels(): ModelIdentity[] {
-    return Array.from(this.models.values()).filter(model => {
+    this.ensureSelectionStructures();
+    return this.availableModels;
+  }
+
+  /**
+   * Rebuild the candidate structures after membership, health or weight changes.
+   * The previous arrays are replaced, never mutated, so decisions holding
+   * them keep a consistent snapshot.
+   */
+  private ensureSelectionStructures(): void {
+    if (!this.structuresDirty) return;
+    this.structuresDirty = false;
+
+    const healthyModels = Array.from(this.models.values()).filter(model => {
       const weight = this.weights.get(model.id);
       const isHealthy = this.healthChecks.get(model.id);
       return weight?.enabled && isHealthy;
     });
+
+    const unsaturatedModels = this.saturatedModels.size > 0
+      ? healthyModels.filter(model => !this.saturatedModels.has(model.id))
+      : healthyModels;
+    this.availableModels = unsaturatedModels.length > 0 ? unsaturatedModels : healthyModels;
+
+    const ids = this.availableModels.map(model => model.id);
+    this.connectionsHeap.rebuild(ids);
+    this.responseTimeHeap.rebuild(ids);
+    this.weightedConnectionsHeap.rebuild(ids);
+
+    // Stable sort keeps registration order among equal priorities
+    this.priorityOrder = this.availableModels
+      .slice()
+      .sort((a, b) => (this.weights.get(b.id)?.priority || 1) - (this.weights.get(a.id)?.priority || 1));
+
+    this.weightedSchedule = this.createWeightedModelList(this.availableModels);
+  }
+
+  /**
+   * Re-score a model in the selection heaps after its load stats changed
+   */
+  private refreshSelectionScores(modelId: string): void {
+    if (this.structuresDirty) return;
+
+    this.connectionsHeap.update(modelId);
+    this.responseTimeHeap.update(modelId);
+    this.weightedConnectionsHeap.update(modelId);
   }
 
   private isModelHealthy(modelId: string): boolean {
@@ -826,6 +904,7 @@ export class LoadBalancer {
     };
 
     this.loadStats.set(modelId, updatedStats);
+    this.refreshSelectionScores(modelId);
   }
 
   private calculateCurrentLoad(modelId: string): number {
@@ -875,21 +954,35 @@ export class LoadBalancer {
     this.healthChecks.set(modelId, isHealthy);
 
     if (wasHealthy !== isHealthy) {
+      this.structuresDirty = true;
       this.notifyModelHealthChanged(modelId, isHealthy);
     }
   }
 
+  /**
+   * One weighted round-robin cycle, interleaved with smooth WRR so heavy
+   * models are spread across the cycle instead of served back to back
+   */
   private createWeightedModelList(models: ModelIdentity[]): ModelIdentity[] {
-    const weighted: ModelIdentity[] = [];
-
-    models.forEach(model => {
+    const counts = models.map(model => {
       const weight = this.weights.get(model.id)?.weight || 1;
-      const count = Math.max(1, Math.round(weight * 10)); // Scale weight to count
+      return Math.max(1, Math.round(weight * 10)); // Scale weight to count
+    });
+    const total = counts.reduce((sum, count) => sum + count, 0);
+    const current = new Array<number>(models.length).fill(0);
+    const weighted: ModelIdentity[] = [];
 
-      for (let i = 0; i < count; i++) {
-        weighted.push(model);
+    for (let n = 0; n < total; n++) {
+      let selected = 0;
+      for (let i = 0; i < models.length; i++) {
+        current[i] = current[i]! + counts[i]!;
+        if (current[i]! > current[selected]!) {
+          selected = i;
+        }
       }
-    });
+      current[selected] = current[selected]! - total;
+      weighted.push(models[selected]!);
+    }
 
     return weighted;
   }
@@ -976,6 +1069,7 @@ export class LoadBalancer {
         activeConnections: stats.activeConnections + 1,
         lastUsed: new Date(),
       });
+      this.refreshSelectionScores(decision.selectedModel.id);
     }
 
     this.notifyModelSelected(decision);
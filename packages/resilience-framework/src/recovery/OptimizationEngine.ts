@@ -8,6 +8,23 @@
 
 import { ModelIdentity, AITask } from '../types/index.js';
 import { PerformanceMetrics } from '../fallback/FallbackManager.js';
+import { TimerWheelScheduler, ScheduledTaskHandle } from '../core/TimerWheelScheduler.js';
+import { Tracer, summarizeSpans, SpanLatencyBreakdown } from '../monitoring/Tracer.js';
+
+/**
+ * Traced spans older than this are ignored by bottleneck analysis
+ */
+const TRACE_ANALYSIS_WINDOW_MS = 5 * 60 * 1000;
+
+/**
+ * Minimum traced attempts before span-derived findings are trusted
+ */
+const MIN_TRACED_ATTEMPTS = 20;
+
+/**
+ * Share of traced time above which a phase counts as a bottleneck
+ */
+const PHASE_SHARE_THRESHOLD = 0.3;
 
 /**
  * Optimization strategy types
@@ -212,8 +229,10 @@ export class OptimizationEngine {
   private listeners = new Set<OptimizationListener>();
   private mlModel?: MLOptimizationModel;
   private isActive = false;
-  private monitoringInterval?: NodeJS.Timeout;
-  private optimizationInterval?: NodeJS.Timeout;
+  private monitoringInterval?: ScheduledTaskHandle;
+  private optimizationInterval?: ScheduledTaskHandle;
+  // Span summaries for the monitoring tick in progress, computed once per tick
+  private tickBreakdowns: Map<string, SpanLatencyBreakdown> | undefined;
 
   // Optimization state
   private resourceAllocations = new Map<string, ResourceAllocation>();
@@ -230,7 +249,8 @@ export class OptimizationEngine {
     monitoringInterval: 30000, // 30 seconds
     optimizationInterval: 300000, // 5 minutes
     rollbackOnFailure: true,
-  }) {
+  }, private readonly scheduler: TimerWheelScheduler = TimerWheelScheduler.shared(),
+     private readonly tracer: Tracer = Tracer.shared()) {
     this.config = config;
     this.initializeTechniqueEffectiveness();
   }
@@ -246,15 +266,15 @@ export class OptimizationEngine {
     this.isActive = true;
 
     // Start monitoring
-    this.monitoringInterval = setInterval(
+    this.monitoringInterval = this.scheduler.schedule(
       () => this.monitorPerformance(),
-      this.config.monitoringInterval
+      { name: 'optimization-monitoring', intervalMs: this.config.monitoringInterval }
     );
 
     // Start optimization cycles
-    this.optimizationInterval = setInterval(
+    this.optimizationInterval = this.scheduler.schedule(
       () => this.runOptimizationCycle(),
-      this.config.optimizationInterval
+      { name: 'optimization-cycle', intervalMs: this.config.optimizationInterval }
     );
 
     console.log('🚀 OptimizationEngine started with strategy:', this.config.strategy);
@@ -271,12 +291,12 @@ export class OptimizationEngine {
     this.isActive = false;
 
     if (this.monitoringInterval) {
-      clearInterval(this.monitoringInterval);
+      this.monitoringInterval.cancel();
       this.monitoringInterval = undefined as any;
     }
 
     if (this.optimizationInterval) {
-      clearInterval(this.optimizationInterval);
+      this.optimizationInterval.cancel();
       this.optimizationInterval = undefined as any;
     }
 
@@ -420,6 +440,14 @@ export class OptimizationEngine {
     return recommendations;
   }
 
+  /**
+   * Split of recently traced time for a component (model ID or `bip.<operation>`),
+   * from head-sampled spans in the tracer's ring buffer
+   */
+  getLatencyBreakdown(component: string): SpanLatencyBreakdown | null {
+    return (this.tickBreakdowns ?? this.getTracedBreakdowns()).get(component) ?? null;
+  }
+
   /**
    * Get optimization status
    */
@@ -524,8 +552,10 @@ export class OptimizationEngine {
    * Monitor performance across all components
    */
   private async monitorPerformance(): Promise<void> {
+    this.tickBreakdowns = this.getTracedBreakdowns();
     try {
-      for (const [component] of this.performanceHistory) {
+      const components = new Set([...this.performanceHistory.keys(), ...this.tickBreakdowns.keys()]);
+      for (const component of components) {
         const metrics = this.getCurrentMetrics(component);
         if (!metrics) continue;
 
@@ -543,6 +573,8 @@ export class OptimizationEngine {
       }
     } catch (error) {
       console.error('🚀 Error during performance monitoring:', error);
+    } finally {
+      this.tickBreakdowns = undefined;
     }
   }
 
@@ -691,6 +723,8 @@ export class OptimizationEngine {
       });
     }
 
+    bottlenecks.push(...this.analyzeTracedPhases(component));
+
     // Store bottleneck analysis
     bottlenecks.forEach(bottleneck => {
       this.bottleneckHistory.push(bottleneck);
@@ -705,6 +739,100 @@ export class OptimizationEngine {
     return bottlenecks;
   }
 
+  /**
+   * Bottlenecks visible in traced spans: time queued behind other requests,
+   * asleep in retry backoff, or rejected by an open circuit breaker
+   */
+  private analyzeTracedPhases(component: string): BottleneckAnalysis[] {
+    const breakdown = this.getLatencyBreakdown(component);
+    if (!breakdown || breakdown.requests + breakdown.modelCalls + breakdown.breakerRejections < MIN_TRACED_ATTEMPTS) {
+      return [];
+    }
+
+    // Whole requests when the component owns root spans, otherwise the phases themselves
+    const total = Math.max(
+      breakdown.requestMs,
+      breakdown.modelCallMs + breakdown.queueMs + breakdown.backoffMs + breakdown.breakerRejectionMs
+    );
+    if (total <= 0) {
+      return [];
+    }
+
+    const bottlenecks: BottleneckAnalysis[] = [];
+    const queueShare = breakdown.queueMs / total;
+    const backoffShare = breakdown.backoffMs / total;
+    const rejectionRate = breakdown.breakerCalls > 0 ? breakdown.breakerRejections / breakdown.breakerCalls : 0;
+    const percent = (share: number) => `${(share * 100).toFixed(0)}%`;
+
+    if (queueShare > PHASE_SHARE_THRESHOLD) {
+      bottlenecks.push({
+        type: 'queue_congestion',
+        severity: queueShare > 0.6 ? 'critical' : 'high',
+        component,
+        impact: queueShare,
+        root_cause: `Requests spend ${percent(queueShare)} of traced time queued`,
+        confidence: 0.9,
+        recommendations: [
+          {
+            technique: 'resource_scaling',
+            priority: 'high',
+            estimatedImprovement: Math.round(queueShare * 100),
+            estimatedEffort: 'medium',
+            riskLevel: 'medium',
+            rationale: 'Add capacity so queued requests start immediately',
+            parameters: { queueShare },
+          },
+        ],
+      });
+    }
+
+    if (backoffShare > PHASE_SHARE_THRESHOLD) {
+      bottlenecks.push({
+        type: 'resource_contention',
+        severity: backoffShare > 0.6 ? 'critical' : 'high',
+        component,
+        impact: backoffShare,
+        root_cause: `Retry backoff accounts for ${percent(backoffShare)} of traced time`,
+        confidence: 0.85,
+        recommendations: [
+          {
+            technique: 'intelligent_routing',
+            priority: 'high',
+            estimatedImprovement: Math.round(backoffShare * 100),
+            estimatedEffort: 'low',
+            riskLevel: 'low',
+            rationale: 'Route away from a model that keeps failing instead of sleeping between retries',
+            parameters: { backoffShare, backoffs: breakdown.backoffs },
+          },
+        ],
+      });
+    }
+
+    if (rejectionRate > PHASE_SHARE_THRESHOLD) {
+      bottlenecks.push({
+        type: 'resource_contention',
+        severity: rejectionRate > 0.6 ? 'critical' : 'high',
+        component,
+        impact: rejectionRate,
+        root_cause: `Circuit breaker rejects ${percent(rejectionRate)} of calls`,
+        confidence: 0.9,
+        recommendations: [
+          {
+            technique: 'intelligent_routing',
+            priority: 'critical',
+            estimatedImprovement: Math.round(rejectionRate * 100),
+            estimatedEffort: 'low',
+            riskLevel: 'low',
+            rationale: 'Send traffic to healthy models while the breaker is open',
+            parameters: { rejectionRate },
+          },
+        ],
+      });
+    }
+
+    return bottlenecks;
+  }
+
   /**
    * Execute optimization technique
    */
@@ -873,7 +1001,55 @@ export class OptimizationEngine {
 
   private getCurrentMetrics(component: string): PerformanceMetrics | null {
     const history = this.performanceHistory.get(component);
-    return history && history.length > 0 ? history[history.length - 1] || null : null;
+    if (history && history.length > 0) {
+      return history[history.length - 1] || null;
+    }
+    return this.metricsFromTraces(component);
+  }
+
+  /**
+   * Performance metrics derived from traced model calls, for components
+   * nobody reports metrics for
+   */
+  private metricsFromTraces(component: string): PerformanceMetrics | null {
+    const breakdown = this.getLatencyBreakdown(component);
+    if (!breakdown) {
+      return null;
+    }
+
+    // Whole requests for operation components, individual attempts for models
+    let requests: number;
+    let failures: number;
+    let totalMs: number;
+    if (breakdown.requests > 0) {
+      requests = breakdown.requests;
+      failures = breakdown.requestErrors;
+      totalMs = breakdown.requestMs;
+    } else if (breakdown.modelCalls > 0) {
+      requests = breakdown.modelCalls + breakdown.breakerRejections;
+      failures = breakdown.modelCallErrors + breakdown.breakerRejections;
+      totalMs = breakdown.modelCallMs + breakdown.queueMs + breakdown.backoffMs + breakdown.breakerRejectionMs;
+    } else {
+      return null;
+    }
+
+    const spanSeconds = (breakdown.lastSpanTime - breakdown.firstSpanTime) / 1000;
+    return {
+      modelId: component,
+      averageResponseTime: totalMs / requests,
+      successRate: 1 - failures / requests,
+      errorRate: failures / requests,
+      lastUpdated: new Date(breakdown.lastSpanTime),
+      requestCount: requests,
+      ...(breakdown.modelCalls > 0 && { p95ResponseTime: breakdown.p95ModelCallMs }),
+      ...(spanSeconds > 0 && { throughputRps: requests / spanSeconds }),
+    };
+  }
+
+  private getTracedBreakdowns(): Map<string, SpanLatencyBreakdown> {
+    return summarizeSpans(this.tracer.getBuffer().toArray(Date.now() - TRACE_ANALYSIS_WINDOW_MS), {
+      headSampledOnly: true,
+    });
   }
 
   private areTargetsMet(metrics: PerformanceMetrics, targets: PerformanceTarget): boolean {
@@ -0,0 +1,174 @@
+/**
+ * Indexed Selection Heap
+ * BIP-03 Implementation - Phase 4: Advanced Features
+ *
+ * Binary min-heap over string keys with a position index, so a key whose
+ * score changed can be sifted in O(log n) instead of rescanning every
+ * candidate. Used by the load balancer for least-connections style picks.
+ *
+ * @author Claude-4-Sonnet (Anthropic)
+ * @version 1.0.0
+ */
+
+/**
+ * Min-heap keyed by id; ties are broken by insertion order
+ */
+export class SelectionHeap {
+  private keys: string[] = [];
+  private scores: number[] = [];
+  private sequence: number[] = [];
+  private positions = new Map<string, number>();
+  private nextSequence = 0;
+
+  constructor(private readonly score: (key: string) => number) {}
+
+  /**
+   * Number of keys in the heap
+   */
+  get size(): number {
+    return this.keys.length;
+  }
+
+  /**
+   * Key with the lowest score, if any
+   */
+  peek(): string | undefined {
+    return this.keys[0];
+  }
+
+  /**
+   * Check whether a key is in the heap
+   */
+  has(key: string): boolean {
+    return this.positions.has(key);
+  }
+
+  /**
+   * Replace the contents with the given keys in O(n)
+   */
+  rebuild(keys: readonly string[]): void {
+    this.keys = keys.slice();
+    this.scores = keys.map(key => this.score(key));
+    this.sequence = keys.map((_, i) => i);
+    this.nextSequence = keys.length;
+    this.positions = new Map(keys.map((key, i) => [key, i]));
+
+    for (let i = (this.keys.length >> 1) - 1; i >= 0; i--) {
+      this.siftDown(i);
+    }
+  }
+
+  /**
+   * Add a key, or re-score it if already present
+   */
+  insert(key: string): void {
+    if (this.positions.has(key)) {
+      this.update(key);
+      return;
+    }
+
+    const index = this.keys.length;
+    this.keys.push(key);
+    this.scores.push(this.score(key));
+    this.sequence.push(this.nextSequence++);
+    this.positions.set(key, index);
+    this.siftUp(index);
+  }
+
+  /**
+   * Remove a key
+   */
+  remove(key: string): boolean {
+    const index = this.positions.get(key);
+    if (index === undefined) return false;
+
+    const last = this.keys.length - 1;
+    this.swap(index, last);
+    this.keys.pop();
+    this.scores.pop();
+    this.sequence.pop();
+    this.positions.delete(key);
+
+    if (index < this.keys.length) {
+      this.siftDown(index);
+      this.siftUp(index);
+    }
+    return true;
+  }
+
+  /**
+   * Re-read the score of a key after it changed
+   */
+  update(key: string): void {
+    const index = this.positions.get(key);
+    if (index === undefined) return;
+
+    const previous = this.scores[index]!;
+    const current = this.score(key);
+    if (current === previous) return;
+
+    this.scores[index] = current;
+    if (current < previous) {
+      this.siftUp(index);
+    } else {
+      this.siftDown(index);
+    }
+  }
+
+  private less(a: number, b: number): boolean {
+    const scoreA = this.scores[a]!;
+    const scoreB = this.scores[b]!;
+    if (scoreA !== scoreB) {
+      // NaN scores sort last, like an unknown value in a linear scan
+      if (Number.isNaN(scoreA)) return false;
+      if (Number.isNaN(scoreB)) return true;
+      return scoreA < scoreB;
+    }
+    return this.sequence[a]! < this.sequence[b]!;
+  }
+
+  private siftUp(index: number): void {
+    while (index > 0) {
+      const parent = (index - 1) >> 1;
+      if (!this.less(index, parent)) break;
+      this.swap(index, parent);
+      index = parent;
+    }
+  }
+
+  private siftDown(index: number): void {
+    const length = this.keys.length;
+
+    for (;;) {
+      const left = 2 * index + 1;
+      const right = left + 1;
+      let smallest = index;
+
+      if (left < length && this.less(left, smallest)) smallest = left;
+      if (right < length && this.less(right, smallest)) smallest = right;
+      if (smallest === index) break;
+
+      this.swap(index, smallest);
+      index = smallest;
+    }
+  }
+
+  private swap(a: number, b: number): void {
+    if (a === b) return;
+
+    const key = this.keys[a]!;
+    this.keys[a] = this.keys[b]!;
+    this.keys[b] = key;
+
+    const score = this.scores[a]!;
+    this.scores[a] = this.scores[b]!;
+    this.scores[b] = score;
+
+    const sequence = this.sequence[a]!;
+    this.sequence[a] = this.sequence[b]!;
+    this.sequence[b] = sequence;
+
+    this.positions.set(this.keys[a]!, a);
+    this.positions.set(this.keys[b]!, b);
+  }
+}
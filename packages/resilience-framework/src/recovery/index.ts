@@ -6,5 +6,7 @@
 export * from './DegradationController.js';
 export * from './AutoRecovery.js';
 export * from './LoadBalancer.js';
+export * from './SelectionHeap.js';
 export * from './ChaosTestSuite.js';
+export * from './ChaosBenchmark.js';
 export * from './OptimizationEngine.js';
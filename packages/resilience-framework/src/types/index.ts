@@ -51,6 +51,23 @@ export interface CircuitBreakerConfig {
   readonly timeout: number; // request timeout in milliseconds
 }
 
+/**
+ * Sliding window aggregation for circuit breakers
+ */
+export type SlidingWindowType = 'count' | 'time';
+
+/**
+ * Sliding-window circuit breaker configuration (failure/slow-call rates)
+ */
+export interface SlidingWindowCircuitBreakerConfig extends CircuitBreakerConfig {
+  readonly slidingWindowType: SlidingWindowType;
+  readonly slidingWindowSize: number; // calls ('count') or seconds ('time')
+  readonly minimumNumberOfCalls: number; // calls needed before rates are evaluated
+  readonly failureRateThreshold: number; // percentage of failed calls that opens the circuit
+  readonly slowCallRateThreshold: number; // percentage of slow calls that opens the circuit
+  readonly slowCallDurationThreshold: number; // milliseconds above which a call is slow
+}
+
 /**
  * Circuit breaker status
  */
@@ -71,13 +88,22 @@ export interface RetryOptions {
   readonly maxDelay: number; // maximum delay in milliseconds
   readonly backoffMultiplier: number; // exponential backoff multiplier
   readonly jitter: boolean; // add random jitter to delays
+  readonly jitterMode?: JitterMode; // how jitter is applied when enabled, default 'proportional'
   readonly retryableErrors?: string[]; // specific error types to retry
 }
 
+/**
+ * Retry jitter modes
+ * - proportional: exponential delay +/- 10%
+ * - full: uniform in [0, exponential delay]
+ * - decorrelated: uniform in [baseDelay, 3 * previous delay], capped at maxDelay
+ */
+export type JitterMode = 'proportional' | 'full' | 'decorrelated';
+
 /**
  * Fallback strategy types
  */
-export type FallbackStrategy = 'sequential' | 'parallel' | 'weighted' | 'random';
+export type FallbackStrategy = 'sequential' | 'parallel' | 'weighted' | 'random' | 'hedged';
 
 /**
  * Fallback configuration
@@ -88,6 +114,9 @@ export interface FallbackConfig {
   readonly strategy: FallbackStrategy;
   readonly maxConcurrent?: number; // for parallel strategy
   readonly weights?: Record<string, number>; // for weighted strategy
+  readonly hedgePercentile?: number; // for hedged strategy: latency percentile (0-100) that triggers a hedge, default 95
+  readonly hedgeDelay?: number; // for hedged strategy: delay (ms) used until enough latency samples exist
+  readonly maxHedges?: number; // for hedged strategy: extra in-flight requests allowed, default 1
   readonly timeout: number; // overall timeout for fallback execution
 }
 
@@ -242,6 +271,8 @@ export interface ResilienceExecutionResult<T = unknown> {
   readonly fallbackUsed: boolean;
   readonly retryCount: number;
   readonly circuitBreakerTriggered: boolean;
+  readonly hedgeCount?: number; // hedged strategy: requests launched while another was in flight
+  readonly wastedWorkMs?: number; // hedged strategy: time spent on requests that were cancelled
   readonly error?: Error;
   readonly metadata?: Record<string, unknown>;
 }
@@ -300,6 +331,34 @@ export class AllModelsFailedError extends ResilienceError {
   }
 }
 
+/**
+ * Request cancelled through its AbortSignal. Circuit breakers do not count it
+ * as a success or a failure: it says nothing about the model's health.
+ */
+export class RequestCancelledError extends ResilienceError {
+  constructor(modelId: string) {
+    super(
+      `Request to model ${modelId} was cancelled`,
+      'REQUEST_CANCELLED',
+      modelId,
+      false
+    );
+    this.name = 'RequestCancelledError';
+  }
+}
+
+export class LoadShedError extends ResilienceError {
+  constructor(modelId: string, reason: string) {
+    super(
+      `Request to model ${modelId} was shed: ${reason}`,
+      'LOAD_SHED',
+      modelId,
+      false
+    );
+    this.name = 'LoadShedError';
+  }
+}
+
 /**
  * Alert notification channels
  */
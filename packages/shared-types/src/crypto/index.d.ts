@@ -48,6 +48,8 @@ export interface KeyStorageEntry {
     readonly expiresAt: Date;
     /** Key usage metadata */
     metadata: KeyMetadata;
+    /** Key derivation parameters (absent on legacy entries: PBKDF2-SHA256, 100000 iterations) */
+    readonly kdf?: KdfParameters;
 }
 /**
  * Metadata for stored keys
@@ -66,6 +68,21 @@ export interface KeyMetadata {
     /** Last used timestamp */
     readonly lastUsed?: Date;
 }
+/**
+ * Key derivation parameters recorded with a stored key
+ */
+export interface KdfParameters {
+    /** Derivation function */
+    readonly algorithm: 'pbkdf2-sha256' | 'scrypt';
+    /** PBKDF2 iteration count */
+    readonly iterations?: number;
+    /** scrypt CPU/memory cost (N) */
+    readonly cost?: number;
+    /** scrypt block size (r) */
+    readonly blockSize?: number;
+    /** scrypt parallelization (p) */
+    readonly parallelization?: number;
+}
 /**
  * Signature verification result
  */
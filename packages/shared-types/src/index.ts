@@ -16,3 +16,6 @@ export * from './api/index.js';
 // Common utility types
 export * from './common/index.js';
 
+// Precompiled governance schema validators
+export * from './schemas/index.js';
+
@@ -0,0 +1,70 @@
+/**
+ * @fileoverview Precompiled validators for the governance JSON schemas
+ * The validators in validators.ts are generated from gov/schemas by
+ * scripts/compile_schemas.js. Schema detection follows the same rules as
+ * scripts/validate_schema.py so both tools pick the same schema for a file.
+ * @author CMMV-Hive Team
+ * @version 1.0.0
+ */
+
+import { SCHEMA_NAMES, schemaValidators, type SchemaName } from './validators.js';
+import type { SchemaValidationError, SchemaValidationResult } from './types.js';
+
+export * from './types.js';
+export { SCHEMA_NAMES, type SchemaName } from './validators.js';
+
+/**
+ * File names that identify a schema without a `$schema` reference
+ */
+const SCHEMA_FILE_NAMES: Readonly<Record<string, SchemaName>> = {
+  'final_report.json': 'minutes_report',
+};
+
+/**
+ * Whether a string names a known schema
+ */
+export function isSchemaName(name: string): name is SchemaName {
+  return (SCHEMA_NAMES as readonly string[]).includes(name);
+}
+
+/**
+ * Validate a parsed document against a schema
+ */
+export function validateSchema(name: SchemaName, data: unknown): SchemaValidationResult {
+  const errors: SchemaValidationError[] = [];
+  schemaValidators[name](data, '', errors);
+  return { valid: errors.length === 0, errors };
+}
+
+/**
+ * Pick the schema for a document: its `$schema` reference when it names a
+ * known schema, then the file name (`<schema>.json` or a known name such as
+ * final_report.json). Returns undefined when nothing matches.
+ */
+export function detectSchema(filePath: string, data: unknown): SchemaName | undefined {
+  if (typeof data === 'object' && data !== null && !Array.isArray(data)) {
+    const reference = (data as Record<string, unknown>)['$schema'];
+    if (typeof reference === 'string') {
+      const match = /([^/\\]+)\.schema\.json$/.exec(reference);
+      if (match?.[1] && isSchemaName(match[1])) {
+        return match[1];
+      }
+    }
+  }
+
+  const fileName = filePath.split(/[/\\]/).pop() ?? '';
+  const mapped = SCHEMA_FILE_NAMES[fileName];
+  if (mapped) {
+    return mapped;
+  }
+
+  const stem = fileName.replace(/\.json$/, '');
+  return isSchemaName(stem) ? stem : undefined;
+}
+
+/**
+ * One line per error, e.g. "/proposals/0/id: must match pattern ..."
+ */
+export function formatSchemaErrors(errors: readonly SchemaValidationError[]): string[] {
+  return errors.map(error => `${error.instancePath || '/'}: ${error.message}`);
+}
@@ -0,0 +1,36 @@
+/**
+ * @fileoverview Result types for the precompiled governance schema validators
+ * @author CMMV-Hive Team
+ * @version 1.0.0
+ */
+
+/**
+ * A single schema violation
+ */
+export interface SchemaValidationError {
+  /** JSON pointer to the offending value ('' for the document root) */
+  readonly instancePath: string;
+  /** Failing schema keyword (type, required, enum, ...) */
+  readonly keyword: string;
+  /** Human-readable description */
+  readonly message: string;
+}
+
+/**
+ * Outcome of validating one document
+ */
+export interface SchemaValidationResult {
+  /** Whether the document satisfies the schema */
+  readonly valid: boolean;
+  /** Every violation found, in document order */
+  readonly errors: readonly SchemaValidationError[];
+}
+
+/**
+ * Generated validator: appends every violation under `path` to `errors`
+ */
+export type SchemaValidateFunction = (
+  data: unknown,
+  path: string,
+  errors: SchemaValidationError[]
+) => void;
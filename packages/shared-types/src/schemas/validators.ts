@@ -0,0 +1,2021 @@
+/**
+ * @fileoverview Standalone validators for gov/schemas/*.schema.json
+ * Generated by scripts/compile_schemas.js - do not edit by hand.
+ * Run `pnpm schemas:compile` after changing a schema.
+ */
+
+/* eslint-disable */
+
+import type { SchemaValidateFunction, SchemaValidationError } from './types.js';
+
+export const SCHEMA_NAMES = ["minutes_report","model_evaluation_entry","model_evaluations","model_test_result","proposal"] as const;
+
+export type SchemaName = typeof SCHEMA_NAMES[number];
+
+function isObject(value: unknown): value is Record<string, unknown> {
+  return typeof value === 'object' && value !== null && !Array.isArray(value);
+}
+
+// String length in code points, as JSON Schema counts it
+function ucs2length(value: string): number {
+  let length = 0;
+  for (const _ of value) length++;
+  return length;
+}
+
+const props0 = new Set<string>(["$schema","minutesId","title","reportDate","reporter","overview","votingDetails","proposals","results","analysis","recommendations","verification","governanceMetrics","metadata"]);
+const pattern6 = new RegExp("^\\d{4}$", 'u');
+const props13 = new Set<string>(["model","provider","role"]);
+const props25 = new Set<string>(["totalModels","totalProposals","votingMechanism","threshold","sessionStart","sessionEnd"]);
+const enum33 = new Set<unknown>(["support-reject","weighted","ranked-choice"]);
+const props45 = new Set<string>(["id","title","proposer","supportScore","supportPercentage","status","ranking","description"]);
+const pattern49 = new RegExp("^(P-\\d{3}|\\d{3})$", 'u');
+const props54 = new Set<string>(["model","provider"]);
+const pattern62 = new RegExp("^\\d+/\\d+$", 'u');
+const enum67 = new Set<unknown>(["approved","rejected","pending"]);
+const props74 = new Set<string>(["approvedProposals","rejectedProposals","approvalRate","consensusLevel","unanimousSupport"]);
+const props88 = new Set<string>(["highSupportProposals","rejectedProposals","keyInsights"]);
+const props95 = new Set<string>(["id","analysis","priority"]);
+const enum103 = new Set<unknown>(["high","medium","low"]);
+const props109 = new Set<string>(["id","reason","recommendation"]);
+const props124 = new Set<string>(["approvedProposals","rejectedProposals","general"]);
+const props143 = new Set<string>(["voteIntegrity","chainIntegrity","participationRate","abstentions","notes"]);
+const props160 = new Set<string>(["approvalRate","consensusLevel","rejectionRate","totalModels","votingIntegrity","officialIdsAssigned"]);
+const props176 = new Set<string>(["version","generatedBy","lastUpdated","schemaVersion"]);
+const props186 = new Set<string>(["provider","fullModel","modelFamily","modelVariant","version","sessionId","status","score","checks","reviewerNotes","masterDecision","updatedAt","history"]);
+const enum202 = new Set<unknown>(["general","contributor","rejected"]);
+const props210 = new Set<string>(["name","score","critical","note"]);
+const enum214 = new Set<unknown>(["Connectivity","Command & Tool Use","Cursor File Operations","Task Completeness","Compliance & Safety","Stability"]);
+const props225 = new Set<string>(["decision","reason","decidedBy","decidedAt"]);
+const props242 = new Set<string>(["event","status","reason","timestamp"]);
+const enum246 = new Set<unknown>(["initial_assessment","update","master_override"]);
+const props253 = new Set<string>(["schemaVersion","updatedAt","evaluations"]);
+const props264 = new Set<string>(["model","provider","sessionId","checks","selfClassification","summary"]);
+const props290 = new Set<string>(["$schema","id","title","proposer","status","type","category","createdAt","updatedAt","license","abstract","motivation","rationale","specification","implementation","benefits","challenges","impact","nextSteps","references","voting","metadata"]);
+const pattern296 = new RegExp("^(BIP-)?\\d{3}$", 'u');
+const enum309 = new Set<unknown>(["Proposer","Implementer","Reviewer","General"]);
+const enum312 = new Set<unknown>(["draft","pending","approved","rejected","implemented","active","withdrawn"]);
+const enum315 = new Set<unknown>(["standards-track","informational","process","enhancement","feature","improvement"]);
+const enum318 = new Set<unknown>(["core","process","interface","security","testing","governance","infrastructure","documentation"]);
+const props339 = new Set<string>(["overview","phases","successCriteria","relatedFiles"]);
+const props348 = new Set<string>(["phase","description","timeline","tasks"]);
+const props383 = new Set<string>(["scope","complexity","priority"]);
+const enum387 = new Set<unknown>(["local","system-wide","breaking"]);
+const enum390 = new Set<unknown>(["low","medium","high"]);
+const enum393 = new Set<unknown>(["low","medium","high","critical"]);
+const props404 = new Set<string>(["title","url","type"]);
+const enum412 = new Set<unknown>(["internal","external","related-proposal"]);
+const props415 = new Set<string>(["totalVotes","supportVotes","approvalRatio","quorumMet","consensusReached","votedAt","threshold"]);
+const props433 = new Set<string>(["tags","priority","estimatedEffort","dependencies"]);
+const enum444 = new Set<unknown>(["small","medium","large","extra-large"]);
+
+function validateMinutesReport(data: any, path: string, errors: SchemaValidationError[]): void {
+  if (!(isObject(data))) {
+    errors.push({ instancePath: path, keyword: 'type', message: "must be object" });
+  }
+  if (isObject(data)) {
+    if (data["minutesId"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'minutesId'" });
+    }
+    if (data["reportDate"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'reportDate'" });
+    }
+    if (data["reporter"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'reporter'" });
+    }
+    if (data["votingDetails"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'votingDetails'" });
+    }
+    if (data["proposals"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'proposals'" });
+    }
+    for (const key1 of Object.keys(data)) {
+      if (props0.has(key1)) continue;
+      errors.push({ instancePath: path, keyword: 'additionalProperties', message: "must NOT have additional property '" + key1 + "'" });
+    }
+    const v2 = data["$schema"];
+    if (v2 !== undefined) {
+      const p3 = path + "/$schema";
+      if (!(typeof v2 === 'string')) {
+        errors.push({ instancePath: p3, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v4 = data["minutesId"];
+    if (v4 !== undefined) {
+      const p5 = path + "/minutesId";
+      if (!(typeof v4 === 'string')) {
+        errors.push({ instancePath: p5, keyword: 'type', message: "must be string" });
+      }
+      if (typeof v4 === 'string') {
+        if (!pattern6.test(v4)) {
+          errors.push({ instancePath: p5, keyword: 'pattern', message: "must match pattern \"^\\d{4}$\"" });
+        }
+      }
+    }
+    const v7 = data["title"];
+    if (v7 !== undefined) {
+      const p8 = path + "/title";
+      if (!(typeof v7 === 'string')) {
+        errors.push({ instancePath: p8, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v9 = data["reportDate"];
+    if (v9 !== undefined) {
+      const p10 = path + "/reportDate";
+      if (!(typeof v9 === 'string')) {
+        errors.push({ instancePath: p10, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v11 = data["reporter"];
+    if (v11 !== undefined) {
+      const p12 = path + "/reporter";
+      if (!(isObject(v11))) {
+        errors.push({ instancePath: p12, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v11)) {
+        if (v11["model"] === undefined) {
+          errors.push({ instancePath: p12, keyword: 'required', message: "must have required property 'model'" });
+        }
+        if (v11["provider"] === undefined) {
+          errors.push({ instancePath: p12, keyword: 'required', message: "must have required property 'provider'" });
+        }
+        for (const key14 of Object.keys(v11)) {
+          if (props13.has(key14)) continue;
+          errors.push({ instancePath: p12, keyword: 'additionalProperties', message: "must NOT have additional property '" + key14 + "'" });
+        }
+        const v15 = v11["model"];
+        if (v15 !== undefined) {
+          const p16 = p12 + "/model";
+          if (!(typeof v15 === 'string')) {
+            errors.push({ instancePath: p16, keyword: 'type', message: "must be string" });
+          }
+        }
+        const v17 = v11["provider"];
+        if (v17 !== undefined) {
+          const p18 = p12 + "/provider";
+          if (!(typeof v17 === 'string')) {
+            errors.push({ instancePath: p18, keyword: 'type', message: "must be string" });
+          }
+        }
+        const v19 = v11["role"];
+        if (v19 !== undefined) {
+          const p20 = p12 + "/role";
+          if (!(typeof v19 === 'string')) {
+            errors.push({ instancePath: p20, keyword: 'type', message: "must be string" });
+          }
+        }
+      }
+    }
+    const v21 = data["overview"];
+    if (v21 !== undefined) {
+      const p22 = path + "/overview";
+      if (!(typeof v21 === 'string')) {
+        errors.push({ instancePath: p22, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v23 = data["votingDetails"];
+    if (v23 !== undefined) {
+      const p24 = path + "/votingDetails";
+      if (!(isObject(v23))) {
+        errors.push({ instancePath: p24, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v23)) {
+        if (v23["totalModels"] === undefined) {
+          errors.push({ instancePath: p24, keyword: 'required', message: "must have required property 'totalModels'" });
+        }
+        if (v23["totalProposals"] === undefined) {
+          errors.push({ instancePath: p24, keyword: 'required', message: "must have required property 'totalProposals'" });
+        }
+        for (const key26 of Object.keys(v23)) {
+          if (props25.has(key26)) continue;
+          errors.push({ instancePath: p24, keyword: 'additionalProperties', message: "must NOT have additional property '" + key26 + "'" });
+        }
+        const v27 = v23["totalModels"];
+        if (v27 !== undefined) {
+          const p28 = p24 + "/totalModels";
+          if (!(Number.isInteger(v27))) {
+            errors.push({ instancePath: p28, keyword: 'type', message: "must be integer" });
+          }
+          if (typeof v27 === 'number') {
+            if (v27 < 1) {
+              errors.push({ instancePath: p28, keyword: 'minimum', message: "must be >= 1" });
+            }
+          }
+        }
+        const v29 = v23["totalProposals"];
+        if (v29 !== undefined) {
+          const p30 = p24 + "/totalProposals";
+          if (!(Number.isInteger(v29))) {
+            errors.push({ instancePath: p30, keyword: 'type', message: "must be integer" });
+          }
+          if (typeof v29 === 'number') {
+            if (v29 < 1) {
+              errors.push({ instancePath: p30, keyword: 'minimum', message: "must be >= 1" });
+            }
+          }
+        }
+        const v31 = v23["votingMechanism"];
+        if (v31 !== undefined) {
+          const p32 = p24 + "/votingMechanism";
+          if (!(typeof v31 === 'string')) {
+            errors.push({ instancePath: p32, keyword: 'type', message: "must be string" });
+          }
+          if (!enum33.has(v31)) {
+            errors.push({ instancePath: p32, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+          }
+        }
+        const v34 = v23["threshold"];
+        if (v34 !== undefined) {
+          const p35 = p24 + "/threshold";
+          if (!((typeof v34 === 'number' && Number.isFinite(v34)))) {
+            errors.push({ instancePath: p35, keyword: 'type', message: "must be number" });
+          }
+          if (typeof v34 === 'number') {
+            if (v34 < 0) {
+              errors.push({ instancePath: p35, keyword: 'minimum', message: "must be >= 0" });
+            }
+            if (v34 > 1) {
+              errors.push({ instancePath: p35, keyword: 'maximum', message: "must be <= 1" });
+            }
+          }
+        }
+        const v36 = v23["sessionStart"];
+        if (v36 !== undefined) {
+          const p37 = p24 + "/sessionStart";
+          if (!(typeof v36 === 'string')) {
+            errors.push({ instancePath: p37, keyword: 'type', message: "must be string" });
+          }
+        }
+        const v38 = v23["sessionEnd"];
+        if (v38 !== undefined) {
+          const p39 = p24 + "/sessionEnd";
+          if (!(typeof v38 === 'string')) {
+            errors.push({ instancePath: p39, keyword: 'type', message: "must be string" });
+          }
+        }
+      }
+    }
+    const v40 = data["proposals"];
+    if (v40 !== undefined) {
+      const p41 = path + "/proposals";
+      if (!(Array.isArray(v40))) {
+        errors.push({ instancePath: p41, keyword: 'type', message: "must be array" });
+      }
+      if (Array.isArray(v40)) {
+        if (v40.length < 1) {
+          errors.push({ instancePath: p41, keyword: 'minItems', message: "must NOT have fewer than 1 items" });
+        }
+        for (let i42 = 0; i42 < v40.length; i42++) {
+          const v43 = v40[i42];
+          const p44 = p41 + '/' + i42;
+          if (!(isObject(v43))) {
+            errors.push({ instancePath: p44, keyword: 'type', message: "must be object" });
+          }
+          if (isObject(v43)) {
+            if (v43["id"] === undefined) {
+              errors.push({ instancePath: p44, keyword: 'required', message: "must have required property 'id'" });
+            }
+            if (v43["title"] === undefined) {
+              errors.push({ instancePath: p44, keyword: 'required', message: "must have required property 'title'" });
+            }
+            if (v43["proposer"] === undefined) {
+              errors.push({ instancePath: p44, keyword: 'required', message: "must have required property 'proposer'" });
+            }
+            if (v43["supportScore"] === undefined) {
+              errors.push({ instancePath: p44, keyword: 'required', message: "must have required property 'supportScore'" });
+            }
+            for (const key46 of Object.keys(v43)) {
+              if (props45.has(key46)) continue;
+              errors.push({ instancePath: p44, keyword: 'additionalProperties', message: "must NOT have additional property '" + key46 + "'" });
+            }
+            const v47 = v43["id"];
+            if (v47 !== undefined) {
+              const p48 = p44 + "/id";
+              if (!(typeof v47 === 'string')) {
+                errors.push({ instancePath: p48, keyword: 'type', message: "must be string" });
+              }
+              if (typeof v47 === 'string') {
+                if (!pattern49.test(v47)) {
+                  errors.push({ instancePath: p48, keyword: 'pattern', message: "must match pattern \"^(P-\\d{3}|\\d{3})$\"" });
+                }
+              }
+            }
+            const v50 = v43["title"];
+            if (v50 !== undefined) {
+              const p51 = p44 + "/title";
+              if (!(typeof v50 === 'string')) {
+                errors.push({ instancePath: p51, keyword: 'type', message: "must be string" });
+              }
+            }
+            const v52 = v43["proposer"];
+            if (v52 !== undefined) {
+              const p53 = p44 + "/proposer";
+              if (!(isObject(v52))) {
+                errors.push({ instancePath: p53, keyword: 'type', message: "must be object" });
+              }
+              if (isObject(v52)) {
+                if (v52["model"] === undefined) {
+                  errors.push({ instancePath: p53, keyword: 'required', message: "must have required property 'model'" });
+                }
+                for (const key55 of Object.keys(v52)) {
+                  if (props54.has(key55)) continue;
+                  errors.push({ instancePath: p53, keyword: 'additionalProperties', message: "must NOT have additional property '" + key55 + "'" });
+                }
+                const v56 = v52["model"];
+                if (v56 !== undefined) {
+                  const p57 = p53 + "/model";
+                  if (!(typeof v56 === 'string')) {
+                    errors.push({ instancePath: p57, keyword: 'type', message: "must be string" });
+                  }
+                }
+                const v58 = v52["provider"];
+                if (v58 !== undefined) {
+                  const p59 = p53 + "/provider";
+                  if (!(typeof v58 === 'string')) {
+                    errors.push({ instancePath: p59, keyword: 'type', message: "must be string" });
+                  }
+                }
+              }
+            }
+            const v60 = v43["supportScore"];
+            if (v60 !== undefined) {
+              const p61 = p44 + "/supportScore";
+              if (!(typeof v60 === 'string')) {
+                errors.push({ instancePath: p61, keyword: 'type', message: "must be string" });
+              }
+              if (typeof v60 === 'string') {
+                if (!pattern62.test(v60)) {
+                  errors.push({ instancePath: p61, keyword: 'pattern', message: "must match pattern \"^\\d+/\\d+$\"" });
+                }
+              }
+            }
+            const v63 = v43["supportPercentage"];
+            if (v63 !== undefined) {
+              const p64 = p44 + "/supportPercentage";
+              if (!((typeof v63 === 'number' && Number.isFinite(v63)))) {
+                errors.push({ instancePath: p64, keyword: 'type', message: "must be number" });
+              }
+              if (typeof v63 === 'number') {
+                if (v63 < 0) {
+                  errors.push({ instancePath: p64, keyword: 'minimum', message: "must be >= 0" });
+                }
+                if (v63 > 100) {
+                  errors.push({ instancePath: p64, keyword: 'maximum', message: "must be <= 100" });
+                }
+              }
+            }
+            const v65 = v43["status"];
+            if (v65 !== undefined) {
+              const p66 = p44 + "/status";
+              if (!(typeof v65 === 'string')) {
+                errors.push({ instancePath: p66, keyword: 'type', message: "must be string" });
+              }
+              if (!enum67.has(v65)) {
+                errors.push({ instancePath: p66, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+              }
+            }
+            const v68 = v43["ranking"];
+            if (v68 !== undefined) {
+              const p69 = p44 + "/ranking";
+              if (!(Number.isInteger(v68))) {
+                errors.push({ instancePath: p69, keyword: 'type', message: "must be integer" });
+              }
+              if (typeof v68 === 'number') {
+                if (v68 < 1) {
+                  errors.push({ instancePath: p69, keyword: 'minimum', message: "must be >= 1" });
+                }
+              }
+            }
+            const v70 = v43["description"];
+            if (v70 !== undefined) {
+              const p71 = p44 + "/description";
+              if (!(typeof v70 === 'string')) {
+                errors.push({ instancePath: p71, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+      }
+    }
+    const v72 = data["results"];
+    if (v72 !== undefined) {
+      const p73 = path + "/results";
+      if (!(isObject(v72))) {
+        errors.push({ instancePath: p73, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v72)) {
+        for (const key75 of Object.keys(v72)) {
+          if (props74.has(key75)) continue;
+          errors.push({ instancePath: p73, keyword: 'additionalProperties', message: "must NOT have additional property '" + key75 + "'" });
+        }
+        const v76 = v72["approvedProposals"];
+        if (v76 !== undefined) {
+          const p77 = p73 + "/approvedProposals";
+          if (!(Number.isInteger(v76))) {
+            errors.push({ instancePath: p77, keyword: 'type', message: "must be integer" });
+          }
+          if (typeof v76 === 'number') {
+            if (v76 < 0) {
+              errors.push({ instancePath: p77, keyword: 'minimum', message: "must be >= 0" });
+            }
+          }
+        }
+        const v78 = v72["rejectedProposals"];
+        if (v78 !== undefined) {
+          const p79 = p73 + "/rejectedProposals";
+          if (!(Number.isInteger(v78))) {
+            errors.push({ instancePath: p79, keyword: 'type', message: "must be integer" });
+          }
+          if (typeof v78 === 'number') {
+            if (v78 < 0) {
+              errors.push({ instancePath: p79, keyword: 'minimum', message: "must be >= 0" });
+            }
+          }
+        }
+        const v80 = v72["approvalRate"];
+        if (v80 !== undefined) {
+          const p81 = p73 + "/approvalRate";
+          if (!((typeof v80 === 'number' && Number.isFinite(v80)))) {
+            errors.push({ instancePath: p81, keyword: 'type', message: "must be number" });
+          }
+          if (typeof v80 === 'number') {
+            if (v80 < 0) {
+              errors.push({ instancePath: p81, keyword: 'minimum', message: "must be >= 0" });
+            }
+            if (v80 > 100) {
+              errors.push({ instancePath: p81, keyword: 'maximum', message: "must be <= 100" });
+            }
+          }
+        }
+        const v82 = v72["consensusLevel"];
+        if (v82 !== undefined) {
+          const p83 = p73 + "/consensusLevel";
+          if (!((typeof v82 === 'number' && Number.isFinite(v82)))) {
+            errors.push({ instancePath: p83, keyword: 'type', message: "must be number" });
+          }
+          if (typeof v82 === 'number') {
+            if (v82 < 0) {
+              errors.push({ instancePath: p83, keyword: 'minimum', message: "must be >= 0" });
+            }
+            if (v82 > 100) {
+              errors.push({ instancePath: p83, keyword: 'maximum', message: "must be <= 100" });
+            }
+          }
+        }
+        const v84 = v72["unanimousSupport"];
+        if (v84 !== undefined) {
+          const p85 = p73 + "/unanimousSupport";
+          if (!(Number.isInteger(v84))) {
+            errors.push({ instancePath: p85, keyword: 'type', message: "must be integer" });
+          }
+          if (typeof v84 === 'number') {
+            if (v84 < 0) {
+              errors.push({ instancePath: p85, keyword: 'minimum', message: "must be >= 0" });
+            }
+          }
+        }
+      }
+    }
+    const v86 = data["analysis"];
+    if (v86 !== undefined) {
+      const p87 = path + "/analysis";
+      if (!(isObject(v86))) {
+        errors.push({ instancePath: p87, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v86)) {
+        for (const key89 of Object.keys(v86)) {
+          if (props88.has(key89)) continue;
+          errors.push({ instancePath: p87, keyword: 'additionalProperties', message: "must NOT have additional property '" + key89 + "'" });
+        }
+        const v90 = v86["highSupportProposals"];
+        if (v90 !== undefined) {
+          const p91 = p87 + "/highSupportProposals";
+          if (!(Array.isArray(v90))) {
+            errors.push({ instancePath: p91, keyword: 'type', message: "must be array" });
+          }
+          if (Array.isArray(v90)) {
+            for (let i92 = 0; i92 < v90.length; i92++) {
+              const v93 = v90[i92];
+              const p94 = p91 + '/' + i92;
+              if (!(isObject(v93))) {
+                errors.push({ instancePath: p94, keyword: 'type', message: "must be object" });
+              }
+              if (isObject(v93)) {
+                if (v93["id"] === undefined) {
+                  errors.push({ instancePath: p94, keyword: 'required', message: "must have required property 'id'" });
+                }
+                if (v93["analysis"] === undefined) {
+                  errors.push({ instancePath: p94, keyword: 'required', message: "must have required property 'analysis'" });
+                }
+                for (const key96 of Object.keys(v93)) {
+                  if (props95.has(key96)) continue;
+                  errors.push({ instancePath: p94, keyword: 'additionalProperties', message: "must NOT have additional property '" + key96 + "'" });
+                }
+                const v97 = v93["id"];
+                if (v97 !== undefined) {
+                  const p98 = p94 + "/id";
+                  if (!(typeof v97 === 'string')) {
+                    errors.push({ instancePath: p98, keyword: 'type', message: "must be string" });
+                  }
+                }
+                const v99 = v93["analysis"];
+                if (v99 !== undefined) {
+                  const p100 = p94 + "/analysis";
+                  if (!(typeof v99 === 'string')) {
+                    errors.push({ instancePath: p100, keyword: 'type', message: "must be string" });
+                  }
+                }
+                const v101 = v93["priority"];
+                if (v101 !== undefined) {
+                  const p102 = p94 + "/priority";
+                  if (!(typeof v101 === 'string')) {
+                    errors.push({ instancePath: p102, keyword: 'type', message: "must be string" });
+                  }
+                  if (!enum103.has(v101)) {
+                    errors.push({ instancePath: p102, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+                  }
+                }
+              }
+            }
+          }
+        }
+        const v104 = v86["rejectedProposals"];
+        if (v104 !== undefined) {
+          const p105 = p87 + "/rejectedProposals";
+          if (!(Array.isArray(v104))) {
+            errors.push({ instancePath: p105, keyword: 'type', message: "must be array" });
+          }
+          if (Array.isArray(v104)) {
+            for (let i106 = 0; i106 < v104.length; i106++) {
+              const v107 = v104[i106];
+              const p108 = p105 + '/' + i106;
+              if (!(isObject(v107))) {
+                errors.push({ instancePath: p108, keyword: 'type', message: "must be object" });
+              }
+              if (isObject(v107)) {
+                if (v107["id"] === undefined) {
+                  errors.push({ instancePath: p108, keyword: 'required', message: "must have required property 'id'" });
+                }
+                if (v107["reason"] === undefined) {
+                  errors.push({ instancePath: p108, keyword: 'required', message: "must have required property 'reason'" });
+                }
+                for (const key110 of Object.keys(v107)) {
+                  if (props109.has(key110)) continue;
+                  errors.push({ instancePath: p108, keyword: 'additionalProperties', message: "must NOT have additional property '" + key110 + "'" });
+                }
+                const v111 = v107["id"];
+                if (v111 !== undefined) {
+                  const p112 = p108 + "/id";
+                  if (!(typeof v111 === 'string')) {
+                    errors.push({ instancePath: p112, keyword: 'type', message: "must be string" });
+                  }
+                }
+                const v113 = v107["reason"];
+                if (v113 !== undefined) {
+                  const p114 = p108 + "/reason";
+                  if (!(typeof v113 === 'string')) {
+                    errors.push({ instancePath: p114, keyword: 'type', message: "must be string" });
+                  }
+                }
+                const v115 = v107["recommendation"];
+                if (v115 !== undefined) {
+                  const p116 = p108 + "/recommendation";
+                  if (!(typeof v115 === 'string')) {
+                    errors.push({ instancePath: p116, keyword: 'type', message: "must be string" });
+                  }
+                }
+              }
+            }
+          }
+        }
+        const v117 = v86["keyInsights"];
+        if (v117 !== undefined) {
+          const p118 = p87 + "/keyInsights";
+          if (!(Array.isArray(v117))) {
+            errors.push({ instancePath: p118, keyword: 'type', message: "must be array" });
+          }
+          if (Array.isArray(v117)) {
+            for (let i119 = 0; i119 < v117.length; i119++) {
+              const v120 = v117[i119];
+              const p121 = p118 + '/' + i119;
+              if (!(typeof v120 === 'string')) {
+                errors.push({ instancePath: p121, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+      }
+    }
+    const v122 = data["recommendations"];
+    if (v122 !== undefined) {
+      const p123 = path + "/recommendations";
+      if (!(isObject(v122))) {
+        errors.push({ instancePath: p123, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v122)) {
+        for (const key125 of Object.keys(v122)) {
+          if (props124.has(key125)) continue;
+          errors.push({ instancePath: p123, keyword: 'additionalProperties', message: "must NOT have additional property '" + key125 + "'" });
+        }
+        const v126 = v122["approvedProposals"];
+        if (v126 !== undefined) {
+          const p127 = p123 + "/approvedProposals";
+          if (!(Array.isArray(v126))) {
+            errors.push({ instancePath: p127, keyword: 'type', message: "must be array" });
+          }
+          if (Array.isArray(v126)) {
+            for (let i128 = 0; i128 < v126.length; i128++) {
+              const v129 = v126[i128];
+              const p130 = p127 + '/' + i128;
+              if (!(typeof v129 === 'string')) {
+                errors.push({ instancePath: p130, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+        const v131 = v122["rejectedProposals"];
+        if (v131 !== undefined) {
+          const p132 = p123 + "/rejectedProposals";
+          if (!(Array.isArray(v131))) {
+            errors.push({ instancePath: p132, keyword: 'type', message: "must be array" });
+          }
+          if (Array.isArray(v131)) {
+            for (let i133 = 0; i133 < v131.length; i133++) {
+              const v134 = v131[i133];
+              const p135 = p132 + '/' + i133;
+              if (!(typeof v134 === 'string')) {
+                errors.push({ instancePath: p135, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+        const v136 = v122["general"];
+        if (v136 !== undefined) {
+          const p137 = p123 + "/general";
+          if (!(Array.isArray(v136))) {
+            errors.push({ instancePath: p137, keyword: 'type', message: "must be array" });
+          }
+          if (Array.isArray(v136)) {
+            for (let i138 = 0; i138 < v136.length; i138++) {
+              const v139 = v136[i138];
+              const p140 = p137 + '/' + i138;
+              if (!(typeof v139 === 'string')) {
+                errors.push({ instancePath: p140, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+      }
+    }
+    const v141 = data["verification"];
+    if (v141 !== undefined) {
+      const p142 = path + "/verification";
+      if (!(isObject(v141))) {
+        errors.push({ instancePath: p142, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v141)) {
+        for (const key144 of Object.keys(v141)) {
+          if (props143.has(key144)) continue;
+          errors.push({ instancePath: p142, keyword: 'additionalProperties', message: "must NOT have additional property '" + key144 + "'" });
+        }
+        const v145 = v141["voteIntegrity"];
+        if (v145 !== undefined) {
+          const p146 = p142 + "/voteIntegrity";
+          if (!(typeof v145 === 'boolean')) {
+            errors.push({ instancePath: p146, keyword: 'type', message: "must be boolean" });
+          }
+        }
+        const v147 = v141["chainIntegrity"];
+        if (v147 !== undefined) {
+          const p148 = p142 + "/chainIntegrity";
+          if (!(typeof v147 === 'boolean')) {
+            errors.push({ instancePath: p148, keyword: 'type', message: "must be boolean" });
+          }
+        }
+        const v149 = v141["participationRate"];
+        if (v149 !== undefined) {
+          const p150 = p142 + "/participationRate";
+          if (!((typeof v149 === 'number' && Number.isFinite(v149)))) {
+            errors.push({ instancePath: p150, keyword: 'type', message: "must be number" });
+          }
+          if (typeof v149 === 'number') {
+            if (v149 < 0) {
+              errors.push({ instancePath: p150, keyword: 'minimum', message: "must be >= 0" });
+            }
+            if (v149 > 100) {
+              errors.push({ instancePath: p150, keyword: 'maximum', message: "must be <= 100" });
+            }
+          }
+        }
+        const v151 = v141["abstentions"];
+        if (v151 !== undefined) {
+          const p152 = p142 + "/abstentions";
+          if (!(Number.isInteger(v151))) {
+            errors.push({ instancePath: p152, keyword: 'type', message: "must be integer" });
+          }
+          if (typeof v151 === 'number') {
+            if (v151 < 0) {
+              errors.push({ instancePath: p152, keyword: 'minimum', message: "must be >= 0" });
+            }
+          }
+        }
+        const v153 = v141["notes"];
+        if (v153 !== undefined) {
+          const p154 = p142 + "/notes";
+          if (!(Array.isArray(v153))) {
+            errors.push({ instancePath: p154, keyword: 'type', message: "must be array" });
+          }
+          if (Array.isArray(v153)) {
+            for (let i155 = 0; i155 < v153.length; i155++) {
+              const v156 = v153[i155];
+              const p157 = p154 + '/' + i155;
+              if (!(typeof v156 === 'string')) {
+                errors.push({ instancePath: p157, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+      }
+    }
+    const v158 = data["governanceMetrics"];
+    if (v158 !== undefined) {
+      const p159 = path + "/governanceMetrics";
+      if (!(isObject(v158))) {
+        errors.push({ instancePath: p159, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v158)) {
+        for (const key161 of Object.keys(v158)) {
+          if (props160.has(key161)) continue;
+          errors.push({ instancePath: p159, keyword: 'additionalProperties', message: "must NOT have additional property '" + key161 + "'" });
+        }
+        const v162 = v158["approvalRate"];
+        if (v162 !== undefined) {
+          const p163 = p159 + "/approvalRate";
+          if (!((typeof v162 === 'number' && Number.isFinite(v162)))) {
+            errors.push({ instancePath: p163, keyword: 'type', message: "must be number" });
+          }
+          if (typeof v162 === 'number') {
+            if (v162 < 0) {
+              errors.push({ instancePath: p163, keyword: 'minimum', message: "must be >= 0" });
+            }
+            if (v162 > 100) {
+              errors.push({ instancePath: p163, keyword: 'maximum', message: "must be <= 100" });
+            }
+          }
+        }
+        const v164 = v158["consensusLevel"];
+        if (v164 !== undefined) {
+          const p165 = p159 + "/consensusLevel";
+          if (!((typeof v164 === 'number' && Number.isFinite(v164)))) {
+            errors.push({ instancePath: p165, keyword: 'type', message: "must be number" });
+          }
+          if (typeof v164 === 'number') {
+            if (v164 < 0) {
+              errors.push({ instancePath: p165, keyword: 'minimum', message: "must be >= 0" });
+            }
+            if (v164 > 100) {
+              errors.push({ instancePath: p165, keyword: 'maximum', message: "must be <= 100" });
+            }
+          }
+        }
+        const v166 = v158["rejectionRate"];
+        if (v166 !== undefined) {
+          const p167 = p159 + "/rejectionRate";
+          if (!((typeof v166 === 'number' && Number.isFinite(v166)))) {
+            errors.push({ instancePath: p167, keyword: 'type', message: "must be number" });
+          }
+          if (typeof v166 === 'number') {
+            if (v166 < 0) {
+              errors.push({ instancePath: p167, keyword: 'minimum', message: "must be >= 0" });
+            }
+            if (v166 > 100) {
+              errors.push({ instancePath: p167, keyword: 'maximum', message: "must be <= 100" });
+            }
+          }
+        }
+        const v168 = v158["totalModels"];
+        if (v168 !== undefined) {
+          const p169 = p159 + "/totalModels";
+          if (!(Number.isInteger(v168))) {
+            errors.push({ instancePath: p169, keyword: 'type', message: "must be integer" });
+          }
+          if (typeof v168 === 'number') {
+            if (v168 < 1) {
+              errors.push({ instancePath: p169, keyword: 'minimum', message: "must be >= 1" });
+            }
+          }
+        }
+        const v170 = v158["votingIntegrity"];
+        if (v170 !== undefined) {
+          const p171 = p159 + "/votingIntegrity";
+          if (!((typeof v170 === 'number' && Number.isFinite(v170)))) {
+            errors.push({ instancePath: p171, keyword: 'type', message: "must be number" });
+          }
+          if (typeof v170 === 'number') {
+            if (v170 < 0) {
+              errors.push({ instancePath: p171, keyword: 'minimum', message: "must be >= 0" });
+            }
+            if (v170 > 100) {
+              errors.push({ instancePath: p171, keyword: 'maximum', message: "must be <= 100" });
+            }
+          }
+        }
+        const v172 = v158["officialIdsAssigned"];
+        if (v172 !== undefined) {
+          const p173 = p159 + "/officialIdsAssigned";
+          if (!(Number.isInteger(v172))) {
+            errors.push({ instancePath: p173, keyword: 'type', message: "must be integer" });
+          }
+          if (typeof v172 === 'number') {
+            if (v172 < 0) {
+              errors.push({ instancePath: p173, keyword: 'minimum', message: "must be >= 0" });
+            }
+          }
+        }
+      }
+    }
+    const v174 = data["metadata"];
+    if (v174 !== undefined) {
+      const p175 = path + "/metadata";
+      if (!(isObject(v174))) {
+        errors.push({ instancePath: p175, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v174)) {
+        for (const key177 of Object.keys(v174)) {
+          if (props176.has(key177)) continue;
+          errors.push({ instancePath: p175, keyword: 'additionalProperties', message: "must NOT have additional property '" + key177 + "'" });
+        }
+        const v178 = v174["version"];
+        if (v178 !== undefined) {
+          const p179 = p175 + "/version";
+          if (!(typeof v178 === 'string')) {
+            errors.push({ instancePath: p179, keyword: 'type', message: "must be string" });
+          }
+        }
+        const v180 = v174["generatedBy"];
+        if (v180 !== undefined) {
+          const p181 = p175 + "/generatedBy";
+          if (!(typeof v180 === 'string')) {
+            errors.push({ instancePath: p181, keyword: 'type', message: "must be string" });
+          }
+        }
+        const v182 = v174["lastUpdated"];
+        if (v182 !== undefined) {
+          const p183 = p175 + "/lastUpdated";
+          if (!(typeof v182 === 'string')) {
+            errors.push({ instancePath: p183, keyword: 'type', message: "must be string" });
+          }
+        }
+        const v184 = v174["schemaVersion"];
+        if (v184 !== undefined) {
+          const p185 = p175 + "/schemaVersion";
+          if (!(typeof v184 === 'string')) {
+            errors.push({ instancePath: p185, keyword: 'type', message: "must be string" });
+          }
+        }
+      }
+    }
+  }
+}
+
+function validateModelEvaluationEntry(data: any, path: string, errors: SchemaValidationError[]): void {
+  if (!(isObject(data))) {
+    errors.push({ instancePath: path, keyword: 'type', message: "must be object" });
+  }
+  if (isObject(data)) {
+    if (data["provider"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'provider'" });
+    }
+    if (data["fullModel"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'fullModel'" });
+    }
+    if (data["modelFamily"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'modelFamily'" });
+    }
+    if (data["modelVariant"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'modelVariant'" });
+    }
+    if (data["status"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'status'" });
+    }
+    if (data["checks"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'checks'" });
+    }
+    if (data["updatedAt"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'updatedAt'" });
+    }
+    for (const key187 of Object.keys(data)) {
+      if (props186.has(key187)) continue;
+      errors.push({ instancePath: path, keyword: 'additionalProperties', message: "must NOT have additional property '" + key187 + "'" });
+    }
+    const v188 = data["provider"];
+    if (v188 !== undefined) {
+      const p189 = path + "/provider";
+      if (!(typeof v188 === 'string')) {
+        errors.push({ instancePath: p189, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v190 = data["fullModel"];
+    if (v190 !== undefined) {
+      const p191 = path + "/fullModel";
+      if (!(typeof v190 === 'string')) {
+        errors.push({ instancePath: p191, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v192 = data["modelFamily"];
+    if (v192 !== undefined) {
+      const p193 = path + "/modelFamily";
+      if (!(typeof v192 === 'string')) {
+        errors.push({ instancePath: p193, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v194 = data["modelVariant"];
+    if (v194 !== undefined) {
+      const p195 = path + "/modelVariant";
+      if (!(typeof v194 === 'string')) {
+        errors.push({ instancePath: p195, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v196 = data["version"];
+    if (v196 !== undefined) {
+      const p197 = path + "/version";
+      if (!(typeof v196 === 'string' || v196 === null)) {
+        errors.push({ instancePath: p197, keyword: 'type', message: "must be string,null" });
+      }
+    }
+    const v198 = data["sessionId"];
+    if (v198 !== undefined) {
+      const p199 = path + "/sessionId";
+      if (!(typeof v198 === 'string' || v198 === null)) {
+        errors.push({ instancePath: p199, keyword: 'type', message: "must be string,null" });
+      }
+    }
+    const v200 = data["status"];
+    if (v200 !== undefined) {
+      const p201 = path + "/status";
+      if (!(typeof v200 === 'string')) {
+        errors.push({ instancePath: p201, keyword: 'type', message: "must be string" });
+      }
+      if (!enum202.has(v200)) {
+        errors.push({ instancePath: p201, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+      }
+    }
+    const v203 = data["score"];
+    if (v203 !== undefined) {
+      const p204 = path + "/score";
+      if (!(Number.isInteger(v203) || v203 === null)) {
+        errors.push({ instancePath: p204, keyword: 'type', message: "must be integer,null" });
+      }
+      if (typeof v203 === 'number') {
+        if (v203 < 0) {
+          errors.push({ instancePath: p204, keyword: 'minimum', message: "must be >= 0" });
+        }
+        if (v203 > 100) {
+          errors.push({ instancePath: p204, keyword: 'maximum', message: "must be <= 100" });
+        }
+      }
+    }
+    const v205 = data["checks"];
+    if (v205 !== undefined) {
+      const p206 = path + "/checks";
+      if (!(Array.isArray(v205))) {
+        errors.push({ instancePath: p206, keyword: 'type', message: "must be array" });
+      }
+      if (Array.isArray(v205)) {
+        if (v205.length < 6) {
+          errors.push({ instancePath: p206, keyword: 'minItems', message: "must NOT have fewer than 6 items" });
+        }
+        if (v205.length > 6) {
+          errors.push({ instancePath: p206, keyword: 'maxItems', message: "must NOT have more than 6 items" });
+        }
+        for (let i207 = 0; i207 < v205.length; i207++) {
+          const v208 = v205[i207];
+          const p209 = p206 + '/' + i207;
+          if (!(isObject(v208))) {
+            errors.push({ instancePath: p209, keyword: 'type', message: "must be object" });
+          }
+          if (isObject(v208)) {
+            if (v208["name"] === undefined) {
+              errors.push({ instancePath: p209, keyword: 'required', message: "must have required property 'name'" });
+            }
+            if (v208["score"] === undefined) {
+              errors.push({ instancePath: p209, keyword: 'required', message: "must have required property 'score'" });
+            }
+            if (v208["critical"] === undefined) {
+              errors.push({ instancePath: p209, keyword: 'required', message: "must have required property 'critical'" });
+            }
+            for (const key211 of Object.keys(v208)) {
+              if (props210.has(key211)) continue;
+              errors.push({ instancePath: p209, keyword: 'additionalProperties', message: "must NOT have additional property '" + key211 + "'" });
+            }
+            const v212 = v208["name"];
+            if (v212 !== undefined) {
+              const p213 = p209 + "/name";
+              if (!(typeof v212 === 'string')) {
+                errors.push({ instancePath: p213, keyword: 'type', message: "must be string" });
+              }
+              if (!enum214.has(v212)) {
+                errors.push({ instancePath: p213, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+              }
+            }
+            const v215 = v208["score"];
+            if (v215 !== undefined) {
+              const p216 = p209 + "/score";
+              if (!(Number.isInteger(v215))) {
+                errors.push({ instancePath: p216, keyword: 'type', message: "must be integer" });
+              }
+              if (typeof v215 === 'number') {
+                if (v215 < 0) {
+                  errors.push({ instancePath: p216, keyword: 'minimum', message: "must be >= 0" });
+                }
+                if (v215 > 25) {
+                  errors.push({ instancePath: p216, keyword: 'maximum', message: "must be <= 25" });
+                }
+              }
+            }
+            const v217 = v208["critical"];
+            if (v217 !== undefined) {
+              const p218 = p209 + "/critical";
+              if (!(typeof v217 === 'boolean')) {
+                errors.push({ instancePath: p218, keyword: 'type', message: "must be boolean" });
+              }
+            }
+            const v219 = v208["note"];
+            if (v219 !== undefined) {
+              const p220 = p209 + "/note";
+              if (!(typeof v219 === 'string')) {
+                errors.push({ instancePath: p220, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+      }
+    }
+    const v221 = data["reviewerNotes"];
+    if (v221 !== undefined) {
+      const p222 = path + "/reviewerNotes";
+      if (!(typeof v221 === 'string')) {
+        errors.push({ instancePath: p222, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v223 = data["masterDecision"];
+    if (v223 !== undefined) {
+      const p224 = path + "/masterDecision";
+      if (!(isObject(v223))) {
+        errors.push({ instancePath: p224, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v223)) {
+        if (v223["decision"] === undefined) {
+          errors.push({ instancePath: p224, keyword: 'required', message: "must have required property 'decision'" });
+        }
+        if (v223["decidedBy"] === undefined) {
+          errors.push({ instancePath: p224, keyword: 'required', message: "must have required property 'decidedBy'" });
+        }
+        if (v223["decidedAt"] === undefined) {
+          errors.push({ instancePath: p224, keyword: 'required', message: "must have required property 'decidedAt'" });
+        }
+        for (const key226 of Object.keys(v223)) {
+          if (props225.has(key226)) continue;
+          errors.push({ instancePath: p224, keyword: 'additionalProperties', message: "must NOT have additional property '" + key226 + "'" });
+        }
+        const v227 = v223["decision"];
+        if (v227 !== undefined) {
+          const p228 = p224 + "/decision";
+          if (!(typeof v227 === 'string')) {
+            errors.push({ instancePath: p228, keyword: 'type', message: "must be string" });
+          }
+          if (!enum202.has(v227)) {
+            errors.push({ instancePath: p228, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+          }
+        }
+        const v229 = v223["reason"];
+        if (v229 !== undefined) {
+          const p230 = p224 + "/reason";
+          if (!(typeof v229 === 'string')) {
+            errors.push({ instancePath: p230, keyword: 'type', message: "must be string" });
+          }
+        }
+        const v231 = v223["decidedBy"];
+        if (v231 !== undefined) {
+          const p232 = p224 + "/decidedBy";
+          if (!(typeof v231 === 'string')) {
+            errors.push({ instancePath: p232, keyword: 'type', message: "must be string" });
+          }
+        }
+        const v233 = v223["decidedAt"];
+        if (v233 !== undefined) {
+          const p234 = p224 + "/decidedAt";
+          if (!(typeof v233 === 'string')) {
+            errors.push({ instancePath: p234, keyword: 'type', message: "must be string" });
+          }
+        }
+      }
+    }
+    const v235 = data["updatedAt"];
+    if (v235 !== undefined) {
+      const p236 = path + "/updatedAt";
+      if (!(typeof v235 === 'string')) {
+        errors.push({ instancePath: p236, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v237 = data["history"];
+    if (v237 !== undefined) {
+      const p238 = path + "/history";
+      if (!(Array.isArray(v237))) {
+        errors.push({ instancePath: p238, keyword: 'type', message: "must be array" });
+      }
+      if (Array.isArray(v237)) {
+        for (let i239 = 0; i239 < v237.length; i239++) {
+          const v240 = v237[i239];
+          const p241 = p238 + '/' + i239;
+          if (!(isObject(v240))) {
+            errors.push({ instancePath: p241, keyword: 'type', message: "must be object" });
+          }
+          if (isObject(v240)) {
+            if (v240["event"] === undefined) {
+              errors.push({ instancePath: p241, keyword: 'required', message: "must have required property 'event'" });
+            }
+            if (v240["status"] === undefined) {
+              errors.push({ instancePath: p241, keyword: 'required', message: "must have required property 'status'" });
+            }
+            if (v240["timestamp"] === undefined) {
+              errors.push({ instancePath: p241, keyword: 'required', message: "must have required property 'timestamp'" });
+            }
+            for (const key243 of Object.keys(v240)) {
+              if (props242.has(key243)) continue;
+              errors.push({ instancePath: p241, keyword: 'additionalProperties', message: "must NOT have additional property '" + key243 + "'" });
+            }
+            const v244 = v240["event"];
+            if (v244 !== undefined) {
+              const p245 = p241 + "/event";
+              if (!(typeof v244 === 'string')) {
+                errors.push({ instancePath: p245, keyword: 'type', message: "must be string" });
+              }
+              if (!enum246.has(v244)) {
+                errors.push({ instancePath: p245, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+              }
+            }
+            const v247 = v240["status"];
+            if (v247 !== undefined) {
+              const p248 = p241 + "/status";
+              if (!(typeof v247 === 'string')) {
+                errors.push({ instancePath: p248, keyword: 'type', message: "must be string" });
+              }
+              if (!enum202.has(v247)) {
+                errors.push({ instancePath: p248, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+              }
+            }
+            const v249 = v240["reason"];
+            if (v249 !== undefined) {
+              const p250 = p241 + "/reason";
+              if (!(typeof v249 === 'string')) {
+                errors.push({ instancePath: p250, keyword: 'type', message: "must be string" });
+              }
+            }
+            const v251 = v240["timestamp"];
+            if (v251 !== undefined) {
+              const p252 = p241 + "/timestamp";
+              if (!(typeof v251 === 'string')) {
+                errors.push({ instancePath: p252, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+function validateModelEvaluations(data: any, path: string, errors: SchemaValidationError[]): void {
+  if (!(isObject(data))) {
+    errors.push({ instancePath: path, keyword: 'type', message: "must be object" });
+  }
+  if (isObject(data)) {
+    if (data["schemaVersion"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'schemaVersion'" });
+    }
+    if (data["updatedAt"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'updatedAt'" });
+    }
+    if (data["evaluations"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'evaluations'" });
+    }
+    for (const key254 of Object.keys(data)) {
+      if (props253.has(key254)) continue;
+      errors.push({ instancePath: path, keyword: 'additionalProperties', message: "must NOT have additional property '" + key254 + "'" });
+    }
+    const v255 = data["schemaVersion"];
+    if (v255 !== undefined) {
+      const p256 = path + "/schemaVersion";
+      if (!(typeof v255 === 'string')) {
+        errors.push({ instancePath: p256, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v257 = data["updatedAt"];
+    if (v257 !== undefined) {
+      const p258 = path + "/updatedAt";
+      if (!(typeof v257 === 'string')) {
+        errors.push({ instancePath: p258, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v259 = data["evaluations"];
+    if (v259 !== undefined) {
+      const p260 = path + "/evaluations";
+      if (!(Array.isArray(v259))) {
+        errors.push({ instancePath: p260, keyword: 'type', message: "must be array" });
+      }
+      if (Array.isArray(v259)) {
+        for (let i261 = 0; i261 < v259.length; i261++) {
+          const v262 = v259[i261];
+          const p263 = p260 + '/' + i261;
+          validateModelEvaluationEntry(v262, p263, errors);
+        }
+      }
+    }
+  }
+}
+
+function validateModelTestResult(data: any, path: string, errors: SchemaValidationError[]): void {
+  if (!(isObject(data))) {
+    errors.push({ instancePath: path, keyword: 'type', message: "must be object" });
+  }
+  if (isObject(data)) {
+    if (data["model"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'model'" });
+    }
+    if (data["provider"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'provider'" });
+    }
+    if (data["checks"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'checks'" });
+    }
+    if (data["selfClassification"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'selfClassification'" });
+    }
+    for (const key265 of Object.keys(data)) {
+      if (props264.has(key265)) continue;
+      errors.push({ instancePath: path, keyword: 'additionalProperties', message: "must NOT have additional property '" + key265 + "'" });
+    }
+    const v266 = data["model"];
+    if (v266 !== undefined) {
+      const p267 = path + "/model";
+      if (!(typeof v266 === 'string')) {
+        errors.push({ instancePath: p267, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v268 = data["provider"];
+    if (v268 !== undefined) {
+      const p269 = path + "/provider";
+      if (!(typeof v268 === 'string')) {
+        errors.push({ instancePath: p269, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v270 = data["sessionId"];
+    if (v270 !== undefined) {
+      const p271 = path + "/sessionId";
+      if (!(typeof v270 === 'string' || v270 === null)) {
+        errors.push({ instancePath: p271, keyword: 'type', message: "must be string,null" });
+      }
+    }
+    const v272 = data["checks"];
+    if (v272 !== undefined) {
+      const p273 = path + "/checks";
+      if (!(Array.isArray(v272))) {
+        errors.push({ instancePath: p273, keyword: 'type', message: "must be array" });
+      }
+      if (Array.isArray(v272)) {
+        if (v272.length < 6) {
+          errors.push({ instancePath: p273, keyword: 'minItems', message: "must NOT have fewer than 6 items" });
+        }
+        if (v272.length > 6) {
+          errors.push({ instancePath: p273, keyword: 'maxItems', message: "must NOT have more than 6 items" });
+        }
+        for (let i274 = 0; i274 < v272.length; i274++) {
+          const v275 = v272[i274];
+          const p276 = p273 + '/' + i274;
+          if (!(isObject(v275))) {
+            errors.push({ instancePath: p276, keyword: 'type', message: "must be object" });
+          }
+          if (isObject(v275)) {
+            if (v275["name"] === undefined) {
+              errors.push({ instancePath: p276, keyword: 'required', message: "must have required property 'name'" });
+            }
+            if (v275["score"] === undefined) {
+              errors.push({ instancePath: p276, keyword: 'required', message: "must have required property 'score'" });
+            }
+            if (v275["critical"] === undefined) {
+              errors.push({ instancePath: p276, keyword: 'required', message: "must have required property 'critical'" });
+            }
+            for (const key277 of Object.keys(v275)) {
+              if (props210.has(key277)) continue;
+              errors.push({ instancePath: p276, keyword: 'additionalProperties', message: "must NOT have additional property '" + key277 + "'" });
+            }
+            const v278 = v275["name"];
+            if (v278 !== undefined) {
+              const p279 = p276 + "/name";
+              if (!(typeof v278 === 'string')) {
+                errors.push({ instancePath: p279, keyword: 'type', message: "must be string" });
+              }
+              if (!enum214.has(v278)) {
+                errors.push({ instancePath: p279, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+              }
+            }
+            const v280 = v275["score"];
+            if (v280 !== undefined) {
+              const p281 = p276 + "/score";
+              if (!(Number.isInteger(v280))) {
+                errors.push({ instancePath: p281, keyword: 'type', message: "must be integer" });
+              }
+              if (typeof v280 === 'number') {
+                if (v280 < 0) {
+                  errors.push({ instancePath: p281, keyword: 'minimum', message: "must be >= 0" });
+                }
+                if (v280 > 25) {
+                  errors.push({ instancePath: p281, keyword: 'maximum', message: "must be <= 25" });
+                }
+              }
+            }
+            const v282 = v275["critical"];
+            if (v282 !== undefined) {
+              const p283 = p276 + "/critical";
+              if (!(typeof v282 === 'boolean')) {
+                errors.push({ instancePath: p283, keyword: 'type', message: "must be boolean" });
+              }
+            }
+            const v284 = v275["note"];
+            if (v284 !== undefined) {
+              const p285 = p276 + "/note";
+              if (!(typeof v284 === 'string')) {
+                errors.push({ instancePath: p285, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+      }
+    }
+    const v286 = data["selfClassification"];
+    if (v286 !== undefined) {
+      const p287 = path + "/selfClassification";
+      if (!(typeof v286 === 'string')) {
+        errors.push({ instancePath: p287, keyword: 'type', message: "must be string" });
+      }
+      if (!enum202.has(v286)) {
+        errors.push({ instancePath: p287, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+      }
+    }
+    const v288 = data["summary"];
+    if (v288 !== undefined) {
+      const p289 = path + "/summary";
+      if (!(typeof v288 === 'string')) {
+        errors.push({ instancePath: p289, keyword: 'type', message: "must be string" });
+      }
+    }
+  }
+}
+
+function validateProposal(data: any, path: string, errors: SchemaValidationError[]): void {
+  if (!(isObject(data))) {
+    errors.push({ instancePath: path, keyword: 'type', message: "must be object" });
+  }
+  if (isObject(data)) {
+    if (data["id"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'id'" });
+    }
+    if (data["title"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'title'" });
+    }
+    if (data["proposer"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'proposer'" });
+    }
+    if (data["status"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'status'" });
+    }
+    if (data["createdAt"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'createdAt'" });
+    }
+    if (data["abstract"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'abstract'" });
+    }
+    if (data["motivation"] === undefined) {
+      errors.push({ instancePath: path, keyword: 'required', message: "must have required property 'motivation'" });
+    }
+    for (const key291 of Object.keys(data)) {
+      if (props290.has(key291)) continue;
+      errors.push({ instancePath: path, keyword: 'additionalProperties', message: "must NOT have additional property '" + key291 + "'" });
+    }
+    const v292 = data["$schema"];
+    if (v292 !== undefined) {
+      const p293 = path + "/$schema";
+      if (!(typeof v292 === 'string')) {
+        errors.push({ instancePath: p293, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v294 = data["id"];
+    if (v294 !== undefined) {
+      const p295 = path + "/id";
+      if (!(typeof v294 === 'string')) {
+        errors.push({ instancePath: p295, keyword: 'type', message: "must be string" });
+      }
+      if (typeof v294 === 'string') {
+        if (!pattern296.test(v294)) {
+          errors.push({ instancePath: p295, keyword: 'pattern', message: "must match pattern \"^(BIP-)?\\d{3}$\"" });
+        }
+      }
+    }
+    const v297 = data["title"];
+    if (v297 !== undefined) {
+      const p298 = path + "/title";
+      if (!(typeof v297 === 'string')) {
+        errors.push({ instancePath: p298, keyword: 'type', message: "must be string" });
+      }
+      if (typeof v297 === 'string') {
+        const len299 = ucs2length(v297);
+        if (len299 < 5) {
+          errors.push({ instancePath: p298, keyword: 'minLength', message: "must NOT have fewer than 5 characters" });
+        }
+        if (len299 > 200) {
+          errors.push({ instancePath: p298, keyword: 'maxLength', message: "must NOT have more than 200 characters" });
+        }
+      }
+    }
+    const v300 = data["proposer"];
+    if (v300 !== undefined) {
+      const p301 = path + "/proposer";
+      if (!(isObject(v300))) {
+        errors.push({ instancePath: p301, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v300)) {
+        if (v300["model"] === undefined) {
+          errors.push({ instancePath: p301, keyword: 'required', message: "must have required property 'model'" });
+        }
+        if (v300["provider"] === undefined) {
+          errors.push({ instancePath: p301, keyword: 'required', message: "must have required property 'provider'" });
+        }
+        for (const key302 of Object.keys(v300)) {
+          if (props13.has(key302)) continue;
+          errors.push({ instancePath: p301, keyword: 'additionalProperties', message: "must NOT have additional property '" + key302 + "'" });
+        }
+        const v303 = v300["model"];
+        if (v303 !== undefined) {
+          const p304 = p301 + "/model";
+          if (!(typeof v303 === 'string')) {
+            errors.push({ instancePath: p304, keyword: 'type', message: "must be string" });
+          }
+        }
+        const v305 = v300["provider"];
+        if (v305 !== undefined) {
+          const p306 = p301 + "/provider";
+          if (!(typeof v305 === 'string')) {
+            errors.push({ instancePath: p306, keyword: 'type', message: "must be string" });
+          }
+        }
+        const v307 = v300["role"];
+        if (v307 !== undefined) {
+          const p308 = p301 + "/role";
+          if (!(typeof v307 === 'string')) {
+            errors.push({ instancePath: p308, keyword: 'type', message: "must be string" });
+          }
+          if (!enum309.has(v307)) {
+            errors.push({ instancePath: p308, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+          }
+        }
+      }
+    }
+    const v310 = data["status"];
+    if (v310 !== undefined) {
+      const p311 = path + "/status";
+      if (!(typeof v310 === 'string')) {
+        errors.push({ instancePath: p311, keyword: 'type', message: "must be string" });
+      }
+      if (!enum312.has(v310)) {
+        errors.push({ instancePath: p311, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+      }
+    }
+    const v313 = data["type"];
+    if (v313 !== undefined) {
+      const p314 = path + "/type";
+      if (!(typeof v313 === 'string')) {
+        errors.push({ instancePath: p314, keyword: 'type', message: "must be string" });
+      }
+      if (!enum315.has(v313)) {
+        errors.push({ instancePath: p314, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+      }
+    }
+    const v316 = data["category"];
+    if (v316 !== undefined) {
+      const p317 = path + "/category";
+      if (!(typeof v316 === 'string')) {
+        errors.push({ instancePath: p317, keyword: 'type', message: "must be string" });
+      }
+      if (!enum318.has(v316)) {
+        errors.push({ instancePath: p317, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+      }
+    }
+    const v319 = data["createdAt"];
+    if (v319 !== undefined) {
+      const p320 = path + "/createdAt";
+      if (!(typeof v319 === 'string')) {
+        errors.push({ instancePath: p320, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v321 = data["updatedAt"];
+    if (v321 !== undefined) {
+      const p322 = path + "/updatedAt";
+      if (!(typeof v321 === 'string')) {
+        errors.push({ instancePath: p322, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v323 = data["license"];
+    if (v323 !== undefined) {
+      const p324 = path + "/license";
+      if (!(typeof v323 === 'string')) {
+        errors.push({ instancePath: p324, keyword: 'type', message: "must be string" });
+      }
+    }
+    const v325 = data["abstract"];
+    if (v325 !== undefined) {
+      const p326 = path + "/abstract";
+      if (!(typeof v325 === 'string')) {
+        errors.push({ instancePath: p326, keyword: 'type', message: "must be string" });
+      }
+      if (typeof v325 === 'string') {
+        const len327 = ucs2length(v325);
+        if (len327 < 50) {
+          errors.push({ instancePath: p326, keyword: 'minLength', message: "must NOT have fewer than 50 characters" });
+        }
+        if (len327 > 500) {
+          errors.push({ instancePath: p326, keyword: 'maxLength', message: "must NOT have more than 500 characters" });
+        }
+      }
+    }
+    const v328 = data["motivation"];
+    if (v328 !== undefined) {
+      const p329 = path + "/motivation";
+      if (!(typeof v328 === 'string')) {
+        errors.push({ instancePath: p329, keyword: 'type', message: "must be string" });
+      }
+      if (typeof v328 === 'string') {
+        const len330 = ucs2length(v328);
+        if (len330 < 100) {
+          errors.push({ instancePath: p329, keyword: 'minLength', message: "must NOT have fewer than 100 characters" });
+        }
+      }
+    }
+    const v331 = data["rationale"];
+    if (v331 !== undefined) {
+      const p332 = path + "/rationale";
+      if (!(typeof v331 === 'string')) {
+        errors.push({ instancePath: p332, keyword: 'type', message: "must be string" });
+      }
+      if (typeof v331 === 'string') {
+        const len333 = ucs2length(v331);
+        if (len333 < 100) {
+          errors.push({ instancePath: p332, keyword: 'minLength', message: "must NOT have fewer than 100 characters" });
+        }
+      }
+    }
+    const v334 = data["specification"];
+    if (v334 !== undefined) {
+      const p335 = path + "/specification";
+      if (!(typeof v334 === 'string')) {
+        errors.push({ instancePath: p335, keyword: 'type', message: "must be string" });
+      }
+      if (typeof v334 === 'string') {
+        const len336 = ucs2length(v334);
+        if (len336 < 100) {
+          errors.push({ instancePath: p335, keyword: 'minLength', message: "must NOT have fewer than 100 characters" });
+        }
+      }
+    }
+    const v337 = data["implementation"];
+    if (v337 !== undefined) {
+      const p338 = path + "/implementation";
+      if (!(isObject(v337))) {
+        errors.push({ instancePath: p338, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v337)) {
+        for (const key340 of Object.keys(v337)) {
+          if (props339.has(key340)) continue;
+          errors.push({ instancePath: p338, keyword: 'additionalProperties', message: "must NOT have additional property '" + key340 + "'" });
+        }
+        const v341 = v337["overview"];
+        if (v341 !== undefined) {
+          const p342 = p338 + "/overview";
+          if (!(typeof v341 === 'string')) {
+            errors.push({ instancePath: p342, keyword: 'type', message: "must be string" });
+          }
+        }
+        const v343 = v337["phases"];
+        if (v343 !== undefined) {
+          const p344 = p338 + "/phases";
+          if (!(Array.isArray(v343))) {
+            errors.push({ instancePath: p344, keyword: 'type', message: "must be array" });
+          }
+          if (Array.isArray(v343)) {
+            for (let i345 = 0; i345 < v343.length; i345++) {
+              const v346 = v343[i345];
+              const p347 = p344 + '/' + i345;
+              if (!(isObject(v346))) {
+                errors.push({ instancePath: p347, keyword: 'type', message: "must be object" });
+              }
+              if (isObject(v346)) {
+                if (v346["phase"] === undefined) {
+                  errors.push({ instancePath: p347, keyword: 'required', message: "must have required property 'phase'" });
+                }
+                if (v346["description"] === undefined) {
+                  errors.push({ instancePath: p347, keyword: 'required', message: "must have required property 'description'" });
+                }
+                if (v346["timeline"] === undefined) {
+                  errors.push({ instancePath: p347, keyword: 'required', message: "must have required property 'timeline'" });
+                }
+                for (const key349 of Object.keys(v346)) {
+                  if (props348.has(key349)) continue;
+                  errors.push({ instancePath: p347, keyword: 'additionalProperties', message: "must NOT have additional property '" + key349 + "'" });
+                }
+                const v350 = v346["phase"];
+                if (v350 !== undefined) {
+                  const p351 = p347 + "/phase";
+                  if (!(typeof v350 === 'string')) {
+                    errors.push({ instancePath: p351, keyword: 'type', message: "must be string" });
+                  }
+                }
+                const v352 = v346["description"];
+                if (v352 !== undefined) {
+                  const p353 = p347 + "/description";
+                  if (!(typeof v352 === 'string')) {
+                    errors.push({ instancePath: p353, keyword: 'type', message: "must be string" });
+                  }
+                }
+                const v354 = v346["timeline"];
+                if (v354 !== undefined) {
+                  const p355 = p347 + "/timeline";
+                  if (!(typeof v354 === 'string')) {
+                    errors.push({ instancePath: p355, keyword: 'type', message: "must be string" });
+                  }
+                }
+                const v356 = v346["tasks"];
+                if (v356 !== undefined) {
+                  const p357 = p347 + "/tasks";
+                  if (!(Array.isArray(v356))) {
+                    errors.push({ instancePath: p357, keyword: 'type', message: "must be array" });
+                  }
+                  if (Array.isArray(v356)) {
+                    for (let i358 = 0; i358 < v356.length; i358++) {
+                      const v359 = v356[i358];
+                      const p360 = p357 + '/' + i358;
+                      if (!(typeof v359 === 'string')) {
+                        errors.push({ instancePath: p360, keyword: 'type', message: "must be string" });
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+        const v361 = v337["successCriteria"];
+        if (v361 !== undefined) {
+          const p362 = p338 + "/successCriteria";
+          if (!(Array.isArray(v361))) {
+            errors.push({ instancePath: p362, keyword: 'type', message: "must be array" });
+          }
+          if (Array.isArray(v361)) {
+            for (let i363 = 0; i363 < v361.length; i363++) {
+              const v364 = v361[i363];
+              const p365 = p362 + '/' + i363;
+              if (!(typeof v364 === 'string')) {
+                errors.push({ instancePath: p365, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+        const v366 = v337["relatedFiles"];
+        if (v366 !== undefined) {
+          const p367 = p338 + "/relatedFiles";
+          if (!(Array.isArray(v366))) {
+            errors.push({ instancePath: p367, keyword: 'type', message: "must be array" });
+          }
+          if (Array.isArray(v366)) {
+            for (let i368 = 0; i368 < v366.length; i368++) {
+              const v369 = v366[i368];
+              const p370 = p367 + '/' + i368;
+              if (!(typeof v369 === 'string')) {
+                errors.push({ instancePath: p370, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+      }
+    }
+    const v371 = data["benefits"];
+    if (v371 !== undefined) {
+      const p372 = path + "/benefits";
+      if (!(Array.isArray(v371))) {
+        errors.push({ instancePath: p372, keyword: 'type', message: "must be array" });
+      }
+      if (Array.isArray(v371)) {
+        if (v371.length < 1) {
+          errors.push({ instancePath: p372, keyword: 'minItems', message: "must NOT have fewer than 1 items" });
+        }
+        for (let i373 = 0; i373 < v371.length; i373++) {
+          const v374 = v371[i373];
+          const p375 = p372 + '/' + i373;
+          if (!(typeof v374 === 'string')) {
+            errors.push({ instancePath: p375, keyword: 'type', message: "must be string" });
+          }
+        }
+      }
+    }
+    const v376 = data["challenges"];
+    if (v376 !== undefined) {
+      const p377 = path + "/challenges";
+      if (!(Array.isArray(v376))) {
+        errors.push({ instancePath: p377, keyword: 'type', message: "must be array" });
+      }
+      if (Array.isArray(v376)) {
+        for (let i378 = 0; i378 < v376.length; i378++) {
+          const v379 = v376[i378];
+          const p380 = p377 + '/' + i378;
+          if (!(typeof v379 === 'string')) {
+            errors.push({ instancePath: p380, keyword: 'type', message: "must be string" });
+          }
+        }
+      }
+    }
+    const v381 = data["impact"];
+    if (v381 !== undefined) {
+      const p382 = path + "/impact";
+      if (!(isObject(v381))) {
+        errors.push({ instancePath: p382, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v381)) {
+        for (const key384 of Object.keys(v381)) {
+          if (props383.has(key384)) continue;
+          errors.push({ instancePath: p382, keyword: 'additionalProperties', message: "must NOT have additional property '" + key384 + "'" });
+        }
+        const v385 = v381["scope"];
+        if (v385 !== undefined) {
+          const p386 = p382 + "/scope";
+          if (!(typeof v385 === 'string')) {
+            errors.push({ instancePath: p386, keyword: 'type', message: "must be string" });
+          }
+          if (!enum387.has(v385)) {
+            errors.push({ instancePath: p386, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+          }
+        }
+        const v388 = v381["complexity"];
+        if (v388 !== undefined) {
+          const p389 = p382 + "/complexity";
+          if (!(typeof v388 === 'string')) {
+            errors.push({ instancePath: p389, keyword: 'type', message: "must be string" });
+          }
+          if (!enum390.has(v388)) {
+            errors.push({ instancePath: p389, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+          }
+        }
+        const v391 = v381["priority"];
+        if (v391 !== undefined) {
+          const p392 = p382 + "/priority";
+          if (!(typeof v391 === 'string')) {
+            errors.push({ instancePath: p392, keyword: 'type', message: "must be string" });
+          }
+          if (!enum393.has(v391)) {
+            errors.push({ instancePath: p392, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+          }
+        }
+      }
+    }
+    const v394 = data["nextSteps"];
+    if (v394 !== undefined) {
+      const p395 = path + "/nextSteps";
+      if (!(Array.isArray(v394))) {
+        errors.push({ instancePath: p395, keyword: 'type', message: "must be array" });
+      }
+      if (Array.isArray(v394)) {
+        for (let i396 = 0; i396 < v394.length; i396++) {
+          const v397 = v394[i396];
+          const p398 = p395 + '/' + i396;
+          if (!(typeof v397 === 'string')) {
+            errors.push({ instancePath: p398, keyword: 'type', message: "must be string" });
+          }
+        }
+      }
+    }
+    const v399 = data["references"];
+    if (v399 !== undefined) {
+      const p400 = path + "/references";
+      if (!(Array.isArray(v399))) {
+        errors.push({ instancePath: p400, keyword: 'type', message: "must be array" });
+      }
+      if (Array.isArray(v399)) {
+        for (let i401 = 0; i401 < v399.length; i401++) {
+          const v402 = v399[i401];
+          const p403 = p400 + '/' + i401;
+          if (!(isObject(v402))) {
+            errors.push({ instancePath: p403, keyword: 'type', message: "must be object" });
+          }
+          if (isObject(v402)) {
+            if (v402["title"] === undefined) {
+              errors.push({ instancePath: p403, keyword: 'required', message: "must have required property 'title'" });
+            }
+            if (v402["url"] === undefined) {
+              errors.push({ instancePath: p403, keyword: 'required', message: "must have required property 'url'" });
+            }
+            for (const key405 of Object.keys(v402)) {
+              if (props404.has(key405)) continue;
+              errors.push({ instancePath: p403, keyword: 'additionalProperties', message: "must NOT have additional property '" + key405 + "'" });
+            }
+            const v406 = v402["title"];
+            if (v406 !== undefined) {
+              const p407 = p403 + "/title";
+              if (!(typeof v406 === 'string')) {
+                errors.push({ instancePath: p407, keyword: 'type', message: "must be string" });
+              }
+            }
+            const v408 = v402["url"];
+            if (v408 !== undefined) {
+              const p409 = p403 + "/url";
+              if (!(typeof v408 === 'string')) {
+                errors.push({ instancePath: p409, keyword: 'type', message: "must be string" });
+              }
+            }
+            const v410 = v402["type"];
+            if (v410 !== undefined) {
+              const p411 = p403 + "/type";
+              if (!(typeof v410 === 'string')) {
+                errors.push({ instancePath: p411, keyword: 'type', message: "must be string" });
+              }
+              if (!enum412.has(v410)) {
+                errors.push({ instancePath: p411, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+              }
+            }
+          }
+        }
+      }
+    }
+    const v413 = data["voting"];
+    if (v413 !== undefined) {
+      const p414 = path + "/voting";
+      if (!(isObject(v413))) {
+        errors.push({ instancePath: p414, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v413)) {
+        for (const key416 of Object.keys(v413)) {
+          if (props415.has(key416)) continue;
+          errors.push({ instancePath: p414, keyword: 'additionalProperties', message: "must NOT have additional property '" + key416 + "'" });
+        }
+        const v417 = v413["totalVotes"];
+        if (v417 !== undefined) {
+          const p418 = p414 + "/totalVotes";
+          if (!(Number.isInteger(v417))) {
+            errors.push({ instancePath: p418, keyword: 'type', message: "must be integer" });
+          }
+          if (typeof v417 === 'number') {
+            if (v417 < 0) {
+              errors.push({ instancePath: p418, keyword: 'minimum', message: "must be >= 0" });
+            }
+          }
+        }
+        const v419 = v413["supportVotes"];
+        if (v419 !== undefined) {
+          const p420 = p414 + "/supportVotes";
+          if (!(Number.isInteger(v419))) {
+            errors.push({ instancePath: p420, keyword: 'type', message: "must be integer" });
+          }
+          if (typeof v419 === 'number') {
+            if (v419 < 0) {
+              errors.push({ instancePath: p420, keyword: 'minimum', message: "must be >= 0" });
+            }
+          }
+        }
+        const v421 = v413["approvalRatio"];
+        if (v421 !== undefined) {
+          const p422 = p414 + "/approvalRatio";
+          if (!((typeof v421 === 'number' && Number.isFinite(v421)))) {
+            errors.push({ instancePath: p422, keyword: 'type', message: "must be number" });
+          }
+          if (typeof v421 === 'number') {
+            if (v421 < 0) {
+              errors.push({ instancePath: p422, keyword: 'minimum', message: "must be >= 0" });
+            }
+            if (v421 > 1) {
+              errors.push({ instancePath: p422, keyword: 'maximum', message: "must be <= 1" });
+            }
+          }
+        }
+        const v423 = v413["quorumMet"];
+        if (v423 !== undefined) {
+          const p424 = p414 + "/quorumMet";
+          if (!(typeof v423 === 'boolean')) {
+            errors.push({ instancePath: p424, keyword: 'type', message: "must be boolean" });
+          }
+        }
+        const v425 = v413["consensusReached"];
+        if (v425 !== undefined) {
+          const p426 = p414 + "/consensusReached";
+          if (!(typeof v425 === 'boolean')) {
+            errors.push({ instancePath: p426, keyword: 'type', message: "must be boolean" });
+          }
+        }
+        const v427 = v413["votedAt"];
+        if (v427 !== undefined) {
+          const p428 = p414 + "/votedAt";
+          if (!(typeof v427 === 'string')) {
+            errors.push({ instancePath: p428, keyword: 'type', message: "must be string" });
+          }
+        }
+        const v429 = v413["threshold"];
+        if (v429 !== undefined) {
+          const p430 = p414 + "/threshold";
+          if (!((typeof v429 === 'number' && Number.isFinite(v429)))) {
+            errors.push({ instancePath: p430, keyword: 'type', message: "must be number" });
+          }
+          if (typeof v429 === 'number') {
+            if (v429 < 0) {
+              errors.push({ instancePath: p430, keyword: 'minimum', message: "must be >= 0" });
+            }
+            if (v429 > 1) {
+              errors.push({ instancePath: p430, keyword: 'maximum', message: "must be <= 1" });
+            }
+          }
+        }
+      }
+    }
+    const v431 = data["metadata"];
+    if (v431 !== undefined) {
+      const p432 = path + "/metadata";
+      if (!(isObject(v431))) {
+        errors.push({ instancePath: p432, keyword: 'type', message: "must be object" });
+      }
+      if (isObject(v431)) {
+        for (const key434 of Object.keys(v431)) {
+          if (props433.has(key434)) continue;
+          errors.push({ instancePath: p432, keyword: 'additionalProperties', message: "must NOT have additional property '" + key434 + "'" });
+        }
+        const v435 = v431["tags"];
+        if (v435 !== undefined) {
+          const p436 = p432 + "/tags";
+          if (!(Array.isArray(v435))) {
+            errors.push({ instancePath: p436, keyword: 'type', message: "must be array" });
+          }
+          if (Array.isArray(v435)) {
+            for (let i437 = 0; i437 < v435.length; i437++) {
+              const v438 = v435[i437];
+              const p439 = p436 + '/' + i437;
+              if (!(typeof v438 === 'string')) {
+                errors.push({ instancePath: p439, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+        const v440 = v431["priority"];
+        if (v440 !== undefined) {
+          const p441 = p432 + "/priority";
+          if (!(typeof v440 === 'string')) {
+            errors.push({ instancePath: p441, keyword: 'type', message: "must be string" });
+          }
+          if (!enum393.has(v440)) {
+            errors.push({ instancePath: p441, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+          }
+        }
+        const v442 = v431["estimatedEffort"];
+        if (v442 !== undefined) {
+          const p443 = p432 + "/estimatedEffort";
+          if (!(typeof v442 === 'string')) {
+            errors.push({ instancePath: p443, keyword: 'type', message: "must be string" });
+          }
+          if (!enum444.has(v442)) {
+            errors.push({ instancePath: p443, keyword: 'enum', message: 'must be equal to one of the allowed values' });
+          }
+        }
+        const v445 = v431["dependencies"];
+        if (v445 !== undefined) {
+          const p446 = p432 + "/dependencies";
+          if (!(Array.isArray(v445))) {
+            errors.push({ instancePath: p446, keyword: 'type', message: "must be array" });
+          }
+          if (Array.isArray(v445)) {
+            for (let i447 = 0; i447 < v445.length; i447++) {
+              const v448 = v445[i447];
+              const p449 = p446 + '/' + i447;
+              if (!(typeof v448 === 'string')) {
+                errors.push({ instancePath: p449, keyword: 'type', message: "must be string" });
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Validate against a schema, appending every violation to `errors`
+ */
+export const schemaValidators: Readonly<Record<SchemaName, SchemaValidateFunction>> = {
+  "minutes_report": validateMinutesReport,
+  "model_evaluation_entry": validateModelEvaluationEntry,
+  "model_evaluations": validateModelEvaluations,
+  "model_test_result": validateModelTestResult,
+  "proposal": validateProposal,
+};
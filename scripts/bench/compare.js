@@ -0,0 +1,179 @@
+#!/usr/bin/env node
+
+/**
+ * Benchmark regression gate
+ *
+ * Compares each package's bench-results.json against its bench-baseline.json
+ * and exits non-zero when a benchmark's throughput drops by more than the
+ * threshold (and by more than its measured noise). Baselines are not
+ * committed: numbers are only comparable on the same machine, so CI
+ * benchmarks the pull request's base commit first and stores the results
+ * with --update; locally, run --update on the commit to compare against.
+ *
+ * Usage:
+ *   node scripts/bench/compare.js [--threshold 0.1] [--update] [--require-baseline] [--json]
+ *
+ *   --threshold         allowed relative ops/sec drop (default 0.1, or $BENCH_THRESHOLD)
+ *   --update            store the current results as the new baselines
+ *   --require-baseline  fail when a package has no baseline
+ *   --json              print the comparison as JSON
+ */
+
+import fs from 'fs';
+import path from 'path';
+import { fileURLToPath } from 'url';
+import { RESULTS_FILE } from './json-reporter.js';
+
+const __filename = fileURLToPath(import.meta.url);
+const __dirname = path.dirname(__filename);
+
+const ROOT = path.join(__dirname, '../..');
+const PACKAGE_DIRS = ['packages', 'apps'];
+const BASELINE_FILE = 'bench-baseline.json';
+
+function parseArgs(argv) {
+    const args = {
+        threshold: Number(process.env.BENCH_THRESHOLD ?? 0.1),
+        update: false,
+        requireBaseline: false,
+        json: false
+    };
+
+    for (let i = 0; i < argv.length; i++) {
+        const arg = argv[i];
+        if (arg === '--update') args.update = true;
+        else if (arg === '--require-baseline') args.requireBaseline = true;
+        else if (arg === '--json') args.json = true;
+        else if (arg === '--threshold') args.threshold = Number(argv[++i]);
+        else throw new Error(`Unknown argument: ${arg}`);
+    }
+
+    if (!Number.isFinite(args.threshold) || args.threshold < 0) {
+        throw new Error(`Invalid threshold: ${args.threshold}`);
+    }
+    return args;
+}
+
+function readJson(file) {
+    try {
+        return JSON.parse(fs.readFileSync(file, 'utf8'));
+    } catch (error) {
+        if (error.code === 'ENOENT') return undefined;
+        throw new Error(`Cannot read ${file}: ${error.message}`);
+    }
+}
+
+function findResultFiles() {
+    const files = [];
+    for (const dir of PACKAGE_DIRS) {
+        const base = path.join(ROOT, dir);
+        if (!fs.existsSync(base)) continue;
+
+        for (const entry of fs.readdirSync(base, { withFileTypes: true })) {
+            const candidate = path.join(base, entry.name, RESULTS_FILE);
+            if (entry.isDirectory() && fs.existsSync(candidate)) {
+                files.push(candidate);
+            }
+        }
+    }
+    return files;
+}
+
+/**
+ * Compare one package; a benchmark regresses when ops/sec fell by more
+ * than the threshold and by more than the combined relative margin of error
+ */
+export function comparePackage(current, baseline, threshold) {
+    const baseById = new Map((baseline?.benchmarks ?? []).map(b => [b.id, b]));
+    const rows = [];
+
+    for (const bench of current.benchmarks) {
+        const base = baseById.get(bench.id);
+        if (!base) {
+            rows.push({ id: bench.id, status: 'new', hz: bench.hz });
+            continue;
+        }
+
+        const change = base.hz > 0 ? (bench.hz - base.hz) / base.hz : 0;
+        const noise = ((bench.rme ?? 0) + (base.rme ?? 0)) / 100;
+        const regressed = change < -Math.max(threshold, noise);
+
+        rows.push({
+            id: bench.id,
+            status: regressed ? 'regressed' : change > threshold ? 'improved' : 'ok',
+            hz: bench.hz,
+            baselineHz: base.hz,
+            change
+        });
+    }
+
+    return rows;
+}
+
+function formatHz(hz) {
+    return hz >= 1000 ? `${(hz / 1000).toFixed(1)}k` : hz.toFixed(1);
+}
+
+function main() {
+    const args = parseArgs(process.argv.slice(2));
+    const resultFiles = findResultFiles();
+
+    if (resultFiles.length === 0) {
+        console.error(`No ${RESULTS_FILE} found; run "pnpm bench" first`);
+        process.exit(1);
+    }
+
+    const report = [];
+    let regressions = 0;
+    let missingBaselines = 0;
+
+    for (const resultFile of resultFiles) {
+        const packageDir = path.dirname(resultFile);
+        const baselineFile = path.join(packageDir, BASELINE_FILE);
+        const current = readJson(resultFile);
+
+        if (args.update) {
+            fs.copyFileSync(resultFile, baselineFile);
+            console.log(`📌 Baseline updated: ${path.relative(ROOT, baselineFile)}`);
+            continue;
+        }
+
+        const baseline = readJson(baselineFile);
+        if (!baseline) missingBaselines++;
+        const rows = comparePackage(current, baseline, args.threshold);
+        regressions += rows.filter(row => row.status === 'regressed').length;
+        report.push({ package: current.package, baseline: baseline ? path.relative(ROOT, baselineFile) : null, rows });
+    }
+
+    if (args.update) return;
+
+    const failed = regressions > 0 || (args.requireBaseline && missingBaselines > 0);
+
+    if (args.json) {
+        console.log(JSON.stringify({ threshold: args.threshold, regressions, missingBaselines, packages: report }, null, 2));
+    } else {
+        for (const pkg of report) {
+            console.log(`\n${pkg.package}${pkg.baseline ? '' : ' (no baseline, run with --update to create one)'}`);
+            for (const row of pkg.rows) {
+                const delta = row.change === undefined ? '' : ` ${(row.change * 100).toFixed(1)}% vs ${formatHz(row.baselineHz)} ops/s`;
+                const icon = row.status === 'regressed' ? '❌' : row.status === 'improved' ? '🚀' : row.status === 'new' ? '🆕' : '✅';
+                console.log(`  ${icon} ${row.id}: ${formatHz(row.hz)} ops/s${delta}`);
+            }
+        }
+        console.log(`\n${regressions === 0 ? '✅ No regressions' : `❌ ${regressions} regression(s)`} (threshold ${(args.threshold * 100).toFixed(0)}%)`);
+        if (args.requireBaseline && missingBaselines > 0) {
+            console.log(`❌ ${missingBaselines} package(s) without a baseline`);
+        }
+    }
+
+    process.exit(failed ? 1 : 0);
+}
+
+if (process.argv[1] && path.resolve(process.argv[1]) === __filename) {
+    try {
+        main();
+    } catch (error) {
+        console.error(`❌ ${error.message}`);
+        process.exit(1);
+    }
+}
@@ -0,0 +1,78 @@
+/**
+ * Vitest benchmark reporter that writes bench-results.json
+ *
+ * Output is independent of the vitest version's built-in bench reporters so
+ * scripts/bench/compare.js can gate regressions against a stored baseline.
+ */
+
+import fs from 'fs';
+import path from 'path';
+
+export const RESULTS_FILE = 'bench-results.json';
+
+export class BenchJsonReporter {
+    constructor(outputFile = RESULTS_FILE) {
+        this.outputFile = outputFile;
+        this.root = process.cwd();
+    }
+
+    onInit(ctx) {
+        this.root = ctx.config.root;
+    }
+
+    onFinished(files = []) {
+        const benchmarks = [];
+
+        for (const file of files) {
+            const relative = path.relative(this.root, file.filepath).split(path.sep).join('/');
+            collect(file.tasks ?? [], [relative], benchmarks);
+        }
+
+        if (benchmarks.length === 0) return;
+
+        const packageJson = readPackageJson(this.root);
+        const report = {
+            package: packageJson?.name ?? path.basename(this.root),
+            generatedAt: new Date().toISOString(),
+            node: process.version,
+            benchmarks: benchmarks.sort((a, b) => a.id.localeCompare(b.id))
+        };
+
+        const target = path.resolve(this.root, this.outputFile);
+        fs.writeFileSync(target, JSON.stringify(report, null, 2) + '\n', 'utf8');
+        console.log(`📊 Benchmark results written to ${path.relative(process.cwd(), target)}`);
+    }
+}
+
+function collect(tasks, trail, out) {
+    for (const task of tasks) {
+        const names = [...trail, task.name];
+
+        if (task.tasks) {
+            collect(task.tasks, names, out);
+            continue;
+        }
+
+        const result = task.result?.benchmark;
+        if (!result) continue;
+
+        out.push({
+            id: names.join(' > '),
+            hz: result.hz,
+            mean: result.mean,
+            p99: result.p99,
+            rme: result.rme,
+            samples: Array.isArray(result.samples) ? result.samples.length : result.samples
+        });
+    }
+}
+
+function readPackageJson(root) {
+    try {
+        return JSON.parse(fs.readFileSync(path.join(root, 'package.json'), 'utf8'));
+    } catch {
+        return undefined;
+    }
+}
+
+export default BenchJsonReporter;
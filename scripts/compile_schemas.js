@@ -0,0 +1,400 @@
+#!/usr/bin/env node
+
+/**
+ * Schema validator compiler
+ *
+ * Compiles every gov/schemas/*.schema.json into standalone validation code
+ * (packages/shared-types/src/schemas/validators.ts), so the TypeScript
+ * packages validate governance JSON without loading or interpreting the
+ * schemas at runtime.
+ *
+ * Only the draft-07 keywords the schemas actually use are supported; any
+ * other assertion keyword fails compilation instead of being skipped.
+ * `format` is treated as an annotation, as in scripts/validate_schema.py.
+ *
+ * Usage:
+ *   node scripts/compile_schemas.js [--check]
+ *
+ *   --check  exit non-zero when the generated file is out of date
+ */
+
+import fs from 'fs';
+import path from 'path';
+import { fileURLToPath, pathToFileURL } from 'url';
+
+const __filename = fileURLToPath(import.meta.url);
+const __dirname = path.dirname(__filename);
+
+const ROOT = path.join(__dirname, '..');
+const SCHEMAS_DIR = path.join(ROOT, 'gov/schemas');
+const OUTPUT_FILE = path.join(ROOT, 'packages/shared-types/src/schemas/validators.ts');
+const SCHEMA_SUFFIX = '.schema.json';
+
+const ANNOTATIONS = new Set([
+    '$schema', '$id', '$comment', 'title', 'description', 'default', 'examples', 'format'
+]);
+
+const ASSERTIONS = new Set([
+    'type', 'enum', '$ref',
+    'minLength', 'maxLength', 'pattern',
+    'minimum', 'maximum',
+    'items', 'minItems', 'maxItems',
+    'required', 'properties', 'additionalProperties'
+]);
+
+const TYPE_CHECKS = {
+    string: v => `typeof ${v} === 'string'`,
+    number: v => `(typeof ${v} === 'number' && Number.isFinite(${v}))`,
+    integer: v => `Number.isInteger(${v})`,
+    boolean: v => `typeof ${v} === 'boolean'`,
+    null: v => `${v} === null`,
+    array: v => `Array.isArray(${v})`,
+    object: v => `isObject(${v})`
+};
+
+/**
+ * Schema name used by both validators: file name without `.schema.json`
+ */
+export function schemaName(file) {
+    return path.basename(file, SCHEMA_SUFFIX);
+}
+
+function functionName(name) {
+    return 'validate' + name.split(/[^A-Za-z0-9]+/).map(part => part.charAt(0).toUpperCase() + part.slice(1)).join('');
+}
+
+function pointerSegment(key) {
+    return String(key).replace(/~/g, '~0').replace(/\//g, '~1');
+}
+
+class ValidatorCompiler {
+    constructor(schemas) {
+        this.schemas = schemas;
+        this.constants = [];
+        this.constantIds = new Map();
+        this.counter = 0;
+        this.usesUcs2Length = false;
+        this.usesPointerSegment = false;
+    }
+
+    compile() {
+        const functions = [];
+        for (const [name, schema] of this.schemas) {
+            const body = [];
+            this.emit(schema, 'data', 'path', body, 1, name);
+            functions.push([
+                `function ${functionName(name)}(data: any, path: string, errors: SchemaValidationError[]): void {`,
+                ...body,
+                '}'
+            ].join('\n'));
+        }
+        return functions;
+    }
+
+    next(prefix) {
+        return `${prefix}${this.counter++}`;
+    }
+
+    constant(prefix, expression) {
+        const existing = this.constantIds.get(expression);
+        if (existing) return existing;
+
+        const id = this.next(prefix);
+        this.constantIds.set(expression, id);
+        this.constants.push(`const ${id} = ${expression};`);
+        return id;
+    }
+
+    emit(schema, value, instancePath, lines, depth, where) {
+        const pad = '  '.repeat(depth);
+        const push = (keyword, message) =>
+            `${pad}  errors.push({ instancePath: ${instancePath}, keyword: '${keyword}', message: ${message} });`;
+
+        if (schema === true) return;
+        if (schema === false) {
+            lines.push(`${pad}errors.push({ instancePath: ${instancePath}, keyword: 'false schema', message: 'must not be present' });`);
+            return;
+        }
+        if (!schema || typeof schema !== 'object' || Array.isArray(schema)) {
+            throw new Error(`${where}: schema must be an object or boolean`);
+        }
+
+        for (const keyword of Object.keys(schema)) {
+            if (!ASSERTIONS.has(keyword) && !ANNOTATIONS.has(keyword)) {
+                throw new Error(`${where}: unsupported keyword '${keyword}'`);
+            }
+        }
+
+        // Draft-07 ignores the siblings of $ref
+        if (schema.$ref !== undefined) {
+            const target = schemaName(schema.$ref);
+            if (!schema.$ref.endsWith(SCHEMA_SUFFIX) || !this.schemas.has(target)) {
+                throw new Error(`${where}: cannot resolve $ref '${schema.$ref}'`);
+            }
+            lines.push(`${pad}${functionName(target)}(${value}, ${instancePath}, errors);`);
+            return;
+        }
+
+        if (schema.type !== undefined) {
+            const types = Array.isArray(schema.type) ? schema.type : [schema.type];
+            for (const type of types) {
+                if (!TYPE_CHECKS[type]) throw new Error(`${where}: unsupported type '${type}'`);
+            }
+            lines.push(`${pad}if (!(${types.map(type => TYPE_CHECKS[type](value)).join(' || ')})) {`);
+            lines.push(push('type', JSON.stringify(`must be ${types.join(',')}`)));
+            lines.push(`${pad}}`);
+        }
+
+        if (schema.enum !== undefined) {
+            if (!schema.enum.every(item => item === null || typeof item !== 'object')) {
+                throw new Error(`${where}: only primitive enum values are supported`);
+            }
+            const allowed = this.constant('enum', `new Set<unknown>(${JSON.stringify(schema.enum)})`);
+            lines.push(`${pad}if (!${allowed}.has(${value})) {`);
+            lines.push(push('enum', "'must be equal to one of the allowed values'"));
+            lines.push(`${pad}}`);
+        }
+
+        this.emitString(schema, value, lines, depth, push);
+        this.emitNumber(schema, value, lines, depth, push);
+        this.emitArray(schema, value, instancePath, lines, depth, where, push);
+        this.emitObject(schema, value, instancePath, lines, depth, where, push);
+    }
+
+    emitString(schema, value, lines, depth, push) {
+        const { minLength, maxLength, pattern } = schema;
+        if (minLength === undefined && maxLength === undefined && pattern === undefined) return;
+
+        const pad = '  '.repeat(depth);
+        lines.push(`${pad}if (typeof ${value} === 'string') {`);
+
+        if (minLength !== undefined || maxLength !== undefined) {
+            this.usesUcs2Length = true;
+            const length = this.next('len');
+            lines.push(`${pad}  const ${length} = ucs2length(${value});`);
+            if (minLength !== undefined) {
+                lines.push(`${pad}  if (${length} < ${minLength}) {`);
+                lines.push(`  ${push('minLength', JSON.stringify(`must NOT have fewer than ${minLength} characters`))}`);
+                lines.push(`${pad}  }`);
+            }
+            if (maxLength !== undefined) {
+                lines.push(`${pad}  if (${length} > ${maxLength}) {`);
+                lines.push(`  ${push('maxLength', JSON.stringify(`must NOT have more than ${maxLength} characters`))}`);
+                lines.push(`${pad}  }`);
+            }
+        }
+
+        if (pattern !== undefined) {
+            const regex = this.constant('pattern', `new RegExp(${JSON.stringify(pattern)}, 'u')`);
+            lines.push(`${pad}  if (!${regex}.test(${value})) {`);
+            lines.push(`  ${push('pattern', JSON.stringify(`must match pattern "${pattern}"`))}`);
+            lines.push(`${pad}  }`);
+        }
+
+        lines.push(`${pad}}`);
+    }
+
+    emitNumber(schema, value, lines, depth, push) {
+        const { minimum, maximum } = schema;
+        if (minimum === undefined && maximum === undefined) return;
+
+        const pad = '  '.repeat(depth);
+        lines.push(`${pad}if (typeof ${value} === 'number') {`);
+        if (minimum !== undefined) {
+            lines.push(`${pad}  if (${value} < ${minimum}) {`);
+            lines.push(`  ${push('minimum', JSON.stringify(`must be >= ${minimum}`))}`);
+            lines.push(`${pad}  }`);
+        }
+        if (maximum !== undefined) {
+            lines.push(`${pad}  if (${value} > ${maximum}) {`);
+            lines.push(`  ${push('maximum', JSON.stringify(`must be <= ${maximum}`))}`);
+            lines.push(`${pad}  }`);
+        }
+        lines.push(`${pad}}`);
+    }
+
+    emitArray(schema, value, instancePath, lines, depth, where, push) {
+        const { items, minItems, maxItems } = schema;
+        if (items === undefined && minItems === undefined && maxItems === undefined) return;
+        if (Array.isArray(items)) throw new Error(`${where}: tuple 'items' is not supported`);
+
+        const pad = '  '.repeat(depth);
+        lines.push(`${pad}if (Array.isArray(${value})) {`);
+        if (minItems !== undefined) {
+            lines.push(`${pad}  if (${value}.length < ${minItems}) {`);
+            lines.push(`  ${push('minItems', JSON.stringify(`must NOT have fewer than ${minItems} items`))}`);
+            lines.push(`${pad}  }`);
+        }
+        if (maxItems !== undefined) {
+            lines.push(`${pad}  if (${value}.length > ${maxItems}) {`);
+            lines.push(`  ${push('maxItems', JSON.stringify(`must NOT have more than ${maxItems} items`))}`);
+            lines.push(`${pad}  }`);
+        }
+        if (items !== undefined && items !== true) {
+            const index = this.next('i');
+            const item = this.next('v');
+            const itemPath = this.next('p');
+            lines.push(`${pad}  for (let ${index} = 0; ${index} < ${value}.length; ${index}++) {`);
+            lines.push(`${pad}    const ${item} = ${value}[${index}];`);
+            lines.push(`${pad}    const ${itemPath} = ${instancePath} + '/' + ${index};`);
+            this.emit(items, item, itemPath, lines, depth + 2, `${where}/items`);
+            lines.push(`${pad}  }`);
+        }
+        lines.push(`${pad}}`);
+    }
+
+    emitObject(schema, value, instancePath, lines, depth, where, push) {
+        const { required, properties, additionalProperties } = schema;
+        if (required === undefined && properties === undefined && additionalProperties === undefined) return;
+
+        const pad = '  '.repeat(depth);
+        lines.push(`${pad}if (isObject(${value})) {`);
+
+        for (const key of required ?? []) {
+            lines.push(`${pad}  if (${value}[${JSON.stringify(key)}] === undefined) {`);
+            lines.push(`  ${push('required', JSON.stringify(`must have required property '${key}'`))}`);
+            lines.push(`${pad}  }`);
+        }
+
+        if (additionalProperties !== undefined && additionalProperties !== true) {
+            const known = this.constant('props', `new Set<string>(${JSON.stringify(Object.keys(properties ?? {}))})`);
+            const key = this.next('key');
+            lines.push(`${pad}  for (const ${key} of Object.keys(${value})) {`);
+            lines.push(`${pad}    if (${known}.has(${key})) continue;`);
+            if (additionalProperties === false) {
+                lines.push(`${pad}    errors.push({ instancePath: ${instancePath}, keyword: 'additionalProperties', message: "must NOT have additional property '" + ${key} + "'" });`);
+            } else {
+                const extraPath = this.next('p');
+                this.usesPointerSegment = true;
+                lines.push(`${pad}    const ${extraPath} = ${instancePath} + '/' + pointerSegment(${key});`);
+                this.emit(additionalProperties, `${value}[${key}]`, extraPath, lines, depth + 2, `${where}/additionalProperties`);
+            }
+            lines.push(`${pad}  }`);
+        }
+
+        for (const [key, subschema] of Object.entries(properties ?? {})) {
+            const property = this.next('v');
+            const propertyPath = this.next('p');
+            lines.push(`${pad}  const ${property} = ${value}[${JSON.stringify(key)}];`);
+            lines.push(`${pad}  if (${property} !== undefined) {`);
+            lines.push(`${pad}    const ${propertyPath} = ${instancePath} + ${JSON.stringify('/' + pointerSegment(key))};`);
+            this.emit(subschema, property, propertyPath, lines, depth + 2, `${where}/properties/${key}`);
+            lines.push(`${pad}  }`);
+        }
+
+        lines.push(`${pad}}`);
+    }
+}
+
+/**
+ * Load every schema under the directory, sorted by name
+ */
+export function loadSchemas(dir = SCHEMAS_DIR) {
+    const schemas = new Map();
+    const files = fs.readdirSync(dir).filter(file => file.endsWith(SCHEMA_SUFFIX)).sort();
+
+    for (const file of files) {
+        try {
+            schemas.set(schemaName(file), JSON.parse(fs.readFileSync(path.join(dir, file), 'utf8')));
+        } catch (error) {
+            throw new Error(`Cannot read schema ${file}: ${error.message}`);
+        }
+    }
+    return schemas;
+}
+
+/**
+ * Generate the TypeScript module for a set of schemas
+ */
+export function generateValidators(schemas) {
+    const compiler = new ValidatorCompiler(schemas);
+    const functions = compiler.compile();
+    const names = [...schemas.keys()];
+
+    const helpers = [
+        'function isObject(value: unknown): value is Record<string, unknown> {',
+        "  return typeof value === 'object' && value !== null && !Array.isArray(value);",
+        '}'
+    ];
+    if (compiler.usesUcs2Length) {
+        helpers.push(
+            '',
+            '// String length in code points, as JSON Schema counts it',
+            'function ucs2length(value: string): number {',
+            '  let length = 0;',
+            '  for (const _ of value) length++;',
+            '  return length;',
+            '}'
+        );
+    }
+    if (compiler.usesPointerSegment) {
+        helpers.push(
+            '',
+            'function pointerSegment(key: string): string {',
+            "  return key.replace(/~/g, '~0').replace(/\\//g, '~1');",
+            '}'
+        );
+    }
+
+    return [
+        '/**',
+        ' * @fileoverview Standalone validators for gov/schemas/*.schema.json',
+        ' * Generated by scripts/compile_schemas.js - do not edit by hand.',
+        ' * Run `pnpm schemas:compile` after changing a schema.',
+        ' */',
+        '',
+        '/* eslint-disable */',
+        '',
+        "import type { SchemaValidateFunction, SchemaValidationError } from './types.js';",
+        '',
+        `export const SCHEMA_NAMES = ${JSON.stringify(names)} as const;`,
+        '',
+        'export type SchemaName = typeof SCHEMA_NAMES[number];',
+        '',
+        ...helpers,
+        '',
+        ...compiler.constants,
+        '',
+        functions.join('\n\n'),
+        '',
+        '/**',
+        ' * Validate against a schema, appending every violation to `errors`',
+        ' */',
+        'export const schemaValidators: Readonly<Record<SchemaName, SchemaValidateFunction>> = {',
+        ...names.map(name => `  ${JSON.stringify(name)}: ${functionName(name)},`),
+        '};',
+        ''
+    ].join('\n');
+}
+
+function main(argv) {
+    const check = argv.includes('--check');
+    const unknown = argv.filter(arg => arg !== '--check');
+    if (unknown.length > 0) throw new Error(`Unknown argument: ${unknown[0]}`);
+
+    const output = generateValidators(loadSchemas());
+    const relative = path.relative(ROOT, OUTPUT_FILE);
+
+    if (check) {
+        const current = fs.existsSync(OUTPUT_FILE) ? fs.readFileSync(OUTPUT_FILE, 'utf8') : '';
+        if (current !== output) {
+            console.error(`❌ ${relative} is out of date; run node scripts/compile_schemas.js`);
+            process.exit(1);
+        }
+        console.log(`✅ ${relative} is up to date`);
+        return;
+    }
+
+    fs.mkdirSync(path.dirname(OUTPUT_FILE), { recursive: true });
+    fs.writeFileSync(OUTPUT_FILE, output);
+    console.log(`✅ Wrote ${relative}`);
+}
+
+if (process.argv[1] && import.meta.url === pathToFileURL(process.argv[1]).href) {
+    try {
+        main(process.argv.slice(2));
+    } catch (error) {
+        console.error(`❌ ${error.message}`);
+        process.exit(1);
+    }
+}
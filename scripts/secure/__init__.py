@@ -10,6 +10,7 @@ from .policy import SecurityPolicy
 from .audit import AuditLogger
 from .monitor import SecurityMonitor
 from .analyzer import SecurityAnalyzer
+from .pool import SandboxWorkerPool
 from .exceptions import (
     SecurityException,
     ResourceLimitException,
@@ -17,7 +18,8 @@ from .exceptions import (
     NetworkViolationException,
     PolicyViolationException,
     TimeoutException,
-    ScriptExecutionException
+    ScriptExecutionException,
+    AuditLogException
 )
 
 __version__ = "1.0.0"
@@ -30,11 +32,13 @@ __all__ = [
     'AuditLogger',
     'SecurityMonitor',
     'SecurityAnalyzer',
+    'SandboxWorkerPool',
     'SecurityException',
     'ResourceLimitException',
     'FileSystemViolationException',
     'NetworkViolationException',
     'PolicyViolationException',
     'TimeoutException',
-    'ScriptExecutionException'
+    'ScriptExecutionException',
+    'AuditLogException'
 ]
@@ -3,17 +3,121 @@ Static analysis tools for script security validation.
 """
 
 import ast
+import hashlib
+import hmac
+import json
+import os
 import re
 from pathlib import Path
-from typing import List, Dict, Any, Tuple
+from typing import List, Dict, Any, Optional, Tuple
 from .audit import AuditLogger
+from .policy import SecurityPolicy
+
+# Bump when the analysis itself changes, to invalidate cached results
+ANALYSIS_CACHE_VERSION = 1
+
+# Calls and imports always reported by the AST pass
+AST_DANGEROUS_CALLS = ('eval', 'exec', 'compile', '__import__')
+AST_DANGEROUS_IMPORTS = ('os', 'subprocess', 'socket')
+
+
+class SecurityVisitor(ast.NodeVisitor):
+    """Single AST pass producing the analyzer findings and the policy's dangerous operations."""
+
+    def __init__(self, source_lines: List[str], rules: Dict[str, Dict[str, str]]):
+        self.source_lines = source_lines
+        self.dangerous_modules = rules.get('modules', {})
+        self.dangerous_functions = rules.get('functions', {})
+        self.dangerous_methods = rules.get('methods', {})
+        self.vulnerabilities: List[Dict[str, Any]] = []
+        self.dangerous_operations: List[Dict[str, Any]] = []
+
+    def visit_Import(self, node):
+        """Check for dangerous imports."""
+        for alias in node.names:
+            if alias.name in AST_DANGEROUS_IMPORTS:
+                self.vulnerabilities.append({
+                    'type': 'dangerous_import',
+                    'pattern': f'import {alias.name}',
+                    'line': node.lineno,
+                    'code': f'import {alias.name}',
+                    'severity': 'medium',
+                    'description': f'Potentially dangerous import: {alias.name}'
+                })
+
+            module_name = alias.name.split('.')[0]
+            if module_name in self.dangerous_modules:
+                self._operation(f'dangerous_import_{module_name}', node, self.dangerous_modules[module_name])
+        self.generic_visit(node)
+
+    def visit_ImportFrom(self, node):
+        """Check for dangerous from imports."""
+        if node.module:
+            module_name = node.module.split('.')[0]
+            if module_name in self.dangerous_modules:
+                for alias in node.names:
+                    self._operation(f'dangerous_import_from_{module_name}.{alias.name}', node,
+                                    self.dangerous_modules[module_name])
+        self.generic_visit(node)
+
+    def visit_Call(self, node):
+        """Check for dangerous function and method calls."""
+        # Handle method calls like os.system()
+        if isinstance(node.func, ast.Attribute) and isinstance(node.func.value, ast.Name):
+            full_method = f"{node.func.value.id}.{node.func.attr}"
+            if full_method in self.dangerous_methods:
+                self._operation(f'dangerous_call_{full_method}', node, self.dangerous_methods[full_method])
+
+        # Handle direct function calls like open(), eval()
+        elif isinstance(node.func, ast.Name):
+            func_name = node.func.id
+            if func_name in AST_DANGEROUS_CALLS:
+                self.vulnerabilities.append({
+                    'type': 'code_execution',
+                    'pattern': f'{func_name}()',
+                    'line': getattr(node, 'lineno', 0),
+                    'code': f'{func_name}() call detected',
+                    'severity': 'high',
+                    'description': f'Dangerous {func_name}() function call'
+                })
+            if func_name in self.dangerous_functions:
+                self._operation(f'dangerous_function_{func_name}', node, self.dangerous_functions[func_name])
+
+        self.generic_visit(node)
+
+    def _operation(self, operation_type: str, node: ast.AST, severity: str) -> None:
+        self.dangerous_operations.append({
+            'type': operation_type,
+            'line': node.lineno,
+            'context': self._get_line_context(node.lineno),
+            'severity': severity or 'low'
+        })
+
+    def _get_line_context(self, lineno):
+        """Get source code context around a line."""
+        if 1 <= lineno <= len(self.source_lines):
+            return self.source_lines[lineno - 1].strip()
+        return ""
+
 
 class SecurityAnalyzer:
-    """Static analysis tool for detecting security vulnerabilities in scripts."""
+    """Static analysis tool for detecting security vulnerabilities in scripts.
+
+    One pass per script: a combined regex gates the per-pattern checks to the
+    lines that can match, and one AST visit yields every AST finding. Results
+    are cached on disk by content hash, analyzer version and policy version;
+    each entry is signed with a key derived from the audit log secret, so a
+    planted or edited entry is ignored.
+    """
 
-    def __init__(self, audit_logger: AuditLogger):
+    def __init__(self, audit_logger: AuditLogger, policy: Optional[SecurityPolicy] = None,
+                 cache_dir: Optional[str] = "scripts/cache/analysis"):
         self.audit_logger = audit_logger
+        self.policy = policy
+        self.cache_dir = Path(cache_dir) if cache_dir else None
         self.vulnerabilities: List[Dict[str, Any]] = []
+        self.cache_stats = {'hits': 0, 'misses': 0}
+        self._cache_key = audit_logger.derive_key('analysis-cache')
 
         # Security patterns to detect
         self.dangerous_patterns = {
@@ -49,6 +153,41 @@ class SecurityAnalyzer:
                 r'__import__\s*\('
             ]
         }
+        self._compile_rules()
+
+    def _compile_rules(self) -> None:
+        """Compile the patterns, the combined gate and the policy AST rules."""
+        self._compiled_patterns = [
+            (category, pattern, re.compile(pattern))
+            for category, patterns in self.dangerous_patterns.items()
+            for pattern in patterns
+        ]
+        self._combined_pattern = re.compile('|'.join(f'(?:{pattern})' for _, pattern, _ in self._compiled_patterns))
+
+        analysis_policy = self.policy.get_static_analysis_policy() if self.policy else {}
+        self._ast_rules = {
+            'modules': {
+                module: sev for sev, mods in analysis_policy.get('dangerous_modules', {}).items() for module in mods
+            },
+            'functions': {
+                func: sev for sev, funcs in analysis_policy.get('dangerous_functions', {}).items() for func in funcs
+            },
+            'methods': {
+                f"{mod}.{meth}": sev
+                for sev, mod_meths in analysis_policy.get('dangerous_methods', {}).items()
+                for mod, meths in mod_meths.items()
+                for meth in meths
+            }
+        }
+
+        # Cached results are only valid for the same analysis, patterns and policy
+        self._policy_version = self.policy.get_version() if self.policy else None
+        rules_json = json.dumps({
+            'version': ANALYSIS_CACHE_VERSION,
+            'patterns': self.dangerous_patterns,
+            'policy': self._policy_version
+        }, sort_keys=True)
+        self._rules_version = hashlib.sha256(rules_json.encode('utf-8')).hexdigest()
 
     def analyze_script(self, script_path: str) -> Dict[str, Any]:
         """
@@ -67,15 +206,25 @@ class SecurityAnalyzer:
             with open(script_path, 'r', encoding='utf-8') as f:
                 content = f.read()
 
-            # Perform various analysis checks
-            self._check_dangerous_patterns(content, str(script_path))
-            self._check_ast_security(script_path)
-            self._check_imports_security(content, str(script_path))
-
+            content_hash = hashlib.sha256(content.encode('utf-8')).hexdigest()
+            findings = self._load_cached(content_hash)
+            cached = findings is not None
+            if cached:
+                self.cache_stats['hits'] += 1
+            else:
+                self.cache_stats['misses'] += 1
+                findings = self._scan(content)
+                self._store_cached(content_hash, findings)
+
+            self.vulnerabilities = findings['vulnerabilities']
             analysis_result = {
                 'script_path': str(script_path),
+                'content_hash': content_hash,
+                'cached': cached,
                 'vulnerabilities_found': len(self.vulnerabilities),
                 'vulnerabilities': self.vulnerabilities.copy(),
+                'dangerous_operations': findings['dangerous_operations'],
+                'syntax_error': findings['syntax_error'],
                 'risk_level': self._calculate_risk_level(),
                 'recommendations': self._generate_recommendations()
             }
@@ -97,6 +246,8 @@ class SecurityAnalyzer:
                 'error': str(e),
                 'vulnerabilities_found': 0,
                 'vulnerabilities': [],
+                'dangerous_operations': [],
+                'syntax_error': None,
                 'risk_level': 'unknown',
                 'recommendations': ['Fix script syntax errors before analysis']
             }
@@ -109,68 +260,101 @@ class SecurityAnalyzer:
 
             return error_result
 
-    def _check_dangerous_patterns(self, content: str, script_path: str) -> None:
-        """Check for dangerous code patterns."""
-        lines = content.split('\n')
-
-        for line_num, line in enumerate(lines, 1):
-            for category, patterns in self.dangerous_patterns.items():
-                for pattern in patterns:
-                    if re.search(pattern, line):
-                        vulnerability = {
-                            'type': category,
-                            'pattern': pattern,
-                            'line': line_num,
-                            'code': line.strip(),
-                            'severity': self._get_pattern_severity(category),
-                            'description': self._get_pattern_description(category, pattern)
-                        }
-                        self.vulnerabilities.append(vulnerability)
-
-    def _check_ast_security(self, script_path: Path) -> None:
-        """Analyze the Abstract Syntax Tree for security issues."""
+    def _scan(self, content: str) -> Dict[str, Any]:
+        """Run the pattern and AST checks once; path-independent, so cacheable."""
+        vulnerabilities = self._check_dangerous_patterns(content)
+        dangerous_operations: List[Dict[str, Any]] = []
+        syntax_error = None
+
         try:
-            with open(script_path, 'r', encoding='utf-8') as f:
-                tree = ast.parse(f.read())
-
-            for node in ast.walk(tree):
-                if isinstance(node, ast.Call):
-                    # Check for dangerous function calls
-                    if isinstance(node.func, ast.Name):
-                        func_name = node.func.id
-                        if func_name in ['eval', 'exec', 'compile', '__import__']:
-                            vulnerability = {
-                                'type': 'code_execution',
-                                'pattern': f'{func_name}()',
-                                'line': getattr(node, 'lineno', 0),
-                                'code': f'{func_name}() call detected',
-                                'severity': 'high',
-                                'description': f'Dangerous {func_name}() function call'
-                            }
-                            self.vulnerabilities.append(vulnerability)
-
-                elif isinstance(node, ast.Import):
-                    # Check for dangerous imports
-                    for alias in node.names:
-                        if alias.name in ['os', 'subprocess', 'socket']:
-                            vulnerability = {
-                                'type': 'dangerous_import',
-                                'pattern': f'import {alias.name}',
-                                'line': node.lineno,
-                                'code': f'import {alias.name}',
-                                'severity': 'medium',
-                                'description': f'Potentially dangerous import: {alias.name}'
-                            }
-                            self.vulnerabilities.append(vulnerability)
-
-        except SyntaxError:
-            # AST parsing will fail for invalid Python, but that's handled in the main method
+            tree = ast.parse(content)
+        except SyntaxError as e:
+            # AST checks are skipped for invalid Python; the pattern findings still apply
+            syntax_error = str(e)
+        else:
+            visitor = SecurityVisitor(content.splitlines(), self._ast_rules)
+            visitor.visit(tree)
+            vulnerabilities.extend(visitor.vulnerabilities)
+            dangerous_operations = visitor.dangerous_operations
+
+        return {
+            'vulnerabilities': vulnerabilities,
+            'dangerous_operations': dangerous_operations,
+            'syntax_error': syntax_error
+        }
+
+    def _check_dangerous_patterns(self, content: str) -> List[Dict[str, Any]]:
+        """Check for dangerous code patterns on the lines the combined pattern matches."""
+        vulnerabilities = []
+
+        for line_num, line in enumerate(content.split('\n'), 1):
+            if not self._combined_pattern.search(line):
+                continue
+            for category, pattern, compiled in self._compiled_patterns:
+                if compiled.search(line):
+                    vulnerabilities.append({
+                        'type': category,
+                        'pattern': pattern,
+                        'line': line_num,
+                        'code': line.strip(),
+                        'severity': self._get_pattern_severity(category),
+                        'description': self._get_pattern_description(category, pattern)
+                    })
+
+        return vulnerabilities
+
+    def _cache_path(self, content_hash: str) -> Optional[Path]:
+        if self.cache_dir is None:
+            return None
+        return self.cache_dir / f"{content_hash}-{self._rules_version[:16]}.json"
+
+    def _load_cached(self, content_hash: str) -> Optional[Dict[str, Any]]:
+        path = self._cache_path(content_hash)
+        if path is None or not path.exists():
+            return None
+        try:
+            with open(path, 'r', encoding='utf-8') as f:
+                entry = json.load(f)
+        except (IOError, ValueError):
+            return None
+        if not isinstance(entry, dict) or not isinstance(entry.get('mac'), str):
+            return None
+        if not hmac.compare_digest(entry['mac'], self._cache_mac(content_hash, entry.get('findings'))):
+            self.audit_logger.log_security_event(
+                "ANALYSIS_CACHE_REJECTED",
+                f"Ignoring analysis cache entry with a bad signature: {path.name}"
+            )
+            return None
+        return entry['findings']
+
+    def _store_cached(self, content_hash: str, findings: Dict[str, Any]) -> None:
+        path = self._cache_path(content_hash)
+        if path is None:
+            return
+        try:
+            self.cache_dir.mkdir(parents=True, exist_ok=True)
+            tmp_path = path.with_suffix(f'.{os.getpid()}.tmp')
+            with open(tmp_path, 'w', encoding='utf-8') as f:
+                json.dump({
+                    'analyzer_version': ANALYSIS_CACHE_VERSION,
+                    'policy_version': self._policy_version,
+                    'rules_version': self._rules_version,
+                    'findings': findings,
+                    'mac': self._cache_mac(content_hash, findings)
+                }, f)
+            os.replace(tmp_path, path)
+        except (IOError, OSError):
+            # The cache is an optimization only
             pass
 
-    def _check_imports_security(self, content: str, script_path: str) -> None:
-        """Check for insecure import patterns."""
-        # This is already covered by the pattern matching, but we could add more sophisticated checks here
-        pass
+    def _cache_mac(self, content_hash: str, findings: Any) -> str:
+        """Sign the findings together with what they were computed from."""
+        payload = json.dumps({
+            'content_hash': content_hash,
+            'rules_version': self._rules_version,
+            'findings': findings
+        }, sort_keys=True)
+        return hmac.new(self._cache_key, payload.encode('utf-8'), hashlib.sha256).hexdigest()
 
     def _get_pattern_severity(self, category: str) -> str:
         """Get severity level for a vulnerability category."""
@@ -2,28 +2,532 @@
 Audit logging system for the secure script execution environment.
 """
 
+import atexit
+import bisect
+import fcntl
 import json
 import hashlib
 import logging
 import hmac
+import os
+import queue
+import threading
 from datetime import datetime
 from pathlib import Path
-from typing import Dict, Any, Optional, List
+from typing import Dict, Any, Optional, List, Tuple
 import subprocess
+from .exceptions import AuditLogException
+
+# Fields added by the chain; excluded from the entry HMAC
+CHAIN_FIELDS = ('entry_hash', 'chain_hash')
+
+# Signed chain checkpoint every N committed entries per log
+DEFAULT_CHECKPOINT_INTERVAL = 100
+
+# Largest number of entries committed with one fsync
+MAX_BATCH_SIZE = 512
+
+_STOP = object()
+
+
+class AuditStream:
+    """One append-only JSONL log with its hash chain, checkpoints and offset index.
+
+    Next to `<name>.log` live `<name>.log.checkpoints` (signed chain states,
+    appended) and `<name>.log.idx` (`[offset, length, timestamp, key]` rows).
+    The index is derived from the log and is rebuilt from it when missing.
+    """
+
+    def __init__(self, path: Path, key_field: str):
+        self.path = path
+        self.key_field = key_field
+        self.checkpoint_path = path.with_name(path.name + '.checkpoints')
+        self.index_path = path.with_name(path.name + '.idx')
+
+        # Committed state, re-synced from the file before every commit
+        self.size = 0
+        self.entries = 0
+        self.last_offset = 0
+        self.committed_chain = ''
+        self.checkpointed_entries = 0
+
+        # Offset index: rows in file order, their timestamps, row positions per key
+        self.rows: List[Tuple[int, int, str, Optional[str]]] = []
+        self.timestamps: List[str] = []
+        self.by_key: Dict[Optional[str], List[int]] = {}
+
+        self.handle = None
+
+    def load(self, checkpoint: Optional[Dict[str, Any]]) -> None:
+        """Recover chain and index state from a trusted checkpoint and the log tail."""
+        self.size = self.path.stat().st_size if self.path.exists() else 0
+
+        if checkpoint:
+            self.entries = checkpoint['entries']
+            self.last_offset = checkpoint['last_offset']
+            self.committed_chain = checkpoint['chain_hash']
+            self.checkpointed_entries = checkpoint['entries']
+        chain_from = checkpoint['offset'] if checkpoint else 0
+
+        index_from = self._load_index()
+        scan_from = min(chain_from, index_from)
+        new_rows = []
+
+        if self.size > scan_from:
+            with open(self.path, 'rb') as f:
+                f.seek(scan_from)
+                offset = scan_from
+                for line in f:
+                    length = len(line)
+                    try:
+                        record = json.loads(line)
+                    except ValueError:
+                        record = None
+                    if isinstance(record, dict):
+                        if offset >= chain_from:
+                            self.entries += 1
+                            self.last_offset = offset
+                            self.committed_chain = record.get('chain_hash', self.committed_chain)
+                        if offset >= index_from:
+                            row = (offset, length, record.get('timestamp', ''), record.get(self.key_field))
+                            self.add_row(row)
+                            new_rows.append(row)
+                    offset += length
+
+        if new_rows:
+            self.append_index_rows(new_rows)
+
+    def catch_up(self, index_lock: threading.Lock) -> None:
+        """Take in entries other processes appended since the last commit.
+
+        Called with the directory lock held, so no writer is mid-append: a
+        tail without a newline is a write that failed and is cut off.
+        """
+        size = self.path.stat().st_size if self.path.exists() else 0
+        if size == self.size:
+            return
+        if size < self.size:
+            raise AuditLogException(f"{self.path.name} shrank from {self.size} to {size} bytes")
+
+        rows = []
+        entries = 0
+        last_offset = self.last_offset
+        committed_chain = self.committed_chain
+        offset = self.size
+        with open(self.path, 'rb') as f:
+            f.seek(offset)
+            for line in f:
+                if not line.endswith(b'\n'):
+                    break
+                try:
+                    record = json.loads(line)
+                except ValueError:
+                    record = None
+                if isinstance(record, dict):
+                    rows.append((offset, len(line), record.get('timestamp', ''), record.get(self.key_field)))
+                    entries += 1
+                    last_offset = offset
+                    committed_chain = record.get('chain_hash', committed_chain)
+                offset += len(line)
+
+        if offset < size:
+            os.truncate(self.path, offset)
+
+        with index_lock:
+            for row in rows:
+                self.add_row(row)
+            self.size = offset
+            self.entries += entries
+            self.last_offset = last_offset
+            self.committed_chain = committed_chain
+
+    def _load_index(self) -> int:
+        """Load index rows that still fit the log; returns the offset they cover up to."""
+        covered = 0
+        if not self.index_path.exists():
+            return covered
+
+        valid = True
+        with open(self.index_path, 'r', encoding='utf-8') as f:
+            for line in f:
+                try:
+                    offset, length, timestamp, key = json.loads(line)
+                except (ValueError, TypeError):
+                    valid = False
+                    break
+                if offset != covered or offset + length > self.size:
+                    valid = False
+                    break
+                self.add_row((offset, length, timestamp, key))
+                covered = offset + length
+
+        if not valid:
+            # Drop the unusable tail so appends continue from a consistent index
+            with open(self.index_path, 'w', encoding='utf-8') as f:
+                for row in self.rows:
+                    f.write(json.dumps(list(row), ensure_ascii=False) + '\n')
+        return covered
+
+    def add_row(self, row: Tuple[int, int, str, Optional[str]]) -> None:
+        self.by_key.setdefault(row[3], []).append(len(self.rows))
+        self.rows.append(row)
+        self.timestamps.append(row[2])
+
+    def append_index_rows(self, rows: List[Tuple[int, int, str, Optional[str]]]) -> None:
+        with open(self.index_path, 'a', encoding='utf-8') as f:
+            f.write(''.join(json.dumps(list(row), ensure_ascii=False) + '\n' for row in rows))
+
+    def read_checkpoints(self) -> List[Dict[str, Any]]:
+        checkpoints = []
+        if not self.checkpoint_path.exists():
+            return checkpoints
+        with open(self.checkpoint_path, 'r', encoding='utf-8') as f:
+            for line in f:
+                try:
+                    checkpoints.append(json.loads(line))
+                except ValueError:
+                    continue
+        return checkpoints
+
+    def read_chain_hash(self, offset: int) -> Optional[str]:
+        """Stored chain hash of the entry starting at offset."""
+        try:
+            with open(self.path, 'rb') as f:
+                f.seek(offset)
+                return json.loads(f.readline()).get('chain_hash')
+        except (IOError, ValueError, AttributeError):
+            return None
+
+    def close(self) -> None:
+        if self.handle is not None:
+            self.handle.close()
+            self.handle = None
+
+
+class AuditJournal:
+    """Chained, group-committed writer for the logs of one directory.
+
+    Shared by every AuditLogger on the same directory, so they all extend one
+    chain. Entries are committed in queue order by a single writer thread:
+    one write and one fsync per log per batch. Each commit holds an flock on
+    the directory and first takes in entries other processes appended, so
+    the chain hash is always computed from the head on disk.
+    """
+
+    _journals: Dict[Path, 'AuditJournal'] = {}
+    _journals_lock = threading.Lock()
+
+    @classmethod
+    def open(cls, log_dir: Path, secret_key: bytes, group_commit: bool,
+             checkpoint_interval: int, fsync: bool) -> 'AuditJournal':
+        """Shared journal for log_dir; options apply when it is first opened."""
+        path = log_dir.resolve()
+        with cls._journals_lock:
+            journal = cls._journals.get(path)
+            if journal is None:
+                journal = cls(log_dir, secret_key, group_commit, checkpoint_interval, fsync)
+                cls._journals[path] = journal
+            journal._references += 1
+            return journal
+
+    def __init__(self, log_dir: Path, secret_key: bytes, group_commit: bool,
+                 checkpoint_interval: int, fsync: bool):
+        self.log_dir = log_dir
+        self._secret_key = secret_key
+        self.checkpoint_interval = max(1, checkpoint_interval)
+        self.fsync = fsync
+        self._references = 0
+
+        self.execution = AuditStream(log_dir / "execution_audit.log", 'script_path')
+        self.security = AuditStream(log_dir / "security_events.log", 'event_type')
+        for stream in (self.execution, self.security):
+            stream.load(self.trusted_checkpoint(stream))
+
+        self._lock_file = open(log_dir / '.audit.lock', 'a')
+        self._chain_lock = threading.Lock()
+        self.index_lock = threading.Lock()
+        self._commit_cond = threading.Condition()
+        self._enqueued = 0
+        self._processed = 0
+        self._failed = 0
+        self._failure: Optional[BaseException] = None
+        self._broken: Optional[BaseException] = None
+        self._queue: "queue.Queue[Any]" = queue.Queue()
+        self._writer = None
+        if group_commit:
+            self._start_writer()
+
+    def entry_hash(self, entry_data: Dict[str, Any]) -> str:
+        """HMAC of an entry's canonical JSON, without the chain fields."""
+        content = {key: value for key, value in entry_data.items() if key not in CHAIN_FIELDS}
+        canonical_json = json.dumps(content, sort_keys=True, separators=(',', ':'))
+        return hmac.new(self._secret_key, canonical_json.encode(), hashlib.sha256).hexdigest()
+
+    @staticmethod
+    def chain_hash(previous_hash: str, entry_hash: str) -> str:
+        """Link an entry to the chain; the first entry starts it."""
+        if not previous_hash:
+            return entry_hash
+        return hashlib.sha256((previous_hash + entry_hash).encode()).hexdigest()
+
+    def append(self, stream: AuditStream, record: Dict[str, Any]) -> None:
+        """Add the entry HMAC and queue (or write) the entry; it is chained on commit."""
+        with self._chain_lock:
+            record['entry_hash'] = self.entry_hash(record)
+
+            item = (stream, record)
+            if self._writer_alive():
+                with self._commit_cond:
+                    self._enqueued += 1
+                self._queue.put(item)
+            else:
+                try:
+                    self._commit([item])
+                except AuditCommitError as e:
+                    raise AuditLogException(f"audit entry not committed: {e.__cause__}") from e.__cause__
+
+    def flush(self, timeout: Optional[float] = None) -> bool:
+        """Wait until every entry appended so far is committed; False on timeout.
+
+        Raises AuditLogException if entries were dropped since the last flush.
+        """
+        with self._commit_cond:
+            target = self._enqueued
+            done = self._commit_cond.wait_for(
+                lambda: self._processed >= target or not self._writer_alive(), timeout
+            )
+            failure, failed = self._failure, self._failed
+            self._failure, self._failed = None, 0
+
+        if failure is not None:
+            raise AuditLogException(f"{failed} audit entries were not committed: {failure}") from failure
+        return done
+
+    def release(self) -> None:
+        """Drop one reference; the last one commits, checkpoints and closes the logs."""
+        with self._journals_lock:
+            self._references -= 1
+            if self._references > 0:
+                return
+            path = self.log_dir.resolve()
+            if self._journals.get(path) is self:
+                del self._journals[path]
+        self.close()
+
+    def close(self) -> None:
+        writer = self._writer
+        if writer is not None and writer.is_alive():
+            self._queue.put(_STOP)
+            writer.join()
+        with self._chain_lock:
+            self._writer = None
+            if self._lock_file.closed:
+                return
+            for stream in (self.execution, self.security):
+                if stream.entries > stream.checkpointed_entries and self._broken is None:
+                    with self._directory_lock():
+                        self._write_checkpoint(stream)
+                stream.close()
+            self._lock_file.close()
+
+    def trusted_checkpoint(self, stream: AuditStream) -> Optional[Dict[str, Any]]:
+        """Last checkpoint with a valid signature that still anchors in the log."""
+        size = stream.path.stat().st_size if stream.path.exists() else 0
+
+        for checkpoint in reversed(stream.read_checkpoints()):
+            if not hmac.compare_digest(str(checkpoint.get('signature', '')), self._sign_checkpoint(checkpoint)):
+                continue
+            if checkpoint.get('offset', size + 1) > size:
+                continue
+            if checkpoint['entries'] and stream.read_chain_hash(checkpoint['last_offset']) != checkpoint['chain_hash']:
+                continue
+            return checkpoint
+        return None
+
+    def _start_writer(self) -> None:
+        writer = threading.Thread(target=self._writer_loop, name="audit-writer", daemon=True)
+        try:
+            writer.start()
+        except RuntimeError:
+            # Thread limit reached (e.g. RLIMIT_NPROC): commit inline instead
+            return
+        self._writer = writer
+        atexit.register(self.close)
+
+    def _writer_alive(self) -> bool:
+        return self._writer is not None and self._writer.is_alive()
+
+    def _writer_loop(self) -> None:
+        while True:
+            batch = [self._queue.get()]
+            while len(batch) < MAX_BATCH_SIZE:
+                try:
+                    batch.append(self._queue.get_nowait())
+                except queue.Empty:
+                    break
+
+            items = [item for item in batch if item is not _STOP]
+            failed, error = 0, None
+            try:
+                self._commit(items)
+            except AuditCommitError as e:
+                failed, error = e.failed, e.__cause__
+            except Exception as e:
+                failed, error = len(items), e
+
+            with self._commit_cond:
+                self._processed += len(items)
+                if error is not None:
+                    self._failed += failed
+                    self._failure = self._failure or error
+                self._commit_cond.notify_all()
+            if len(items) != len(batch):
+                return
+
+    def _directory_lock(self) -> '_FileLock':
+        return _FileLock(self._lock_file)
+
+    def _commit(self, items: List[Tuple[AuditStream, Dict[str, Any]]]) -> None:
+        """Chain and write a batch: one write and one fsync per log, then index and checkpoint.
+
+        Raises AuditCommitError with the number of entries left unwritten.
+        Memory state only advances once a write is on disk; a failed write
+        is cut back off the file, and the journal refuses further commits if
+        that fails too.
+        """
+        failed = 0
+        error: Optional[BaseException] = None
+
+        with self._directory_lock():
+            for stream in (self.execution, self.security):
+                records = [record for target, record in items if target is stream]
+                if not records:
+                    continue
+                try:
+                    if self._broken is not None:
+                        raise AuditLogException(f"audit journal is broken: {self._broken}")
+                    self._commit_stream(stream, records)
+                except Exception as e:
+                    failed += len(records)
+                    error = error or e
+
+        if error is not None:
+            raise AuditCommitError(failed) from error
+
+    def _commit_stream(self, stream: AuditStream, records: List[Dict[str, Any]]) -> None:
+        stream.catch_up(self.index_lock)
+
+        rows = []
+        chunks = []
+        offset = stream.size
+        previous_hash = stream.committed_chain
+        for record in records:
+            previous_hash = self.chain_hash(previous_hash, record['entry_hash'])
+            record['chain_hash'] = previous_hash
+            line = (json.dumps(record, ensure_ascii=False) + '\n').encode('utf-8')
+            rows.append((offset, len(line), record.get('timestamp', ''), record.get(stream.key_field)))
+            chunks.append(line)
+            offset += len(line)
+
+        try:
+            if stream.handle is None:
+                stream.handle = open(stream.path, 'ab')
+            stream.handle.write(b''.join(chunks))
+            stream.handle.flush()
+            if self.fsync:
+                os.fsync(stream.handle.fileno())
+        except Exception:
+            stream.close()
+            try:
+                os.truncate(stream.path, stream.size)
+            except OSError as truncate_error:
+                self._broken = truncate_error
+            raise
+
+        with self.index_lock:
+            for row in rows:
+                stream.add_row(row)
+            stream.size = offset
+            stream.entries += len(records)
+            stream.last_offset = rows[-1][0]
+            stream.committed_chain = previous_hash
+
+        # The log is committed; the index is rebuilt from it and a checkpoint
+        # is retried on the next batch if either write fails
+        try:
+            stream.append_index_rows(rows)
+            if stream.entries - stream.checkpointed_entries >= self.checkpoint_interval:
+                self._write_checkpoint(stream)
+        except OSError as e:
+            print(f"Warning: Failed to update audit index or checkpoint for {stream.path.name}: {e}")
+
+    def _sign_checkpoint(self, checkpoint: Dict[str, Any]) -> str:
+        content = {key: value for key, value in checkpoint.items() if key != 'signature'}
+        canonical_json = json.dumps(content, sort_keys=True, separators=(',', ':'))
+        return hmac.new(self._secret_key, canonical_json.encode(), hashlib.sha256).hexdigest()
+
+    def _write_checkpoint(self, stream: AuditStream) -> None:
+        """Append a signed checkpoint of the committed chain state."""
+        checkpoint = {
+            'timestamp': datetime.utcnow().isoformat(),
+            'entries': stream.entries,
+            'offset': stream.size,
+            'last_offset': stream.last_offset,
+            'chain_hash': stream.committed_chain
+        }
+        checkpoint['signature'] = self._sign_checkpoint(checkpoint)
+
+        with open(stream.checkpoint_path, 'a', encoding='utf-8') as f:
+            f.write(json.dumps(checkpoint) + '\n')
+            f.flush()
+            if self.fsync:
+                os.fsync(f.fileno())
+        stream.checkpointed_entries = stream.entries
+
+
+class AuditCommitError(Exception):
+    """A batch commit failed; `failed` entries were not written."""
+
+    def __init__(self, failed: int):
+        super().__init__(f"{failed} audit entries not committed")
+        self.failed = failed
+
+
+class _FileLock:
+    """Exclusive flock on the journal's lock file, shared by all processes on the directory."""
+
+    def __init__(self, handle):
+        self.handle = handle
+
+    def __enter__(self):
+        fcntl.flock(self.handle.fileno(), fcntl.LOCK_EX)
+        return self
+
+    def __exit__(self, *exc_info):
+        fcntl.flock(self.handle.fileno(), fcntl.LOCK_UN)
+
 
 class AuditLogger:
-    """Comprehensive audit logging for script execution."""
+    """Comprehensive audit logging for script execution.
+
+    Entries are group-committed by the directory's AuditJournal; queries and
+    the integrity check flush it first, so they always see earlier entries.
+    """
 
-    def __init__(self, log_dir: str = "scripts/logs"):
+    def __init__(self, log_dir: str = "scripts/logs", group_commit: bool = True,
+                 checkpoint_interval: int = DEFAULT_CHECKPOINT_INTERVAL, fsync: bool = True):
         self.log_dir = Path(log_dir)
         self.log_dir.mkdir(exist_ok=True)
         self.execution_log = self.log_dir / "execution_audit.log"
         self.security_log = self.log_dir / "security_events.log"
 
         # Tamper-evident logging setup
-        self.integrity_log = self.log_dir / "log_integrity.dat"
         self._log_secret_key = self._generate_log_key()
-        self._previous_hash = self._load_previous_hash()
+        self._journal = AuditJournal.open(self.log_dir, self._log_secret_key, group_commit,
+                                          checkpoint_interval, fsync)
+        self._execution_stream = self._journal.execution
+        self._security_stream = self._journal.security
+        self._closed = False
 
         # Set up logging
         self.logger = logging.getLogger(__name__)
@@ -57,9 +561,7 @@ class AuditLogger:
         }
 
         # Write to execution audit log
-        with open(self.execution_log, 'a', encoding='utf-8') as f:
-            json.dump(execution_record, f, ensure_ascii=False)
-            f.write('\n')
+        self._journal.append(self._execution_stream, execution_record)
 
         # Optional console log for observability (no file noise)
         status = "SUCCESS" if success else "FAILED"
@@ -90,30 +592,24 @@ class AuditLogger:
             'details': details or {}
         }
 
-        # Add tamper-evident hash chain
-        entry_hash = self._calculate_entry_hash(event_record)
-        event_record['entry_hash'] = entry_hash
+        # Chain and write to security events log as JSON only
+        self._journal.append(self._security_stream, event_record)
 
-        # Calculate chain hash
-        if self._previous_hash:
-            chain_hash = hashlib.sha256((self._previous_hash + entry_hash).encode()).hexdigest()
-            event_record['chain_hash'] = chain_hash
-            self._previous_hash = chain_hash
-        else:
-            # First entry in chain
-            event_record['chain_hash'] = entry_hash
-            self._previous_hash = entry_hash
+        # Also log to standard logging for real-time monitoring (but not to file)
+        print(f"[SECURITY] {event_type}: {message}", flush=True)
 
-        # Write to security events log as JSON only
-        with open(self.security_log, 'a', encoding='utf-8') as f:
-            json.dump(event_record, f, ensure_ascii=False)
-            f.write('\n')
+    def flush(self, timeout: Optional[float] = None) -> bool:
+        """Wait until every entry logged so far is on disk; False on timeout.
 
-        # Update integrity chain
-        self._update_integrity_chain(entry_hash)
+        Raises AuditLogException if earlier entries could not be written.
+        """
+        return self._journal.flush(timeout)
 
-        # Also log to standard logging for real-time monitoring (but not to file)
-        print(f"[SECURITY] {event_type}: {message}", flush=True)
+    def close(self) -> None:
+        """Release the journal; the last logger on a directory checkpoints it."""
+        if not self._closed:
+            self._closed = True
+            self._journal.release()
 
     def _calculate_file_hash(self, file_path: str) -> str:
         """Calculate SHA256 hash of script file."""
@@ -150,184 +646,158 @@ class AuditLogger:
         )
 
     def get_execution_history(self, script_path: Optional[str] = None,
-                            limit: int = 100) -> List[Dict[str, Any]]:
-        """Retrieve execution history, optionally filtered by script."""
-        executions = []
-
-        try:
-            if not self.execution_log.exists():
-                return executions
-
-            with open(self.execution_log, 'r', encoding='utf-8') as f:
-                for line_num, line in enumerate(f, 1):
-                    line = line.strip()
-                    if not line:
-                        continue
-
-                    try:
-                        record = json.loads(line)
-                        if script_path is None or record.get('script_path') == script_path:
-                            executions.append(record)
-                            if len(executions) >= limit:
-                                break
-                    except json.JSONDecodeError as e:
-                        # Log the error but continue processing other lines
-                        print(f"Warning: Failed to parse JSON at line {line_num}: {e}")
-                        continue
-
-        except (FileNotFoundError, IOError):
-            # File doesn't exist or can't be read
-            pass
-
-        return executions
+                            limit: int = 100, since: Optional[str] = None) -> List[Dict[str, Any]]:
+        """Retrieve execution history, optionally filtered by script and start time (ISO)."""
+        return self._query(self._execution_stream, script_path, limit, since)
 
     def get_security_events(self, event_type: Optional[str] = None,
-                          limit: int = 50) -> List[Dict[str, Any]]:
-        """Retrieve security events, optionally filtered by type."""
-        events = []
+                          limit: int = 50, since: Optional[str] = None) -> List[Dict[str, Any]]:
+        """Retrieve security events, optionally filtered by type and start time (ISO)."""
+        return self._query(self._security_stream, event_type, limit, since)
+
+    def _query(self, stream: AuditStream, key: Optional[str], limit: int,
+               since: Optional[str]) -> List[Dict[str, Any]]:
+        """Seek to the index rows matching key/since; oldest first, like the log."""
+        self.flush()
+
+        with self._journal.index_lock:
+            first = bisect.bisect_left(stream.timestamps, since) if since else 0
+            if key is None:
+                positions = range(first, len(stream.rows))
+            else:
+                candidates = stream.by_key.get(key, [])
+                positions = candidates[bisect.bisect_left(candidates, first):]
+            rows = [stream.rows[position] for position in positions[:max(0, limit)]]
+
+        records = []
+        if not rows:
+            return records
 
         try:
-            if not self.security_log.exists():
-                return events
-
-            with open(self.security_log, 'r', encoding='utf-8') as f:
-                for line_num, line in enumerate(f, 1):
-                    line = line.strip()
-                    if not line:
-                        continue
-
+            with open(stream.path, 'rb') as f:
+                for offset, length, _, _ in rows:
+                    f.seek(offset)
                     try:
-                        record = json.loads(line)
-                        if event_type is None or record.get('event_type') == event_type:
-                            events.append(record)
-                            if len(events) >= limit:
-                                break
-                    except json.JSONDecodeError as e:
-                        # Log the error but continue processing other lines
-                        print(f"Warning: Failed to parse JSON at line {line_num}: {e}")
+                        records.append(json.loads(f.read(length)))
+                    except ValueError as e:
+                        # Log the error but continue processing other entries
+                        print(f"Warning: Failed to parse JSON at offset {offset}: {e}")
                         continue
-
         except (FileNotFoundError, IOError):
             # File doesn't exist or can't be read
             pass
 
-        return events
+        return records
 
     def _generate_log_key(self) -> bytes:
         """Generate or load a secret key for log integrity."""
         key_file = self.log_dir / ".log_key"
-        if key_file.exists():
-            with open(key_file, 'rb') as f:
-                return f.read()
-        else:
-            # Generate a new key
+        if not key_file.exists():
+            # Generate a new key; link it into place so concurrent processes
+            # agree on one key and never read a half-written file
             key = hashlib.sha256(str(datetime.utcnow().timestamp()).encode()).digest()
-            with open(key_file, 'wb') as f:
+            temp_file = self.log_dir / f".log_key.{os.getpid()}.{threading.get_ident()}"
+            with open(temp_file, 'wb') as f:
                 f.write(key)
             # Secure the key file
-            key_file.chmod(0o600)
-            return key
-
-    def _load_previous_hash(self) -> str:
-        """Load the previous log hash for chain validation."""
-        if self.integrity_log.exists():
+            temp_file.chmod(0o600)
             try:
-                with open(self.integrity_log, 'r') as f:
-                    data = json.load(f)
-                    return data.get('last_hash', '')
-            except (json.JSONDecodeError, IOError):
-                return ''
-        return ''
+                os.link(temp_file, key_file)
+            except FileExistsError:
+                pass
+            finally:
+                temp_file.unlink()
+        with open(key_file, 'rb') as f:
+            return f.read()
+
+    def derive_key(self, purpose: str) -> bytes:
+        """Derive a key for `purpose` from the log secret, which never leaves the logger."""
+        return hmac.new(self._log_secret_key, purpose.encode('utf-8'), hashlib.sha256).digest()
 
     def _calculate_entry_hash(self, entry_data: Dict[str, Any]) -> str:
         """Calculate hash for a log entry."""
-        # Create a canonical JSON representation
-        canonical_json = json.dumps(entry_data, sort_keys=True, separators=(',', ':'))
-        # Use HMAC for integrity
-        return hmac.new(self._log_secret_key, canonical_json.encode(), hashlib.sha256).hexdigest()
-
-    def _update_integrity_chain(self, entry_hash: str) -> None:
-        """Update the integrity chain with new hash."""
-        chain_hash = hashlib.sha256((self._previous_hash + entry_hash).encode()).hexdigest()
+        return self._journal.entry_hash(entry_data)
 
-        integrity_data = {
-            'timestamp': datetime.utcnow().isoformat(),
-            'last_hash': chain_hash,
-            'previous_hash': self._previous_hash,
-            'entry_hash': entry_hash
-        }
+    def _trusted_checkpoint(self, stream: AuditStream) -> Optional[Dict[str, Any]]:
+        """Last checkpoint of a log that can be trusted as a verification start."""
+        return self._journal.trusted_checkpoint(stream)
 
-        with open(self.integrity_log, 'w') as f:
-            json.dump(integrity_data, f, indent=2)
+    def verify_log_integrity(self, full: bool = False) -> Dict[str, Any]:
+        """Verify the integrity of the audit logs.
 
-        self._previous_hash = chain_hash
-
-    def verify_log_integrity(self) -> Dict[str, Any]:
-        """Verify the integrity of the audit logs."""
+        Verification resumes from each log's last trusted checkpoint; pass
+        full=True to re-verify both logs from their first entry.
+        """
+        self.flush()
         verification_result = {
             'security_events_integrity': True,
             'execution_audit_integrity': True,
             'chain_valid': True,
             'tampered_entries': [],
             'total_entries_checked': 0,
+            'total_entries': 0,
             'errors': []
         }
 
-        # Verify security events log
-        verification_result.update(self._verify_log_file_integrity(
-            self.security_log, 'security_events_integrity'
-        ))
-
-        # Verify execution audit log
-        verification_result.update(self._verify_log_file_integrity(
-            self.execution_log, 'execution_audit_integrity'
-        ))
+        for stream, result_key in ((self._security_stream, 'security_events_integrity'),
+                                   (self._execution_stream, 'execution_audit_integrity')):
+            result = self._verify_log_file_integrity(stream, result_key, full)
+            verification_result[result_key] = result[result_key]
+            verification_result['chain_valid'] = verification_result['chain_valid'] and result[result_key]
+            verification_result['tampered_entries'].extend(result['tampered_entries'])
+            verification_result['errors'].extend(result['errors'])
+            verification_result['total_entries_checked'] += result['entries_checked']
+            verification_result['total_entries'] += result['total_entries']
 
         return verification_result
 
-    def _verify_log_file_integrity(self, log_file: Path, result_key: str) -> Dict[str, Any]:
-        """Verify integrity of a specific log file."""
-        result = {result_key: True, 'tampered_entries': [], 'total_entries': 0, 'errors': []}
+    def _verify_log_file_integrity(self, stream: AuditStream, result_key: str, full: bool) -> Dict[str, Any]:
+        """Verify integrity of a specific log file from its last trusted checkpoint."""
+        result = {result_key: True, 'tampered_entries': [], 'total_entries': 0,
+                  'entries_checked': 0, 'verified_from': 0, 'errors': []}
 
-        if not log_file.exists():
+        if not stream.path.exists():
             return result
 
-        expected_previous_hash = ''
+        checkpoint = None if full else self._trusted_checkpoint(stream)
+        offset = checkpoint['offset'] if checkpoint else 0
+        previous_hash = checkpoint['chain_hash'] if checkpoint else ''
+        line_num = checkpoint['entries'] if checkpoint else 0
+        result['verified_from'] = line_num
 
         try:
-            with open(log_file, 'r', encoding='utf-8') as f:
-                for line_num, line in enumerate(f, 1):
-                    line = line.strip()
-                    if not line:
+            with open(stream.path, 'rb') as f:
+                f.seek(offset)
+                for line in f:
+                    if not line.strip():
                         continue
+                    line_num += 1
 
                     try:
                         entry = json.loads(line)
-                        result['total_entries'] += 1
-
-                        # Calculate expected hash for this entry
-                        entry_hash = self._calculate_entry_hash(entry)
-
-                        # Verify chain
-                        if expected_previous_hash:
-                            chain_hash = hashlib.sha256((expected_previous_hash + entry_hash).encode()).hexdigest()
-                            stored_chain_hash = entry.get('chain_hash', '')
-                            if chain_hash != stored_chain_hash:
-                                result[result_key] = False
-                                result['tampered_entries'].append({
-                                    'line': line_num,
-                                    'entry_hash': entry_hash,
-                                    'expected_chain': chain_hash,
-                                    'stored_chain': stored_chain_hash
-                                })
-
-                        expected_previous_hash = entry_hash
-
-                    except json.JSONDecodeError as e:
-                        result['errors'].append(f"Line {line_num}: {e}")
+                    except ValueError as e:
+                        result['errors'].append(f"{stream.path.name} line {line_num}: {e}")
                         continue
+                    result['entries_checked'] += 1
+
+                    # The entry must match its HMAC, and link to the entry before it
+                    entry_hash = self._calculate_entry_hash(entry)
+                    expected_chain = AuditJournal.chain_hash(previous_hash, entry.get('entry_hash', ''))
+                    stored_chain = entry.get('chain_hash', '')
+                    if entry_hash != entry.get('entry_hash') or expected_chain != stored_chain:
+                        result[result_key] = False
+                        result['tampered_entries'].append({
+                            'log': stream.path.name,
+                            'line': line_num,
+                            'entry_hash': entry_hash,
+                            'expected_chain': expected_chain,
+                            'stored_chain': stored_chain
+                        })
+
+                    previous_hash = stored_chain
 
         except IOError as e:
             result['errors'].append(f"File read error: {e}")
 
+        result['total_entries'] = line_num
         return result
@@ -29,3 +29,7 @@ class TimeoutException(SecurityException):
 class ScriptExecutionException(SecurityException):
     """Raised when script execution fails for security reasons."""
     pass
+
+class AuditLogException(SecurityException):
+    """Raised when audit entries could not be committed to the log."""
+    pass
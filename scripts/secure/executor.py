@@ -10,26 +10,61 @@ import os
 import psutil
 import socket
 import threading
-import ast
 from pathlib import Path
 from typing import Dict, Any, Optional, List, Union
 from .policy import SecurityPolicy
 from .audit import AuditLogger
 from .monitor import SecurityMonitor
 from .analyzer import SecurityAnalyzer
+from .pool import SandboxWorkerPool
 from .exceptions import (
     ResourceLimitException, TimeoutException, ScriptExecutionException,
     FileSystemViolationException, NetworkViolationException, PolicyViolationException
 )
 
+# Syscalls a CPython script needs to start, import modules and do plain I/O.
+# The pool only loads this filter when worker_pool.seccomp is enabled: it has
+# not been validated against every interpreter build, and a missing entry
+# kills the script with SIGSYS.
+ESSENTIAL_SYSCALLS = [
+    # File I/O
+    "read", "write", "readv", "writev", "pread64", "pwrite64",
+    "open", "openat", "close", "lseek", "dup", "dup2", "dup3", "pipe", "pipe2",
+    "fcntl", "ioctl", "fsync", "fdatasync", "ftruncate",
+    # File metadata and directories (imports list and stat package paths)
+    "stat", "fstat", "lstat", "newfstatat", "statx", "access", "faccessat", "faccessat2",
+    "readlink", "readlinkat", "getdents64", "getcwd", "chdir", "fchdir",
+    "mkdir", "mkdirat", "unlink", "unlinkat", "rename", "renameat", "renameat2",
+    # Process management
+    "exit", "exit_group", "getpid", "getppid", "gettid", "getuid", "geteuid", "getgid", "getegid",
+    "getgroups", "getrlimit", "prlimit64", "set_tid_address", "set_robust_list", "rseq",
+    "sched_getaffinity", "sched_yield", "uname", "sysinfo", "wait4",
+    # Threads and locks
+    "futex", "clone", "clone3",
+    # Time
+    "clock_gettime", "clock_getres", "clock_nanosleep", "gettimeofday", "nanosleep",
+    # Memory management
+    "brk", "mmap", "munmap", "mremap", "mprotect", "madvise",
+    # Signal handling
+    "rt_sigaction", "rt_sigprocmask", "rt_sigreturn", "sigaltstack",
+    # Randomness (hash seeds, os.urandom)
+    "getrandom",
+    # I/O multiplexing (subprocess, select)
+    "poll", "ppoll", "select", "pselect6", "epoll_create1", "epoll_ctl", "epoll_wait", "epoll_pwait",
+    # Sockets: the network guards decide, seccomp must not kill the caller
+    "socket", "connect", "bind", "getsockname", "getpeername", "getsockopt", "setsockopt",
+    "sendto", "recvfrom", "sendmsg", "recvmsg", "shutdown"
+]
+
 class SecureScriptExecutor:
     """Secure script execution environment with sandboxing and resource controls."""
 
-    def __init__(self, policy_file: str = "scripts/config/security_policy.yml"):
+    def __init__(self, policy_file: str = "scripts/config/security_policy.yml",
+                 use_worker_pool: Optional[bool] = None, log_dir: str = "scripts/logs"):
         self.policy = SecurityPolicy(policy_file)
-        self.audit_logger = AuditLogger()
+        self.audit_logger = AuditLogger(log_dir)
         self.security_monitor = SecurityMonitor(self.policy, self.audit_logger)
-        self.security_analyzer = SecurityAnalyzer(self.audit_logger)
+        self.security_analyzer = SecurityAnalyzer(self.audit_logger, self.policy)
         self.quarantine_dir = Path("scripts/quarantine")
         self.quarantine_dir.mkdir(exist_ok=True)
 
@@ -41,6 +76,12 @@ class SecureScriptExecutor:
         # Filesystem monitoring
         self.filesystem_access_log = []
 
+        # Pre-started sandbox workers (policy `worker_pool` section, off by default)
+        self.worker_pool = None
+        pool_config = self.policy.get_worker_pool_config()
+        if pool_config.get('enabled', False) if use_worker_pool is None else use_worker_pool:
+            self.worker_pool = self._create_worker_pool(pool_config)
+
         # Start security monitoring
         self.security_monitor.start_monitoring()
 
@@ -186,8 +227,12 @@ class SecureScriptExecutor:
         self.network_activity = []
         return activity_copy
 
-    def _validate_filesystem_access(self, script_path: str) -> None:
-        """Validate filesystem access permissions for script execution."""
+    def _validate_filesystem_access(self, script_path: str) -> Dict[str, Any]:
+        """Validate filesystem access permissions for script execution.
+
+        Returns the (cached) static analysis, which also carries the AST-based
+        dangerous operation findings checked here.
+        """
         script_path_obj = Path(script_path)
 
         # Check if script path is allowed
@@ -200,56 +245,54 @@ class SecureScriptExecutor:
             raise FileSystemViolationException(f"Script path not allowed: {script_path}")
 
         # Perform AST-based static analysis for dangerous operations
-        try:
-            with open(script_path, 'r', encoding='utf-8') as f:
-                content = f.read()
-
-            # Parse the script into an AST
-            tree = ast.parse(content, filename=str(script_path))
-
-            # Analyze the AST for dangerous operations
-            dangerous_findings = self._analyze_ast_for_dangers(tree, content)
-
-            if dangerous_findings:
-                risk_level = self._calculate_risk_level(dangerous_findings)
-
-                for finding in dangerous_findings:
-                    self.audit_logger.log_security_event(
-                        event_type="DANGEROUS_OPERATION_DETECTED",
-                        message=f"Potentially dangerous operation: {finding['type']} at line {finding['line']}",
-                        script_path=str(script_path),
-                        details={
-                            'operation_type': finding['type'],
-                            'line_number': finding['line'],
-                            'context': finding.get('context', ''),
-                            'risk_level': risk_level
-                        }
-                    )
-
-                # If high risk, we could quarantine or block execution
-                if risk_level == 'high':
-                    self.audit_logger.log_security_event(
-                        event_type="HIGH_RISK_SCRIPT_DETECTED",
-                        message="Script contains high-risk operations - execution blocked",
-                        script_path=str(script_path),
-                        details={'risk_level': risk_level, 'findings': dangerous_findings}
-                    )
-                    # For now, just log - in production this could raise an exception
+        analysis_result = self.security_analyzer.analyze_script(str(script_path))
 
-        except SyntaxError as e:
+        if 'error' in analysis_result:
             self.audit_logger.log_security_event(
-                event_type="SCRIPT_SYNTAX_ERROR",
-                message=f"Script has syntax errors: {str(e)}",
+                event_type="SCRIPT_ANALYSIS_ERROR",
+                message=f"Could not analyze script AST: {analysis_result['error']}",
                 script_path=str(script_path),
-                details={'syntax_error': str(e)}
+                details={'error': analysis_result['error']}
             )
-        except Exception as e:
+            return analysis_result
+
+        if analysis_result['syntax_error']:
             self.audit_logger.log_security_event(
-                event_type="SCRIPT_ANALYSIS_ERROR",
-                message=f"Could not analyze script AST: {str(e)}",
+                event_type="SCRIPT_SYNTAX_ERROR",
+                message=f"Script has syntax errors: {analysis_result['syntax_error']}",
                 script_path=str(script_path),
-                details={'error': str(e)}
+                details={'syntax_error': analysis_result['syntax_error']}
             )
+            return analysis_result
+
+        dangerous_findings = analysis_result['dangerous_operations']
+        if dangerous_findings:
+            risk_level = self._calculate_risk_level(dangerous_findings)
+
+            for finding in dangerous_findings:
+                self.audit_logger.log_security_event(
+                    event_type="DANGEROUS_OPERATION_DETECTED",
+                    message=f"Potentially dangerous operation: {finding['type']} at line {finding['line']}",
+                    script_path=str(script_path),
+                    details={
+                        'operation_type': finding['type'],
+                        'line_number': finding['line'],
+                        'context': finding.get('context', ''),
+                        'risk_level': risk_level
+                    }
+                )
+
+            # If high risk, we could quarantine or block execution
+            if risk_level == 'high':
+                self.audit_logger.log_security_event(
+                    event_type="HIGH_RISK_SCRIPT_DETECTED",
+                    message="Script contains high-risk operations - execution blocked",
+                    script_path=str(script_path),
+                    details={'risk_level': risk_level, 'findings': dangerous_findings}
+                )
+                # For now, just log - in production this could raise an exception
+
+        return analysis_result
 
     def _setup_seccomp_filters(self) -> None:
         """Set up seccomp filters for system call restrictions.
@@ -273,26 +316,8 @@ class SecureScriptExecutor:
             # Create seccomp filter with a default action to kill the process
             filter = seccomp.SyscallFilter(seccomp.KILL)
 
-            # A minimal set of syscalls needed for a simple Python script
-            # This list is highly restrictive and may need to be expanded based on script needs
-            essential_syscalls = [
-                # File I/O
-                "read", "write", "openat", "close", "stat", "fstat",
-                "lseek", "readlink", "access", "brk", "mmap", "munmap",
-                # Process management
-                "exit_group", "getpid", "getuid", "geteuid", "getgid", "getegid",
-                # Time
-                "clock_gettime", "nanosleep",
-                # Memory management
-                "mprotect",
-                # Signal handling
-                "rt_sigaction", "rt_sigprocmask",
-                # Dynamic linking / library loading related
-                "pread64", "newfstatat", "open", "lstat"
-            ]
-
             # Allow all essential syscalls
-            for syscall in essential_syscalls:
+            for syscall in ESSENTIAL_SYSCALLS:
                 try:
                     filter.add_rule(seccomp.ALLOW, syscall)
                 except seccomp.SyscallFilterException:
@@ -305,7 +330,7 @@ class SecureScriptExecutor:
             self.audit_logger.log_security_event(
                 event_type="SECCOMP_APPLIED",
                 message="Seccomp syscall filter successfully applied",
-                details={"allowed_syscalls_count": len(essential_syscalls)}
+                details={"allowed_syscalls_count": len(ESSENTIAL_SYSCALLS)}
             )
 
         except Exception as e:
@@ -355,10 +380,8 @@ class SecureScriptExecutor:
             raise ScriptExecutionException(f"Script file not found: {script_path}")
 
         # Phase 2: Advanced Security - Filesystem, Network Controls, and Static Analysis
-        self._validate_filesystem_access(str(script_path))
-
-        # Perform static analysis
-        analysis_result = self.security_analyzer.analyze_script(str(script_path))
+        # (one cached analysis serves both the AST checks and the static analysis)
+        analysis_result = self._validate_filesystem_access(str(script_path))
         if analysis_result['vulnerabilities_found'] > 0:
             # Log vulnerabilities but don't block execution (configurable)
             self.audit_logger.log_security_event(
@@ -368,6 +391,9 @@ class SecureScriptExecutor:
                 details={'risk_level': analysis_result['risk_level']}
             )
 
+        if self.worker_pool is not None:
+            return self._execute_in_pool(script_path, args, timeout, analysis_result)
+
         self._start_network_monitoring()
         self._setup_seccomp_filters()
 
@@ -472,9 +498,120 @@ class SecureScriptExecutor:
             )
             raise ScriptExecutionException(f"Script execution failed: {str(e)}")
 
+    def _execute_in_pool(self, script_path: Path, args: Optional[List[str]],
+                         timeout: Optional[float], analysis_result: Dict[str, Any]) -> Dict[str, Any]:
+        """Run an already validated script on a pre-started sandbox worker.
+
+        The worker's forked child applies the resource limits, seccomp filter and
+        network guards itself, so this process is left unrestricted.
+        """
+        limits = self.policy.get_execution_limits()
+        exec_timeout = timeout or limits['timeout_seconds']
+
+        try:
+            source = script_path.read_text(encoding='utf-8')
+        except (OSError, UnicodeDecodeError) as e:
+            raise ScriptExecutionException(f"Failed to read script: {e}")
+
+        try:
+            outcome = self.worker_pool.run(source, str(script_path.resolve()), list(args or []), exec_timeout)
+        except ScriptExecutionException as e:
+            self.audit_logger.log_security_event(
+                event_type="EXECUTION_ERROR",
+                message=f"Unexpected error during script execution: {str(e)}",
+                script_path=str(script_path)
+            )
+            raise
+
+        execution_time = outcome['execution_time']
+        resource_usage = outcome['resource_usage']
+
+        if outcome['timed_out']:
+            self.audit_logger.log_execution(
+                script_path=str(script_path),
+                args=args,
+                execution_time=execution_time,
+                success=False,
+                resource_usage={'error': 'timeout'}
+            )
+            raise TimeoutException(f"Script execution timed out after {exec_timeout} seconds")
+
+        result = subprocess.CompletedProcess(
+            ['python3', str(script_path)] + (args or []),
+            outcome['return_code'], outcome['stdout'], outcome['stderr']
+        )
+
+        self.audit_logger.log_execution(
+            script_path=str(script_path),
+            args=args,
+            result=result,
+            execution_time=execution_time,
+            success=result.returncode == 0,
+            resource_usage=resource_usage
+        )
+
+        network_logs = outcome['network_activity']
+        self._validate_network_activity(network_logs)
+        self._check_execution_policy(result, execution_time)
+
+        success = result.returncode == 0
+        self.security_monitor.record_execution(
+            str(script_path), success, execution_time, resource_usage
+        )
+
+        return {
+            'success': success,
+            'stdout': result.stdout,
+            'stderr': result.stderr,
+            'return_code': result.returncode,
+            'execution_time': execution_time,
+            'resource_usage': resource_usage,
+            'network_activity': network_logs,
+            'static_analysis': analysis_result,
+            'pool': {
+                'queue_wait': outcome['queue_wait'],
+                'overhead': outcome['overhead']
+            },
+            'security_checks': {
+                'filesystem_validated': True,
+                'network_monitored': True,
+                'resource_limits_applied': True,
+                'static_analysis_performed': True,
+                'seccomp_applied': outcome['seccomp_applied'],
+                'worker_pool': True
+            }
+        }
+
+    def _create_worker_pool(self, pool_config: Dict[str, Any]) -> SandboxWorkerPool:
+        """Build the worker pool from the execution and network policy."""
+        limits = self.policy.get_execution_limits()
+        network = self.policy.get_network_policy()
+        policy_frame = {
+            'limits': {key: limits[key] for key in ('cpu_seconds', 'memory_mb', 'file_size_mb', 'max_processes')
+                       if key in limits},
+            'network': {
+                'allowed_domains': network.get('allowed_domains', []),
+                'blocked_ports': network.get('blocked_ports', [])
+            },
+            'seccomp_syscalls': ESSENTIAL_SYSCALLS if pool_config.get('seccomp', False) else [],
+            'max_output_bytes': pool_config.get('max_output_mb', 10) * 1024 * 1024
+        }
+        return SandboxWorkerPool(
+            policy_frame,
+            env=self._prepare_secure_environment(),
+            cwd=str(self.quarantine_dir.resolve()),
+            size=pool_config.get('size', 2),
+            max_runs_per_worker=pool_config.get('max_runs_per_worker', 50)
+        )
+
+    def shutdown(self) -> None:
+        """Stop the sandbox workers, if any."""
+        if self.worker_pool is not None:
+            self.worker_pool.shutdown()
+
     def get_security_stats(self) -> Dict[str, Any]:
         """Get security monitoring statistics."""
-        return {
+        stats = {
             'monitoring_stats': self.security_monitor.get_stats(),
             'recent_alerts': self.security_monitor.get_recent_alerts(5),
             'audit_summary': {
@@ -482,6 +619,9 @@ class SecureScriptExecutor:
                 'security_events_count': len(self.audit_logger.get_security_events())
             }
         }
+        if self.worker_pool is not None:
+            stats['worker_pool'] = self.worker_pool.get_stats()
+        return stats
 
     def analyze_script_security(self, script_path: str) -> Dict[str, Any]:
         """Perform detailed security analysis on a script without executing it."""
@@ -668,114 +808,6 @@ class SecureScriptExecutor:
                 details={'stderr_length': len(result.stderr), 'threshold': max_stderr_length}
             )
 
-        # Check for system calls that might indicate violations
-        suspicious_patterns = ['import os', 'import subprocess', 'exec(', 'eval(']
-        script_content = ""
-        try:
-            # This is a simplified check - in practice, we'd analyze the AST
-            # This check is deprecated in favor of the full AST analysis performed earlier.
-            # Kept for compatibility, but should be removed in a future version.
-            pass
-        except Exception:
-            pass  # Ignore errors in pattern checking
-
-    def _analyze_ast_for_dangers(self, tree: ast.AST, content: str) -> List[Dict[str, Any]]:
-        """Analyze AST for potentially dangerous operations."""
-        analysis_policy = self.policy.get_static_analysis_policy()
-        dangerous_modules_config = analysis_policy.get('dangerous_modules', {})
-        dangerous_functions_config = analysis_policy.get('dangerous_functions', {})
-        dangerous_methods_config = analysis_policy.get('dangerous_methods', {})
-
-        # Flatten configs for easier lookup
-        dangerous_modules = {
-            module: sev for sev, mods in dangerous_modules_config.items() for module in mods
-        }
-        dangerous_functions = {
-            func: sev for sev, funcs in dangerous_functions_config.items() for func in funcs
-        }
-        dangerous_methods = {
-            f"{mod}.{meth}": sev
-            for sev, mod_meths in dangerous_methods_config.items()
-            for mod, meths in mod_meths.items()
-            for meth in meths
-        }
-
-        class DangerousOperationVisitor(ast.NodeVisitor):
-            def __init__(self, source_lines):
-                self.source_lines = source_lines
-                self.findings = []
-
-            def visit_Import(self, node):
-                """Check for dangerous imports."""
-                for alias in node.names:
-                    module_name = alias.name.split('.')[0]
-                    if module_name in dangerous_modules:
-                        self.findings.append({
-                            'type': f'dangerous_import_{module_name}',
-                            'line': node.lineno,
-                            'context': self._get_line_context(node.lineno),
-                            'severity': dangerous_modules.get(module_name, 'low')
-                        })
-                self.generic_visit(node)
-
-            def visit_Call(self, node):
-                """Check for dangerous function calls."""
-                # Handle method calls like os.system()
-                if isinstance(node.func, ast.Attribute) and isinstance(node.func.value, ast.Name):
-                    module_name = node.func.value.id
-                    method_name = node.func.attr
-                    full_method = f"{module_name}.{method_name}"
-                    if full_method in dangerous_methods:
-                        self.findings.append({
-                            'type': f'dangerous_call_{full_method}',
-                            'line': node.lineno,
-                            'context': self._get_line_context(node.lineno),
-                            'severity': dangerous_methods.get(full_method, 'low')
-                        })
-
-                # Handle direct function calls like open(), eval()
-                elif isinstance(node.func, ast.Name):
-                    func_name = node.func.id
-                    if func_name in dangerous_functions:
-                        self.findings.append({
-                            'type': f'dangerous_function_{func_name}',
-                            'line': node.lineno,
-                            'context': self._get_line_context(node.lineno),
-                            'severity': dangerous_functions.get(func_name, 'low')
-                        })
-
-                self.generic_visit(node)
-
-            def visit_ImportFrom(self, node):
-                """Check for dangerous from imports."""
-                if node.module:
-                    module_name = node.module.split('.')[0]
-                    if module_name in dangerous_modules:
-                        severity = dangerous_modules.get(module_name, 'low')
-                        for alias in node.names:
-                            self.findings.append({
-                                'type': f'dangerous_import_from_{module_name}.{alias.name}',
-                                'line': node.lineno,
-                                'context': self._get_line_context(node.lineno),
-                                'severity': severity
-                            })
-                self.generic_visit(node)
-
-            def _get_line_context(self, lineno):
-                """Get source code context around a line."""
-                if 1 <= lineno <= len(self.source_lines):
-                    return self.source_lines[lineno - 1].strip()
-                return ""
-
-        # Split content into lines for context
-        source_lines = content.splitlines()
-
-        # Visit all nodes in the AST
-        visitor = DangerousOperationVisitor(source_lines)
-        visitor.visit(tree)
-
-        return visitor.findings
-
     def _calculate_risk_level(self, findings: List[Dict[str, Any]]) -> str:
         """Calculate overall risk level based on findings."""
         if not findings:
@@ -7,7 +7,6 @@ import shutil
 from pathlib import Path
 from typing import List, Dict, Any, Optional
 from .executor import SecureScriptExecutor
-from .analyzer import SecurityAnalyzer
 from .audit import AuditLogger
 
 class ScriptMigrationManager:
@@ -15,7 +14,7 @@ class ScriptMigrationManager:
 
     def __init__(self, secure_executor: SecureScriptExecutor):
         self.executor = secure_executor
-        self.analyzer = SecurityAnalyzer(self.executor.audit_logger)
+        self.analyzer = self.executor.security_analyzer
         self.audit_logger = self.executor.audit_logger
 
     def analyze_script_for_migration(self, script_path: str) -> Dict[str, Any]:
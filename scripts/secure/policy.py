@@ -2,6 +2,8 @@
 Security policy management for the secure script execution environment.
 """
 
+import hashlib
+import json
 import yaml
 from pathlib import Path
 from typing import Dict, Any, List
@@ -77,6 +79,15 @@ class SecurityPolicy:
         """Get static analysis configuration."""
         return self._get_policy_root().get('static_analysis', {}).copy()
 
+    def get_version(self) -> str:
+        """Content hash of the loaded policy; changes whenever any setting does."""
+        canonical_json = json.dumps(self._policy, sort_keys=True, default=str)
+        return hashlib.sha256(canonical_json.encode('utf-8')).hexdigest()
+
+    def get_worker_pool_config(self) -> Dict[str, Any]:
+        """Get sandbox worker pool configuration."""
+        return self._get_policy_root().get('worker_pool', {}).copy()
+
     def is_path_allowed(self, path: str) -> bool:
         """Check if a filesystem path is allowed.
 
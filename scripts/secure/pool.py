@@ -0,0 +1,300 @@
+"""
+Sandbox Worker Pool - Pre-started, policy-locked workers for SecureScriptExecutor.
+
+Each worker (worker.py) is started once with the secure environment and the
+policy, then forks a locked-down child per script it receives over its pipe.
+Workers are recycled after a fixed number of runs, or immediately after a run
+that violated the policy, timed out or crashed; replacements are started in
+the background so the next request does not pay the startup cost.
+"""
+
+import json
+import os
+import queue
+import select
+import struct
+import subprocess
+import sys
+import threading
+import time
+from pathlib import Path
+from typing import Any, Dict, List, Optional
+from .exceptions import ScriptExecutionException
+
+WORKER_SCRIPT = Path(__file__).with_name('worker.py')
+HEADER = struct.Struct('>I')
+
+# Extra time the worker gets beyond the script timeout to report back
+RESPONSE_GRACE_SECONDS = 5.0
+
+
+class SandboxWorker:
+    """One pre-started worker process and its frame pipe."""
+
+    def __init__(self, policy_frame: Dict[str, Any], env: Dict[str, str], cwd: str,
+                 startup_timeout: float = 10.0):
+        start = time.perf_counter()
+        self.process = subprocess.Popen(
+            [sys.executable, '-I', str(WORKER_SCRIPT)],
+            stdin=subprocess.PIPE,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.DEVNULL,
+            env=env,
+            cwd=cwd,
+            close_fds=True
+        )
+        self.runs = 0
+
+        try:
+            self._send(policy_frame)
+            ready = self._receive(startup_timeout)
+        except Exception:
+            self.close()
+            raise
+        if not ready or ready.get('type') != 'ready':
+            self.close()
+            raise ScriptExecutionException("Sandbox worker failed to start")
+
+        self.pid = ready['pid']
+        self.startup_time = time.perf_counter() - start
+
+    def run(self, request: Dict[str, Any]) -> Dict[str, Any]:
+        """Send one script and wait for its result."""
+        self._send(request)
+        result = self._receive(float(request['timeout']) + RESPONSE_GRACE_SECONDS)
+        if result is None:
+            raise ScriptExecutionException("Sandbox worker exited or stopped responding")
+        return result
+
+    def close(self) -> None:
+        """Stop the worker, killing it if it does not exit promptly."""
+        try:
+            if self.process.poll() is None:
+                self._send({'type': 'shutdown'})
+                self.process.wait(timeout=1.0)
+        except Exception:
+            self.process.kill()
+            self.process.wait()
+        finally:
+            for stream in (self.process.stdin, self.process.stdout):
+                try:
+                    stream.close()
+                except Exception:
+                    pass
+
+    def _send(self, message: Dict[str, Any]) -> None:
+        body = json.dumps(message).encode('utf-8')
+        self.process.stdin.write(HEADER.pack(len(body)) + body)
+        self.process.stdin.flush()
+
+    def _receive(self, timeout: float) -> Optional[Dict[str, Any]]:
+        fd = self.process.stdout.fileno()
+        deadline = time.monotonic() + timeout
+        header = self._read_exact(fd, HEADER.size, deadline)
+        if header is None:
+            return None
+        body = self._read_exact(fd, HEADER.unpack(header)[0], deadline)
+        return json.loads(body.decode('utf-8')) if body is not None else None
+
+    @staticmethod
+    def _read_exact(fd: int, size: int, deadline: float) -> Optional[bytes]:
+        chunks = []
+        while size > 0:
+            remaining = deadline - time.monotonic()
+            if remaining <= 0 or not select.select([fd], [], [], remaining)[0]:
+                return None
+            chunk = os.read(fd, size)
+            if not chunk:
+                return None
+            chunks.append(chunk)
+            size -= len(chunk)
+        return b''.join(chunks)
+
+
+class SandboxWorkerPool:
+    """Bounded pool of sandbox workers with queue-wait and overhead accounting."""
+
+    def __init__(self, policy_frame: Dict[str, Any], env: Dict[str, str], cwd: str,
+                 size: int = 2, max_runs_per_worker: int = 50, prestart: bool = True):
+        self.policy_frame = policy_frame
+        self.env = env
+        self.cwd = cwd
+        self.size = max(1, size)
+        self.max_runs_per_worker = max(1, max_runs_per_worker)
+
+        self._idle: "queue.Queue[SandboxWorker]" = queue.Queue()
+        self._lock = threading.Lock()
+        self._live = 0
+        self._closed = False
+        self._stats = {
+            'runs': 0,
+            'spawned': 0,
+            'spawn_failures': 0,
+            'recycled': {'max_runs': 0, 'violation': 0, 'crash': 0},
+            'queue_wait_total': 0.0,
+            'queue_wait_max': 0.0,
+            'overhead_total': 0.0,
+            'overhead_max': 0.0,
+            'startup_total': 0.0
+        }
+
+        if prestart:
+            for _ in range(self.size):
+                self._replenish_async()
+
+    def run(self, source: str, script_path: str, args: List[str], timeout: float) -> Dict[str, Any]:
+        """Run a script on the next free worker; adds queue_wait and overhead (seconds)."""
+        enqueued = time.perf_counter()
+        worker = self._acquire()
+        queue_wait = time.perf_counter() - enqueued
+
+        try:
+            result = worker.run({
+                'type': 'run',
+                'source': source,
+                'script_path': script_path,
+                'args': args,
+                'timeout': timeout
+            })
+        except Exception as e:
+            self._retire(worker, 'crash')
+            if isinstance(e, ScriptExecutionException):
+                raise
+            raise ScriptExecutionException(f"Sandbox worker failed: {e}") from e
+
+        # Everything the caller waited for besides the queue and the script itself
+        overhead = max(0.0, time.perf_counter() - enqueued - queue_wait - result['execution_time'])
+
+        worker.runs += 1
+        if result.get('violation'):
+            self._retire(worker, 'violation')
+        elif worker.runs >= self.max_runs_per_worker:
+            self._retire(worker, 'max_runs')
+        else:
+            self._release(worker)
+
+        with self._lock:
+            stats = self._stats
+            stats['runs'] += 1
+            stats['queue_wait_total'] += queue_wait
+            stats['queue_wait_max'] = max(stats['queue_wait_max'], queue_wait)
+            stats['overhead_total'] += overhead
+            stats['overhead_max'] = max(stats['overhead_max'], overhead)
+
+        result['queue_wait'] = queue_wait
+        result['overhead'] = overhead
+        return result
+
+    def get_stats(self) -> Dict[str, Any]:
+        """Pool occupancy, recycling and per-run latency figures (milliseconds)."""
+        with self._lock:
+            stats = dict(self._stats)
+            recycled = dict(self._stats['recycled'])
+            live = self._live
+
+        runs = stats['runs']
+        spawned = stats['spawned']
+        return {
+            'size': self.size,
+            'max_runs_per_worker': self.max_runs_per_worker,
+            'live_workers': live,
+            'idle_workers': self._idle.qsize(),
+            'runs': runs,
+            'workers_spawned': spawned,
+            'spawn_failures': stats['spawn_failures'],
+            'workers_recycled': recycled,
+            'queue_wait_ms': {
+                'avg': stats['queue_wait_total'] / runs * 1000 if runs else 0.0,
+                'max': stats['queue_wait_max'] * 1000
+            },
+            'overhead_ms': {
+                'avg': stats['overhead_total'] / runs * 1000 if runs else 0.0,
+                'max': stats['overhead_max'] * 1000
+            },
+            'worker_startup_ms': {
+                'avg': stats['startup_total'] / spawned * 1000 if spawned else 0.0
+            }
+        }
+
+    def shutdown(self) -> None:
+        """Stop all idle workers; busy ones are stopped when they are returned."""
+        with self._lock:
+            self._closed = True
+        while True:
+            try:
+                worker = self._idle.get_nowait()
+            except queue.Empty:
+                break
+            worker.close()
+            with self._lock:
+                self._live -= 1
+
+    def _acquire(self) -> SandboxWorker:
+        while True:
+            try:
+                return self._idle.get_nowait()
+            except queue.Empty:
+                pass
+
+            with self._lock:
+                if self._closed:
+                    raise ScriptExecutionException("Sandbox worker pool is shut down")
+                can_spawn = self._live < self.size
+                if can_spawn:
+                    self._live += 1
+
+            if can_spawn:
+                return self._spawn_reserved()
+
+            try:
+                return self._idle.get(timeout=0.1)
+            except queue.Empty:
+                continue
+
+    def _spawn_reserved(self) -> SandboxWorker:
+        """Start a worker for a slot already counted in _live."""
+        try:
+            worker = SandboxWorker(self.policy_frame, self.env, self.cwd)
+        except Exception:
+            with self._lock:
+                self._live -= 1
+                self._stats['spawn_failures'] += 1
+            raise
+
+        with self._lock:
+            self._stats['spawned'] += 1
+            self._stats['startup_total'] += worker.startup_time
+        return worker
+
+    def _release(self, worker: SandboxWorker) -> None:
+        with self._lock:
+            closed = self._closed
+            if closed:
+                self._live -= 1
+        if closed:
+            worker.close()
+        else:
+            self._idle.put(worker)
+
+    def _retire(self, worker: SandboxWorker, reason: str) -> None:
+        with self._lock:
+            self._live -= 1
+            self._stats['recycled'][reason] += 1
+        threading.Thread(target=worker.close, daemon=True).start()
+        self._replenish_async()
+
+    def _replenish_async(self) -> None:
+        """Start a replacement worker in the background if there is room."""
+        with self._lock:
+            if self._closed or self._live >= self.size:
+                return
+            self._live += 1
+
+        def spawn():
+            try:
+                worker = self._spawn_reserved()
+            except Exception:
+                return  # the next acquire retries synchronously
+            self._release(worker)
+
+        threading.Thread(target=spawn, daemon=True).start()
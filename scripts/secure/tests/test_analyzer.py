@@ -0,0 +1,177 @@
+"""
+Unit tests for the SecurityAnalyzer single-pass scan and analysis cache.
+"""
+
+import json
+import re
+import shutil
+import tempfile
+import unittest
+from pathlib import Path
+from ..analyzer import ANALYSIS_CACHE_VERSION, SecurityAnalyzer
+from ..audit import AuditLogger
+from ..policy import SecurityPolicy
+
+SCRIPT = """
+import os
+import subprocess
+from socket import socket
+
+def run():
+    os.system("ls")
+    os.popen("ls")
+    subprocess.run(["ls"])
+    eval("1 + 1")
+    return open("data.txt").read()
+"""
+
+POLICY = """
+security:
+  execution:
+    timeout_seconds: 300
+    cpu_seconds: 60
+    memory_mb: 512
+  filesystem:
+    allowed_paths: ["/tmp"]
+  network:
+    allowed_domains: []
+  monitoring:
+    log_level: "INFO"
+  static_analysis:
+    dangerous_modules:
+      medium: ["subprocess", "socket"]
+    dangerous_functions:
+      high: ["eval"]
+    dangerous_methods:
+      high:
+        os: ["system"]
+"""
+
+class TestSecurityAnalyzer(unittest.TestCase):
+    """Test cases for SecurityAnalyzer class."""
+
+    def setUp(self):
+        """Set up test environment."""
+        self.temp_dir = Path(tempfile.mkdtemp())
+        self.audit_logger = AuditLogger(str(self.temp_dir))
+        self.policy_file = self.temp_dir / "policy.yml"
+        self.policy_file.write_text(POLICY)
+        self.cache_dir = self.temp_dir / "cache"
+
+    def tearDown(self):
+        """Clean up test environment."""
+        self.audit_logger.close()
+        shutil.rmtree(self.temp_dir)
+
+    def make_analyzer(self, policy_text=None):
+        if policy_text is not None:
+            self.policy_file.write_text(policy_text)
+        policy = SecurityPolicy(str(self.policy_file))
+        return SecurityAnalyzer(self.audit_logger, policy, cache_dir=str(self.cache_dir))
+
+    def write_script(self, name, content=SCRIPT):
+        path = self.temp_dir / name
+        path.write_text(content)
+        return str(path)
+
+    def test_pattern_findings_match_per_pattern_scan(self):
+        """Test the gated scan finds exactly what checking every pattern on every line finds."""
+        analyzer = self.make_analyzer()
+        expected = [
+            (category, pattern, line_num)
+            for line_num, line in enumerate(SCRIPT.split('\n'), 1)
+            for category, patterns in analyzer.dangerous_patterns.items()
+            for pattern in patterns
+            if re.search(pattern, line)
+        ]
+
+        findings = analyzer._check_dangerous_patterns(SCRIPT)
+        self.assertEqual([(v['type'], v['pattern'], v['line']) for v in findings], expected)
+
+        # Overlapping matches on one line are all reported
+        popen_line = [v['type'] for v in findings if v['line'] == 8]
+        self.assertEqual(popen_line, ['shell_execution', 'file_operations'])
+
+    def test_single_ast_pass(self):
+        """Test one visit yields both analyzer findings and policy operations."""
+        result = self.make_analyzer().analyze_script(self.write_script("script.py"))
+
+        findings = [(v['type'], v['pattern']) for v in result['vulnerabilities']]
+        self.assertIn(('code_execution', 'eval()'), findings)
+        self.assertIn(('dangerous_import', 'import os'), findings)
+
+        operations = [op['type'] for op in result['dangerous_operations']]
+        self.assertEqual(operations, [
+            'dangerous_import_subprocess',
+            'dangerous_import_from_socket.socket',
+            'dangerous_call_os.system',
+            'dangerous_function_eval'
+        ])
+        self.assertIsNone(result['syntax_error'])
+
+    def test_cache_hit_for_unchanged_content(self):
+        """Test identical content is analyzed once, whatever its path."""
+        analyzer = self.make_analyzer()
+        first = analyzer.analyze_script(self.write_script("a.py"))
+        second = analyzer.analyze_script(self.write_script("b.py"))
+
+        self.assertFalse(first['cached'])
+        self.assertTrue(second['cached'])
+        self.assertEqual(second['script_path'], str(self.temp_dir / "b.py"))
+        self.assertEqual(first['vulnerabilities'], second['vulnerabilities'])
+        self.assertEqual(first['risk_level'], second['risk_level'])
+
+        # Persistent: a new analyzer reuses the stored result
+        self.assertTrue(self.make_analyzer().analyze_script(self.write_script("c.py"))['cached'])
+
+    def test_cache_invalidation(self):
+        """Test changed content or a changed policy is analyzed again."""
+        analyzer = self.make_analyzer()
+        path = self.write_script("script.py")
+        analyzer.analyze_script(path)
+
+        self.write_script("script.py", SCRIPT + "\nexec('x = 1')\n")
+        self.assertFalse(analyzer.analyze_script(path)['cached'])
+
+        changed = self.make_analyzer(POLICY.replace("timeout_seconds: 300", "timeout_seconds: 120"))
+        self.assertFalse(changed.analyze_script(path)['cached'])
+        self.assertEqual(changed.cache_stats, {'hits': 0, 'misses': 1})
+
+    def test_tampered_cache_entry_is_ignored(self):
+        """Test a cache entry edited on disk or signed with another key is not trusted."""
+        path = self.write_script("script.py")
+        self.make_analyzer().analyze_script(path)
+
+        entry_file = next(self.cache_dir.glob("*.json"))
+        entry = json.loads(entry_file.read_text())
+        self.assertEqual(entry['analyzer_version'], ANALYSIS_CACHE_VERSION)
+        entry['findings']['vulnerabilities'] = []
+        entry_file.write_text(json.dumps(entry))
+
+        result = self.make_analyzer().analyze_script(path)
+        self.assertFalse(result['cached'])
+        self.assertGreater(result['vulnerabilities_found'], 0)
+
+        # Entries written under another audit secret are rejected too
+        other_dir = Path(tempfile.mkdtemp())
+        try:
+            other_logger = AuditLogger(str(other_dir))
+            other = SecurityAnalyzer(other_logger, SecurityPolicy(str(self.policy_file)), cache_dir=str(self.cache_dir))
+            self.assertFalse(other.analyze_script(path)['cached'])
+            other_logger.close()
+        finally:
+            shutil.rmtree(other_dir)
+
+    def test_syntax_error_is_cached(self):
+        """Test invalid Python keeps its pattern findings and reports the syntax error."""
+        analyzer = self.make_analyzer()
+        path = self.write_script("broken.py", "import os\nos.system('ls'\n")
+
+        for expected_cached in (False, True):
+            result = analyzer.analyze_script(path)
+            self.assertEqual(result['cached'], expected_cached)
+            self.assertIsNotNone(result['syntax_error'])
+            self.assertEqual([v['type'] for v in result['vulnerabilities']], ['dangerous_imports', 'shell_execution'])
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,197 @@
+"""
+Unit tests for the AuditLogger group commit, checkpoints and offset index.
+"""
+
+import json
+import multiprocessing
+import os
+import shutil
+import tempfile
+import threading
+import unittest
+from pathlib import Path
+from unittest.mock import patch
+from ..audit import AuditLogger
+from ..exceptions import AuditLogException
+
+class TestAuditLogger(unittest.TestCase):
+    """Test cases for AuditLogger class."""
+
+    def setUp(self):
+        """Set up test environment."""
+        self.log_dir = tempfile.mkdtemp()
+        self.loggers = []
+
+    def tearDown(self):
+        """Clean up test environment."""
+        for logger in self.loggers:
+            logger.close()
+        shutil.rmtree(self.log_dir)
+
+    def make_logger(self, **kwargs):
+        logger = AuditLogger(self.log_dir, **kwargs)
+        self.loggers.append(logger)
+        return logger
+
+    def log_events(self, logger, count, event_type='TEST_EVENT'):
+        for i in range(count):
+            logger.log_security_event(event_type=event_type, message=f"event {i}", details={'i': i})
+
+    def tamper(self, log_file, line_index):
+        lines = Path(log_file).read_text(encoding='utf-8').splitlines(keepends=True)
+        # Same length, so offsets and checkpoint anchors stay in place
+        lines[line_index] = lines[line_index].replace('"event ', '"EVENT ')
+        Path(log_file).write_text(''.join(lines), encoding='utf-8')
+
+    def test_chain_verifies(self):
+        """Test a fresh chain verifies and every entry is linked."""
+        logger = self.make_logger()
+        self.log_events(logger, 5)
+
+        result = logger.verify_log_integrity(full=True)
+        self.assertTrue(result['security_events_integrity'])
+        self.assertTrue(result['chain_valid'])
+        self.assertEqual(result['total_entries_checked'], 5)
+
+    def test_tamper_detection(self):
+        """Test a modified entry is reported on its own line."""
+        logger = self.make_logger()
+        self.log_events(logger, 3)
+        logger.flush()
+
+        self.tamper(logger.security_log, 1)
+
+        result = logger.verify_log_integrity()
+        self.assertFalse(result['security_events_integrity'])
+        self.assertEqual([entry['line'] for entry in result['tampered_entries']], [2])
+
+    def test_verification_resumes_from_checkpoint(self):
+        """Test only entries after the last trusted checkpoint are re-verified."""
+        logger = self.make_logger(group_commit=False, checkpoint_interval=4)
+        self.log_events(logger, 10)
+
+        checkpoints = logger._security_stream.read_checkpoints()
+        self.assertEqual([checkpoint['entries'] for checkpoint in checkpoints], [4, 8])
+
+        result = logger.verify_log_integrity()
+        self.assertTrue(result['security_events_integrity'])
+        self.assertEqual(result['total_entries_checked'], 2)
+        self.assertEqual(result['total_entries'], 10)
+
+        # Tampering before the checkpoint needs a full verification
+        self.tamper(logger.security_log, 0)
+        self.assertTrue(logger.verify_log_integrity()['security_events_integrity'])
+        self.assertFalse(logger.verify_log_integrity(full=True)['security_events_integrity'])
+
+    def test_forged_checkpoint_is_ignored(self):
+        """Test a checkpoint with a bad signature is not trusted."""
+        logger = self.make_logger(group_commit=False, checkpoint_interval=2)
+        self.log_events(logger, 4)
+
+        checkpoint_path = logger._security_stream.checkpoint_path
+        checkpoints = logger._security_stream.read_checkpoints()
+        forged = dict(checkpoints[-1], chain_hash='0' * 64)
+        with open(checkpoint_path, 'a', encoding='utf-8') as f:
+            f.write(json.dumps(forged) + '\n')
+
+        self.assertEqual(logger._trusted_checkpoint(logger._security_stream), checkpoints[-1])
+
+    def test_group_commit_from_threads(self):
+        """Test concurrent writers are committed in batches with a valid chain."""
+        fsyncs = []
+        real_fsync = __import__('os').fsync
+
+        def counting_fsync(fd):
+            fsyncs.append(fd)
+            real_fsync(fd)
+
+        with patch('secure.audit.os.fsync', side_effect=counting_fsync):
+            logger = self.make_logger()
+            threads = [threading.Thread(target=self.log_events, args=(logger, 50, f"T{n}")) for n in range(4)]
+            for thread in threads:
+                thread.start()
+            for thread in threads:
+                thread.join()
+            self.assertTrue(logger.flush(timeout=10))
+
+        events = logger.get_security_events(limit=1000)
+        self.assertEqual(len(events), 200)
+        self.assertLessEqual(len(fsyncs), 200)
+        self.assertTrue(logger.verify_log_integrity(full=True)['security_events_integrity'])
+
+    def test_indexed_queries(self):
+        """Test queries by key, start time and limit use the offset index."""
+        logger = self.make_logger()
+        self.log_events(logger, 3, 'ALPHA')
+        self.log_events(logger, 2, 'BETA')
+        logger.flush()
+        since = logger.get_security_events('BETA')[0]['timestamp']
+        self.log_events(logger, 2, 'ALPHA')
+
+        self.assertEqual(len(logger.get_security_events('ALPHA')), 5)
+        self.assertEqual([event['message'] for event in logger.get_security_events('ALPHA', limit=2)],
+                         ['event 0', 'event 1'])
+        self.assertEqual(len(logger.get_security_events(since=since)), 4)
+        self.assertEqual(len(logger.get_security_events('ALPHA', since=since)), 2)
+        self.assertEqual(logger.get_security_events('MISSING'), [])
+
+        logger.log_execution('/tmp/script.py', execution_time=0.1, success=True)
+        self.assertEqual(len(logger.get_execution_history('/tmp/script.py')), 1)
+
+    def test_restart_recovers_chain_and_index(self):
+        """Test a new logger continues the chain and rebuilds a missing index."""
+        first = self.make_logger(checkpoint_interval=3)
+        self.log_events(first, 5, 'ALPHA')
+        first.close()
+
+        (Path(self.log_dir) / 'security_events.log.idx').unlink()
+
+        second = self.make_logger(checkpoint_interval=3)
+        self.log_events(second, 2, 'BETA')
+
+        self.assertEqual(len(second.get_security_events('ALPHA')), 5)
+        self.assertEqual(len(second.get_security_events('BETA')), 2)
+        self.assertTrue(second.verify_log_integrity(full=True)['security_events_integrity'])
+
+    def test_failed_commit_is_reported_and_not_chained(self):
+        """Test a failed write surfaces on flush and leaves the chain intact."""
+        logger = self.make_logger()
+        self.log_events(logger, 2, 'ALPHA')
+        self.assertTrue(logger.flush(timeout=10))
+
+        with patch('secure.audit.os.fsync', side_effect=OSError("disk full")):
+            self.log_events(logger, 3, 'LOST')
+            with self.assertRaises(AuditLogException):
+                logger.flush(timeout=10)
+
+        self.log_events(logger, 2, 'BETA')
+        self.assertTrue(logger.flush(timeout=10))
+
+        self.assertEqual(logger.get_security_events('LOST'), [])
+        self.assertEqual(len(logger.get_security_events(limit=100)), 4)
+        self.assertTrue(logger.verify_log_integrity(full=True)['security_events_integrity'])
+
+    def test_processes_share_one_chain(self):
+        """Test loggers in separate processes extend the same chain and index."""
+        context = multiprocessing.get_context('fork')
+
+        def write(name):
+            logger = AuditLogger(self.log_dir)
+            self.log_events(logger, 40, name)
+            logger.close()
+            os._exit(0)
+
+        processes = [context.Process(target=write, args=(f"P{n}",)) for n in range(3)]
+        for process in processes:
+            process.start()
+        for process in processes:
+            process.join(timeout=30)
+            self.assertEqual(process.exitcode, 0)
+
+        logger = self.make_logger()
+        self.assertEqual(len(logger.get_security_events(limit=1000)), 120)
+        self.assertEqual(len(logger.get_security_events('P1', limit=1000)), 40)
+        self.assertTrue(logger.verify_log_integrity(full=True)['security_events_integrity'])
+
+if __name__ == '__main__':
+    unittest.main()
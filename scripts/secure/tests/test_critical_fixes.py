@@ -203,7 +203,7 @@ security:
             os.unlink(policy_file)
 
     @patch('socket.socket.connect')
-    def test_network_monitoring_blocks_disallowed_domains(self, mock_connect):
+    def test_network_monitoring_blocks_disallowed_domains(self, mock_connect, tmp_path):
         """Test that network monitoring blocks connections to disallowed domains."""
         with tempfile.NamedTemporaryFile(mode='w', suffix='.yml', delete=False) as f:
             f.write("""
@@ -230,7 +230,7 @@ security:
             policy_file = f.name
 
         try:
-            executor = SecureScriptExecutor(policy_file)
+            executor = SecureScriptExecutor(policy_file, log_dir=str(tmp_path))
 
             # Mock socket operations to test blocking
             mock_socket = MagicMock()
@@ -263,7 +263,7 @@ security:
         finally:
             os.unlink(policy_file)
 
-    def test_ast_based_static_analysis(self):
+    def test_ast_based_static_analysis(self, tmp_path):
         """Test AST-based static analysis detects dangerous operations."""
         with tempfile.NamedTemporaryFile(mode='w', suffix='.yml', delete=False) as f:
             f.write("""
@@ -290,7 +290,7 @@ security:
             policy_file = f.name
 
         try:
-            executor = SecureScriptExecutor(policy_file)
+            executor = SecureScriptExecutor(policy_file, log_dir=str(tmp_path))
 
             # Test script with dangerous operations
             dangerous_script = """
@@ -323,7 +323,7 @@ def dangerous_function():
         finally:
             os.unlink(policy_file)
 
-    def test_resource_limits_configurable_thresholds(self):
+    def test_resource_limits_configurable_thresholds(self, tmp_path):
         """Test that execution policy uses configurable thresholds from policy."""
         with tempfile.NamedTemporaryFile(mode='w', suffix='.yml', delete=False) as f:
             f.write("""
@@ -354,7 +354,7 @@ security:
             from secure.audit import AuditLogger
 
             with patch.object(AuditLogger, 'log_security_event') as mock_log:
-                executor = SecureScriptExecutor(policy_file)
+                executor = SecureScriptExecutor(policy_file, log_dir=str(tmp_path))
 
                 # Create a mock result for testing
                 from subprocess import CompletedProcess
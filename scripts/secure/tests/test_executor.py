@@ -16,7 +16,7 @@ class TestSecureScriptExecutor(unittest.TestCase):
     def setUp(self):
         """Set up test environment."""
         self.temp_dir = tempfile.mkdtemp()
-        self.executor = SecureScriptExecutor()
+        self.executor = SecureScriptExecutor(log_dir=str(Path(self.temp_dir) / "logs"))
 
         # Create a simple test script
         self.test_script = Path(self.temp_dir) / "test_script.py"
@@ -29,6 +29,8 @@ sys.exit(0)
     def tearDown(self):
         """Clean up test environment."""
         import shutil
+        self.executor.security_monitor.stop_monitoring()
+        self.executor.audit_logger.close()
         shutil.rmtree(self.temp_dir)
 
     def test_script_validation_valid(self):
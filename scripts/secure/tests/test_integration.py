@@ -3,6 +3,7 @@ Integration tests for BIP-04 Secure Script Execution Environment.
 """
 
 import unittest
+import shutil
 import tempfile
 from pathlib import Path
 from ..executor import SecureScriptExecutor
@@ -14,13 +15,16 @@ class TestIntegration(unittest.TestCase):
 
     def setUp(self):
         """Set up integration test environment."""
-        self.executor = SecureScriptExecutor()
+        self.log_dir = tempfile.mkdtemp()
+        self.executor = SecureScriptExecutor(log_dir=self.log_dir)
         self.migration_manager = ScriptMigrationManager(self.executor)
         self.test_suite = SecurityTestSuite(self.executor)
 
     def tearDown(self):
         """Clean up test environment."""
-        pass
+        self.executor.security_monitor.stop_monitoring()
+        self.executor.audit_logger.close()
+        shutil.rmtree(self.log_dir)
 
     def test_full_execution_workflow(self):
         """Test complete script execution workflow."""
@@ -201,7 +205,7 @@ print(f"CPU intensive task completed in {end - start:.2f} seconds")
         # Test with invalid security policy
         try:
             # This should not crash the system
-            invalid_executor = SecureScriptExecutor(policy_file="/non/existent/policy.yml")
+            invalid_executor = SecureScriptExecutor(policy_file="/non/existent/policy.yml", log_dir=self.log_dir)
             # The executor should handle missing policy gracefully
         except Exception:
             # Expected to fail, but should not crash
@@ -2,6 +2,8 @@
 Unit tests for the SecurityMonitor class.
 """
 
+import shutil
+import tempfile
 import unittest
 from unittest.mock import MagicMock
 from ..monitor import SecurityMonitor
@@ -14,12 +16,15 @@ class TestSecurityMonitor(unittest.TestCase):
     def setUp(self):
         """Set up test environment."""
         self.policy = SecurityPolicy()
-        self.audit_logger = AuditLogger()
+        self.log_dir = tempfile.mkdtemp()
+        self.audit_logger = AuditLogger(self.log_dir)
         self.monitor = SecurityMonitor(self.policy, self.audit_logger)
 
     def tearDown(self):
         """Clean up test environment."""
         self.monitor.stop_monitoring()
+        self.audit_logger.close()
+        shutil.rmtree(self.log_dir)
 
     def test_initialization(self):
         """Test monitor initialization."""
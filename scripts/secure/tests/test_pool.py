@@ -0,0 +1,168 @@
+"""
+Unit tests for the SandboxWorkerPool and the executor's worker pool path.
+"""
+
+import os
+import shutil
+import sys
+import tempfile
+import unittest
+from pathlib import Path
+from ..executor import SecureScriptExecutor
+from ..exceptions import NetworkViolationException, TimeoutException
+from ..pool import SandboxWorkerPool
+
+POLICY_FRAME = {
+    'limits': {'cpu_seconds': 30, 'memory_mb': 1024, 'file_size_mb': 10, 'max_processes': 512},
+    'network': {'allowed_domains': [], 'blocked_ports': [22]},
+    'seccomp_syscalls': [],
+    'max_output_bytes': 1024 * 1024
+}
+
+class TestSandboxWorkerPool(unittest.TestCase):
+    """Test cases for SandboxWorkerPool class."""
+
+    def setUp(self):
+        """Set up test environment."""
+        self.temp_dir = tempfile.mkdtemp()
+        self.pool = SandboxWorkerPool(POLICY_FRAME, env=dict(os.environ), cwd=self.temp_dir,
+                                      size=1, max_runs_per_worker=3, prestart=False)
+
+    def tearDown(self):
+        """Clean up test environment."""
+        self.pool.shutdown()
+        shutil.rmtree(self.temp_dir)
+
+    def run_source(self, source, args=None, timeout=10.0):
+        return self.pool.run(source, str(Path(self.temp_dir) / 'script.py'), args or [], timeout)
+
+    def test_successful_run(self):
+        """Test output, arguments and argv of a successful run."""
+        result = self.run_source("import sys\nprint('hello', sys.argv[1:])\n", ['a', 'b'])
+
+        self.assertEqual(result['return_code'], 0)
+        self.assertEqual(result['stdout'], "hello ['a', 'b']\n")
+        self.assertFalse(result['violation'])
+        self.assertGreaterEqual(result['queue_wait'], 0.0)
+        self.assertGreaterEqual(result['overhead'], 0.0)
+
+    def test_exit_codes(self):
+        """Test SystemExit and uncaught exceptions map to exit codes."""
+        self.assertEqual(self.run_source("import sys\nsys.exit(3)\n")['return_code'], 3)
+
+        result = self.run_source("raise ValueError('boom')\n")
+        self.assertEqual(result['return_code'], 1)
+        self.assertIn('ValueError: boom', result['stderr'])
+
+    def test_runs_are_isolated(self):
+        """Test state set by one script is not visible to the next."""
+        self.run_source("import json\njson.leaked = True\n")
+        result = self.run_source("import json\nprint(hasattr(json, 'leaked'))\n")
+        self.assertEqual(result['stdout'].strip(), 'False')
+
+    def test_timeout_recycles_worker(self):
+        """Test a timed out script is killed and its worker replaced."""
+        result = self.run_source("import time\ntime.sleep(30)\n", timeout=0.5)
+
+        self.assertTrue(result['timed_out'])
+        self.assertTrue(result['violation'])
+        self.assertEqual(self.pool.get_stats()['workers_recycled']['violation'], 1)
+
+        # The pool still serves requests afterwards
+        self.assertEqual(self.run_source("print('again')\n")['stdout'], 'again\n')
+
+    def test_blocked_connection(self):
+        """Test connections outside the network policy are blocked and flagged."""
+        result = self.run_source(
+            "import socket\n"
+            "try:\n"
+            "    socket.socket().connect(('example.com', 80))\n"
+            "except OSError as e:\n"
+            "    print('blocked:', e)\n"
+        )
+
+        self.assertIn('blocked: Connection to disallowed domain', result['stdout'])
+        self.assertTrue(result['violation'])
+        self.assertEqual(result['network_activity'][0]['host'], 'example.com')
+
+    def test_forged_report_is_ignored(self):
+        """Test a script writing fake report frames to its fds cannot clear a violation."""
+        result = self.run_source(
+            "import json, os, socket, struct\n"
+            "body = json.dumps({'type': 'locked', 'network_activity': [], 'violation': False}).encode()\n"
+            "for fd in range(3, 64):\n"
+            "    try:\n"
+            "        os.write(fd, struct.pack('>I', len(body)) + body)\n"
+            "    except OSError:\n"
+            "        pass\n"
+            "try:\n"
+            "    socket.socket().connect(('example.com', 80))\n"
+            "except OSError as e:\n"
+            "    print('blocked:', e)\n"
+        )
+
+        self.assertIn('blocked:', result['stdout'])
+        self.assertTrue(result['violation'])
+        self.assertEqual(result['violation_reason'], 'Unexpected guard frame')
+
+    def test_recycles_after_max_runs(self):
+        """Test workers are replaced after max_runs_per_worker scripts."""
+        pids = [int(self.run_source("import os\nprint(os.getppid())\n")['stdout']) for _ in range(4)]
+
+        self.assertEqual(len(set(pids[:3])), 1)
+        self.assertNotEqual(pids[3], pids[0])
+        stats = self.pool.get_stats()
+        self.assertEqual(stats['runs'], 4)
+        self.assertEqual(stats['workers_recycled']['max_runs'], 1)
+        self.assertIn('avg', stats['queue_wait_ms'])
+        self.assertIn('max', stats['overhead_ms'])
+
+class TestExecutorWorkerPool(unittest.TestCase):
+    """Test cases for SecureScriptExecutor with the worker pool enabled."""
+
+    def setUp(self):
+        """Set up test environment."""
+        self.temp_dir = tempfile.mkdtemp()
+        self.executor = SecureScriptExecutor(use_worker_pool=True, log_dir=str(Path(self.temp_dir) / "logs"))
+
+    def tearDown(self):
+        """Clean up test environment."""
+        self.executor.shutdown()
+        self.executor.security_monitor.stop_monitoring()
+        self.executor.audit_logger.close()
+        shutil.rmtree(self.temp_dir)
+
+    def write_script(self, source):
+        script = Path(self.temp_dir) / "pool_script.py"
+        script.write_text(source)
+        return str(script)
+
+    def test_pooled_execution(self):
+        """Test a pooled run returns the usual result plus pool timings."""
+        result = self.executor.execute_script(self.write_script("print('pooled')\n"))
+
+        self.assertTrue(result['success'])
+        self.assertEqual(result['stdout'], 'pooled\n')
+        self.assertTrue(result['security_checks']['worker_pool'])
+        self.assertIn('queue_wait', result['pool'])
+        self.assertEqual(self.executor.get_security_stats()['worker_pool']['runs'], 1)
+
+    def test_pooled_timeout(self):
+        """Test pooled timeouts raise TimeoutException."""
+        with self.assertRaises(TimeoutException):
+            self.executor.execute_script(self.write_script("import time\ntime.sleep(30)\n"), timeout=0.5)
+
+    def test_pooled_network_violation(self):
+        """Test pooled network activity is validated against the policy."""
+        script = self.write_script(
+            "import socket\n"
+            "try:\n"
+            "    socket.socket().connect(('example.com', 80))\n"
+            "except OSError:\n"
+            "    pass\n"
+        )
+        with self.assertRaises(NetworkViolationException):
+            self.executor.execute_script(script)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,430 @@
+"""
+Sandbox Worker - Pre-initialized, policy-locked process for the worker pool.
+
+Started by SandboxWorkerPool with the executor's prepared environment. The
+worker receives its policy once, then forks one child per script frame: the
+child applies the resource limits, installs the network guards and runs the
+script source in-process, so each run starts from the same clean, initialized
+state without launching a new interpreter. Only the standard library is used.
+
+Protocol: length-prefixed (4-byte big-endian) JSON frames on stdin/stdout.
+
+The run report is built here, not in the child: the child's only channel is
+a guard socket on which it reports its lockdown before the script starts and
+then asks for a verdict on every connect/bind. The worker records that
+activity itself, so a script can add entries but never forge or erase them.
+"""
+
+import json
+import os
+import resource
+import select
+import signal
+import socket
+import struct
+import sys
+import time
+import traceback
+from typing import Any, Dict, List, Optional, Tuple
+
+HEADER = struct.Struct('>I')
+
+# (rlimit, policy key, default, scale) - same mapping as SecureScriptExecutor
+RESOURCE_LIMITS = (
+    (resource.RLIMIT_CPU, 'cpu_seconds', 60, 1),
+    (resource.RLIMIT_AS, 'memory_mb', 512, 1024 * 1024),
+    (resource.RLIMIT_FSIZE, 'file_size_mb', 100, 1024 * 1024),
+    (resource.RLIMIT_NPROC, 'max_processes', 5, 1),
+)
+CRITICAL_LIMITS = ('cpu_seconds', 'memory_mb')
+
+# Exit code of a child that could not be locked down
+LOCKDOWN_FAILED = 126
+
+# Largest guard frame the worker accepts from a child
+MAX_GUARD_FRAME = 64 * 1024
+
+
+def read_frame(fd: int) -> Optional[Dict[str, Any]]:
+    """Read one frame; None on EOF."""
+    header = _read_exact(fd, HEADER.size)
+    if header is None:
+        return None
+    body = _read_exact(fd, HEADER.unpack(header)[0])
+    return json.loads(body.decode('utf-8')) if body is not None else None
+
+
+def write_frame(fd: int, message: Dict[str, Any]) -> None:
+    """Write one frame."""
+    body = json.dumps(message).encode('utf-8')
+    data = HEADER.pack(len(body)) + body
+    while data:
+        data = data[os.write(fd, data):]
+
+
+def _read_exact(fd: int, size: int) -> Optional[bytes]:
+    chunks = []
+    while size > 0:
+        chunk = os.read(fd, size)
+        if not chunk:
+            return None
+        chunks.append(chunk)
+        size -= len(chunk)
+    return b''.join(chunks)
+
+
+def is_domain_allowed(host: str, allowed_domains: List[str]) -> bool:
+    """Mirror of SecurityPolicy.is_domain_allowed (empty list denies all)."""
+    host_lower = host.lower()
+    return any(
+        host_lower == domain.lower() or host_lower.endswith('.' + domain.lower())
+        for domain in allowed_domains
+    )
+
+
+def apply_resource_limits(limits: Dict[str, Any]) -> Dict[str, int]:
+    """Apply the policy rlimits to this process; raises if a critical one fails."""
+    applied = {}
+    failed = {}
+
+    for constant, key, default, scale in RESOURCE_LIMITS:
+        value = limits.get(key, default) * scale
+        try:
+            _, hard = resource.getrlimit(constant)
+            target = value if hard == resource.RLIM_INFINITY else min(value, hard)
+            resource.setrlimit(constant, (target, target))
+            applied[key] = target
+        except (ValueError, OSError) as e:
+            failed[key] = str(e)
+
+    critical = [key for key in failed if key in CRITICAL_LIMITS]
+    if critical:
+        raise OSError(f"Critical resource limits could not be applied: {critical}. Details: {failed}")
+    return applied
+
+
+def install_network_guards(guard_fd: int) -> None:
+    """Ask the worker for a verdict on every socket connect/bind; deny if it cannot answer."""
+    original_connect = socket.socket.connect
+    original_bind = socket.socket.bind
+
+    def check(sock, operation, address):
+        host, port = address if isinstance(address, tuple) else (str(address), 0)
+        try:
+            write_frame(guard_fd, {
+                'type': 'check',
+                'operation': operation,
+                'host': host,
+                'port': port,
+                'socket_family': int(sock.family),
+                'socket_type': int(sock.type)
+            })
+            verdict = read_frame(guard_fd)
+        except (OSError, ValueError):
+            verdict = None
+        if not verdict or not verdict.get('allow'):
+            raise socket.error(verdict.get('reason') if verdict else "Network guard unavailable")
+
+    def guarded_connect(sock, address):
+        check(sock, 'connect', address)
+        return original_connect(sock, address)
+
+    def guarded_bind(sock, address):
+        check(sock, 'bind', address)
+        return original_bind(sock, address)
+
+    socket.socket.connect = guarded_connect
+    socket.socket.bind = guarded_bind
+
+
+def check_network(request: Dict[str, Any], network: Dict[str, Any]) -> Tuple[Dict[str, Any], Optional[str]]:
+    """Activity record and denial reason (None if allowed) for a child's guard request."""
+    host = str(request.get('host', ''))
+    try:
+        port = int(request.get('port') or 0)
+        family = int(request.get('socket_family') or 0)
+        sock_type = int(request.get('socket_type') or 0)
+    except (TypeError, ValueError):
+        port, family, sock_type = 0, 0, 0
+    operation = request.get('operation')
+
+    info = {
+        'timestamp': time.time(),
+        'operation': operation,
+        'host': host,
+        'port': port,
+        'socket_family': family,
+        'socket_type': sock_type
+    }
+
+    blocked_ports = set(network.get('blocked_ports', []))
+    reason = None
+    if operation == 'connect':
+        if host and not is_domain_allowed(host, network.get('allowed_domains', [])):
+            reason = "Connection to disallowed domain"
+        elif port and port in blocked_ports:
+            reason = "Connection to blocked port"
+    elif operation == 'bind':
+        if port and port in blocked_ports:
+            reason = "Binding to blocked port"
+    else:
+        reason = "Unknown network operation"
+    return info, reason
+
+
+def apply_seccomp(syscalls: List[str]) -> bool:
+    """Load the executor's syscall allowlist when libseccomp is available."""
+    if not syscalls:
+        return False
+    try:
+        import seccomp
+    except ImportError:
+        return False
+
+    syscall_filter = seccomp.SyscallFilter(seccomp.KILL)
+    for syscall in syscalls:
+        try:
+            syscall_filter.add_rule(seccomp.ALLOW, syscall)
+        except seccomp.SyscallFilterException:
+            continue
+    syscall_filter.load()
+    return True
+
+
+def run_child(request: Dict[str, Any], policy: Dict[str, Any],
+              out_w: int, err_w: int, guard_fd: int) -> None:
+    """Forked child: lock down, report the lockdown, run the script, exit."""
+    os.dup2(out_w, 1)
+    os.dup2(err_w, 2)
+    os.close(out_w)
+    os.close(err_w)
+
+    def finish(code: int) -> None:
+        try:
+            sys.stdout.flush()
+            sys.stderr.flush()
+        except Exception:
+            pass
+        os._exit(code)
+
+    try:
+        apply_resource_limits(policy.get('limits', {}))
+        install_network_guards(guard_fd)
+        seccomp_applied = apply_seccomp(policy.get('seccomp_syscalls', []))
+        # Sent before the script runs, so the worker can trust it
+        write_frame(guard_fd, {'type': 'locked', 'seccomp_applied': seccomp_applied})
+    except Exception as e:
+        reason = f"Sandbox lockdown failed: {e}"
+        print(reason, file=sys.stderr)
+        try:
+            write_frame(guard_fd, {'type': 'lockdown_failed', 'reason': reason})
+        except Exception:
+            pass
+        finish(LOCKDOWN_FAILED)
+
+    script_path = request['script_path']
+    sys.argv = [script_path] + list(request.get('args', []))
+    sys.path[0] = os.path.dirname(os.path.abspath(script_path))
+
+    code = 0
+    try:
+        compiled = compile(request['source'], script_path, 'exec')
+        exec(compiled, {'__name__': '__main__', '__file__': script_path, '__builtins__': __builtins__})
+    except SystemExit as e:
+        if e.code is None:
+            code = 0
+        elif isinstance(e.code, int):
+            code = e.code
+        else:
+            print(e.code, file=sys.stderr)
+            code = 1
+    except BaseException:
+        traceback.print_exc()
+        code = 1
+
+    finish(code)
+
+
+class GuardChannel:
+    """Worker side of a child's guard socket; builds the run report."""
+
+    def __init__(self, fd: int, network: Dict[str, Any]):
+        self.fd = fd
+        self.network = network
+        self.buffer = bytearray()
+        self.lockdown: Optional[Dict[str, Any]] = None
+        self.activity: List[Dict[str, Any]] = []
+        self.violation_reason: Optional[str] = None
+
+    def receive(self, chunk: bytes) -> bool:
+        """Handle incoming bytes; False once the channel must be closed."""
+        self.buffer += chunk
+        while len(self.buffer) >= HEADER.size:
+            size = HEADER.unpack_from(self.buffer)[0]
+            if size > MAX_GUARD_FRAME:
+                return self._abuse("Oversized guard frame")
+            if len(self.buffer) < HEADER.size + size:
+                break
+            body = bytes(self.buffer[HEADER.size:HEADER.size + size])
+            del self.buffer[:HEADER.size + size]
+            try:
+                message = json.loads(body.decode('utf-8'))
+            except (ValueError, UnicodeDecodeError):
+                return self._abuse("Malformed guard frame")
+            if not isinstance(message, dict) or not self._handle(message):
+                return False
+        return True
+
+    def _handle(self, message: Dict[str, Any]) -> bool:
+        if self.lockdown is None:
+            # Only the first frame may report the lockdown; the script has not run yet
+            if message.get('type') not in ('locked', 'lockdown_failed'):
+                return self._abuse("Guard frame before lockdown report")
+            self.lockdown = message
+            return True
+
+        if message.get('type') != 'check':
+            return self._abuse("Unexpected guard frame")
+
+        info, reason = check_network(message, self.network)
+        self.activity.append(info)
+        if reason is not None:
+            self.violation_reason = self.violation_reason or reason
+        try:
+            write_frame(self.fd, {'allow': reason is None, 'reason': reason})
+        except BlockingIOError:
+            return self._abuse("Guard channel flooded")
+        except OSError:
+            return False
+        return True
+
+    def _abuse(self, reason: str) -> bool:
+        self.violation_reason = self.violation_reason or reason
+        return False
+
+    def report(self) -> Dict[str, Any]:
+        lockdown = self.lockdown or {}
+        reason = self.violation_reason
+        if lockdown.get('type') != 'locked':
+            reason = lockdown.get('reason') or "Sandbox lockdown failed: no lockdown report"
+        return {
+            'network_activity': self.activity,
+            'violation': reason is not None,
+            'violation_reason': reason,
+            'seccomp_applied': bool(lockdown.get('seccomp_applied')) if lockdown.get('type') == 'locked' else False
+        }
+
+
+def run_request(request: Dict[str, Any], policy: Dict[str, Any], protocol_fds: List[int]) -> Dict[str, Any]:
+    """Fork a child for one script and collect its output, status and report."""
+    out_r, out_w = os.pipe()
+    err_r, err_w = os.pipe()
+    guard_parent_sock, guard_child_sock = socket.socketpair()
+    guard_parent, guard_child = guard_parent_sock.detach(), guard_child_sock.detach()
+    max_output = policy.get('max_output_bytes', 10 * 1024 * 1024)
+
+    start = time.monotonic()
+    pid = os.fork()
+    if pid == 0:
+        for fd in protocol_fds + [out_r, err_r, guard_parent]:
+            os.close(fd)
+        run_child(request, policy, out_w, err_w, guard_child)
+
+    for fd in (out_w, err_w, guard_child):
+        os.close(fd)
+
+    # Non-blocking, so a child that stops reading verdicts cannot stall the worker
+    os.set_blocking(guard_parent, False)
+    guard = GuardChannel(guard_parent, policy.get('network', {}))
+
+    buffers = {out_r: bytearray(), err_r: bytearray()}
+    open_fds = set(buffers) | {guard_parent}
+    deadline = start + float(request.get('timeout', 300))
+    timed_out = False
+    truncated = False
+
+    while open_fds:
+        remaining = deadline - time.monotonic()
+        if remaining <= 0:
+            timed_out = True
+            os.kill(pid, signal.SIGKILL)
+            break
+
+        ready, _, _ = select.select(list(open_fds), [], [], remaining)
+        for fd in ready:
+            try:
+                chunk = os.read(fd, 65536)
+            except BlockingIOError:
+                continue
+            if fd == guard_parent:
+                if not chunk or not guard.receive(chunk):
+                    # Closed at once: a child waiting for a verdict gets EOF and is denied
+                    open_fds.discard(fd)
+                    os.close(fd)
+                    guard_parent = -1
+            elif not chunk:
+                open_fds.discard(fd)
+            elif len(buffers[fd]) < max_output:
+                buffers[fd] += chunk
+            else:
+                truncated = True
+
+    for fd in list(buffers) + ([guard_parent] if guard_parent >= 0 else []):
+        os.close(fd)
+
+    _, status, rusage = os.wait4(pid, 0)
+    execution_time = time.monotonic() - start
+    return_code = os.waitstatus_to_exitcode(status)
+    report = guard.report()
+
+    # Killed by a limit (SIGXCPU, or SIGKILL at the CPU hard limit) or by the timeout
+    if timed_out or return_code in (-signal.SIGXCPU, -signal.SIGKILL, -signal.SIGSYS):
+        report['violation'] = True
+        report['violation_reason'] = report['violation_reason'] or (
+            'timeout' if timed_out else f"terminated by signal {-return_code}"
+        )
+
+    return {
+        'type': 'result',
+        'return_code': return_code,
+        'stdout': bytes(buffers[out_r]).decode('utf-8', errors='replace'),
+        'stderr': bytes(buffers[err_r]).decode('utf-8', errors='replace'),
+        'timed_out': timed_out,
+        'output_truncated': truncated,
+        'execution_time': execution_time,
+        'network_activity': report['network_activity'],
+        'violation': report['violation'],
+        'violation_reason': report['violation_reason'],
+        'seccomp_applied': report['seccomp_applied'],
+        'resource_usage': {
+            'cpu_user_seconds': rusage.ru_utime,
+            'cpu_system_seconds': rusage.ru_stime,
+            'max_rss_mb': rusage.ru_maxrss / 1024,
+            'exit_signal': -return_code if return_code < 0 else None
+        }
+    }
+
+
+def main() -> None:
+    # Keep the protocol off fds 0/1 so forked children can redirect them freely
+    protocol_in = os.dup(0)
+    protocol_out = os.dup(1)
+    devnull = os.open(os.devnull, os.O_RDWR)
+    os.dup2(devnull, 0)
+    os.dup2(2, 1)
+    os.close(devnull)
+
+    policy = read_frame(protocol_in)
+    if policy is None:
+        return
+    write_frame(protocol_out, {'type': 'ready', 'pid': os.getpid()})
+
+    while True:
+        request = read_frame(protocol_in)
+        if request is None or request.get('type') == 'shutdown':
+            return
+        write_frame(protocol_out, run_request(request, policy, [protocol_in, protocol_out]))
+
+
+if __name__ == '__main__':
+    main()
@@ -4,23 +4,49 @@ Schema Validation Script for CMMV-Hive
 
 This script validates JSON files against their corresponding JSON schemas
 to ensure data integrity and consistency across the project.
+
+Each schema is checked and compiled into a validator once, then reused for
+every file. --batch validates many files in a single process (paths from the
+command line or stdin) and skips files no schema claims, using the same
+detection rules as the precompiled TypeScript validators in
+packages/shared-types/src/schemas.
 """
 
 import json
-import os
+import re
 import sys
 from pathlib import Path
-from typing import Dict, List, Optional, Tuple
-import jsonschema
-from jsonschema import ValidationError, SchemaError
+from typing import Dict, Iterator, List, Optional, Tuple
+from jsonschema import SchemaError, validators
+
+try:  # jsonschema >= 4.18
+    from referencing import Registry, Resource
+except ImportError:  # pragma: no cover - older jsonschema
+    Registry = None
+    from jsonschema import RefResolver
+
+DEFAULT_SCHEMAS_DIR = Path(__file__).resolve().parent.parent / "gov" / "schemas"
+
+# File names that identify a schema without a `$schema` reference
+SCHEMA_FILE_NAMES = {"final_report.json": "minutes_report"}
+
+# Template directories hold placeholder documents that are not valid JSON
+SKIPPED_DIRECTORIES = {"node_modules", "templates", "dist"}
+
+SCHEMA_REFERENCE = re.compile(r"([^/\\]+)\.schema\.json$")
 
 
 class SchemaValidator:
     """Validates JSON files against JSON schemas."""
 
-    def __init__(self, schemas_dir: str = "schemas"):
+    def __init__(self, schemas_dir: str = "schemas", verbose: bool = True):
         self.schemas_dir = Path(schemas_dir)
+        if not self.schemas_dir.exists() and not self.schemas_dir.is_absolute():
+            self.schemas_dir = DEFAULT_SCHEMAS_DIR
+        self.verbose = verbose
         self.schemas: Dict[str, dict] = {}
+        self._uris: Dict[str, str] = {}
+        self._validators: Dict[str, object] = {}
         self._load_schemas()
 
     def _load_schemas(self) -> None:
@@ -35,10 +61,67 @@ class SchemaValidator:
                     schema = json.load(f)
                     schema_name = schema_file.stem.replace('.schema', '')
                     self.schemas[schema_name] = schema
-                    print(f"Loaded schema: {schema_name}")
+                    self._uris[schema_name] = schema_file.resolve().as_uri()
+                    if self.verbose:
+                        print(f"Loaded schema: {schema_name}")
             except (json.JSONDecodeError, IOError) as e:
                 print(f"Error loading schema {schema_file}: {e}")
 
+    def _validator(self, schema_name: str):
+        """Compiled validator for a schema, built and checked on first use."""
+        validator = self._validators.get(schema_name)
+        if validator is not None:
+            return validator
+
+        schema = self.schemas[schema_name]
+        cls = validators.validator_for(schema)
+        cls.check_schema(schema)
+
+        # Relative $refs (./model_evaluation_entry.schema.json) resolve
+        # against the schema's own file URI to its siblings
+        documents = {
+            name: {**document, "$id": self._uris[name]}
+            for name, document in self.schemas.items()
+        }
+        root = documents[schema_name]
+        if Registry is not None:
+            registry = Registry().with_resources(
+                (document["$id"], Resource.from_contents(document))
+                for document in documents.values()
+            )
+            validator = cls(root, registry=registry)
+        else:
+            store = {document["$id"]: document for document in documents.values()}
+            validator = cls(root, resolver=RefResolver(root["$id"], root, store=store))
+
+        self._validators[schema_name] = validator
+        return validator
+
+    def detect_schema(self, file_path: Path, data: object) -> Optional[str]:
+        """
+        Schema claimed by a document: its `$schema` reference when it names a
+        known schema, then the file name (a known name such as
+        final_report.json, or `<schema>.json`). None when nothing matches.
+        """
+        if isinstance(data, dict) and isinstance(data.get("$schema"), str):
+            match = SCHEMA_REFERENCE.search(data["$schema"])
+            if match and match.group(1) in self.schemas:
+                return match.group(1)
+
+        mapped = SCHEMA_FILE_NAMES.get(file_path.name)
+        if mapped in self.schemas:
+            return mapped
+
+        return file_path.stem if file_path.stem in self.schemas else None
+
+    def validate_data(self, data: object, schema_name: str) -> List[str]:
+        """Every violation of a schema, as "path: message" lines."""
+        errors = sorted(self._validator(schema_name).iter_errors(data), key=lambda e: list(e.absolute_path))
+        return [
+            f"/{'/'.join(str(part) for part in error.absolute_path)}: {error.message}"
+            for error in errors
+        ]
+
     def validate_file(self, file_path: str, schema_name: Optional[str] = None) -> Tuple[bool, List[str]]:
         """
         Validate a JSON file against a schema.
@@ -50,36 +133,57 @@ class SchemaValidator:
         Returns:
             Tuple of (is_valid, error_messages)
         """
+        status, _, errors = self.check_file(file_path, schema_name)
+        return status == "valid", errors
+
+    def check_file(self, file_path: str, schema_name: Optional[str] = None,
+                   fallback: bool = True) -> Tuple[str, Optional[str], List[str]]:
+        """
+        Validate a JSON file and report how it was handled.
+
+        Args:
+            file_path: Path to the JSON file to validate
+            schema_name: Name of the schema to use (auto-detected if None)
+            fallback: Guess a schema from the path when detection finds none;
+                otherwise the file is skipped
+
+        Returns:
+            Tuple of (status, schema_name, error_messages), where status is
+            "valid", "invalid" or "skipped"
+        """
         file_path = Path(file_path)
 
         if not file_path.exists():
-            return False, [f"File not found: {file_path}"]
+            return "invalid", schema_name, [f"File not found: {file_path}"]
+
+        try:
+            with open(file_path, 'r', encoding='utf-8') as f:
+                data = json.load(f)
+        except json.JSONDecodeError as e:
+            return "invalid", schema_name, [f"Invalid JSON: {e}"]
+        except IOError as e:
+            return "invalid", schema_name, [f"File read error: {e}"]
 
         # Auto-detect schema if not provided
         if schema_name is None:
-            schema_name = self._detect_schema(file_path)
+            schema_name = self.detect_schema(file_path, data)
+            if schema_name is None:
+                if not fallback:
+                    return "skipped", None, []
+                schema_name = self._detect_schema(file_path)
 
         if schema_name not in self.schemas:
-            return False, [f"Schema not found: {schema_name}"]
+            return "invalid", schema_name, [f"Schema not found: {schema_name}"]
 
         try:
-            with open(file_path, 'r', encoding='utf-8') as f:
-                data = json.load(f)
-
-            jsonschema.validate(data, self.schemas[schema_name])
-            return True, []
-
-        except json.JSONDecodeError as e:
-            return False, [f"Invalid JSON: {e}"]
-        except ValidationError as e:
-            return False, [f"Validation error: {e.message}"]
+            errors = self.validate_data(data, schema_name)
         except SchemaError as e:
-            return False, [f"Schema error: {e}"]
-        except IOError as e:
-            return False, [f"File read error: {e}"]
+            return "invalid", schema_name, [f"Schema error: {e}"]
+
+        return ("invalid" if errors else "valid"), schema_name, errors
 
     def _detect_schema(self, file_path: Path) -> str:
-        """Auto-detect the appropriate schema based on file path and content."""
+        """Guess a schema from the file path (single-file fallback)."""
         file_name = file_path.name.lower()
 
         # Detect based on file name and path
@@ -96,7 +200,8 @@ class SchemaValidator:
 
     def validate_directory(self, directory: str, recursive: bool = True) -> Dict[str, List[str]]:
         """
-        Validate all JSON files in a directory.
+        Validate all JSON files in a directory. Files no schema claims are
+        skipped.
 
         Args:
             directory: Directory path to scan
@@ -105,14 +210,11 @@ class SchemaValidator:
         Returns:
             Dictionary mapping file paths to error messages
         """
-        directory = Path(directory)
         errors = {}
 
-        pattern = "**/*.json" if recursive else "*.json"
-
-        for json_file in directory.glob(pattern):
-            is_valid, error_messages = self.validate_file(str(json_file))
-            if not is_valid:
+        for json_file in iter_json_files(Path(directory), recursive):
+            status, _, error_messages = self.check_file(str(json_file), fallback=False)
+            if status == "invalid":
                 errors[str(json_file)] = error_messages
 
         return errors
@@ -122,9 +224,20 @@ class SchemaValidator:
         return list(self.schemas.keys())
 
 
+def iter_json_files(directory: Path, recursive: bool = True) -> Iterator[Path]:
+    """JSON documents under a directory, skipping schemas, templates and dot-directories."""
+    for entry in sorted(directory.iterdir()):
+        if entry.is_dir():
+            if recursive and not entry.name.startswith('.') and entry.name not in SKIPPED_DIRECTORIES:
+                yield from iter_json_files(entry, recursive)
+        elif entry.suffix == '.json' and not entry.name.endswith('.schema.json'):
+            yield entry
+
+
 def main():
     """Main CLI interface."""
     import argparse
+    import time
 
     parser = argparse.ArgumentParser(
         description="Validate JSON files against JSON schemas for CMMV-Hive"
@@ -132,7 +245,7 @@ def main():
     parser.add_argument(
         'paths',
         nargs='*',
-        help='Files or directories to validate'
+        help='Files or directories to validate ("-" reads paths from stdin)'
     )
     parser.add_argument(
         '--schema',
@@ -141,7 +254,7 @@ def main():
     parser.add_argument(
         '--schemas-dir',
         default='schemas',
-        help='Directory containing JSON schemas'
+        help='Directory containing JSON schemas (default: gov/schemas when ./schemas is missing)'
     )
     parser.add_argument(
         '--list-schemas',
@@ -154,10 +267,29 @@ def main():
         default=True,
         help='Recursively validate directories'
     )
+    parser.add_argument(
+        '--batch',
+        action='store_true',
+        help='Validate every path in one pass; files no schema claims are skipped'
+    )
+    parser.add_argument(
+        '--quiet', '-q',
+        action='store_true',
+        help='Only print invalid files and the summary'
+    )
+    parser.add_argument(
+        '--json',
+        metavar='FILE',
+        help='Write a JSON report of every file to FILE ("-" for stdout only)'
+    )
 
     args = parser.parse_args()
 
-    validator = SchemaValidator(args.schemas_dir)
+    # A report on stdout replaces the human-readable output
+    emit = print if args.json != '-' else (lambda *_args, **_kwargs: None)
+    quiet = args.quiet or args.json == '-'
+
+    validator = SchemaValidator(args.schemas_dir, verbose=not (args.batch or quiet))
 
     if args.list_schemas:
         print("Available schemas:")
@@ -165,63 +297,84 @@ def main():
             print(f"  - {schema}")
         return
 
-    if not args.paths:
+    paths: List[str] = []
+    for path in args.paths:
+        if path == '-':
+            paths.extend(line.strip() for line in sys.stdin if line.strip())
+        else:
+            paths.append(path)
+
+    if not paths:
         print("Error: No files or directories specified.")
         print("Use --help for usage information.")
         sys.exit(1)
 
-    all_errors = {}
-    total_files = 0
-    valid_files = 0
+    start = time.perf_counter()
+    results: List[Tuple[str, str, Optional[str], List[str]]] = []
+    seen = set()
 
-    for path in args.paths:
+    for path in paths:
         path_obj = Path(path)
 
-        if path_obj.is_file() and path_obj.suffix == '.json':
-            # Validate single file
-            total_files += 1
-            is_valid, errors = validator.validate_file(path, args.schema)
-            if is_valid:
-                valid_files += 1
-                print(f"✅ {path}")
-            else:
-                all_errors[path] = errors
-                print(f"❌ {path}")
-                for error in errors:
-                    print(f"   {error}")
-
-        elif path_obj.is_dir():
-            # Validate directory
-            dir_errors = validator.validate_directory(path, args.recursive)
-            total_files += len(dir_errors) + sum(
-                1 for _ in path_obj.glob("**/*.json" if args.recursive else "*.json")
-            ) - len(dir_errors)
-            valid_files += (total_files - len(dir_errors))
-
-            for file_path, errors in dir_errors.items():
-                all_errors[file_path] = errors
-                print(f"❌ {file_path}")
-                for error in errors:
-                    print(f"   {error}")
+        if path_obj.is_dir():
+            files = list(iter_json_files(path_obj, args.recursive))
+            fallback = False
+        elif path_obj.is_file() and path_obj.suffix == '.json':
+            files = [path_obj]
+            fallback = not args.batch
+        else:
+            emit(f"Warning: {path} is not a JSON file or directory")
+            continue
+
+        for json_file in files:
+            if json_file in seen:
+                continue
+            seen.add(json_file)
 
-            # Print valid files
-            for json_file in path_obj.glob("**/*.json" if args.recursive else "*.json"):
-                if str(json_file) not in dir_errors:
-                    print(f"✅ {json_file}")
+            status, schema_name, errors = validator.check_file(str(json_file), args.schema, fallback)
+            results.append((str(json_file), status, schema_name, errors))
 
+            if status == "invalid":
+                emit(f"❌ {json_file}" + (f" ({schema_name})" if schema_name else ""))
+                for error in errors:
+                    emit(f"   {error}")
+            elif not quiet:
+                emit(f"✅ {json_file} ({schema_name})" if status == "valid" else f"⏭️  {json_file} (no schema)")
+
+    duration_ms = round((time.perf_counter() - start) * 1000)
+    valid_files = sum(1 for _, status, _, _ in results if status == "valid")
+    invalid_files = [(path, errors) for path, status, _, errors in results if status == "invalid"]
+    skipped_files = sum(1 for _, status, _, _ in results if status == "skipped")
+    checked_files = valid_files + len(invalid_files)
+
+    if args.json:
+        report = {
+            "valid": valid_files,
+            "invalid": len(invalid_files),
+            "skipped": skipped_files,
+            "durationMs": duration_ms,
+            "files": [
+                {"path": path, "status": status, "schema": schema_name, "errors": errors}
+                for path, status, schema_name, errors in results
+            ],
+        }
+        if args.json == '-':
+            print(json.dumps(report, indent=2))
         else:
-            print(f"Warning: {path} is not a JSON file or directory")
+            with open(args.json, 'w', encoding='utf-8') as f:
+                json.dump(report, f, indent=2)
 
     # Summary
-    print(f"\nSummary: {valid_files}/{total_files} files validated successfully")
+    emit(f"\nSummary: {valid_files}/{checked_files} files validated successfully"
+         f" ({skipped_files} skipped without a schema, {duration_ms}ms)")
 
-    if all_errors:
-        print(f"\nFound {len(all_errors)} files with validation errors:")
-        for file_path, errors in all_errors.items():
-            print(f"- {file_path}: {len(errors)} errors")
+    if invalid_files:
+        emit(f"\nFound {len(invalid_files)} files with validation errors:")
+        for file_path, errors in invalid_files:
+            emit(f"- {file_path}: {len(errors)} errors")
         sys.exit(1)
     else:
-        print("\nAll files validated successfully! 🎉")
+        emit("\nAll files validated successfully! 🎉")
 
 
 if __name__ == "__main__":
@@ -2,13 +2,13 @@
 
 import fs from 'fs';
 import path from 'path';
-import { fileURLToPath } from 'url';
+import { fileURLToPath, pathToFileURL } from 'url';
 
 const __filename = fileURLToPath(import.meta.url);
 const __dirname = path.dirname(__filename);
 
-const MINUTES_DIR = path.join(__dirname, '../../gov/minutes/0004');
-const VOTES_DIR = path.join(MINUTES_DIR, 'votes');
+const MINUTES_ROOT = path.join(__dirname, '../../gov/minutes');
+const TALLY_ENGINE = path.join(__dirname, '../../packages/bip-system/dist/bip-system/src/voting/TallyEngine.js');
 
 // Colors for console output
 const colors = {
@@ -32,74 +32,89 @@ function logHeader(message) {
     log(`${'='.repeat(60)}\n`, 'cyan');
 }
 
-function readVoteFile(filePath) {
-    try {
-        const content = fs.readFileSync(filePath, 'utf8');
-        return JSON.parse(content);
-    } catch (error) {
-        log(`Erro ao ler arquivo ${filePath}: ${error.message}`, 'red');
-        return null;
+function parseArgs(argv) {
+    const options = { minuteId: null, incremental: false, strict: false, concurrency: 8 };
+
+    for (let i = 0; i < argv.length; i++) {
+        const arg = argv[i];
+        if (arg === '--incremental' || arg === '-i') {
+            options.incremental = true;
+        } else if (arg === '--strict') {
+            options.strict = true;
+        } else if (arg === '--concurrency') {
+            options.concurrency = Math.max(1, parseInt(argv[++i], 10) || 8);
+        } else if (!arg.startsWith('-')) {
+            options.minuteId = arg;
+        }
     }
+
+    return options;
 }
 
-function getAllVoteFiles() {
-    const files = fs.readdirSync(VOTES_DIR);
-    return files
-        .filter(file => file.endsWith('.json') && file !== 'TEMPLATE.json')
-        .map(file => path.join(VOTES_DIR, file));
+function latestMinuteId() {
+    const minutes = fs.readdirSync(MINUTES_ROOT)
+        .filter(name => /^\d+$/.test(name))
+        .sort();
+    return minutes[minutes.length - 1];
 }
 
-function processVotes() {
-    const voteFiles = getAllVoteFiles();
-    const votes = [];
-    const proposals = new Map();
-
-    logHeader('PROCESSANDO VOTOS DA REUNIÃO 0004');
-    log(`Encontrados ${voteFiles.length} arquivos de votos\n`);
-
-    // Process each vote file
-    for (const filePath of voteFiles) {
-        const voteData = readVoteFile(filePath);
-        if (!voteData) continue;
-
-        const modelName = voteData.model;
-        votes.push(voteData);
-
-        log(`📊 Processando voto de: ${modelName}`, 'yellow');
-
-        // Process each proposal weight
-        for (const weight of voteData.weights) {
-            const proposalId = weight.proposal_id;
-
-            if (!proposals.has(proposalId)) {
-                proposals.set(proposalId, {
-                    id: proposalId,
-                    votes: [],
-                    totalWeight: 0,
-                    averageWeight: 0,
-                    voteCount: 0,
-                    comments: []
-                });
-            }
+async function loadTallyEngine() {
+    if (!fs.existsSync(TALLY_ENGINE)) {
+        throw new Error('bip-system não compilado. Execute "npm run bip:build" primeiro.');
+    }
+    return import(pathToFileURL(TALLY_ENGINE).href);
+}
+
+async function processVotes(minuteId, options) {
+    const { TallyEngine } = await loadTallyEngine();
+    const engine = new TallyEngine(MINUTES_ROOT, { concurrency: options.concurrency });
+
+    logHeader(`PROCESSANDO VOTOS DA REUNIÃO ${minuteId}`);
+
+    const expectedHashes = await engine.readChainHashes(minuteId);
+    const report = await engine.tally(minuteId, {
+        ...(expectedHashes ? { expectedHashes } : {}),
+        rejectHashMismatches: options.strict,
+        incremental: options.incremental
+    });
+
+    log(`Encontrados ${report.votes.length + report.rejected.length} arquivos de votos ` +
+        `(${report.stats.read} lidos, ${report.stats.reused} reaproveitados)\n`);
+
+    for (const issue of report.hashMismatches) {
+        log(`⚠️  Hash divergente em ${issue.file}: ${issue.reason}`, 'yellow');
+    }
+    for (const issue of report.rejected) {
+        log(`Erro ao ler arquivo ${issue.file}: ${issue.reason}`, 'red');
+    }
 
-            const proposal = proposals.get(proposalId);
+    // Per-proposal vote lists for the report; totals come from the engine
+    const proposals = new Map(report.proposals.map(tally => [tally.proposalId, {
+        id: tally.proposalId,
+        votes: [],
+        totalWeight: tally.totalWeight,
+        averageWeight: tally.averageWeight,
+        voteCount: tally.voteCount,
+        comments: []
+    }]));
+
+    for (const vote of report.votes) {
+        log(`📊 Processando voto de: ${vote.model}`, 'yellow');
+
+        for (const entry of vote.votes) {
+            const proposal = proposals.get(entry.proposalId);
             proposal.votes.push({
-                model: modelName,
-                weight: weight.weight,
-                comment: weight.comment
+                model: vote.model,
+                weight: entry.weight,
+                comment: entry.justification
             });
-            proposal.totalWeight += weight.weight;
-            proposal.voteCount += 1;
-            proposal.comments.push(`${modelName}: ${weight.comment}`);
+            if (entry.justification) {
+                proposal.comments.push(`${vote.model}: ${entry.justification}`);
+            }
         }
     }
 
-    // Calculate averages
-    for (const proposal of proposals.values()) {
-        proposal.averageWeight = proposal.totalWeight / proposal.voteCount;
-    }
-
-    return { votes, proposals };
+    return { votes: report.votes, proposals };
 }
 
 function generateReport(votes, proposals) {
@@ -151,12 +166,12 @@ function generateReport(votes, proposals) {
     return sortedProposals;
 }
 
-function saveReportToFile(sortedProposals, votes) {
+function saveReportToFile(minuteId, sortedProposals, votes) {
     const timestamp = new Date().toISOString().replace(/[:.]/g, '-');
-    const reportFile = path.join(MINUTES_DIR, `voting_results_${timestamp}.json`);
+    const reportFile = path.join(MINUTES_ROOT, minuteId, `voting_results_${timestamp}.json`);
 
     const report = {
-        minute_id: "0004",
+        minute_id: minuteId,
         timestamp: new Date().toISOString(),
         total_votes: votes.length,
         total_proposals: sortedProposals.length,
@@ -173,11 +188,17 @@ function saveReportToFile(sortedProposals, votes) {
     log(`💾 Relatório salvo em: ${reportFile}`, 'green');
 }
 
-function main() {
+async function main() {
     try {
-        const { votes, proposals } = processVotes();
+        const options = parseArgs(process.argv.slice(2));
+        const minuteId = options.minuteId ?? latestMinuteId();
+        if (!minuteId || !fs.existsSync(path.join(MINUTES_ROOT, minuteId))) {
+            throw new Error(`Reunião ${minuteId ?? '(nenhuma)'} não encontrada em ${MINUTES_ROOT}`);
+        }
+
+        const { votes, proposals } = await processVotes(minuteId, options);
         const sortedProposals = generateReport(votes, proposals);
-        saveReportToFile(sortedProposals, votes);
+        saveReportToFile(minuteId, sortedProposals, votes);
 
         logHeader('CONTAGEM CONCLUÍDA COM SUCESSO');
         log('✅ Todos os votos foram processados e o relatório foi gerado!', 'green');